@@ -9,23 +9,30 @@
 #include "Grid/GridOccupancySubsystem.h"
 #include "Turn/TurnCorePhaseManager.h"
 #include "Turn/DistanceFieldSubsystem.h"
+#include "Turn/CooperativePlannerSubsystem.h"  // CodeRevision: INC-2025-1210-R1 (2025-12-14 10:00)
+#include "Turn/ConflictResolverSubsystem.h"  // CodeRevision: INC-2025-1210-R2 (2025-12-26 10:00)
+#include "Turn/TurnProfilerSubsystem.h"  // CodeRevision: INC-2025-1230-R1 (2025-12-23 10:00)
 #include "Utility/GridUtils.h"  // CodeRevision: INC-2025-00016-R1 (2025-11-16 14:00)
 #include "Utility/RogueGameplayTags.h"
+#include "Character/EnemyUnitBase.h"  // CodeRevision: INC-2025-1220-R1 (2025-12-18 10:00)
 #include "Kismet/GameplayStatics.h"
 #include "AbilitySystemInterface.h"
 #include "GenericTeamAgentInterface.h"
 #include "../../Utility/ProjectDiagnostics.h"
 
 // CodeRevision: INC-2025-00030-R2 (Migrate to UGridPathfindingSubsystem) (2025-11-17 00:40)
+// CodeRevision: INC-2025-1229-R1 (Observation/intent diagnostics through gated ROGUE_DIAG channels) (2025-12-22 14:00)
 void UEnemyAISubsystem::BuildObservations(
     const TArray<AActor*>& Enemies,
     const FIntPoint& PlayerGrid,
     UGridPathfindingSubsystem* PathFinder,
     TArray<FEnemyObservation>& OutObs)
 {
+    TURN_PROFILE_SCOPE(this, Observe);
+
     OutObs.Empty(Enemies.Num());
 
-    UE_LOG(LogEnemyAI, Verbose,
+    ROGUE_DIAG(AI, LogEnemyAI, Verbose,
         TEXT("[BuildObservations] ==== START ==== Enemies=%d, PlayerGrid=(%d,%d), PathFinder=%s"),
         Enemies.Num(),
         PlayerGrid.X, PlayerGrid.Y,
@@ -37,14 +44,14 @@ void UEnemyAISubsystem::BuildObservations(
         return;
     }
 
-    UE_LOG(LogEnemyAI, Log, TEXT("[BuildObservations] PlayerGrid=(%d, %d)"), PlayerGrid.X, PlayerGrid.Y);
+    ROGUE_DIAG(AI, LogEnemyAI, Log, TEXT("[BuildObservations] PlayerGrid=(%d, %d)"), PlayerGrid.X, PlayerGrid.Y);
 
     if (UWorld* World = GetWorld())
     {
         if (UTurnCorePhaseManager* TurnCore = World->GetSubsystem<UTurnCorePhaseManager>())
         {
             TurnCore->CoreObservationPhase(PlayerGrid);
-            UE_LOG(LogEnemyAI, Log, TEXT("[BuildObservations] DistanceField updated with PlayerGrid=(%d,%d)"), PlayerGrid.X, PlayerGrid.Y);
+            ROGUE_DIAG(AI, LogEnemyAI, Log, TEXT("[BuildObservations] DistanceField updated with PlayerGrid=(%d,%d)"), PlayerGrid.X, PlayerGrid.Y);
         }
         else
         {
@@ -71,7 +78,7 @@ void UEnemyAISubsystem::BuildObservations(
 
         if (!IsValid(Enemy))
         {
-            UE_LOG(LogEnemyAI, Log,
+            ROGUE_DIAG(AI, LogEnemyAI, Log,
                 TEXT("[BuildObservations] Enemy[%d] is invalid, inserting dummy observation"), i);
 
             Obs.GridPosition = FIntPoint::ZeroValue;
@@ -97,24 +104,23 @@ void UEnemyAISubsystem::BuildObservations(
 
             ++ValidEnemies;
 
-            if (i < 3)
-            {
-                UE_LOG(LogEnemyAI, Log,
-                    TEXT("[BuildObservations] Enemy[%d]: %s, Grid=(%d, %d), DistToPlayer=%d"),
-                    i, *Enemy->GetName(), Obs.GridPosition.X, Obs.GridPosition.Y, Obs.DistanceInTiles);
-            }
+            ROGUE_DIAG(AI, LogEnemyAI, Verbose,
+                TEXT("[BuildObservations] Enemy[%d]: %s, Grid=(%d, %d), DistToPlayer=%d"),
+                i, *Enemy->GetName(), Obs.GridPosition.X, Obs.GridPosition.Y, Obs.DistanceInTiles);
         }
 
         OutObs.Add(Obs);
     }
 
-    UE_LOG(LogEnemyAI, Log,
+    ROGUE_DIAG(AI, LogEnemyAI, Log,
         TEXT("[BuildObservations] ==== RESULT ==== Generated %d observations (Valid=%d, Invalid=%d)"),
         OutObs.Num(), ValidEnemies, InvalidEnemies);
 
-    if (UWorld* World = GetWorld())
+    // Diagnostics only: skip the extra walkability queries unless the lines will be printed
+    UWorld* DiagWorld = ROGUE_DIAG_ACTIVE(AI, LogEnemyAI, Verbose) ? GetWorld() : nullptr;
+    if (DiagWorld)
     {
-        if (UGridOccupancySubsystem* Occupancy = World->GetSubsystem<UGridOccupancySubsystem>())
+        if (UGridOccupancySubsystem* Occupancy = DiagWorld->GetSubsystem<UGridOccupancySubsystem>())
         {
             /*
             int32 SampleRadius = 3;
@@ -164,9 +170,11 @@ void UEnemyAISubsystem::CollectIntents(
     TArray<FEnemyIntent>& OutIntents)
 {
 // CodeRevision: INC-2025-1130-R1 (Two-pass enemy intent generation to avoid attacker blocking) (2025-11-27 16:30)
+    TURN_PROFILE_SCOPE(this, Think);
+
     OutIntents.Empty(Obs.Num());
 
-    UE_LOG(LogEnemyAI, Warning,
+    ROGUE_DIAG(AI, LogEnemyAI, Log,
         TEXT("[CollectIntents] ==== START ==== Observations=%d, Enemies=%d"),
         Obs.Num(), Enemies.Num());
 
@@ -187,19 +195,21 @@ void UEnemyAISubsystem::CollectIntents(
     const FGameplayTag MoveTag = RogueGameplayTags::AI_Intent_Move;
     const FGameplayTag WaitTag = RogueGameplayTags::AI_Intent_Wait;
 
-    TSet<FIntPoint> HardBlockedCells;
-    TSet<FIntPoint> ClaimedMoveTargets;
-    TSet<TWeakObjectPtr<AActor>> ActorsWithIntent;
+    // CodeRevision: INC-2025-1214-R1 (Phase scratch lives in the turn frame arena) (2025-12-15 14:00)
+    FTurnFrameArenaScope ArenaScope(this);  // CodeRevision: INC-2025-1214-R2 (2025-12-26 12:00)
+    TTurnFrameSet<FIntPoint> HardBlockedCells;
+    TTurnFrameSet<FIntPoint> ClaimedMoveTargets;
+    TTurnFrameSet<TWeakObjectPtr<AActor>> ActorsWithIntent;
 
     // ---- Pass 1: Determine attackers and hard-block their cells ----
-    UE_LOG(LogEnemyAI, Warning, TEXT("[CollectIntents] === PASS 1: Attack Intent Generation ==="));
+    ROGUE_DIAG(AI, LogEnemyAI, Verbose, TEXT("[CollectIntents] === PASS 1: Attack Intent Generation ==="));
     for (int32 i = 0; i < Obs.Num(); ++i)
     {
         AActor* Enemy = Enemies[i];
 
         if (!IsValid(Enemy))
         {
-            UE_LOG(LogEnemyAI, Warning, TEXT("[CollectIntents] Enemy[%d] is invalid, skipping"), i);
+            ROGUE_DIAG(AI, LogEnemyAI, Warning, TEXT("[CollectIntents] Enemy[%d] is invalid, skipping"), i);
             continue;
         }
 
@@ -215,20 +225,20 @@ void UEnemyAISubsystem::CollectIntents(
             HardBlockedCells.Add(Obs[i].GridPosition);
             ++AttackIntents;
 
-            UE_LOG(LogEnemyAI, Warning,
+            ROGUE_DIAG(AI, LogEnemyAI, Verbose,
                 TEXT("[CollectIntents] Pass1[%d]: %s -> ATTACK at (%d,%d), HardBlocked"),
                 i, *GetNameSafe(Enemy),
                 Obs[i].GridPosition.X, Obs[i].GridPosition.Y);
         }
     }
 
-    UE_LOG(LogEnemyAI, Warning,
+    ROGUE_DIAG(AI, LogEnemyAI, Log,
         TEXT("[CollectIntents] Pass1 Complete: AttackIntents=%d, HardBlockedCells=%d"),
         AttackIntents, HardBlockedCells.Num());
 
     // ---- Pass 2: Handle movers / waits while respecting claimed cells ----
-    UE_LOG(LogEnemyAI, Warning, TEXT("[CollectIntents] === PASS 2: Move/Wait Intent Generation ==="));
-    TArray<int32> MoveCandidateIndices;
+    ROGUE_DIAG(AI, LogEnemyAI, Verbose, TEXT("[CollectIntents] === PASS 2: Move/Wait Intent Generation ==="));
+    TTurnFrameArray<int32> MoveCandidateIndices;
     MoveCandidateIndices.Reserve(Obs.Num());
 
     for (int32 i = 0; i < Obs.Num(); ++i)
@@ -270,16 +280,38 @@ void UEnemyAISubsystem::CollectIntents(
         return A < B;
     });
 
+    // CodeRevision: INC-2025-1210-R1 (Cooperative space-time planning replaces per-enemy greedy steps when enabled) (2025-12-14 10:00)
+    TTurnFrameMap<AActor*, FIntPoint> PlannedSteps;
+    if (UCooperativePlannerSubsystem::IsCooperativePlanningEnabled())
+    {
+        PlanCooperativeMoves(Obs, Enemies, MoveCandidateIndices, HardBlockedCells, PlannedSteps);
+
+        // Greedy fallback movers must not step into cells already claimed by planned routes.
+        for (const TPair<AActor*, FIntPoint>& Pair : PlannedSteps)
+        {
+            ClaimedMoveTargets.Add(Pair.Value);
+        }
+    }
+
     for (const int32 i : MoveCandidateIndices)
     {
         AActor* Enemy = Enemies[i];
         const FEnemyObservation& Observation = Obs[i];
 
-        FEnemyIntent Intent = ComputeMoveOrWaitIntent(
-            Enemy,
-            Observation,
-            HardBlockedCells,
-            ClaimedMoveTargets);
+        FEnemyIntent Intent;
+        if (const FIntPoint* PlannedCell = PlannedSteps.Find(Enemy))
+        {
+            Intent.NextCell = *PlannedCell;
+            Intent.AbilityTag = (*PlannedCell != Observation.GridPosition) ? MoveTag : WaitTag;
+        }
+        else
+        {
+            Intent = ComputeMoveOrWaitIntent(
+                Enemy,
+                Observation,
+                HardBlockedCells,
+                ClaimedMoveTargets);
+        }
 
         Intent.Actor = Enemy;
         Intent.Owner = Enemy;
@@ -290,7 +322,7 @@ void UEnemyAISubsystem::CollectIntents(
             ClaimedMoveTargets.Add(Intent.NextCell);
             ++MoveIntents;
 
-            UE_LOG(LogEnemyAI, VeryVerbose,
+            ROGUE_DIAG(AI, LogEnemyAI, VeryVerbose,
                 TEXT("[CollectIntents] Pass2[%d]: %s -> MOVE (%d,%d) -> (%d,%d)"),
                 i, *GetNameSafe(Enemy),
                 Observation.GridPosition.X, Observation.GridPosition.Y,
@@ -300,7 +332,7 @@ void UEnemyAISubsystem::CollectIntents(
         {
             ++WaitIntents;
 
-            UE_LOG(LogEnemyAI, VeryVerbose,
+            ROGUE_DIAG(AI, LogEnemyAI, VeryVerbose,
                 TEXT("[CollectIntents] Pass2[%d]: %s -> WAIT at (%d,%d)"),
                 i, *GetNameSafe(Enemy),
                 Observation.GridPosition.X, Observation.GridPosition.Y);
@@ -318,17 +350,93 @@ void UEnemyAISubsystem::CollectIntents(
     }
 
     // INC-2025-0002: 詳細なサマリログ
-    UE_LOG(LogEnemyAI, Warning,
+    ROGUE_DIAG(AI, LogEnemyAI, Log,
         TEXT("[CollectIntents] ==== RESULT ==== Generated %d intents (Attack=%d, Move=%d, Wait=%d)"),
         OutIntents.Num(), AttackIntents, MoveIntents, WaitIntents);
 }
 
+// CodeRevision: INC-2025-1210-R1 (Add WHCA* cooperative planner for enemy movement) (2025-12-14 10:00)
+void UEnemyAISubsystem::PlanCooperativeMoves(
+    const TArray<FEnemyObservation>& Obs,
+    const TArray<AActor*>& Enemies,
+    const TTurnFrameArray<int32>& MoveCandidateIndices,
+    const TTurnFrameSet<FIntPoint>& HardBlockedCells,
+    TTurnFrameMap<AActor*, FIntPoint>& OutPlannedSteps) const
+{
+    UWorld* World = GetWorld();
+    UCooperativePlannerSubsystem* Planner = World ? World->GetSubsystem<UCooperativePlannerSubsystem>() : nullptr;
+    if (!Planner || MoveCandidateIndices.Num() == 0)
+    {
+        return;
+    }
+
+    const FIntPoint PlayerCell = Obs[MoveCandidateIndices[0]].PlayerGridPosition;
+
+    TArray<FReservationEntry> Movers;
+    Movers.Reserve(MoveCandidateIndices.Num());
+    TTurnFrameSet<AActor*> MoverActors;
+
+    for (const int32 i : MoveCandidateIndices)
+    {
+        FReservationEntry Entry;
+        Entry.Actor = Enemies[i];
+        Entry.CurrentCell = Obs[i].GridPosition;
+        Entry.Cell = Obs[i].GridPosition;
+        Entry.AbilityTag = RogueGameplayTags::AI_Intent_Move;
+        // CodeRevision: INC-2025-1210-R2 (Planner and resolver rank movers from one priority source) (2025-12-26 10:00)
+        UConflictResolverSubsystem::AssignPriority(Entry);
+        Movers.Add(Entry);
+        MoverActors.Add(Enemies[i]);
+    }
+
+    // Static blockers: attackers, the player, and every non-planned occupant (at its reserved destination if any).
+    TSet<FIntPoint> StaticBlocked;
+    StaticBlocked.Reserve(HardBlockedCells.Num() + 1);
+    for (const FIntPoint& Cell : HardBlockedCells)
+    {
+        StaticBlocked.Add(Cell);
+    }
+    StaticBlocked.Add(PlayerCell);
+
+    if (const UGridOccupancySubsystem* Occupancy = World->GetSubsystem<UGridOccupancySubsystem>())
+    {
+        // CodeRevision: INC-2025-1217-R1 (Player is represented by PlayerCell only, so plans do not depend on its reservation) (2025-12-16 14:00)
+        const AActor* PlayerPawn = UGameplayStatics::GetPlayerPawn(World, 0);
+
+        for (const TPair<FIntPoint, TWeakObjectPtr<AActor>>& Pair : Occupancy->GetOccupiedCellMap())
+        {
+            AActor* Occupant = Pair.Value.Get();
+            if (!Occupant || Occupant == PlayerPawn || MoverActors.Contains(Occupant))
+            {
+                continue;
+            }
+            const FIntPoint Reserved = Occupancy->GetReservedCellForActor(Occupant);
+            StaticBlocked.Add(Reserved != FIntPoint(-1, -1) ? Reserved : Pair.Key);
+        }
+    }
+
+    TArray<FCooperativePlan> Plans;
+    Planner->PlanCooperativeRoutes(Movers, PlayerCell, StaticBlocked, Plans);
+
+    for (int32 Index = 0; Index < Plans.Num(); ++Index)
+    {
+        if (Plans[Index].bFound)
+        {
+            OutPlannedSteps.Add(Movers[Index].Actor.Get(), Plans[Index].GetNextCell());
+        }
+    }
+
+    ROGUE_DIAG(AI, LogEnemyAI, Verbose,
+        TEXT("[CollectIntents] Cooperative planner routed %d/%d movers (StaticBlocked=%d)"),
+        OutPlannedSteps.Num(), Movers.Num(), StaticBlocked.Num());
+}
+
 // CodeRevision: INC-2025-1130-R1 (Two-pass enemy intent generation to avoid attacker blocking) (2025-11-27 16:30)
 FEnemyIntent UEnemyAISubsystem::ComputeMoveOrWaitIntent(
     AActor* EnemyActor,
     const FEnemyObservation& Obs,
-    const TSet<FIntPoint>& HardBlockedCells,
-    const TSet<FIntPoint>& ClaimedMoveTargets) const
+    const TTurnFrameSet<FIntPoint>& HardBlockedCells,
+    const TTurnFrameSet<FIntPoint>& ClaimedMoveTargets) const
 {
     FEnemyIntent Intent;
     Intent.CurrentCell = Obs.GridPosition;
@@ -383,13 +491,14 @@ FEnemyIntent UEnemyAISubsystem::ComputeMoveOrWaitIntent(
         ClaimedMoveTargets.Contains(PrimaryCell);
 
     // CodeRevision: INC-2025-1123-LOG-R7 (Debug: Log primary cell check conditions) (2025-11-23 03:00)
-    UE_LOG(LogEnemyAI, Warning,
+    // CodeRevision: INC-2025-1229-R2 (Per-enemy decision lines gated by the AI diagnostics channel) (2025-12-26 14:00)
+    ROGUE_DIAG(AI, LogEnemyAI, Verbose,
         TEXT("[ComputeMoveOrWaitIntent] %s: PrimaryCell=(%d,%d) CurrentCell=(%d,%d) PlayerCell=(%d,%d)"),
         *GetNameSafe(EnemyActor),
         PrimaryCell.X, PrimaryCell.Y,
         Obs.GridPosition.X, Obs.GridPosition.Y,
         Obs.PlayerGridPosition.X, Obs.PlayerGridPosition.Y);
-    UE_LOG(LogEnemyAI, Warning,
+    ROGUE_DIAG(AI, LogEnemyAI, Verbose,
         TEXT("[ComputeMoveOrWaitIntent] %s: Walkable=%d, CloserOrEqual=%d (Cost %d->%d), Blocked=%d"),
         *GetNameSafe(EnemyActor),
         bPrimaryWalkable ? 1 : 0,
@@ -406,7 +515,7 @@ FEnemyIntent UEnemyAISubsystem::ComputeMoveOrWaitIntent(
     {
         Intent.AbilityTag = RogueGameplayTags::AI_Intent_Move;
         Intent.NextCell = PrimaryCell;
-        UE_LOG(LogEnemyAI, Warning,
+        ROGUE_DIAG(AI, LogEnemyAI, Verbose,
             TEXT("[ComputeMoveOrWaitIntent] %s: Using PRIMARY cell (%d,%d) -> Cost %d -> %d"),
             *GetNameSafe(EnemyActor),
             PrimaryCell.X, PrimaryCell.Y,
@@ -415,11 +524,11 @@ FEnemyIntent UEnemyAISubsystem::ComputeMoveOrWaitIntent(
     }
 
     // Log why primary was rejected
-    UE_LOG(LogEnemyAI, Warning,
+    ROGUE_DIAG(AI, LogEnemyAI, Verbose,
         TEXT("[ComputeMoveOrWaitIntent] %s: PRIMARY REJECTED - seeking alternate"),
         *GetNameSafe(EnemyActor));
 
-    TArray<FIntPoint> Candidates;
+    FMoveCandidateArray Candidates;
     FindAlternateMoveCells(
         Obs.GridPosition,
         Obs.PlayerGridPosition,
@@ -447,7 +556,7 @@ FEnemyIntent UEnemyAISubsystem::ComputeMoveOrWaitIntent(
         if (bBlockedByUnit && bOnlyEqualDist)
         {
             Intent.AbilityTag = RogueGameplayTags::AI_Intent_Wait;
-            UE_LOG(LogEnemyAI, Verbose,
+            ROGUE_DIAG(AI, LogEnemyAI, Verbose,
                 TEXT("[ComputeMoveOrWaitIntent] %s: Blocked by unit at (%d,%d). Best alt (%d,%d) is equal dist (%d). WAITING."),
                 *GetNameSafe(EnemyActor),
                 PrimaryCell.X, PrimaryCell.Y,
@@ -459,7 +568,7 @@ FEnemyIntent UEnemyAISubsystem::ComputeMoveOrWaitIntent(
 
         Intent.AbilityTag = RogueGameplayTags::AI_Intent_Move;
         Intent.NextCell = ChosenCell;
-        UE_LOG(LogEnemyAI, Warning,
+        ROGUE_DIAG(AI, LogEnemyAI, Verbose,
             TEXT("[ComputeMoveOrWaitIntent] %s: Using ALTERNATE cell (%d,%d) -> Dist %d -> %d (Candidates=%d)"),
             *GetNameSafe(EnemyActor),
             ChosenCell.X, ChosenCell.Y,
@@ -478,9 +587,9 @@ void UEnemyAISubsystem::FindAlternateMoveCells(
     const FIntPoint& PlayerGrid,
     int32 CurrentDistanceInTiles,
     AActor* EnemyActor,
-    const TSet<FIntPoint>& HardBlockedCells,
-    const TSet<FIntPoint>& ClaimedMoveTargets,
-    TArray<FIntPoint>& OutCandidates) const
+    const TTurnFrameSet<FIntPoint>& HardBlockedCells,
+    const TTurnFrameSet<FIntPoint>& ClaimedMoveTargets,
+    FMoveCandidateArray& OutCandidates) const
 {
     OutCandidates.Reset();
 
@@ -526,7 +635,7 @@ void UEnemyAISubsystem::FindAlternateMoveCells(
 
 					if (!bShoulder1Walkable || !bShoulder2Walkable)
 					{
-						UE_LOG(LogEnemyAI, Verbose,
+						ROGUE_DIAG(AI, LogEnemyAI, Verbose,
 							TEXT("[FindAlternateMoveCells] Reject diagonal (%d,%d)->(%d,%d) due to corner (Shoulder1=%d Shoulder2=%d)"),
 							SelfCell.X, SelfCell.Y,
 							Candidate.X, Candidate.Y,
@@ -541,13 +650,13 @@ void UEnemyAISubsystem::FindAlternateMoveCells(
         OutCandidates.Add(Candidate);
     }
 
-    UE_LOG(LogEnemyAI, Verbose,
+    ROGUE_DIAG(AI, LogEnemyAI, Verbose,
         TEXT("[FindAlternateMoveCells] Self=(%d,%d) Dist=%d, CandidateCount=%d"),
         SelfCell.X, SelfCell.Y, CurrentDistanceInTiles, OutCandidates.Num());
 }
 
 FIntPoint UEnemyAISubsystem::SelectBestAlternateCell(
-    const TArray<FIntPoint>& Candidates,
+    const FMoveCandidateArray& Candidates,
     const FIntPoint& SelfCell,
     const FIntPoint& PlayerGrid) const
 {
@@ -571,7 +680,7 @@ FIntPoint UEnemyAISubsystem::SelectBestAlternateCell(
         }
     }
 
-    UE_LOG(LogEnemyAI, Verbose,
+    ROGUE_DIAG(AI, LogEnemyAI, Verbose,
         TEXT("[SelectBestAlternateCell] Self=(%d,%d) Player=(%d,%d) Best=(%d,%d) Score=%.2f"),
         SelfCell.X, SelfCell.Y,
         PlayerGrid.X, PlayerGrid.Y,
@@ -623,7 +732,7 @@ float UEnemyAISubsystem::ScoreMoveCandidate(
 		Score += Wortho;
 	}
 
-    UE_LOG(LogEnemyAI, VeryVerbose,
+    ROGUE_DIAG(AI, LogEnemyAI, VeryVerbose,
         TEXT("[ScoreMoveCandidate] Self=(%d,%d) Candidate=(%d,%d) ΔDist=%d Wdist*Δ=%.2f Wrow*%d=%.2f Wcol*%d=%.2f Wlane*dot=%.2f Total=%.2f"),
         SelfCell.X, SelfCell.Y,
         Candidate.X, Candidate.Y,
@@ -678,7 +787,8 @@ FEnemyIntent UEnemyAISubsystem::ComputeIntent(
         Intent = Thinker->ComputeIntent(Observation);
         Intent.Actor = Enemy;
 
-        UE_LOG(LogEnemyAI, Log,
+        // CodeRevision: INC-2025-1229-R2 (Per-enemy decision lines gated by the AI diagnostics channel) (2025-12-26 14:00)
+        ROGUE_DIAG(AI, LogEnemyAI, Verbose,
             TEXT("[ComputeIntent] Enemy=%s, Thinker found, Intent=%s"),
             *Enemy->GetName(), *Intent.AbilityTag.ToString());
     }
@@ -686,7 +796,7 @@ FEnemyIntent UEnemyAISubsystem::ComputeIntent(
     {
         Intent.AbilityTag = FGameplayTag::RequestGameplayTag(TEXT("AI.Intent.Wait"));
 
-        UE_LOG(LogEnemyAI, Warning,
+        ROGUE_DIAG(AI, LogEnemyAI, Verbose,
             TEXT("[ComputeIntent] Enemy=%s has NO Thinker component, defaulting to Wait"),
             *Enemy->GetName());
     }
@@ -734,6 +844,12 @@ void UEnemyAISubsystem::CollectAllEnemies(
             continue;
         }
 
+        // CodeRevision: INC-2025-1220-R1 (Pooled enemies are not on the floor) (2025-12-18 10:00)
+        if (const AEnemyUnitBase* PooledCheck = Cast<AEnemyUnitBase>(A); PooledCheck && PooledCheck->IsInPool())
+        {
+            continue;
+        }
+
         int32 TeamId = 255;
         if (const IGenericTeamAgentInterface* TeamAgent = Cast<IGenericTeamAgentInterface>(A))
         {
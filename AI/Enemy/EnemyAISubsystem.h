@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "Turn/TurnSystemTypes.h"
+#include "Turn/TurnFrameArena.h"  // CodeRevision: INC-2025-1214-R1 (2025-12-15 14:00)
 #include "../../Utility/ProjectDiagnostics.h"
 #include "EnemyAISubsystem.generated.h"
 
@@ -73,23 +74,39 @@ public:
 		TArray<AActor*>& OutEnemies);
 
 private:
+	// CodeRevision: INC-2025-1214-R1 (Phase scratch lives in the turn frame arena) (2025-12-15 14:00)
+	// At most 8 neighbours, so alternate candidates never leave the stack.
+	using FMoveCandidateArray = TArray<FIntPoint, TInlineAllocator<8>>;
+
 	FEnemyIntent ComputeMoveOrWaitIntent(
 		AActor* EnemyActor,
 		const FEnemyObservation& Obs,
-		const TSet<FIntPoint>& HardBlockedCells,
-		const TSet<FIntPoint>& ClaimedMoveTargets) const;
+		const TTurnFrameSet<FIntPoint>& HardBlockedCells,
+		const TTurnFrameSet<FIntPoint>& ClaimedMoveTargets) const;
+
+	// CodeRevision: INC-2025-1210-R1 (Add WHCA* cooperative planner for enemy movement) (2025-12-14 10:00)
+	/**
+	 * Plan next steps for all move candidates at once (ts.Enemy.CooperativePlanning).
+	 * Candidates without a route are left out of OutPlannedSteps and use ComputeMoveOrWaitIntent.
+	 */
+	void PlanCooperativeMoves(
+		const TArray<FEnemyObservation>& Obs,
+		const TArray<AActor*>& Enemies,
+		const TTurnFrameArray<int32>& MoveCandidateIndices,
+		const TTurnFrameSet<FIntPoint>& HardBlockedCells,
+		TTurnFrameMap<AActor*, FIntPoint>& OutPlannedSteps) const;
 
 	void FindAlternateMoveCells(
 		const FIntPoint& SelfCell,
 		const FIntPoint& PlayerGrid,
 		int32 CurrentDistanceInTiles,
 		AActor* EnemyActor,
-		const TSet<FIntPoint>& HardBlockedCells,
-		const TSet<FIntPoint>& ClaimedMoveTargets,
-		TArray<FIntPoint>& OutCandidates) const;
+		const TTurnFrameSet<FIntPoint>& HardBlockedCells,
+		const TTurnFrameSet<FIntPoint>& ClaimedMoveTargets,
+		FMoveCandidateArray& OutCandidates) const;
 
 	FIntPoint SelectBestAlternateCell(
-		const TArray<FIntPoint>& Candidates,
+		const FMoveCandidateArray& Candidates,
 		const FIntPoint& SelfCell,
 		const FIntPoint& PlayerGrid) const;
 
@@ -0,0 +1,301 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+// CodeRevision: INC-2025-1217-R1 (Speculative enemy planning during the input window) (2025-12-16 14:00)
+#include "AI/Enemy/EnemySpeculationSubsystem.h"
+#include "AI/Enemy/EnemyAISubsystem.h"
+#include "AI/Enemy/EnemyTurnDataSubsystem.h"
+#include "Turn/PlayerTravelSubsystem.h"
+#include "Grid/GridPathfindingSubsystem.h"
+#include "Grid/GridOccupancySubsystem.h"
+#include "Turn/TurnProfilerSubsystem.h"  // CodeRevision: INC-2025-1230-R2 (2025-12-27 11:00)
+#include "Turn/TurnFrameArena.h"  // CodeRevision: INC-2025-1217-R2 (2025-12-27 15:00)
+#include "Kismet/GameplayStatics.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+
+DEFINE_LOG_CATEGORY(LogEnemySpeculation);
+
+// CodeRevision: INC-2025-1217-R2 (Off by default until adoption is covered by tests) (2025-12-27 15:00)
+static int32 GTS_Enemy_Speculation = 0;
+static FAutoConsoleVariableRef CVarTS_Enemy_Speculation(
+    TEXT("ts.Enemy.Speculation"),
+    GTS_Enemy_Speculation,
+    TEXT("Precompute enemy intents for every player destination while the input window is open (0=off (default), 1=on)."),
+    ECVF_Default
+);
+
+static float GTS_Enemy_SpeculationBudgetMs = 2.0f;
+static FAutoConsoleVariableRef CVarTS_Enemy_SpeculationBudgetMs(
+    TEXT("ts.Enemy.SpeculationBudgetMs"),
+    GTS_Enemy_SpeculationBudgetMs,
+    TEXT("Game-thread time per tick spent on speculative enemy plans (at least one candidate is planned per tick)."),
+    ECVF_Default
+);
+
+namespace EnemySpeculationPrivate
+{
+    // Wait first (cheapest to miss), then the eight steps.
+    static const FIntPoint CandidateOffsets[] =
+    {
+        { 0, 0 },
+        { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 },
+        { 1, 1 }, { 1, -1 }, { -1, 1 }, { -1, -1 }
+    };
+}
+
+void UEnemySpeculationSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    UE_LOG(LogEnemySpeculation, Log, TEXT("[EnemySpeculation] Initialized"));
+}
+
+void UEnemySpeculationSubsystem::Deinitialize()
+{
+    CancelSpeculation();
+
+    UE_LOG(LogEnemySpeculation, Log, TEXT("[EnemySpeculation] Deinitialized (Adopted=%d, Missed=%d)"),
+        AdoptedCount, MissedCount);
+
+    Super::Deinitialize();
+}
+
+//------------------------------------------------------------------------------
+// Lifecycle of one speculation
+//------------------------------------------------------------------------------
+
+void UEnemySpeculationSubsystem::BeginSpeculation(int32 TurnId)
+{
+    using namespace EnemySpeculationPrivate;
+
+    CancelSpeculation();
+
+    if (GTS_Enemy_Speculation == 0)
+    {
+        return;
+    }
+
+    UWorld* World = GetWorld();
+    UEnemyTurnDataSubsystem* EnemyData = World ? World->GetSubsystem<UEnemyTurnDataSubsystem>() : nullptr;
+    UGridPathfindingSubsystem* PathFinder = World ? World->GetSubsystem<UGridPathfindingSubsystem>() : nullptr;
+    UDistanceFieldSubsystem* DistanceField = World ? World->GetSubsystem<UDistanceFieldSubsystem>() : nullptr;
+    APawn* PlayerPawn = World ? UGameplayStatics::GetPlayerPawn(World, 0) : nullptr;
+
+    if (!EnemyData || !PathFinder || !DistanceField || !PlayerPawn)
+    {
+        return;
+    }
+
+    TArray<AActor*> Enemies;
+    EnemyData->GatherEnemiesForIntents(Enemies);
+    if (Enemies.Num() == 0)
+    {
+        return;
+    }
+
+    // Same player cell ExecuteEnemyPhase uses when the player stays put.
+    const FIntPoint PlayerCell = PathFinder->WorldToGrid(PlayerPawn->GetActorLocation());
+
+    // CodeRevision: INC-2025-1218-R1 (While traveling the next step is known; plan only that one) (2025-12-17 10:00)
+    const UPlayerTravelSubsystem* Travel = World->GetSubsystem<UPlayerTravelSubsystem>();
+    const FIntPoint TravelCell = Travel ? Travel->PeekNextCell() : FIntPoint(-1, -1);
+    if (TravelCell != FIntPoint(-1, -1))
+    {
+        PendingCells.Add(TravelCell);
+    }
+    else
+    {
+        for (const FIntPoint& Offset : CandidateOffsets)
+        {
+            const FIntPoint Candidate = PlayerCell + Offset;
+
+            FString FailureReason;
+            if (Offset == FIntPoint::ZeroValue || PathFinder->IsMoveValid(PlayerCell, Candidate, PlayerPawn, FailureReason))
+            {
+                PendingCells.Add(Candidate);
+            }
+        }
+    }
+
+    Roster.Append(Enemies);
+    SpeculationTurnId = TurnId;
+    BoardSignature = ComputeBoardSignature(TurnId, Enemies);
+    DistanceField->CaptureSnapshot(LiveField);
+    Plans.Reserve(PendingCells.Num());
+
+    UE_LOG(LogEnemySpeculation, Log,
+        TEXT("[EnemySpeculation] Turn %d: queued %d candidate cells around (%d,%d) for %d enemies"),
+        TurnId, PendingCells.Num(), PlayerCell.X, PlayerCell.Y, Enemies.Num());
+
+    ScheduleSlice();
+}
+
+void UEnemySpeculationSubsystem::CancelSpeculation()
+{
+    // Invalidates any slice already queued on the timer manager.
+    ++SpeculationSerial;
+    bSliceScheduled = false;
+
+    SpeculationTurnId = INDEX_NONE;
+    BoardSignature = 0;
+    Roster.Reset();
+    PendingCells.Reset();
+    Plans.Reset();
+    LiveField = UDistanceFieldSubsystem::FFieldSnapshot();
+}
+
+bool UEnemySpeculationSubsystem::TryAdoptPlan(int32 TurnId, const FIntPoint& PlayerTargetCell, const TArray<AActor*>& Enemies, TArray<FEnemyIntent>& OutIntents)
+{
+    if (SpeculationTurnId == INDEX_NONE)
+    {
+        return false;
+    }
+
+    FEnemySpeculativePlan* Plan = nullptr;
+    if (SpeculationTurnId == TurnId && ComputeBoardSignature(TurnId, Enemies) == BoardSignature)
+    {
+        Plan = Plans.FindByPredicate([&PlayerTargetCell](const FEnemySpeculativePlan& Candidate)
+        {
+            return Candidate.PlayerCell == PlayerTargetCell;
+        });
+    }
+
+    bool bAdopted = false;
+    if (Plan)
+    {
+        if (UDistanceFieldSubsystem* DistanceField = GetWorld()->GetSubsystem<UDistanceFieldSubsystem>())
+        {
+            // Downstream resolve reads DistanceReduction from the field, so it must match the plan.
+            DistanceField->RestoreSnapshot(MoveTemp(Plan->DistanceField));
+            OutIntents = MoveTemp(Plan->Intents);
+            bAdopted = true;
+        }
+    }
+
+    if (bAdopted)
+    {
+        ++AdoptedCount;
+    }
+    else
+    {
+        ++MissedCount;
+    }
+
+    UE_LOG(LogEnemySpeculation, Log,
+        TEXT("[EnemySpeculation] Turn %d: %s plan for (%d,%d) (Planned=%d/%d, Adopted=%d, Missed=%d)"),
+        TurnId, bAdopted ? TEXT("adopted") : TEXT("no usable"), PlayerTargetCell.X, PlayerTargetCell.Y,
+        Plans.Num(), Plans.Num() + PendingCells.Num(), AdoptedCount, MissedCount);
+
+    CancelSpeculation();
+    return bAdopted;
+}
+
+//------------------------------------------------------------------------------
+// Time-sliced planning
+//------------------------------------------------------------------------------
+
+void UEnemySpeculationSubsystem::ScheduleSlice()
+{
+    UWorld* World = GetWorld();
+    if (bSliceScheduled || !World || PendingCells.Num() == 0)
+    {
+        return;
+    }
+
+    bSliceScheduled = true;
+    const uint32 Serial = SpeculationSerial;
+    World->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateWeakLambda(this, [this, Serial]()
+    {
+        RunSlice(Serial);
+    }));
+}
+
+void UEnemySpeculationSubsystem::RunSlice(uint32 Serial)
+{
+    if (Serial != SpeculationSerial)
+    {
+        return;
+    }
+    bSliceScheduled = false;
+
+    UWorld* World = GetWorld();
+    UEnemyAISubsystem* EnemyAI = World ? World->GetSubsystem<UEnemyAISubsystem>() : nullptr;
+    UGridPathfindingSubsystem* PathFinder = World ? World->GetSubsystem<UGridPathfindingSubsystem>() : nullptr;
+    UDistanceFieldSubsystem* DistanceField = World ? World->GetSubsystem<UDistanceFieldSubsystem>() : nullptr;
+    if (!EnemyAI || !PathFinder || !DistanceField)
+    {
+        CancelSpeculation();
+        return;
+    }
+
+    // The board may have changed since the window opened (late spawn, death); stop early.
+    const TArray<AActor*>& Enemies = ObjectPtrDecay(Roster);
+    if (ComputeBoardSignature(SpeculationTurnId, Enemies) != BoardSignature)
+    {
+        UE_LOG(LogEnemySpeculation, Log, TEXT("[EnemySpeculation] Turn %d: board changed, dropping speculation"), SpeculationTurnId);
+        CancelSpeculation();
+        return;
+    }
+
+    // CodeRevision: INC-2025-1230-R2 (One phase scope for profiler and replay; speculative planning timed separately) (2025-12-27 11:00)
+    // Observe / Think inside the slice are speculative; they are timed here, not as this turn's phases
+    TURN_PROFILE_SCOPE(this, Speculate);
+
+    const double BudgetSeconds = FMath::Max(0.f, GTS_Enemy_SpeculationBudgetMs) / 1000.0;
+    const double StartSeconds = FPlatformTime::Seconds();
+
+    TArray<FEnemyObservation> Observations;
+    do
+    {
+        FEnemySpeculativePlan& Plan = Plans.AddDefaulted_GetRef();
+        Plan.PlayerCell = PendingCells[0];
+        PendingCells.RemoveAt(0, 1, EAllowShrinking::No);
+
+        // CodeRevision: INC-2025-1217-R2 (Speculative plans rewind their arena scratch) (2025-12-27 15:00)
+        // Each plan's observe/think scratch is dropped before the next; only heap outputs are kept
+        FTurnFrameArenaMark PlanMark(this);
+
+        EnemyAI->BuildObservations(Enemies, Plan.PlayerCell, PathFinder, Observations);
+        EnemyAI->CollectIntents(Observations, Enemies, Plan.Intents);
+        DistanceField->ExtractSnapshot(Plan.DistanceField);
+    }
+    while (PendingCells.Num() > 0 && FPlatformTime::Seconds() - StartSeconds < BudgetSeconds);
+
+    // Anything reading the field before the command lands must still see the live one.
+    DistanceField->RestoreSnapshot(LiveField);
+
+    UE_LOG(LogEnemySpeculation, Verbose, TEXT("[EnemySpeculation] Turn %d: slice planned up to %d/%d in %.3fms"),
+        SpeculationTurnId, Plans.Num(), Plans.Num() + PendingCells.Num(), (FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+
+    ScheduleSlice();
+}
+
+uint32 UEnemySpeculationSubsystem::ComputeBoardSignature(int32 TurnId, const TArray<AActor*>& Enemies) const
+{
+    uint32 Hash = 2166136261u;
+    auto Mix = [&Hash](uint32 Value)
+    {
+        Hash ^= Value;
+        Hash *= 16777619u;
+    };
+
+    Mix(static_cast<uint32>(TurnId));
+    for (const AActor* Enemy : Enemies)
+    {
+        Mix(PointerHash(Enemy));
+    }
+
+    if (const UGridOccupancySubsystem* Occupancy = GetWorld()->GetSubsystem<UGridOccupancySubsystem>())
+    {
+        for (const TPair<FIntPoint, TWeakObjectPtr<AActor>>& Pair : Occupancy->GetOccupiedCellMap())
+        {
+            Mix(static_cast<uint32>(Pair.Key.X));
+            Mix(static_cast<uint32>(Pair.Key.Y));
+            Mix(PointerHash(Pair.Value.Get()));
+        }
+    }
+
+    return Hash;
+}
@@ -0,0 +1,83 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+// CodeRevision: INC-2025-1217-R1 (Speculative enemy planning during the input window) (2025-12-16 14:00)
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Turn/TurnSystemTypes.h"
+#include "Turn/DistanceFieldSubsystem.h"
+#include "EnemySpeculationSubsystem.generated.h"
+
+// Log category
+DECLARE_LOG_CATEGORY_EXTERN(LogEnemySpeculation, Log, All);
+
+/** Enemy intents (and the distance field they were planned on) for one player destination */
+struct FEnemySpeculativePlan
+{
+    FIntPoint PlayerCell = FIntPoint(-1, -1);
+    TArray<FEnemyIntent> Intents;
+    UDistanceFieldSubsystem::FFieldSnapshot DistanceField;
+};
+
+/**
+ * UEnemySpeculationSubsystem: plans enemy intents for every player destination before the
+ * player has chosen one.
+ *
+ * - BeginSpeculation (input window opened) snapshots the board and queues "wait" plus every
+ *   legal one-step destination.
+ * - Candidates are planned on the game thread in time-sliced batches (ts.Enemy.SpeculationBudgetMs
+ *   per tick), running the same BuildObservations/CollectIntents path as a regular turn.
+ * - TryAdoptPlan (called by RegenerateIntentsForPlayerPosition) hands back the matching plan and
+ *   its distance field when the board is unchanged; otherwise the caller plans as before.
+ *
+ * Plans are discarded after one adoption attempt, on CancelSpeculation and when the turn changes.
+ */
+UCLASS()
+class LYRAGAME_API UEnemySpeculationSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    /** Start planning for TurnId (no-op when ts.Enemy.Speculation is 0). */
+    void BeginSpeculation(int32 TurnId);
+
+    /** Drop every pending and finished plan (e.g. the player attacked and enemies may have changed). */
+    void CancelSpeculation();
+
+    /**
+     * Adopt the plan for PlayerTargetCell if it was planned for TurnId on the current board with
+     * exactly this enemy roster. Restores the plan's distance field on success.
+     */
+    bool TryAdoptPlan(int32 TurnId, const FIntPoint& PlayerTargetCell, const TArray<AActor*>& Enemies, TArray<FEnemyIntent>& OutIntents);
+
+    int32 GetAdoptedCount() const { return AdoptedCount; }
+    int32 GetMissedCount() const { return MissedCount; }
+
+private:
+    void ScheduleSlice();
+    void RunSlice(uint32 Serial);
+
+    /** Hash of the occupancy layout, the roster order and the turn */
+    uint32 ComputeBoardSignature(int32 TurnId, const TArray<AActor*>& Enemies) const;
+
+    int32 SpeculationTurnId = INDEX_NONE;
+    uint32 BoardSignature = 0;
+    uint32 SpeculationSerial = 0;
+    bool bSliceScheduled = false;
+
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<AActor>> Roster;
+
+    TArray<FIntPoint> PendingCells;
+    TArray<FEnemySpeculativePlan> Plans;
+
+    // Field as it was when speculation started; put back after every slice
+    UDistanceFieldSubsystem::FFieldSnapshot LiveField;
+
+    int32 AdoptedCount = 0;
+    int32 MissedCount = 0;
+};
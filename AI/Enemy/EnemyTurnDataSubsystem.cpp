@@ -10,6 +10,8 @@
 #include "Turn/DistanceFieldSubsystem.h"
 #include "GameFramework/Pawn.h"
 #include "Turn/UnitTurnStateSubsystem.h"
+#include "AI/Enemy/EnemySpeculationSubsystem.h"
+#include "Character/EnemyUnitBase.h"  // CodeRevision: INC-2025-1220-R1 (2025-12-18 10:00)
 
 // ログカテゴリ定義
 DEFINE_LOG_CATEGORY(LogEnemyTurnDataSys);
@@ -176,6 +178,13 @@ void UEnemyTurnDataSubsystem::RebuildEnemyList(FName TagFilter)
         GetWorld(), TagFilter, FoundEnemies
     );
 
+    // CodeRevision: INC-2025-1220-R1 (Pooled enemies are not on the floor) (2025-12-18 10:00)
+    FoundEnemies.RemoveAllSwap([](const AActor* Actor)
+    {
+        const AEnemyUnitBase* Enemy = Cast<AEnemyUnitBase>(Actor);
+        return Enemy && Enemy->IsInPool();
+    });
+
     UE_LOG(LogEnemyTurnDataSys, Log,
         TEXT("[RebuildEnemyList] Found %d actors with tag '%s'"),
         FoundEnemies.Num(), *TagFilter.ToString());
@@ -305,7 +314,12 @@ bool UEnemyTurnDataSubsystem::HasWaitIntent() const
 
 void UEnemyTurnDataSubsystem::SaveIntents(const TArray<FEnemyIntent>& NewIntents)
 {
-    Intents = NewIntents;
+    // CodeRevision: INC-2025-1214-R1 (Reuse the stored buffer instead of reallocating every turn) (2025-12-15 14:00)
+    if (&NewIntents != &Intents)
+    {
+        Intents.Reset();
+        Intents.Append(NewIntents);
+    }
     ++DataRevision;
 
     // INC-2025-0002: ログ強化 - 保存されるIntentsのAttack/Move/Wait件数を集計
@@ -418,7 +432,11 @@ void UEnemyTurnDataSubsystem::SetIntents(const TArray<FEnemyIntent>& NewIntents)
     if (ensureAlwaysMsgf(GetWorld() && GetWorld()->GetNetMode() != NM_Client,
         TEXT("[EnemyTurnData] SetIntents must run on server")))
     {
-        Intents = NewIntents;
+        if (&NewIntents != &Intents)
+        {
+            Intents.Reset();
+            Intents.Append(NewIntents);
+        }
         ++DataRevision;
         UE_LOG(LogEnemyTurnDataSys, Log,
             TEXT("[EnemyTurnData] SetIntents: %d intents (Revision=%d)"),
@@ -681,6 +699,26 @@ bool UEnemyTurnDataSubsystem::EnsureIntentsFallback(
     return FallbackIntents.Num() > 0;
 }
 
+void UEnemyTurnDataSubsystem::GatherEnemiesForIntents(TArray<AActor*>& OutEnemies)
+{
+    // Rebuild enemy list
+    // CodeRevision: INC-2025-1122-PERF-R4 (Use cached enemies instead of RebuildEnemyList)
+    UWorld* World = GetWorld();
+    if (UUnitTurnStateSubsystem* UnitState = World ? World->GetSubsystem<UUnitTurnStateSubsystem>() : nullptr)
+    {
+        TArray<AActor*> CachedEnemies;
+        UnitState->CopyEnemiesTo(CachedEnemies);
+        SyncEnemiesFromList(CachedEnemies);
+    }
+    else
+    {
+        // Fallback if UnitState is missing
+        RebuildEnemyList(FName("Enemy"));
+    }
+
+    OutEnemies = GetEnemiesSortedCopy();
+}
+
 // CodeRevision: INC-2025-1122-SIMUL-R5 (Extract intent regeneration logic from ExecuteEnemyPhase) (2025-11-22)
 bool UEnemyTurnDataSubsystem::RegenerateIntentsForPlayerPosition(int32 TurnId, const FIntPoint& PlayerTargetCell, TArray<FEnemyIntent>& OutIntents)
 {
@@ -702,26 +740,25 @@ bool UEnemyTurnDataSubsystem::RegenerateIntentsForPlayerPosition(int32 TurnId, c
         return false;
     }
 
-    // Rebuild enemy list
-    // CodeRevision: INC-2025-1122-PERF-R4 (Use cached enemies instead of RebuildEnemyList)
-    if (UUnitTurnStateSubsystem* UnitState = World->GetSubsystem<UUnitTurnStateSubsystem>())
-    {
-        TArray<AActor*> CachedEnemies;
-        UnitState->CopyEnemiesTo(CachedEnemies);
-        SyncEnemiesFromList(CachedEnemies);
-    }
-    else
-    {
-        // Fallback if UnitState is missing
-        RebuildEnemyList(FName("Enemy"));
-    }
-
-    // Get enemy actors
-    TArray<AActor*> EnemyActors = GetEnemiesSortedCopy();
+    TArray<AActor*> EnemyActors;
+    GatherEnemiesForIntents(EnemyActors);
     UE_LOG(LogEnemyTurnDataSys, Log,
         TEXT("[Turn %d] RegenerateIntents: Found %d enemies after RebuildEnemyList"),
         TurnId, EnemyActors.Num());
 
+    // CodeRevision: INC-2025-1217-R1 (Adopt the intents precomputed during the input window) (2025-12-16 14:00)
+    if (UEnemySpeculationSubsystem* Speculation = World->GetSubsystem<UEnemySpeculationSubsystem>())
+    {
+        if (Speculation->TryAdoptPlan(TurnId, PlayerTargetCell, EnemyActors, OutIntents))
+        {
+            Intents = OutIntents;
+            UE_LOG(LogEnemyTurnDataSys, Log,
+                TEXT("[Turn %d] RegenerateIntents: Adopted speculative plan (%d intents) for PlayerCell=(%d,%d)"),
+                TurnId, OutIntents.Num(), PlayerTargetCell.X, PlayerTargetCell.Y);
+            return true;
+        }
+    }
+
     if (EnemyActors.Num() == 0)
     {
         OutIntents.Empty();
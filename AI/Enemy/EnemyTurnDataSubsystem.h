@@ -234,6 +234,13 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Turn|Enemy")
     bool RegenerateIntentsForPlayerPosition(int32 TurnId, const FIntPoint& PlayerTargetCell, TArray<FEnemyIntent>& OutIntents);
 
+    // CodeRevision: INC-2025-1217-R1 (Shared enemy roster for regular and speculative intent generation) (2025-12-16 14:00)
+    /**
+     * Sync the sorted enemy list from UnitTurnState (or rebuild it) and copy it out.
+     * This is the roster and order RegenerateIntentsForPlayerPosition plans with.
+     */
+    void GatherEnemiesForIntents(TArray<AActor*>& OutEnemies);
+
     /**
      * 指定TimeSlotのIntentを抽出（BPループ削減）
      */
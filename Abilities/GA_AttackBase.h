@@ -3,6 +3,7 @@
 
 #include "CoreMinimal.h"
 #include "GA_TurnActionBase.h"
+#include "Turn/TurnSystemTypes.h"
 #include "GA_AttackBase.generated.h"
 
 // Log category
@@ -68,7 +69,7 @@ public:
 
 private:
     // ★★★ Barrier統合用の内部状態 (2025-11-12) ★★★
-    FGuid AttackActionId;
+    FTurnActionHandle AttackActionId;
     int32 AttackTurnId = -1;
     bool bBarrierRegistered = false;
 
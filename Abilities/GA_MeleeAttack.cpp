@@ -425,7 +425,7 @@ void UGA_MeleeAttack::ApplyDamageToTarget(AActor* Target)
 
     if (UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo())
     {
-        const float FinalDamage = (Damage > 0.0f) ? Damage : 28.0f;
+        const float FinalDamage = GetEffectiveDamage();
 
         if (Damage <= 0.0f)
         {
@@ -434,65 +434,64 @@ void UGA_MeleeAttack::ApplyDamageToTarget(AActor* Target)
                 Damage, FinalDamage);
         }
 
-        // ===== Lyra標準パターン: CombatSet.BaseDamage属性を設定 =====
-        // LyraDamageExecutionはこの属性をキャプチャして使用します
-        const ULyraCombatSet* CombatSet = ASC->GetSet<ULyraCombatSet>();
-        float OldBaseDamage = 0.0f;
-        if (CombatSet)
-        {
-            OldBaseDamage = CombatSet->GetBaseDamage();
-            ASC->SetNumericAttributeBase(ULyraCombatSet::GetBaseDamageAttribute(), FinalDamage);
-            UE_LOG(LogAttackAbility, Warning,
-                TEXT("[GA_MeleeAttack] Set attacker CombatSet.BaseDamage = %.2f (was %.2f)"),
-                FinalDamage, OldBaseDamage);
-        }
-        else
+        if (!ASC->GetSet<ULyraCombatSet>())
         {
             UE_LOG(LogAttackAbility, Error,
                 TEXT("[GA_MeleeAttack] WARNING: Attacker has no CombatSet! Damage may fail."));
         }
 
-        FGameplayEffectContextHandle ContextHandle = ASC->MakeEffectContext();
-        ContextHandle.AddSourceObject(this);
+        UE_LOG(LogAttackAbility, Warning,
+            TEXT("[GA_MeleeAttack] Applying GameplayEffect: %s (LyraDamageExecution will capture BaseDamage=%.2f)"),
+            *MeleeAttackEffect->GetName(), FinalDamage);
 
-        FGameplayEffectSpecHandle SpecHandle = ASC->MakeOutgoingSpec(MeleeAttackEffect, 1.0f, ContextHandle);
-        if (SpecHandle.IsValid())
-        {
-            UE_LOG(LogAttackAbility, Warning,
-                TEXT("[GA_MeleeAttack] Applying GameplayEffect: %s (LyraDamageExecution will capture BaseDamage=%.2f)"),
-                *MeleeAttackEffect->GetName(), FinalDamage);
-
-            if (UAbilitySystemComponent* TargetASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(Target))
-            {
-                FActiveGameplayEffectHandle EffectHandle = ASC->ApplyGameplayEffectSpecToTarget(*SpecHandle.Data.Get(), TargetASC);
-                // Instant エフェクトの場合、ハンドルは無効だが正常に適用される
-                if (EffectHandle.IsValid())
-                {
-                    UE_LOG(LogAttackAbility, Log,
-                        TEXT("[GA_MeleeAttack] GameplayEffect applied successfully (Duration effect, handle is valid)"));
-                }
-                else
-                {
-                    UE_LOG(LogAttackAbility, Log,
-                        TEXT("[GA_MeleeAttack] GameplayEffect applied (Instant effect, handle is invalid but this is normal)"));
-                }
-            }
-        }
-        else
+        // CodeRevision: INC-2025-1213-R2 (Turbo simulation applies attack damage through the melee GAS path) (2025-12-26 11:00)
+        if (!ApplyMeleeDamage(ASC, Target, GetDamageEffect(), FinalDamage, this))
         {
             UE_LOG(LogAttackAbility, Error,
-                TEXT("[GA_MeleeAttack] Failed to create GameplayEffectSpec"));
+                TEXT("[GA_MeleeAttack] Failed to apply GameplayEffect to %s"), *Target->GetName());
         }
+    }
+}
 
-        // BaseDamageをリセット（次回の攻撃に影響しないように）
-        if (CombatSet)
-        {
-            ASC->SetNumericAttributeBase(ULyraCombatSet::GetBaseDamageAttribute(), OldBaseDamage);
-            UE_LOG(LogAttackAbility, Verbose,
-                TEXT("[GA_MeleeAttack] Reset attacker CombatSet.BaseDamage to %.2f"),
-                OldBaseDamage);
-        }
+// CodeRevision: INC-2025-1213-R2 (Turbo simulation applies attack damage through the melee GAS path) (2025-12-26 11:00)
+const UGameplayEffect* UGA_MeleeAttack::GetDamageEffect() const
+{
+    return MeleeAttackEffect ? MeleeAttackEffect->GetDefaultObject<UGameplayEffect>() : nullptr;
+}
+
+bool UGA_MeleeAttack::ApplyMeleeDamage(UAbilitySystemComponent* SourceASC, AActor* Target, const UGameplayEffect* Effect,
+    float InDamage, const UObject* SourceObject)
+{
+    UAbilitySystemComponent* TargetASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(Target);
+    if (!SourceASC || !TargetASC || !Effect)
+    {
+        return false;
+    }
+
+    // ===== Lyra標準パターン: CombatSet.BaseDamage属性を設定 =====
+    // LyraDamageExecutionはこの属性をキャプチャして使用します
+    const ULyraCombatSet* CombatSet = SourceASC->GetSet<ULyraCombatSet>();
+    float OldBaseDamage = 0.0f;
+    const bool bSetBaseDamage = CombatSet && InDamage >= 0.0f;
+    if (bSetBaseDamage)
+    {
+        OldBaseDamage = CombatSet->GetBaseDamage();
+        SourceASC->SetNumericAttributeBase(ULyraCombatSet::GetBaseDamageAttribute(), InDamage);
+    }
+
+    FGameplayEffectContextHandle ContextHandle = SourceASC->MakeEffectContext();
+    ContextHandle.AddSourceObject(SourceObject);
+
+    // Instant エフェクトの場合、ハンドルは無効だが正常に適用される
+    const FGameplayEffectSpec Spec(Effect, ContextHandle, 1.0f);
+    SourceASC->ApplyGameplayEffectSpecToTarget(Spec, TargetASC);
+
+    // BaseDamageをリセット（次回の攻撃に影響しないように）
+    if (bSetBaseDamage)
+    {
+        SourceASC->SetNumericAttributeBase(ULyraCombatSet::GetBaseDamageAttribute(), OldBaseDamage);
     }
+    return true;
 }
 
 //------------------------------------------------------------------------------
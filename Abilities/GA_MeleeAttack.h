@@ -8,6 +8,7 @@
 
 // Forward declarations
 class UGameplayEffect;
+class UAbilitySystemComponent;
 class AUnitBase;
 class UGridPathfindingSubsystem;
 
@@ -35,6 +36,21 @@ public:
         bool bWasCancelled
     ) override;
 
+    // CodeRevision: INC-2025-1213-R2 (Turbo simulation applies attack damage through the melee GAS path) (2025-12-26 11:00)
+    /** Damage effect of this ability (nullptr when unset). */
+    const UGameplayEffect* GetDamageEffect() const;
+
+    /** Damage written to CombatSet.BaseDamage for the effect (fallback 28 when unset). */
+    float GetEffectiveDamage() const { return Damage > 0.0f ? Damage : 28.0f; }
+
+    /**
+     * Damage step of the melee attack without activating the ability: applies Effect from SourceASC
+     * to Target's ASC with the attacker's CombatSet.BaseDamage temporarily set to InDamage (< 0 keeps it).
+     * Instant effects execute synchronously. Returns false when either side has no ASC or Effect is null.
+     */
+    static bool ApplyMeleeDamage(UAbilitySystemComponent* SourceASC, AActor* Target, const UGameplayEffect* Effect,
+        float InDamage, const UObject* SourceObject);
+
 protected:
     // Config parameters
 
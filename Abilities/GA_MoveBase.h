@@ -3,6 +3,7 @@
 
 #include "CoreMinimal.h"
 #include "GA_TurnActionBase.h"
+#include "Turn/TurnSystemTypes.h"
 #include "GameplayTagContainer.h"
 #include "GA_MoveBase.generated.h"
 
@@ -177,7 +178,7 @@ private:
 	bool bMoveFinishedDelegateBound = false;
 
 	// Barrier 連携用
-	FGuid MoveActionId;
+	FTurnActionHandle MoveActionId;
 	int32 MoveTurnId = -1;
 	bool bBarrierRegistered = false;
 
@@ -33,7 +33,7 @@ void UGA_WaitBase::ActivateAbility(const FGameplayAbilitySpecHandle Handle,
     const FGameplayEventData* TriggerEventData)
 {
     WaitTurnId = INDEX_NONE;
-    WaitActionId = FGuid();
+    WaitActionId = FTurnActionHandle();
     bBarrierActionRegistered = false;
     bBarrierActionCompleted = false;
     bTurnManagerNotified = false;
@@ -63,7 +63,7 @@ void UGA_WaitBase::EndAbility(const FGameplayAbilitySpecHandle Handle,
     Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
 
     WaitTurnId = INDEX_NONE;
-    WaitActionId = FGuid();
+    WaitActionId = FTurnActionHandle();
     bBarrierActionRegistered = false;
     bBarrierActionCompleted = false;
     bTurnManagerNotified = false;
@@ -3,6 +3,7 @@
 
 #include "CoreMinimal.h"
 #include "GA_TurnActionBase.h"
+#include "Turn/TurnSystemTypes.h"
 #include "GA_WaitBase.generated.h"
 
 // Log category
@@ -51,7 +52,7 @@ private:
 
 private:
     int32 WaitTurnId = INDEX_NONE;
-    FGuid WaitActionId;
+    FTurnActionHandle WaitActionId;
     bool bBarrierActionRegistered = false;
     bool bBarrierActionCompleted = false;
     bool bTurnManagerNotified = false;
@@ -13,6 +13,10 @@
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemGlobals.h"
 #include "Utility/RogueGameplayTags.h"  // Ability/Phase/Gate等の集中定義
+#include "Character/UnitMovementComponent.h"  // CodeRevision: INC-2025-1220-R1 (2025-12-18 10:00)
+#include "Character/TBSAttributeSet_Combat.h"
+#include "AbilitySystem/Attributes/LyraHealthSet.h"
+#include "GameplayEffect.h"
 #include "Net/UnrealNetwork.h"
 
 DEFINE_LOG_CATEGORY(LogEnemyUnit);
@@ -353,6 +357,75 @@ void AEnemyUnitBase::GrantAbilitySetsIfNeeded()
     bGrantedAbilitySets = true;
 }
 
+//------------------------------------------------------------------------------
+// Actor pool
+// CodeRevision: INC-2025-1220-R1 (Pool enemy actors across floors) (2025-12-18 10:00)
+//------------------------------------------------------------------------------
+void AEnemyUnitBase::DeactivateForPool()
+{
+    if (bInPool)
+    {
+        return;
+    }
+    bInPool = true;
+
+    if (MovementComp)
+    {
+        MovementComp->CancelMovement();
+    }
+
+    if (AbilitySystemComponent && HasAuthority())
+    {
+        AbilitySystemComponent->CancelAllAbilities();
+
+        // Timed effects (buffs, debuffs) belong to the old floor; infinite ones from the ability sets stay
+        FGameplayEffectQuery TimedEffects;
+        TimedEffects.CustomMatchDelegate.BindLambda([](const FActiveGameplayEffect& Effect)
+        {
+            return Effect.Spec.Def && Effect.Spec.Def->DurationPolicy == EGameplayEffectDurationType::HasDuration;
+        });
+        AbilitySystemComponent->RemoveActiveEffects(TimedEffects);
+    }
+
+    SetActorHiddenInGame(true);
+    SetActorEnableCollision(false);
+    SetActorTickEnabled(false);
+
+    UE_LOG(LogEnemyUnit, Verbose, TEXT("[Pool] %s deactivated"), *GetName());
+}
+
+void AEnemyUnitBase::ReactivateFromPool(const FVector& NewLocation)
+{
+    if (!bInPool)
+    {
+        return;
+    }
+    bInPool = false;
+
+    SetActorLocationAndRotation(NewLocation, FRotator::ZeroRotator, false, nullptr, ETeleportType::ResetPhysics);
+
+    // Full health on whichever health attributes this unit carries
+    if (AbilitySystemComponent && HasAuthority())
+    {
+        if (AbilitySystemComponent->GetSet<ULyraHealthSet>())
+        {
+            AbilitySystemComponent->SetNumericAttributeBase(ULyraHealthSet::GetHealthAttribute(),
+                AbilitySystemComponent->GetNumericAttribute(ULyraHealthSet::GetMaxHealthAttribute()));
+        }
+        if (AbilitySystemComponent->GetSet<UTBSAttributeSet_Combat>())
+        {
+            AbilitySystemComponent->SetNumericAttributeBase(UTBSAttributeSet_Combat::GetHealthAttribute(),
+                AbilitySystemComponent->GetNumericAttribute(UTBSAttributeSet_Combat::GetMaxHealthAttribute()));
+        }
+    }
+
+    SetActorEnableCollision(true);
+    SetActorTickEnabled(true);
+    SetActorHiddenInGame(false);
+
+    UE_LOG(LogEnemyUnit, Verbose, TEXT("[Pool] %s reactivated at %s"), *GetName(), *NewLocation.ToString());
+}
+
 //------------------------------------------------------------------------------
 // IAbilitySystemInterface Override
 //------------------------------------------------------------------------------
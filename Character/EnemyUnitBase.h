@@ -46,6 +46,26 @@ public:
      */
     virtual UAbilitySystemComponent* GetAbilitySystemComponent() const override;
 
+    // ━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━
+    // ★ Actor pool (AUnitManager)
+    // ━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━
+    // CodeRevision: INC-2025-1220-R1 (Pool enemy actors across floors) (2025-12-18 10:00)
+
+    /**
+     * Park this unit in the pool: hidden, no collision, no tick, abilities cancelled.
+     * Controller, ASC, granted ability sets and enemy tags are kept for reuse.
+     */
+    void DeactivateForPool();
+
+    /**
+     * Bring a pooled unit back at NewLocation with full health and no timed effects.
+     * Stats, occupancy and the stable ID are re-applied by AUnitManager.
+     */
+    void ReactivateFromPool(const FVector& NewLocation);
+
+    /** True while parked in AUnitManager's pool; such units are not part of the floor. */
+    bool IsInPool() const { return bInPool; }
+
 protected:
     // ━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━
     // ★コアメソッド
@@ -151,6 +171,8 @@ private:
     void GrantAbilitySetsIfNeeded();
     bool bGrantedAbilitySets = false;
 
+    bool bInPool = false;
+
     // ━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━
     // ★ Ability System Component (Pawn-owned)
     // ━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━
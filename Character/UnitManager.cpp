@@ -21,6 +21,15 @@
 #include "Teams/LyraTeamSubsystem.h"
 #include "GenericTeamAgentInterface.h"
 #include "GameFramework/PlayerState.h"
+// CodeRevision: INC-2025-1220-R1 (Pool enemy actors across floors) (2025-12-18 10:00)
+#include "Character/LyraHealthComponent.h"
+#include "Turn/StableActorRegistry.h"
+#include "AI/Enemy/EnemyTurnDataSubsystem.h"
+// CodeRevision: INC-2025-1229-R1 (Per-channel compile-time and runtime diagnostics gating) (2025-12-22 14:00)
+#include "Utility/ProjectDiagnostics.h"
+// CodeRevision: INC-2025-1234-R1 (Per-room free-cell spawn sampler) (2025-12-25 10:00)
+#include "Grid/URogueDungeonSubsystem.h"
+#include "Grid/DungeonFloorGenerator.h"
 
 // CodeRevision: INC-2025-00030-R2 (Migrate to UGridPathfindingSubsystem) (2025-11-17 00:40)
 namespace UnitManager_Private
@@ -38,6 +47,62 @@ namespace UnitManager_Private
 			Occupancy->OccupyCell(Cell, Actor);
 		}
 	}
+
+	// CodeRevision: INC-2025-1234-R1 (Per-room free-cell spawn sampler) (2025-12-25 10:00)
+	// CodeRevision: INC-2025-1234-R2 (Spawn distance from a local step-count BFS instead of the shared DistanceField) (2025-12-27 20:00)
+	static int32 ChebyshevSteps(const FIntPoint& A, const FIntPoint& B)
+	{
+		return FMath::Max(FMath::Abs(A.X - B.X), FMath::Abs(A.Y - B.Y));
+	}
+
+	/**
+	 * PlayerCell から MaxSteps 歩未満で届くセルとその歩数（8方向・斜め1歩=1歩、角抜けは DistanceField と同じく片側が通れれば可）。
+	 * 探索は Bounds 内だけ：部屋セルへ MaxSteps 歩未満で届く経路は部屋矩形を MaxSteps 広げた範囲から出ない。
+	 */
+	static void CollectStepsNearPlayer(const UGridPathfindingSubsystem* PathFinder, const FIntPoint& PlayerCell, int32 MaxSteps,
+		const FIntRectLite& Bounds, TMap<FIntPoint, int32>& OutSteps)
+	{
+		static const FIntPoint Dirs[] = { {1, 0}, {-1, 0}, {0, 1}, {0, -1}, {1, 1}, {1, -1}, {-1, 1}, {-1, -1} };
+
+		auto IsWalkable = [PathFinder, &Bounds](const FIntPoint& Cell)
+		{
+			return Bounds.Contains(Cell.X, Cell.Y) && PathFinder->GetGridCost(Cell.X, Cell.Y) >= 0;
+		};
+
+		OutSteps.Reset();
+		OutSteps.Add(PlayerCell, 0);
+		TArray<FIntPoint> Frontier = { PlayerCell };
+		TArray<FIntPoint> Next;
+		for (int32 Step = 1; Step < MaxSteps && Frontier.Num() > 0; ++Step)
+		{
+			Next.Reset();
+			for (const FIntPoint& From : Frontier)
+			{
+				for (const FIntPoint& Dir : Dirs)
+				{
+					const FIntPoint To = From + Dir;
+					if (OutSteps.Contains(To) || !IsWalkable(To))
+					{
+						continue;
+					}
+					if (Dir.X != 0 && Dir.Y != 0 && !IsWalkable(From + FIntPoint(Dir.X, 0)) && !IsWalkable(From + FIntPoint(0, Dir.Y)))
+					{
+						continue;
+					}
+					OutSteps.Add(To, Step);
+					Next.Add(To);
+				}
+			}
+			Swap(Frontier, Next);
+		}
+	}
+
+	/** Cell からプレイヤーまでの歩数（BFS の範囲外・到達不能ならチェビシェフ距離） */
+	static int32 StepsFromPlayer(const TMap<FIntPoint, int32>& NearSteps, const FIntPoint& PlayerCell, const FIntPoint& Cell)
+	{
+		const int32* Steps = NearSteps.Find(Cell);
+		return Steps ? *Steps : ChebyshevSteps(Cell, PlayerCell);
+	}
 }
 
 AUnitManager::AUnitManager()
@@ -183,10 +248,12 @@ int32 AUnitManager::SpawnEnemyUnits(int32 DesiredEnemyCount)
 		TargetEnemyCount, *PlayerStartRoom->GetActorLocation().ToString());
 
 	int32 SpawnedEnemies = 0;
+	int32 PooledEnemies = 0;
 	bool bLoggedMissingEnemyClass = false;
 
 	// すべての敵をPlayerStartRoomにスポーン
-	const TArray<FVector> EnemySpawns = SpawnLocations(PlayerStartRoom, TargetEnemyCount);
+	// CodeRevision: INC-2025-1234-R1 (Per-room free-cell spawn sampler) (2025-12-25 10:00)
+	const TArray<FVector> EnemySpawns = SampleSpawnLocations(PlayerStartRoom, TargetEnemyCount, EnemyMinPlayerDistanceCells);
 
 	UE_LOG(LogTemp, Log, TEXT("[UnitManager::SpawnEnemyUnits] Found %d spawn locations in PlayerStartRoom"),
 		EnemySpawns.Num());
@@ -231,11 +298,20 @@ int32 AUnitManager::SpawnEnemyUnits(int32 DesiredEnemyCount)
 		UE_LOG(LogTemp, Log, TEXT("[UnitManager::SpawnEnemyUnits] Spawning enemy at: %s (Z=%.2f, HalfHeight=%.2f)"),
 			*SpawnLoc.ToString(), SpawnLoc.Z, CapsuleHalfHeight);
 
-		FTransform SpawnTM(FRotator::ZeroRotator, SpawnLoc, FVector::OneVector);
-		FActorSpawnParameters P;
-		P.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+		// CodeRevision: INC-2025-1220-R1 (Pool enemy actors across floors) (2025-12-18 10:00)
+		// プールから再利用できればSpawnActor・PawnData・Controller生成・アビリティ付与を全て省略
+		AEnemyUnitBase* Enemy = bUseEnemyPool ? AcquirePooledEnemy(SpawnLoc) : nullptr;
+		const bool bFromPool = (Enemy != nullptr);
+
+		if (!Enemy)
+		{
+			FTransform SpawnTM(FRotator::ZeroRotator, SpawnLoc, FVector::OneVector);
+			FActorSpawnParameters P;
+			P.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+			Enemy = World->SpawnActor<AEnemyUnitBase>(EnemyUnitClass, SpawnTM, P);
+		}
 
-		AEnemyUnitBase* Enemy = World->SpawnActor<AEnemyUnitBase>(EnemyUnitClass, SpawnTM, P);
 		if (!Enemy)
 		{
 			UE_LOG(LogTemp, Warning, TEXT("[UnitManager::SpawnEnemyUnits] Failed to spawn enemy at %s"),
@@ -243,7 +319,15 @@ int32 AUnitManager::SpawnEnemyUnits(int32 DesiredEnemyCount)
 			continue;
 		}
 
-		if (Enemy->HasAuthority())
+		if (!Enemy->HasAuthority())
+		{
+			continue;
+		}
+
+		// CodeRevision: INC-2025-1220-R2 (Pooled enemies rejoin the floor like fresh spawns) (2025-12-26 13:00)
+		// プール再利用で省略するのはPawnData・Controller生成・アビリティ付与（ASC）のみ。
+		// ステータス・チーム・AllUnits・占有セル・StableID登録は新規スポーンと同じく毎フロア行う
+		if (!bFromPool)
 		{
 			if (AEnemyUnitBase* EnemyUnit = Cast<AEnemyUnitBase>(Enemy))
 			{
@@ -279,36 +363,45 @@ int32 AUnitManager::SpawnEnemyUnits(int32 DesiredEnemyCount)
 						*EnemyUnit->GetName());
 				}
 			}
+		}
 
-			Enemy->StatBlock = DefaultStatBlock;
-			Enemy->StatBlock.Team = 2;  // ★★★ BUGFIX [INC-2025-00004]: Set Team=2 in StatBlock BEFORE SetStatVars()
-			Enemy->SetStatVars();
-			Enemy->SetActorHiddenInGame(false);
-			Enemy->Team = 2;  // ★★★ FIX: Changed from 1 to 2 to match LyraTBSAIController TeamID
+		Enemy->StatBlock = DefaultStatBlock;
+		Enemy->StatBlock.Team = 2;  // ★★★ BUGFIX [INC-2025-00004]: Set Team=2 in StatBlock BEFORE SetStatVars()
+		Enemy->SetStatVars();
+		Enemy->SetActorHiddenInGame(false);
+		Enemy->Team = 2;  // ★★★ FIX: Changed from 1 to 2 to match LyraTBSAIController TeamID
 
-			// ★★★ BUGFIX [INC-2025-00004]: Register enemy to ULyraTeamSubsystem ★★★
-			// This ensures proper team damage calculation in LyraDamageExecution
-			// FIX: Changed TeamID from 1 to 2 to match project's enemy team convention
-			if (ULyraTeamSubsystem* TeamSubsystem = World->GetSubsystem<ULyraTeamSubsystem>())
-			{
-				const bool bSuccess = TeamSubsystem->ChangeTeamForActor(Enemy, 2);
-				UE_LOG(LogTemp, Log, TEXT("[UnitManager] Registered enemy %s to TeamSubsystem with TeamID=2 (Success=%d)"),
-					*Enemy->GetName(), bSuccess ? 1 : 0);
-			}
-			else
-			{
-				UE_LOG(LogTemp, Error, TEXT("[UnitManager] ULyraTeamSubsystem not found! Enemy %s team registration failed."),
-					*Enemy->GetName());
-			}
+		// ★★★ BUGFIX [INC-2025-00004]: Register enemy to ULyraTeamSubsystem ★★★
+		// This ensures proper team damage calculation in LyraDamageExecution
+		// FIX: Changed TeamID from 1 to 2 to match project's enemy team convention
+		if (ULyraTeamSubsystem* TeamSubsystem = World->GetSubsystem<ULyraTeamSubsystem>())
+		{
+			const bool bSuccess = TeamSubsystem->ChangeTeamForActor(Enemy, 2);
+			UE_LOG(LogTemp, Log, TEXT("[UnitManager] Registered enemy %s to TeamSubsystem with TeamID=2 (Success=%d)"),
+				*Enemy->GetName(), bSuccess ? 1 : 0);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Error, TEXT("[UnitManager] ULyraTeamSubsystem not found! Enemy %s team registration failed."),
+				*Enemy->GetName());
+		}
 
-			AllUnits.Add(Enemy);
+		AllUnits.Add(Enemy);
 
-			UnitManager_Private::OccupyInitialCell(World, PathFinder, Enemy);
-			++SpawnedEnemies;
+		UnitManager_Private::OccupyInitialCell(World, PathFinder, Enemy);
+		if (UStableActorRegistry* Registry = World->GetSubsystem<UStableActorRegistry>())
+		{
+			Registry->RegisterActor(Enemy);
+		}
+		++SpawnedEnemies;
 
-			UE_LOG(LogTemp, Log, TEXT("[UnitManager::SpawnEnemyUnits] Successfully spawned enemy %d/%d: %s"),
-				SpawnedEnemies, TargetEnemyCount, *Enemy->GetName());
+		if (bFromPool)
+		{
+			++PooledEnemies;
 		}
+
+		UE_LOG(LogTemp, Log, TEXT("[UnitManager::SpawnEnemyUnits] Successfully %s enemy %d/%d: %s"),
+			bFromPool ? TEXT("reused") : TEXT("spawned"), SpawnedEnemies, TargetEnemyCount, *Enemy->GetName());
 	}
 
 	if (SpawnedEnemies >= TargetEnemyCount)
@@ -322,10 +415,94 @@ int32 AUnitManager::SpawnEnemyUnits(int32 DesiredEnemyCount)
 			SpawnedEnemies, TargetEnemyCount);
 	}
 
+	UE_LOG(LogTemp, Log, TEXT("[UnitManager::SpawnEnemyUnits] Pool: reused=%d spawned=%d remaining=%d"),
+		PooledEnemies, SpawnedEnemies - PooledEnemies, EnemyPool.Num());
+
 	bEnemiesSpawned = SpawnedEnemies > 0;
 	return SpawnedEnemies;
 }
 
+// ========================= 敵アクタープール =========================
+// CodeRevision: INC-2025-1220-R1 (Pool enemy actors across floors) (2025-12-18 10:00)
+void AUnitManager::ReleaseEnemyToPool(AEnemyUnitBase* Enemy)
+{
+	if (!IsValid(Enemy) || Enemy->IsInPool())
+	{
+		return;
+	}
+
+	AllUnits.Remove(Enemy);
+
+	if (UWorld* World = GetWorld())
+	{
+		if (UGridOccupancySubsystem* Occupancy = World->GetSubsystem<UGridOccupancySubsystem>())
+		{
+			Occupancy->UnregisterActor(Enemy);
+		}
+		if (UStableActorRegistry* Registry = World->GetSubsystem<UStableActorRegistry>())
+		{
+			Registry->UnregisterActor(Enemy);
+		}
+	}
+
+	// 死亡処理中のユニットやクラス変更後の古いユニットは再利用しない
+	const ULyraHealthComponent* HealthComp = ULyraHealthComponent::FindHealthComponent(Enemy);
+	const bool bReusable = bUseEnemyPool
+		&& EnemyUnitClass && Enemy->IsA(EnemyUnitClass)
+		&& !(HealthComp && HealthComp->IsDeadOrDying());
+
+	if (!bReusable)
+	{
+		Enemy->Destroy();
+		return;
+	}
+
+	Enemy->DeactivateForPool();
+	EnemyPool.Add(Enemy);
+}
+
+void AUnitManager::ReleaseAllEnemiesToPool()
+{
+	// ReleaseEnemyToPool が AllUnits から削除するためコピーを走査
+	const TArray<TObjectPtr<AUnitBase>> Units = AllUnits;
+	int32 Released = 0;
+
+	for (AUnitBase* Unit : Units)
+	{
+		if (AEnemyUnitBase* Enemy = Cast<AEnemyUnitBase>(Unit))
+		{
+			ReleaseEnemyToPool(Enemy);
+			++Released;
+		}
+	}
+
+	// 行動順の登録も前フロアのもの。再利用された敵は次の収集で新しい順番を受け取る
+	if (Released > 0)
+	{
+		if (UEnemyTurnDataSubsystem* EnemyData = GetWorld() ? GetWorld()->GetSubsystem<UEnemyTurnDataSubsystem>() : nullptr)
+		{
+			EnemyData->ClearAllRegistrations();
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[UnitManager] Released %d enemies (pool size=%d)"), Released, EnemyPool.Num());
+}
+
+AEnemyUnitBase* AUnitManager::AcquirePooledEnemy(const FVector& SpawnLoc)
+{
+	while (EnemyPool.Num() > 0)
+	{
+		AEnemyUnitBase* Enemy = EnemyPool.Pop(EAllowShrinking::No);
+		if (IsValid(Enemy))
+		{
+			Enemy->ReactivateFromPool(SpawnLoc);
+			return Enemy;
+		}
+	}
+
+	return nullptr;
+}
+
 // ========================= Trace: GetUnitStatBlock =========================
 void AUnitManager::GetUnitStatBlock(int32 Index)
 {
@@ -436,6 +613,12 @@ void AUnitManager::BuildUnits(const TArray<AAABB*>& RoomsIn)
 	// ★★★ 敵スポーンフラグをリセット（2025-11-09）
 	// 新しいフロアの生成時に敵を再スポーン可能にする
 	bEnemiesSpawned = false;
+	// CodeRevision: INC-2025-1234-R1 (Per-room free-cell spawn sampler) (2025-12-25 10:00)
+	// 部屋セル一覧は新しいフロアのラベルから作り直す
+	SpawnSampler.Reset();
+	// CodeRevision: INC-2025-1220-R1 (Pool enemy actors across floors) (2025-12-18 10:00)
+	// 前フロアの敵は破棄せずプールへ戻す（以前は配列から外すだけでアクターが残っていた）
+	ReleaseAllEnemiesToPool();
 	AllUnits.Reset();  // 既存のユニット配列もクリア
 
 	UE_LOG(LogTemp, Warning, TEXT("BuildUnits: Received %d rooms. (bEnemiesSpawned reset to false)"), Rooms.Num());
@@ -599,53 +782,113 @@ int32 AUnitManager::RoomArea(AAABB* InputAABB) const
 // ========================= Trace: SpawnLocations(InputRoom, NumberOfSpawns) =========================
 TArray<FVector> AUnitManager::SpawnLocations(AAABB* InputRoom, int32 NumberOfSpawns)
 {
+	// CodeRevision: INC-2025-1234-R1 (Per-room free-cell spawn sampler) (2025-12-25 10:00)
+	return SampleSpawnLocations(InputRoom, NumberOfSpawns, 0);
+}
+
+// CodeRevision: INC-2025-1234-R1 (Per-room free-cell spawn sampler) (2025-12-25 10:00)
+// 以前は部屋AABB内のランダム点を最大16回試行（被り・進入不可で失敗すると黙って数が減る）。
+// 現在は部屋の歩行可能セル一覧から非復元抽出するため、1体あたり試行のやり直しはない。
+TArray<FVector> AUnitManager::SampleSpawnLocations(AAABB* InputRoom, int32 NumberOfSpawns, int32 MinPlayerDistance)
+{
+	using namespace UnitManager_Private;
+
 	TArray<FVector> Out;
 	if (!IsValid(InputRoom) || NumberOfSpawns <= 0 || !PathFinder) return Out;
 
 	const FVector Center = InputRoom->GetActorLocation();
 	const FVector Half   = GetRoomHalfExtents(InputRoom);
 
-	// ★★★ 占有情報チェック用のサブシステム取得 ★★★
+	// 部屋AABBが覆うセル範囲（ルームマーカーは生成時の部屋矩形と一致）
+	int32 GridWidth = 0, GridHeight = 0, TileSize = 100;
+	PathFinder->GetGridInfo(GridWidth, GridHeight, TileSize);
+	const float HalfTile = TileSize * 0.5f;
+	const FIntPoint MinCell = PathFinder->WorldToGrid(FVector(Center.X - Half.X + HalfTile, Center.Y - Half.Y + HalfTile, Center.Z));
+	const FIntPoint MaxCell = PathFinder->WorldToGrid(FVector(Center.X + Half.X - HalfTile, Center.Y + Half.Y - HalfTile, Center.Z));
+	const FIntRectLite RoomRect(MinCell.X, MinCell.Y, MaxCell.X, MaxCell.Y);
+
 	UWorld* World = GetWorld();
 	UGridOccupancySubsystem* Occupancy = World ? World->GetSubsystem<UGridOccupancySubsystem>() : nullptr;
 
-	UE_LOG(LogTemp, Warning, TEXT("SpawnLocations: Searching for %d spawns in room at %s with half-extents %s"), NumberOfSpawns, *Center.ToString(), *Half.ToString());
+	// ★★★ プレイヤーからの最小距離（共有の DistanceField は敵AIの目標用なので触らず、部屋まわりだけローカルに BFS） ★★★
+	TMap<FIntPoint, int32> NearSteps;
+	FIntPoint PlayerCell = FIntPoint::ZeroValue;
+	const APawn* PlayerPawn = (MinPlayerDistance > 0) ? UGameplayStatics::GetPlayerPawn(this, 0) : nullptr;
+	if (PlayerPawn)
+	{
+		PlayerCell = PathFinder->WorldToGrid(PlayerPawn->GetActorLocation());
+		const FIntPoint Nearest(FMath::Clamp(PlayerCell.X, RoomRect.X0, RoomRect.X1), FMath::Clamp(PlayerCell.Y, RoomRect.Y0, RoomRect.Y1));
+		if (ChebyshevSteps(Nearest, PlayerCell) < MinPlayerDistance)
+		{
+			const FIntRectLite SearchRect(RoomRect.X0 - MinPlayerDistance, RoomRect.Y0 - MinPlayerDistance,
+				RoomRect.X1 + MinPlayerDistance, RoomRect.Y1 + MinPlayerDistance);
+			CollectStepsNearPlayer(PathFinder, PlayerCell, MinPlayerDistance, SearchRect, NearSteps);
+		}
+	}
 
-	for (int32 n = 0; n < NumberOfSpawns; ++n)
+	// 生成後の地形変更・占有・プレイヤー距離はセルごとに O(1) で判定
+	auto IsFree = [&](const FIntPoint& Cell)
 	{
-		// 16 回まで試行して被り/進入不可を避ける
-		for (int32 t = 0; t <= 15; ++t)
+		if (PathFinder->GetGridCost(Cell.X, Cell.Y) < 0)
 		{
-			const int32 RX = FMath::RandRange(
-				FMath::FloorToInt((Center.X - Half.X) / 100.f),
-				FMath::FloorToInt((Center.X + Half.X) / 100.f) - 1);
-			const int32 RY = FMath::RandRange(
-				FMath::FloorToInt((Center.Y - Half.Y) / 100.f),
-				FMath::FloorToInt((Center.Y + Half.Y) / 100.f) - 1);
+			return false;
+		}
+		if (Occupancy && Occupancy->IsCellOccupied(Cell))
+		{
+			return false;
+		}
+		return !PlayerPawn || StepsFromPlayer(NearSteps, PlayerCell, Cell) >= MinPlayerDistance;
+	};
+
+	// 部屋セル一覧はフロアごとに1回だけ作る
+	if (!SpawnSampler.IsBuilt())
+	{
+		const URogueDungeonSubsystem* DungeonSys = World ? World->GetSubsystem<URogueDungeonSubsystem>() : nullptr;
+		if (const ADungeonFloorGenerator* Floor = DungeonSys ? DungeonSys->GetFloorGenerator() : nullptr)
+		{
+			SpawnSampler.Build(Floor->GetGridLabels());
+		}
+	}
 
-			const FVector Candidate( RX * 100.f + 50.f, RY * 100.f + 50.f, Center.Z );
+	FRandomStream Rng(FMath::Rand());
+	TArray<FIntPoint> Cells;
+	Cells.Reserve(NumberOfSpawns);
 
-			if (!Out.Contains(Candidate))
+	const int32 RoomId = SpawnSampler.FindRoom(RoomRect);
+	if (RoomId != INDEX_NONE)
+	{
+		SpawnSampler.Sample(RoomId, NumberOfSpawns, SpawnMinSpacingCells, Rng, IsFree, Cells);
+	}
+	else
+	{
+		// ラベルのない部屋（BP配置など）は矩形内のセルをその場で列挙
+		TArray<FIntPoint> Pool;
+		Pool.Reserve(RoomRect.W() * RoomRect.H());
+		for (int32 Y = RoomRect.Y0; Y <= RoomRect.Y1; ++Y)
+		{
+			for (int32 X = RoomRect.X0; X <= RoomRect.X1; ++X)
 			{
-				// ★★★ 1. グリッドステータスをチェック（通行可能か） ★★★
-				const int32 Status = PathFinder->ReturnGridStatus(Candidate);
+				Pool.Add(FIntPoint(X, Y));
+			}
+		}
+		FRoomSpawnSampler::SampleFrom(Pool, RoomRect, NumberOfSpawns, SpawnMinSpacingCells, Rng, IsFree, Cells);
+	}
 
-				// ★★★ 2. 占有状態をチェック（既に他のユニットがいないか） ★★★
-				const FIntPoint Cell = PathFinder->WorldToGrid(Candidate);
-				const bool bIsOccupied = Occupancy ? Occupancy->IsCellOccupied(Cell) : false;
+	Out.Reserve(Cells.Num());
+	for (const FIntPoint& Cell : Cells)
+	{
+		Out.Add(PathFinder->GridToWorldCenter(Cell, Center.Z));
+	}
 
-				UE_LOG(LogTemp, Log, TEXT("SpawnLocations: Attempt %d for spawn %d. Candidate: %s, Cell: (%d,%d), Status: %d, Occupied: %d"),
-					t, n, *Candidate.ToString(), Cell.X, Cell.Y, Status, bIsOccupied ? 1 : 0);
+	// CodeRevision: INC-2025-1229-R1 (Per-channel compile-time and runtime diagnostics gating) (2025-12-22 14:00)
+	ROGUE_DIAG(Grid, LogTemp, Log, TEXT("SpawnLocations: %d/%d spawns in room %d at %s (cells %d,%d-%d,%d, spacing %.1f, min player distance %d)"),
+		Out.Num(), NumberOfSpawns, RoomId, *Center.ToString(), RoomRect.X0, RoomRect.Y0, RoomRect.X1, RoomRect.Y1,
+		SpawnMinSpacingCells, MinPlayerDistance);
 
-				// ★★★ 通行可能かつ未占有の場合のみスポーン位置として採用 ★★★
-				if (Status >= 0 && !bIsOccupied)
-				{
-					Out.Add(Candidate);
-					UE_LOG(LogTemp, Warning, TEXT("SpawnLocations: Found valid spawn at %s (Cell: %d,%d)"), *Candidate.ToString(), Cell.X, Cell.Y);
-					break; // 次のユニットへ
-				}
-			}
-		}
+	if (Out.Num() < NumberOfSpawns)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[UnitManager] SpawnLocations: room at %s has only %d free cell(s) for %d spawn(s)"),
+			*Center.ToString(), Out.Num(), NumberOfSpawns);
 	}
 
 	return Out;
@@ -3,12 +3,15 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "Character/UnitStatBlock.h"
+// CodeRevision: INC-2025-1234-R1 (Per-room free-cell spawn sampler) (2025-12-25 10:00)
+#include "Grid/RoomSpawnSampler.h"
 #include "UnitManager.generated.h"
 
 // CodeRevision: INC-2025-00030-R2 (Migrate to UGridPathfindingSubsystem) (2025-11-17 00:40)
 // ===== 前方宣言 =====
 class AAABB;
 class AUnitBase;
+class AEnemyUnitBase;
 class UGridPathfindingSubsystem;
 class APlayerControllerBase;
 class UDebugObserverCSV;
@@ -57,6 +60,20 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Units", meta=(AllowPrivateAccess="true"))
 	TObjectPtr<ULyraPawnData> DefaultEnemyPawnData = nullptr;
 
+	// CodeRevision: INC-2025-1220-R1 (Pool enemy actors across floors) (2025-12-18 10:00)
+	/** Keep enemies of the previous floor in a pool and reuse them instead of SpawnActor */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Units|Pool")
+	bool bUseEnemyPool = true;
+
+	// CodeRevision: INC-2025-1234-R1 (Per-room free-cell spawn sampler) (2025-12-25 10:00)
+	/** 同じ呼び出しで選ぶスポーン同士の最小距離（セル, Poisson-disk。1以下=隣接可） */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Units|Spawn", meta=(ClampMin="0"))
+	float SpawnMinSpacingCells = 0.0f;
+
+	/** 敵スポーンとプレイヤーの最小距離（8方向の歩数。0=制限なし） */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Units|Spawn", meta=(ClampMin="0"))
+	int32 EnemyMinPlayerDistanceCells = 0;
+
 	// ===== ランタイム配列 =====
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Units")
 	TArray<TObjectPtr<AUnitBase>> AllUnits;
@@ -96,6 +113,19 @@ public:
 	UFUNCTION(BlueprintCallable) TArray<FVector> SpawnLocations(AAABB* InputRoom, int32 NumberOfSpawns);
 	UFUNCTION(BlueprintCallable) int32 RoomArea(AAABB* InputAABB) const;
 
+	// 敵アクタープール（フロア間で再利用）
+	// CodeRevision: INC-2025-1220-R1 (Pool enemy actors across floors) (2025-12-18 10:00)
+	/** Unregister Enemy from the floor and park it in the pool (destroys it when pooling is off). */
+	UFUNCTION(BlueprintCallable, Category="Units|Pool")
+	void ReleaseEnemyToPool(AEnemyUnitBase* Enemy);
+
+	/** Release every enemy in AllUnits (floor transition). */
+	UFUNCTION(BlueprintCallable, Category="Units|Pool")
+	void ReleaseAllEnemiesToPool();
+
+	UFUNCTION(BlueprintPure, Category="Units|Pool")
+	int32 GetPooledEnemyCount() const { return EnemyPool.Num(); }
+
 	// ルーム管理（外部アクセス用）
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Rooms")
 	TObjectPtr<AAABB> PlayerStartRoom = nullptr;
@@ -119,6 +149,19 @@ private:
 	bool bEnemyStatsInitialized = false;
 	bool bEnemiesSpawned = false;
 
+	// 非アクティブな敵（ASC・付与済みアビリティ・Controllerを保持したまま）
+	UPROPERTY() TArray<TObjectPtr<AEnemyUnitBase>> EnemyPool;
+
+	/** Pop a pooled enemy and reactivate it at SpawnLoc (nullptr when the pool is empty). */
+	AEnemyUnitBase* AcquirePooledEnemy(const FVector& SpawnLoc);
+
+	// CodeRevision: INC-2025-1234-R1 (Per-room free-cell spawn sampler) (2025-12-25 10:00)
+	// フロアごとの部屋セル一覧（BuildUnits でリセット、初回スポーン時に構築）
+	FRoomSpawnSampler SpawnSampler;
+
+	/** SpawnLocations 本体。MinPlayerDistance > 0 ならプレイヤーからその歩数未満のセルを除外 */
+	TArray<FVector> SampleSpawnLocations(AAABB* InputRoom, int32 NumberOfSpawns, int32 MinPlayerDistance);
+
 	// ヘルパ
 	void EnsureTeamSize2();
 	FVector GetRoomHalfExtents(AAABB* Room) const;
@@ -8,8 +8,11 @@
 #include "Character/UnitMovementComponent.h"
 #include "Character/UnitStatBlock.h"
 #include "Character/UnitBase.h"
+// CodeRevision: INC-2025-1233-R1 (Batched movement update for all moving units) (2025-12-24 14:00)
+#include "Character/UnitMovementManagerSubsystem.h"
 #include "Grid/GridPathfindingSubsystem.h"
 #include "Grid/GridOccupancySubsystem.h"
+#include "Turn/PlayerTravelSubsystem.h"
 #include "Utility/PathFinderUtils.h"
 #include "GameFramework/Actor.h"
 #include "TimerManager.h"
@@ -22,6 +25,7 @@ DEFINE_LOG_CATEGORY(LogUnitMovement);
 
 UUnitMovementComponent::UUnitMovementComponent()
 {
+	// Tickは ts.Movement.Batched 0 のフォールバック時のみ（通常は UUnitMovementManagerSubsystem が一括更新）
 	PrimaryComponentTick.bCanEverTick = true;
 	PrimaryComponentTick.bStartWithTickEnabled = false; // 必要な時だけTick
 
@@ -43,11 +47,21 @@ void UUnitMovementComponent::TickComponent(float DeltaTime, ELevelTick TickType,
 	else
 	{
 		// Ensure anim-facing variables decay to idle when not moving.
-		MoveDirectionAnim = FVector::ZeroVector;
-		MoveSpeedAnim = 0.0f;
+		// CodeRevision: INC-2025-1233-R1 (Batched movement update for all moving units) (2025-12-24 14:00)
+		// 停止中はTick不要（次の MoveUnit で再開）
+		ResetAnimMotion();
+		SetComponentTickEnabled(false);
 	}
 }
 
+void UUnitMovementComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// CodeRevision: INC-2025-1233-R1 (Batched movement update for all moving units) (2025-12-24 14:00)
+	UnregisterFromManager();
+
+	Super::EndPlay(EndPlayReason);
+}
+
 //------------------------------------------------------------------------------
 // Movement Control
 //------------------------------------------------------------------------------
@@ -65,8 +79,20 @@ void UUnitMovementComponent::MoveUnit(const TArray<FVector>& Path)
 	CurrentPathIndex = 0;
 	bIsMoving = true;
 
-	// Tickを有効化
-	SetComponentTickEnabled(true);
+	// CodeRevision: INC-2025-1233-R1 (Batched movement update for all moving units) (2025-12-24 14:00)
+	// マネージャーに登録して一括更新（無効時のみ自前でTick）
+	if (UUnitMovementManagerSubsystem* Manager = UUnitMovementManagerSubsystem::Get(this))
+	{
+		SetComponentTickEnabled(false);
+		Manager->Register(this, CurrentPath[0]);
+	}
+	else
+	{
+		// CodeRevision: INC-2025-1233-R2 (Seed every batched step from the actor's current transform) (2025-12-26 15:00)
+		// 移動中に ts.Movement.Batched 0 へ切り替えた場合、マネージャー側の登録を外して二重更新を防ぐ
+		UnregisterFromManager();
+		SetComponentTickEnabled(true);
+	}
 
 	// イベント配信
 	AUnitBase* OwnerUnit = GetOwnerUnit();
@@ -126,6 +152,7 @@ void UUnitMovementComponent::CancelMovement()
 
 	// Tickを無効化
 	SetComponentTickEnabled(false);
+	UnregisterFromManager();
 
 	// イベント配信
 	AUnitBase* OwnerUnit = GetOwnerUnit();
@@ -180,11 +207,16 @@ void UUnitMovementComponent::UpdateMovement(float DeltaTime)
 		return;
 	}
 
+	// CodeRevision: INC-2025-1218-R1 (Faster playback while the player is traveling with no enemy in view) (2025-12-17 10:00)
+	const UPlayerTravelSubsystem* Travel = GetWorld() ? GetWorld()->GetSubsystem<UPlayerTravelSubsystem>() : nullptr;
+	// CodeRevision: INC-2025-1218-R2 (Travel speed-up applies only to the traveling player) (2025-12-27 18:00)
+	const float Speed = PixelsPerSec * (Travel ? Travel->GetMoveSpeedScale(Owner) : 1.0f);
+
 	const FVector CurrentLocation = Owner->GetActorLocation();
 	const FVector TargetLocation = CurrentPath[CurrentPathIndex];
 	const FVector Direction = (TargetLocation - CurrentLocation).GetSafeNormal();
     MoveDirectionAnim = FVector(Direction.X, Direction.Y, 0.0f).GetSafeNormal();
-    MoveSpeedAnim = PixelsPerSec;
+    MoveSpeedAnim = Speed;
 	const float DistanceToTarget = FVector::Dist(CurrentLocation, TargetLocation);
 
 	// 到達判定
@@ -214,18 +246,18 @@ void UUnitMovementComponent::UpdateMovement(float DeltaTime)
 	if (bUseSmoothMovement)
 	{
 		// スムーズな補間移動
-		NewLocation = FMath::VInterpConstantTo(CurrentLocation, TargetLocation, DeltaTime, PixelsPerSec);
+		NewLocation = FMath::VInterpConstantTo(CurrentLocation, TargetLocation, DeltaTime, Speed);
 	}
 	else
 	{
 		// 直線移動
-		const float MoveDistance = PixelsPerSec * DeltaTime;
+		const float MoveDistance = Speed * DeltaTime;
 		NewLocation = CurrentLocation + Direction * FMath::Min(MoveDistance, DistanceToTarget);
 	}
 
 	Owner->SetActorLocation(NewLocation);
     MoveDirectionAnim = FVector(Direction.X, Direction.Y, 0.0f).GetSafeNormal();
-    MoveSpeedAnim = PixelsPerSec;
+    MoveSpeedAnim = Speed;
 }
 
 void UUnitMovementComponent::MoveToNextWaypoint()
@@ -236,6 +268,14 @@ void UUnitMovementComponent::MoveToNextWaypoint()
 	{
 		FinishMovement();
 	}
+	else if (BatchIndex != INDEX_NONE)
+	{
+		// CodeRevision: INC-2025-1233-R1 (Batched movement update for all moving units) (2025-12-24 14:00)
+		if (UUnitMovementManagerSubsystem* Manager = GetWorld() ? GetWorld()->GetSubsystem<UUnitMovementManagerSubsystem>() : nullptr)
+		{
+			Manager->SetTarget(this, CurrentPath[CurrentPathIndex]);
+		}
+	}
 }
 
 void UUnitMovementComponent::FinishMovement()
@@ -243,6 +283,7 @@ void UUnitMovementComponent::FinishMovement()
 	// CodeRevision: INC-2025-1129-R1 (Prevent movement hang by capping grid occupancy retries) (2025-11-27 16:00)
 	bIsMoving = false;
 	SetComponentTickEnabled(false); // Tickは先に止める
+	UnregisterFromManager();
 
 	AUnitBase* OwnerUnit = GetOwnerUnit();
 
@@ -328,6 +369,20 @@ AUnitBase* UUnitMovementComponent::GetOwnerUnit() const
 	return Cast<AUnitBase>(GetOwner());
 }
 
+void UUnitMovementComponent::UnregisterFromManager()
+{
+	if (BatchIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	if (UUnitMovementManagerSubsystem* Manager = GetWorld() ? GetWorld()->GetSubsystem<UUnitMovementManagerSubsystem>() : nullptr)
+	{
+		Manager->Unregister(this);
+	}
+	BatchIndex = INDEX_NONE;
+}
+
 void UUnitMovementComponent::ResetAnimMotion()
 {
 	MoveDirectionAnim = FVector::ZeroVector;
@@ -15,6 +15,7 @@ DECLARE_LOG_CATEGORY_EXTERN(LogUnitMovement, Log, All);
 
 class AUnitBase;
 class UGridPathfindingSubsystem;
+class UUnitMovementManagerSubsystem;
 struct FUnitStatBlock;
 
 /** 移動完了デリゲート */
@@ -40,6 +41,7 @@ public:
 	UUnitMovementComponent();
 
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	// ========== Movement Control ==========
 
@@ -129,6 +131,13 @@ public:
 	FOnUnitMoveCancelled OnMoveCancelled;
 
 protected:
+	// CodeRevision: INC-2025-1233-R1 (Batched movement update for all moving units) (2025-12-24 14:00)
+	// 移動中はマネージャーが一括更新する（このComponentはTickしない）
+	friend class UUnitMovementManagerSubsystem;
+
+	/** UUnitMovementManagerSubsystem 内のインデックス（未登録なら INDEX_NONE） */
+	int32 BatchIndex = INDEX_NONE;
+
 	// ========== Movement State ==========
 
 	/** 現在の移動パス */
@@ -203,4 +212,7 @@ protected:
 
 	/** アニメ用の速度・方向を強制リセット */
 	void ResetAnimMotion();
+
+	/** 一括更新マネージャーから外す（未登録なら何もしない） */
+	void UnregisterFromManager();
 };
@@ -0,0 +1,258 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+// CodeRevision: INC-2025-1233-R1 (Batched movement update for all moving units) (2025-12-24 14:00)
+#include "Character/UnitMovementManagerSubsystem.h"
+#include "Character/UnitMovementComponent.h"
+#include "Turn/PlayerTravelSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+static int32 GTS_Movement_Batched = 1;
+static FAutoConsoleVariableRef CVarTS_Movement_Batched(
+    TEXT("ts.Movement.Batched"),
+    GTS_Movement_Batched,
+    TEXT("Advance moving units in one batched update (0 = each UUnitMovementComponent ticks itself). Applies to moves started afterwards."),
+    ECVF_Default
+);
+
+namespace UnitMovementManagerPrivate
+{
+    // Same rate UUnitMovementComponent::UpdateMovement turns with
+    static constexpr float RotationInterpSpeed = 10.0f;
+}
+
+//------------------------------------------------------------------------------
+// Lifecycle
+//------------------------------------------------------------------------------
+
+bool UUnitMovementManagerSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UUnitMovementManagerSubsystem::Deinitialize()
+{
+    while (Movers.Num() > 0)
+    {
+        if (UUnitMovementComponent* Mover = Movers.Last().Get())
+        {
+            Mover->BatchIndex = INDEX_NONE;
+        }
+        RemoveAtSwap(Movers.Num() - 1);
+    }
+
+    Super::Deinitialize();
+}
+
+bool UUnitMovementManagerSubsystem::IsTickable() const
+{
+    return Movers.Num() > 0;
+}
+
+TStatId UUnitMovementManagerSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UUnitMovementManagerSubsystem, STATGROUP_Tickables);
+}
+
+UUnitMovementManagerSubsystem* UUnitMovementManagerSubsystem::Get(const UObject* WorldContext)
+{
+    if (GTS_Movement_Batched == 0)
+    {
+        return nullptr;
+    }
+    UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UUnitMovementManagerSubsystem>() : nullptr;
+}
+
+//------------------------------------------------------------------------------
+// Registration
+//------------------------------------------------------------------------------
+
+void UUnitMovementManagerSubsystem::Register(UUnitMovementComponent* Mover, const FVector& Target)
+{
+    if (!Mover || !Mover->GetOwner())
+    {
+        return;
+    }
+
+    if (Mover->BatchIndex == INDEX_NONE)
+    {
+        Mover->BatchIndex = Movers.Add(Mover);
+        TargetX.AddUninitialized();
+        TargetY.AddUninitialized();
+        TargetZ.AddUninitialized();
+    }
+    StoreTarget(Mover->BatchIndex, Target);
+}
+
+void UUnitMovementManagerSubsystem::SetTarget(UUnitMovementComponent* Mover, const FVector& Target)
+{
+    if (Mover && Movers.IsValidIndex(Mover->BatchIndex) && Movers[Mover->BatchIndex] == Mover)
+    {
+        StoreTarget(Mover->BatchIndex, Target);
+    }
+}
+
+void UUnitMovementManagerSubsystem::Unregister(UUnitMovementComponent* Mover)
+{
+    if (Mover && Movers.IsValidIndex(Mover->BatchIndex) && Movers[Mover->BatchIndex] == Mover)
+    {
+        const int32 Index = Mover->BatchIndex;
+        Mover->BatchIndex = INDEX_NONE;
+        RemoveAtSwap(Index);
+    }
+}
+
+void UUnitMovementManagerSubsystem::StoreTarget(int32 Index, const FVector& Target)
+{
+    TargetX[Index] = Target.X;
+    TargetY[Index] = Target.Y;
+    TargetZ[Index] = Target.Z;
+}
+
+void UUnitMovementManagerSubsystem::RemoveAtSwap(int32 Index)
+{
+    const int32 Last = Movers.Num() - 1;
+    if (Index != Last)
+    {
+        if (UUnitMovementComponent* Moved = Movers[Last].Get())
+        {
+            Moved->BatchIndex = Index;
+        }
+    }
+
+    Movers.RemoveAtSwap(Index, EAllowShrinking::No);
+    TargetX.RemoveAtSwap(Index, EAllowShrinking::No);
+    TargetY.RemoveAtSwap(Index, EAllowShrinking::No);
+    TargetZ.RemoveAtSwap(Index, EAllowShrinking::No);
+}
+
+//------------------------------------------------------------------------------
+// Batched update
+//------------------------------------------------------------------------------
+
+void UUnitMovementManagerSubsystem::Tick(float DeltaTime)
+{
+    using namespace UnitMovementManagerPrivate;
+
+    TRACE_CPUPROFILER_EVENT_SCOPE(UnitMovementManager_Tick);
+
+    // Destroyed components (EndPlay normally unregisters; this covers GC without EndPlay)
+    for (int32 Index = Movers.Num() - 1; Index >= 0; --Index)
+    {
+        if (!Movers[Index].IsValid() || !Movers[Index]->GetOwner())
+        {
+            RemoveAtSwap(Index);
+        }
+    }
+
+    const int32 Count = Movers.Num();
+    if (Count == 0)
+    {
+        return;
+    }
+
+    // CodeRevision: INC-2025-1218-R1 (Faster playback while the player is traveling with no enemy in view) (2025-12-17 10:00)
+    // CodeRevision: INC-2025-1218-R2 (Travel speed-up applies only to the traveling player) (2025-12-27 18:00)
+    const UPlayerTravelSubsystem* Travel = GetWorld() ? GetWorld()->GetSubsystem<UPlayerTravelSubsystem>() : nullptr;
+    const AActor* Traveler = Travel ? Travel->GetTravelingPawn() : nullptr;
+    const float TravelerSpeedScale = Traveler ? Travel->GetMoveSpeedScale(Traveler) : 1.0f;
+
+    PosX.SetNumUninitialized(Count, EAllowShrinking::No);
+    PosY.SetNumUninitialized(Count, EAllowShrinking::No);
+    PosZ.SetNumUninitialized(Count, EAllowShrinking::No);
+    Speed.SetNumUninitialized(Count, EAllowShrinking::No);
+    ArrivalSq.SetNumUninitialized(Count, EAllowShrinking::No);
+    DirX.SetNumUninitialized(Count, EAllowShrinking::No);
+    DirY.SetNumUninitialized(Count, EAllowShrinking::No);
+    Arrived.SetNumUninitialized(Count, EAllowShrinking::No);
+
+    // CodeRevision: INC-2025-1233-R2 (Seed every batched step from the actor's current transform) (2025-12-26 15:00)
+    // (0) Gather: the step starts from wherever the unit is now, like UpdateMovement does. Anything that
+    // moved it since the last frame (occupancy eviction, Z correction, a snap) or changed its speed is kept.
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        const UUnitMovementComponent* Mover = Movers[Index].Get();
+        const FVector Location = Mover->GetOwner()->GetActorLocation();
+        PosX[Index] = Location.X;
+        PosY[Index] = Location.Y;
+        PosZ[Index] = Location.Z;
+        Speed[Index] = Mover->PixelsPerSec * (Mover->GetOwner() == Traveler ? TravelerSpeedScale : 1.0f);
+        ArrivalSq[Index] = FMath::Square(static_cast<double>(Mover->ArrivalThreshold));
+    }
+
+    // (1) Position step over the parallel arrays only (no UObject access; branch-free for the vectorizer).
+    // Constant-speed step clamped at the target, which is what both VInterpConstantTo and the
+    // non-smooth straight step of UpdateMovement reduce to.
+    {
+        double* RESTRICT PX = PosX.GetData();
+        double* RESTRICT PY = PosY.GetData();
+        double* RESTRICT PZ = PosZ.GetData();
+        const double* RESTRICT TX = TargetX.GetData();
+        const double* RESTRICT TY = TargetY.GetData();
+        const double* RESTRICT TZ = TargetZ.GetData();
+        const float* RESTRICT S = Speed.GetData();
+        const double* RESTRICT A = ArrivalSq.GetData();
+        double* RESTRICT DX = DirX.GetData();
+        double* RESTRICT DY = DirY.GetData();
+        uint8* RESTRICT Done = Arrived.GetData();
+
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            const double OffX = TX[Index] - PX[Index];
+            const double OffY = TY[Index] - PY[Index];
+            const double OffZ = TZ[Index] - PZ[Index];
+            const double DistSq = OffX * OffX + OffY * OffY + OffZ * OffZ;
+            const double Dist = FMath::Sqrt(DistSq);
+            const double InvDist = 1.0 / FMath::Max(Dist, UE_DOUBLE_SMALL_NUMBER);
+            const double MaxStep = static_cast<double>(S[Index]) * DeltaTime;
+
+            // Inside the arrival radius the unit does not move this frame (waypoint advances instead)
+            const bool bArrived = DistSq <= A[Index];
+            const double Alpha = bArrived ? 0.0 : FMath::Min(1.0, MaxStep * InvDist);
+
+            PX[Index] += OffX * Alpha;
+            PY[Index] += OffY * Alpha;
+            PZ[Index] += OffZ * Alpha;
+            DX[Index] = OffX * InvDist;
+            DY[Index] = OffY * InvDist;
+            Done[Index] = bArrived ? 1 : 0;
+        }
+    }
+
+    // (2) One transform push per unit
+    Arrivals.Reset();
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        UUnitMovementComponent* Mover = Movers[Index].Get();
+        AActor* Owner = Mover->GetOwner();
+
+        const FVector Direction2D = FVector(DirX[Index], DirY[Index], 0.0).GetSafeNormal();
+        Mover->MoveDirectionAnim = Direction2D;
+        Mover->MoveSpeedAnim = Speed[Index];
+
+        if (Arrived[Index])
+        {
+            Arrivals.Add(Mover);
+            continue;
+        }
+
+        FRotator Rotation = Owner->GetActorRotation();
+        if (!Direction2D.IsNearlyZero())
+        {
+            Rotation = FMath::RInterpTo(Rotation, Direction2D.Rotation(), DeltaTime, RotationInterpSpeed);
+        }
+        Owner->SetActorLocationAndRotation(FVector(PosX[Index], PosY[Index], PosZ[Index]), Rotation);
+    }
+
+    // (3) Waypoint advance / finish after the pass: callbacks may register or unregister movers
+    for (const TWeakObjectPtr<UUnitMovementComponent>& Arrival : Arrivals)
+    {
+        if (UUnitMovementComponent* Mover = Arrival.Get())
+        {
+            Mover->MoveToNextWaypoint();
+        }
+    }
+}
@@ -0,0 +1,78 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+// CodeRevision: INC-2025-1233-R1 (Batched movement update for all moving units) (2025-12-24 14:00)
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UnitMovementManagerSubsystem.generated.h"
+
+class UUnitMovementComponent;
+
+/**
+ * UUnitMovementManagerSubsystem: advances every moving UUnitMovementComponent in one update.
+ *
+ * A mover is registered while it follows a path (MoveUnit -> FinishMovement / CancelMovement);
+ * components never tick while batched. Per-mover state is kept as parallel arrays: the position
+ * step runs over plain floats without touching UObjects, then each unit gets a single
+ * SetActorLocationAndRotation. Location, rotation and speed are gathered from the actor and the
+ * component at the start of every update (only the waypoint is kept between frames), so external
+ * writes such as occupancy evictions, Z corrections or UpdateSpeedFromStats are never overwritten
+ * and the result matches the per-component path frame for frame. Waypoint arrivals are handed back to the component after the
+ * pass, so completion callbacks may start or stop other moves safely.
+ *
+ * ts.Movement.Batched 0 falls back to per-component ticks for moves started afterwards.
+ */
+UCLASS()
+class LYRAGAME_API UUnitMovementManagerSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+    virtual void Deinitialize() override;
+
+    // FTickableGameObject
+    virtual void Tick(float DeltaTime) override;
+    virtual bool IsTickable() const override;
+    virtual TStatId GetStatId() const override;
+
+    /** Manager of WorldContext's world, or nullptr when batching is off (ts.Movement.Batched 0). */
+    static UUnitMovementManagerSubsystem* Get(const UObject* WorldContext);
+
+    /** Start driving Mover towards Target. */
+    void Register(UUnitMovementComponent* Mover, const FVector& Target);
+
+    /** Next waypoint of a registered mover. */
+    void SetTarget(UUnitMovementComponent* Mover, const FVector& Target);
+
+    /** No-op for movers that are not registered. */
+    void Unregister(UUnitMovementComponent* Mover);
+
+    int32 Num() const { return Movers.Num(); }
+
+private:
+    // CodeRevision: INC-2025-1233-R2 (Seed every batched step from the actor's current transform) (2025-12-26 15:00)
+    void StoreTarget(int32 Index, const FVector& Target);
+    void RemoveAtSwap(int32 Index);
+
+    TArray<TWeakObjectPtr<UUnitMovementComponent>> Movers;
+
+    // Parallel arrays, one entry per mover (the current waypoint)
+    TArray<double> TargetX;
+    TArray<double> TargetY;
+    TArray<double> TargetZ;
+
+    // Per-tick scratch, gathered from the actors and components before the step
+    TArray<double> PosX;
+    TArray<double> PosY;
+    TArray<double> PosZ;
+    TArray<float> Speed;
+    TArray<double> ArrivalSq;
+
+    // Per-tick scratch
+    TArray<double> DirX;
+    TArray<double> DirY;
+    TArray<uint8> Arrived;
+    TArray<TWeakObjectPtr<UUnitMovementComponent>> Arrivals;
+};
@@ -9,6 +9,7 @@ class LYRAGAME_API UDungeonTemplate_NormalBSP : public UDungeonTemplateAsset
     GENERATED_BODY()
 public:
     virtual void Generate_Implementation(ADungeonFloorGenerator* Generator, const FDungeonResolvedParams& Params, FRandomStream& Rng) override;
+    virtual bool GetNativeLayout(EMapTemplate& OutLayout) const override { OutLayout = EMapTemplate::NormalBSP; return true; }
 };
 
 UCLASS(Blueprintable, meta=(DisplayName="Preset: Large Hall"))
@@ -17,6 +18,7 @@ class LYRAGAME_API UDungeonTemplate_LargeHall : public UDungeonTemplateAsset
     GENERATED_BODY()
 public:
     virtual void Generate_Implementation(ADungeonFloorGenerator* Generator, const FDungeonResolvedParams& Params, FRandomStream& Rng) override;
+    virtual bool GetNativeLayout(EMapTemplate& OutLayout) const override { OutLayout = EMapTemplate::LargeHall; return true; }
 };
 
 UCLASS(Blueprintable, meta=(DisplayName="Preset: Four Quads"))
@@ -25,6 +27,7 @@ class LYRAGAME_API UDungeonTemplate_FourQuads : public UDungeonTemplateAsset
     GENERATED_BODY()
 public:
     virtual void Generate_Implementation(ADungeonFloorGenerator* Generator, const FDungeonResolvedParams& Params, FRandomStream& Rng) override;
+    virtual bool GetNativeLayout(EMapTemplate& OutLayout) const override { OutLayout = EMapTemplate::FourQuads; return true; }
 };
 
 UCLASS(Blueprintable, meta=(DisplayName="Preset: Central Cross"))
@@ -33,4 +36,5 @@ class LYRAGAME_API UDungeonTemplate_CentralCross : public UDungeonTemplateAsset
     GENERATED_BODY()
 public:
     virtual void Generate_Implementation(ADungeonFloorGenerator* Generator, const FDungeonResolvedParams& Params, FRandomStream& Rng) override;
+    virtual bool GetNativeLayout(EMapTemplate& OutLayout) const override { OutLayout = EMapTemplate::CentralCrossWithMiniRooms; return true; }
 };
\ No newline at end of file
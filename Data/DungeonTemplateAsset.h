@@ -1,6 +1,7 @@
 #pragma once
 #include "UObject/Object.h"
 #include "Engine/DataAsset.h"
+#include "Data/DungeonTemplateTypes.h"
 #include "DungeonTemplateAsset.generated.h"
 
 class ADungeonFloorGenerator;
@@ -15,4 +16,8 @@ public:
     UFUNCTION(BlueprintNativeEvent, Category="Dungeon|Template")
     void Generate(ADungeonFloorGenerator* Generator, const FDungeonResolvedParams& Params, FRandomStream& Rng);
     virtual void Generate_Implementation(ADungeonFloorGenerator* Generator, const FDungeonResolvedParams& Params, FRandomStream& Rng) {}
+
+    // CodeRevision: INC-2025-1221-R1 (Grid generation as a pure function over a plain buffer) (2025-12-18 14:00)
+    /** Native preset layout carved by this template, if any. Lets generation run off the game thread. */
+    virtual bool GetNativeLayout(EMapTemplate& OutLayout) const { return false; }
 };
\ No newline at end of file
@@ -0,0 +1,679 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+// CodeRevision: INC-2025-1228-R1 (Lock-free binary log sink with a background writer and on-demand CSV) (2025-12-22 10:00)
+#include "Debug/DebugLogSink.h"
+
+#include "HAL/Event.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+static int32 GTS_Log_SinkMaxFileMB = 64;
+static FAutoConsoleVariableRef CVarTS_Log_SinkMaxFileMB(
+    TEXT("ts.Log.SinkMaxFileMB"),
+    GTS_Log_SinkMaxFileMB,
+    TEXT("Size at which the binary turn log rotates to a new file (MB)."),
+    ECVF_Default);
+
+static int32 GTS_Log_SinkMaxFiles = 16;
+static FAutoConsoleVariableRef CVarTS_Log_SinkMaxFiles(
+    TEXT("ts.Log.SinkMaxFiles"),
+    GTS_Log_SinkMaxFiles,
+    TEXT("Rotated binary turn log files kept per session (oldest are deleted)."),
+    ECVF_Default);
+
+namespace DebugLogSinkPrivate
+{
+    // Writer wakes at least this often while idle
+    constexpr uint32 WriterIdleWaitMs = 50;
+    constexpr int32 WriteBufferFlushBytes = 256 * 1024;
+
+    template <typename T>
+    FORCEINLINE void AppendValue(TArray<uint8>& Out, const T& Value)
+    {
+        Out.Append(reinterpret_cast<const uint8*>(&Value), sizeof(T));
+    }
+
+    template <typename T>
+    FORCEINLINE T ReadValue(const uint8* Data)
+    {
+        T Value;
+        FMemory::Memcpy(&Value, Data, sizeof(T));
+        return Value;
+    }
+
+    static void AppendRecord(TArray<uint8>& Out, double Timestamp, int32 TurnId, uint32 CategoryId, uint8 Kind, uint8 Verbosity, const UTF8CHAR* Message, uint16 MessageBytes)
+    {
+        AppendValue(Out, Timestamp);
+        AppendValue(Out, TurnId);
+        AppendValue(Out, CategoryId);
+        AppendValue(Out, Kind);
+        AppendValue(Out, Verbosity);
+        AppendValue(Out, MessageBytes);
+        Out.Append(reinterpret_cast<const uint8*>(Message), MessageBytes);
+    }
+
+    /** TCHAR -> UTF-8 into a fixed buffer, truncated on a code point boundary. No allocation. */
+    static int32 EncodeUTF8(const TCHAR* Source, UTF8CHAR* Dest, int32 DestCapacity)
+    {
+        int32 Written = 0;
+        for (const TCHAR* Char = Source; *Char; ++Char)
+        {
+            uint32 Code = static_cast<uint32>(*Char);
+            if constexpr (sizeof(TCHAR) == 2)
+            {
+                const uint32 Next = static_cast<uint32>(Char[1]);
+                if (Code >= 0xD800 && Code <= 0xDBFF && Next >= 0xDC00 && Next <= 0xDFFF)
+                {
+                    Code = 0x10000 + ((Code - 0xD800) << 10) + (Next - 0xDC00);
+                    ++Char;
+                }
+            }
+
+            const int32 Len = Code < 0x80 ? 1 : (Code < 0x800 ? 2 : (Code < 0x10000 ? 3 : 4));
+            if (Written + Len > DestCapacity)
+            {
+                break;
+            }
+
+            switch (Len)
+            {
+            case 1:
+                Dest[Written++] = static_cast<UTF8CHAR>(Code);
+                break;
+            case 2:
+                Dest[Written++] = static_cast<UTF8CHAR>(0xC0 | (Code >> 6));
+                Dest[Written++] = static_cast<UTF8CHAR>(0x80 | (Code & 0x3F));
+                break;
+            case 3:
+                Dest[Written++] = static_cast<UTF8CHAR>(0xE0 | (Code >> 12));
+                Dest[Written++] = static_cast<UTF8CHAR>(0x80 | ((Code >> 6) & 0x3F));
+                Dest[Written++] = static_cast<UTF8CHAR>(0x80 | (Code & 0x3F));
+                break;
+            default:
+                Dest[Written++] = static_cast<UTF8CHAR>(0xF0 | (Code >> 18));
+                Dest[Written++] = static_cast<UTF8CHAR>(0x80 | ((Code >> 12) & 0x3F));
+                Dest[Written++] = static_cast<UTF8CHAR>(0x80 | ((Code >> 6) & 0x3F));
+                Dest[Written++] = static_cast<UTF8CHAR>(0x80 | (Code & 0x3F));
+                break;
+            }
+        }
+        return Written;
+    }
+
+    static const TCHAR* GetKindName(EDebugLogRecordKind Kind)
+    {
+        switch (Kind)
+        {
+        case EDebugLogRecordKind::PhaseStart:   return TEXT("PhaseStart");
+        case EDebugLogRecordKind::PhaseEnd:     return TEXT("PhaseEnd");
+        case EDebugLogRecordKind::Intent:       return TEXT("Intent");
+        case EDebugLogRecordKind::SessionStart: return TEXT("SessionStart");
+        case EDebugLogRecordKind::SessionEnd:   return TEXT("SessionEnd");
+        default:                                return TEXT("Log");
+        }
+    }
+
+    static FString EscapeCSV(const FString& Value)
+    {
+        FString Escaped = Value;
+        Escaped.ReplaceInline(TEXT("\""), TEXT("\"\""));
+        if (Escaped.Contains(TEXT(",")) || Escaped.Contains(TEXT("\"")) || Escaped.Contains(TEXT("\n")))
+        {
+            Escaped = FString::Printf(TEXT("\"%s\""), *Escaped);
+        }
+        return Escaped;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Reader
+//------------------------------------------------------------------------------
+
+FString FDebugLogRecord::GetMessage() const
+{
+    if (!Message || MessageBytes <= 0)
+    {
+        return FString();
+    }
+
+    const FUTF8ToTCHAR Converted(Message, MessageBytes);
+    return FString(Converted.Length(), Converted.Get());
+}
+
+FDebugLogReader::FDebugLogReader(TConstArrayView64<uint8> InBytes)
+    : Bytes(InBytes)
+{
+    using namespace DebugLogSinkPrivate;
+
+    if (Bytes.Num() >= FDebugLogSink::FileHeaderBytes)
+    {
+        bValidHeader = ReadValue<uint32>(Bytes.GetData()) == FDebugLogSink::FileMagic
+            && ReadValue<uint16>(Bytes.GetData() + 4) == FDebugLogSink::FileVersion;
+    }
+    Offset = FDebugLogSink::FileHeaderBytes;
+}
+
+bool FDebugLogReader::Next(FDebugLogRecord& OutRecord)
+{
+    using namespace DebugLogSinkPrivate;
+
+    while (bValidHeader && Offset + FDebugLogSink::RecordHeaderBytes <= Bytes.Num())
+    {
+        const uint8* Data = Bytes.GetData() + Offset;
+        const uint8 KindValue = Data[16];
+        const uint16 MessageBytes = ReadValue<uint16>(Data + 18);
+
+        // Unknown kind or a record cut off by a crash: stop here
+        if (KindValue >= static_cast<uint8>(EDebugLogRecordKind::Count)
+            || Offset + FDebugLogSink::RecordHeaderBytes + MessageBytes > Bytes.Num())
+        {
+            Offset = Bytes.Num();
+            return false;
+        }
+
+        OutRecord.Offset = Offset;
+        OutRecord.Timestamp = ReadValue<double>(Data);
+        OutRecord.TurnId = ReadValue<int32>(Data + 8);
+        OutRecord.CategoryId = ReadValue<uint32>(Data + 12);
+        OutRecord.Kind = static_cast<EDebugLogRecordKind>(KindValue);
+        OutRecord.Verbosity = static_cast<ELogVerbosity::Type>(Data[17]);
+        OutRecord.Message = reinterpret_cast<const UTF8CHAR*>(Data + FDebugLogSink::RecordHeaderBytes);
+        OutRecord.MessageBytes = MessageBytes;
+
+        Offset += FDebugLogSink::RecordHeaderBytes + MessageBytes;
+
+        if (OutRecord.Kind == EDebugLogRecordKind::Name)
+        {
+            CategoryNames.Add(OutRecord.CategoryId, OutRecord.GetMessage());
+            continue;
+        }
+        return true;
+    }
+    return false;
+}
+
+void FDebugLogReader::Seek(int64 InOffset)
+{
+    Offset = FMath::Clamp<int64>(InOffset, FDebugLogSink::FileHeaderBytes, Bytes.Num());
+}
+
+const FString& FDebugLogReader::GetCategoryName(uint32 CategoryId) const
+{
+    static const FString Empty;
+    const FString* Found = CategoryNames.Find(CategoryId);
+    return Found ? *Found : Empty;
+}
+
+//------------------------------------------------------------------------------
+// Sink lifecycle
+//------------------------------------------------------------------------------
+
+FDebugLogSink::FDebugLogSink(int32 InCapacity)
+{
+    Capacity = FMath::RoundUpToPowerOfTwo(static_cast<uint32>(FMath::Max(InCapacity, 64)));
+    IndexMask = Capacity - 1;
+    WakeMask = (Capacity / 4) - 1;
+
+    Slots = MakeUnique<FSlot[]>(Capacity);
+    for (uint64 Index = 0; Index < Capacity; ++Index)
+    {
+        Slots[Index].Sequence.store(Index, std::memory_order_relaxed);
+    }
+
+    WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+    if (FPlatformProcess::SupportsMultithreading())
+    {
+        Thread = FRunnableThread::Create(this, TEXT("DebugLogSinkWriter"), 0, TPri_BelowNormal);
+    }
+}
+
+FDebugLogSink::~FDebugLogSink()
+{
+    Stop();
+    if (Thread)
+    {
+        Thread->WaitForCompletion();
+        delete Thread;
+        Thread = nullptr;
+    }
+
+    Drain();
+    CloseFile();
+
+    FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+    WakeEvent = nullptr;
+}
+
+uint32 FDebugLogSink::Run()
+{
+    while (!bStopping.load(std::memory_order_relaxed))
+    {
+        if (Drain() == 0)
+        {
+            WakeEvent->Wait(DebugLogSinkPrivate::WriterIdleWaitMs);
+        }
+    }
+    return 0;
+}
+
+void FDebugLogSink::Stop()
+{
+    bStopping.store(true, std::memory_order_relaxed);
+    if (WakeEvent)
+    {
+        WakeEvent->Trigger();
+    }
+}
+
+//------------------------------------------------------------------------------
+// Producers
+//------------------------------------------------------------------------------
+
+bool FDebugLogSink::Push(EDebugLogRecordKind Kind, FName Category, ELogVerbosity::Type Verbosity, const TCHAR* Message, bool bBlocking)
+{
+    const bool bSessionRecord = Kind == EDebugLogRecordKind::SessionStart || Kind == EDebugLogRecordKind::SessionEnd;
+    if (!bSessionRecord && !IsSessionOpen())
+    {
+        return false;
+    }
+
+    const uint32 CategoryId = Category.GetDisplayIndex().ToUnstableInt();
+    for (;;)
+    {
+        if (TryEnqueue(Kind, CategoryId, Verbosity, Message ? Message : TEXT("")))
+        {
+            RecordCount.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        if (!bBlocking || bStopping.load(std::memory_order_relaxed))
+        {
+            DroppedCount.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        if (Thread)
+        {
+            WakeEvent->Trigger();
+            FPlatformProcess::Sleep(0.0005f);
+        }
+        else
+        {
+            Drain();
+        }
+    }
+}
+
+bool FDebugLogSink::TryEnqueue(EDebugLogRecordKind Kind, uint32 CategoryId, ELogVerbosity::Type Verbosity, const TCHAR* Message)
+{
+    // Bounded MPMC ring (sequence per slot); only the writer consumes
+    uint64 Pos = EnqueuePos.load(std::memory_order_relaxed);
+    FSlot* Slot = nullptr;
+    for (;;)
+    {
+        Slot = &Slots[Pos & IndexMask];
+        const uint64 Sequence = Slot->Sequence.load(std::memory_order_acquire);
+        const int64 Diff = static_cast<int64>(Sequence) - static_cast<int64>(Pos);
+        if (Diff == 0)
+        {
+            if (EnqueuePos.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (Diff < 0)
+        {
+            return false;
+        }
+        else
+        {
+            Pos = EnqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    Slot->Timestamp = FPlatformTime::Seconds();
+    Slot->TurnId = TurnId.load(std::memory_order_relaxed);
+    Slot->CategoryId = CategoryId;
+    Slot->Kind = static_cast<uint8>(Kind);
+    Slot->Verbosity = static_cast<uint8>(Verbosity & ELogVerbosity::VerbosityMask);
+    Slot->MessageBytes = static_cast<uint16>(DebugLogSinkPrivate::EncodeUTF8(Message, Slot->Message, MaxMessageBytes));
+    Slot->Sequence.store(Pos + 1, std::memory_order_release);
+
+    if ((Pos & WakeMask) == 0)
+    {
+        if (Thread)
+        {
+            WakeEvent->Trigger();
+        }
+        else
+        {
+            // No worker threads on this platform: producers are the only thread, drain inline
+            Drain();
+        }
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Session control
+//------------------------------------------------------------------------------
+
+void FDebugLogSink::BeginSession(const FString& SessionTimestamp)
+{
+    RecordCount.store(0, std::memory_order_relaxed);
+    bSessionOpen.store(true, std::memory_order_relaxed);
+    Push(EDebugLogRecordKind::SessionStart, NAME_None, ELogVerbosity::Log, *SessionTimestamp, /*bBlocking*/true);
+}
+
+void FDebugLogSink::EndSession()
+{
+    if (!IsSessionOpen())
+    {
+        return;
+    }
+
+    Push(EDebugLogRecordKind::SessionEnd, NAME_None, ELogVerbosity::Log, TEXT(""), /*bBlocking*/true);
+    bSessionOpen.store(false, std::memory_order_relaxed);
+}
+
+bool FDebugLogSink::Flush(double TimeoutSeconds)
+{
+    if (!Thread)
+    {
+        Drain();
+        return true;
+    }
+
+    const uint64 Target = EnqueuePos.load(std::memory_order_acquire);
+    const double Deadline = FPlatformTime::Seconds() + TimeoutSeconds;
+    while (WrittenPos.load(std::memory_order_acquire) < Target)
+    {
+        if (FPlatformTime::Seconds() > Deadline)
+        {
+            return false;
+        }
+        WakeEvent->Trigger();
+        FPlatformProcess::Sleep(0.001f);
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Writer
+//------------------------------------------------------------------------------
+
+int32 FDebugLogSink::Drain()
+{
+    int32 Drained = 0;
+    for (;;)
+    {
+        FSlot& Slot = Slots[DequeuePos & IndexMask];
+        if (Slot.Sequence.load(std::memory_order_acquire) != DequeuePos + 1)
+        {
+            break;
+        }
+
+        WriteRecord(Slot);
+        Slot.Sequence.store(DequeuePos + Capacity, std::memory_order_release);
+        ++DequeuePos;
+        ++Drained;
+    }
+
+    if (Drained > 0)
+    {
+        FlushBuffer();
+    }
+    WrittenPos.store(DequeuePos, std::memory_order_release);
+    return Drained;
+}
+
+void FDebugLogSink::WriteRecord(const FSlot& Slot)
+{
+    using namespace DebugLogSinkPrivate;
+
+    const EDebugLogRecordKind Kind = static_cast<EDebugLogRecordKind>(Slot.Kind);
+    if (Kind == EDebugLogRecordKind::SessionStart)
+    {
+        const FUTF8ToTCHAR Timestamp(Slot.Message, Slot.MessageBytes);
+        OpenSession(FString(Timestamp.Length(), Timestamp.Get()));
+    }
+
+    // Records outside a session have nowhere to go
+    if (!File)
+    {
+        return;
+    }
+
+    const int64 MaxFileBytes = static_cast<int64>(FMath::Max(GTS_Log_SinkMaxFileMB, 1)) * 1024 * 1024;
+    if (FileBytes + WriteBuffer.Num() >= MaxFileBytes)
+    {
+        FlushBuffer();
+        File.Reset();
+        if (!OpenFile())
+        {
+            return;
+        }
+    }
+
+    if (Slot.CategoryId != 0 && !DefinedCategories.Contains(Slot.CategoryId))
+    {
+        DefinedCategories.Add(Slot.CategoryId);
+
+        const FString Name = FName::CreateFromDisplayId(FNameEntryId::FromUnstableInt(Slot.CategoryId), 0).ToString();
+        const FTCHARToUTF8 NameUTF8(*Name, Name.Len());
+        const uint16 NameBytes = static_cast<uint16>(FMath::Min(NameUTF8.Length(), MaxMessageBytes));
+        AppendRecord(WriteBuffer, Slot.Timestamp, Slot.TurnId, Slot.CategoryId, static_cast<uint8>(EDebugLogRecordKind::Name), 0,
+            reinterpret_cast<const UTF8CHAR*>(NameUTF8.Get()), NameBytes);
+    }
+
+    AppendRecord(WriteBuffer, Slot.Timestamp, Slot.TurnId, Slot.CategoryId, Slot.Kind, Slot.Verbosity, Slot.Message, Slot.MessageBytes);
+
+    if (Kind == EDebugLogRecordKind::SessionEnd)
+    {
+        CloseFile();
+    }
+    else if (WriteBuffer.Num() >= WriteBufferFlushBytes)
+    {
+        FlushBuffer();
+    }
+}
+
+void FDebugLogSink::OpenSession(const FString& SessionTimestamp)
+{
+    CloseFile();
+
+    // Restarting a session (ClearLogs) replaces its files
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    for (const FString& Stale : FindSessionFiles(SessionTimestamp))
+    {
+        PlatformFile.DeleteFile(*Stale);
+    }
+
+    SessionBase = GetLogDirectory() / FString::Printf(TEXT("Session_%s"), *SessionTimestamp);
+    SessionFiles.Reset();
+    FileIndex = 0;
+    OpenFile();
+}
+
+bool FDebugLogSink::OpenFile()
+{
+    using namespace DebugLogSinkPrivate;
+
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    PlatformFile.CreateDirectoryTree(*GetLogDirectory());
+
+    const FString Path = FString::Printf(TEXT("%s_%03d.tlog"), *SessionBase, FileIndex++);
+    File.Reset(PlatformFile.OpenWrite(*Path));
+    FileBytes = 0;
+    DefinedCategories.Reset();
+    if (!File)
+    {
+        return false;
+    }
+
+    SessionFiles.Add(Path);
+    while (SessionFiles.Num() > FMath::Max(GTS_Log_SinkMaxFiles, 1))
+    {
+        PlatformFile.DeleteFile(*SessionFiles[0]);
+        SessionFiles.RemoveAt(0);
+    }
+
+    AppendValue(WriteBuffer, FileMagic);
+    AppendValue(WriteBuffer, FileVersion);
+    AppendValue(WriteBuffer, static_cast<uint16>(0));
+    return true;
+}
+
+void FDebugLogSink::FlushBuffer()
+{
+    if (File && WriteBuffer.Num() > 0)
+    {
+        File->Write(WriteBuffer.GetData(), WriteBuffer.Num());
+        File->Flush();
+        FileBytes += WriteBuffer.Num();
+    }
+    WriteBuffer.Reset();
+}
+
+void FDebugLogSink::CloseFile()
+{
+    FlushBuffer();
+    File.Reset();
+}
+
+//------------------------------------------------------------------------------
+// Files / conversion
+//------------------------------------------------------------------------------
+
+FString FDebugLogSink::GetLogDirectory()
+{
+    return FPaths::ProjectSavedDir() / TEXT("TurnLogs");
+}
+
+TArray<FString> FDebugLogSink::FindSessionFiles(const FString& SessionTimestamp)
+{
+    const FString Directory = GetLogDirectory();
+
+    TArray<FString> Names;
+    IFileManager::Get().FindFiles(Names, *(Directory / FString::Printf(TEXT("Session_%s_*.tlog"), *SessionTimestamp)), /*Files*/true, /*Directories*/false);
+    Names.Sort();
+
+    TArray<FString> Paths;
+    Paths.Reserve(Names.Num());
+    for (const FString& Name : Names)
+    {
+        Paths.Add(Directory / Name);
+    }
+    return Paths;
+}
+
+bool FDebugLogSink::ConvertToCSV(TConstArrayView<FString> BinaryFiles, const FString& CsvPath, int32* OutRows)
+{
+    using namespace DebugLogSinkPrivate;
+
+    TUniquePtr<FArchive> Out(IFileManager::Get().CreateFileWriter(*CsvPath));
+    if (!Out)
+    {
+        return false;
+    }
+
+    FString Chunk;
+    Chunk.Reserve(WriteBufferFlushBytes);
+    auto FlushChunk = [&Chunk, &Out]()
+    {
+        const FTCHARToUTF8 Converted(*Chunk, Chunk.Len());
+        Out->Serialize((void*)Converted.Get(), Converted.Length());
+        Chunk.Reset();
+    };
+
+    Chunk += GetCSVHeader();
+    Chunk += LINE_TERMINATOR;
+
+    int32 Rows = 0;
+    for (const FString& Path : BinaryFiles)
+    {
+        // Files are bounded by ts.Log.SinkMaxFileMB, so one at a time fits in memory
+        TArray<uint8> Bytes;
+        if (!FFileHelper::LoadFileToArray(Bytes, *Path))
+        {
+            continue;
+        }
+
+        FDebugLogReader Reader(Bytes);
+        FDebugLogRecord Record;
+        while (Reader.Next(Record))
+        {
+            Chunk += FormatCSVRow(Record, Reader.GetCategoryName(Record.CategoryId));
+            Chunk += LINE_TERMINATOR;
+            ++Rows;
+
+            if (Chunk.Len() >= WriteBufferFlushBytes)
+            {
+                FlushChunk();
+            }
+        }
+    }
+
+    FlushChunk();
+    if (OutRows)
+    {
+        *OutRows = Rows;
+    }
+    return Out->Close();
+}
+
+FString FDebugLogSink::FormatCSVRow(const FDebugLogRecord& Record, const FString& CategoryName)
+{
+    using namespace DebugLogSinkPrivate;
+
+    FString Category;
+    FString Message;
+    switch (Record.Kind)
+    {
+    case EDebugLogRecordKind::SessionStart:
+        Category = TEXT("Session");
+        Message = FString::Printf(TEXT("=== SESSION %s STARTED ==="), *Record.GetMessage());
+        break;
+    case EDebugLogRecordKind::SessionEnd:
+        Category = TEXT("Session");
+        Message = TEXT("=== SESSION ENDED ===");
+        break;
+    case EDebugLogRecordKind::Log:
+        Category = CategoryName;
+        Category.RemoveFromStart(TEXT("Log"), ESearchCase::CaseSensitive);
+        Message = Record.GetMessage();
+        break;
+    default:
+        Category = CategoryName;
+        Message = Record.GetMessage();
+        break;
+    }
+
+    const TCHAR* Type = Record.Kind == EDebugLogRecordKind::Log ? ToString(Record.Verbosity) : GetKindName(Record.Kind);
+    return FString::Printf(TEXT("%s,%d,%s,%.6f,%s"), Type, Record.TurnId, *Category, Record.Timestamp, *EscapeCSV(Message));
+}
+
+static FAutoConsoleCommand CmdTS_Log_ExportCSV(
+    TEXT("ts.Log.ExportCSV"),
+    TEXT("Render a binary turn log session as CSV. Usage: ts.Log.ExportCSV <SessionTimestamp> [OutFile]"),
+    FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+    {
+        if (Args.Num() < 1)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("[DebugLogSink] Usage: ts.Log.ExportCSV <SessionTimestamp> [OutFile]"));
+            return;
+        }
+
+        const TArray<FString> Files = FDebugLogSink::FindSessionFiles(Args[0]);
+        const FString CsvPath = Args.Num() > 1 ? Args[1] : FDebugLogSink::GetLogDirectory() / FString::Printf(TEXT("Session_%s.csv"), *Args[0]);
+
+        int32 Rows = 0;
+        const bool bOk = Files.Num() > 0 && FDebugLogSink::ConvertToCSV(Files, CsvPath, &Rows);
+        UE_LOG(LogTemp, Log, TEXT("[DebugLogSink] ExportCSV %s: %d file(s), %d row(s) -> %s (%s)"),
+            *Args[0], Files.Num(), Rows, *CsvPath, bOk ? TEXT("ok") : TEXT("failed"));
+    }));
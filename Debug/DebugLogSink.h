@@ -0,0 +1,191 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+// CodeRevision: INC-2025-1228-R1 (Lock-free binary log sink with a background writer and on-demand CSV) (2025-12-22 10:00)
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "Logging/LogVerbosity.h"
+#include <atomic>
+
+class FEvent;
+class FRunnableThread;
+class IFileHandle;
+
+/** Record kinds stored in a binary turn log (.tlog). Values are part of the file format. */
+enum class EDebugLogRecordKind : uint8
+{
+    // Category name definition: CategoryId = id, payload = UTF-8 name. Emitted once per file before first use.
+    Name = 0,
+    Log,
+    PhaseStart,
+    PhaseEnd,
+    Intent,
+    // Payload = session timestamp; the writer opens a new file set on this record
+    SessionStart,
+    SessionEnd,
+
+    Count
+};
+
+/**
+ * One decoded record. Message points into the reader's byte view (not null terminated).
+ *
+ * File layout (little endian): 8-byte file header {uint32 Magic, uint16 Version, uint16 Reserved},
+ * then records of {double Timestamp, int32 TurnId, uint32 CategoryId, uint8 Kind, uint8 Verbosity,
+ * uint16 MessageBytes} followed by MessageBytes of UTF-8.
+ */
+struct LYRAGAME_API FDebugLogRecord
+{
+    int64 Offset = 0;
+    double Timestamp = 0.0;
+    int32 TurnId = INDEX_NONE;
+    uint32 CategoryId = 0;
+    EDebugLogRecordKind Kind = EDebugLogRecordKind::Log;
+    ELogVerbosity::Type Verbosity = ELogVerbosity::Log;
+    const UTF8CHAR* Message = nullptr;
+    int32 MessageBytes = 0;
+
+    FString GetMessage() const;
+};
+
+/** Sequential reader over the bytes of one .tlog file. Truncated tails (crash mid-write) end the stream cleanly. */
+class LYRAGAME_API FDebugLogReader
+{
+public:
+    explicit FDebugLogReader(TConstArrayView64<uint8> InBytes);
+
+    bool IsValid() const { return bValidHeader; }
+
+    /** Next non-Name record; Name records only update the category table. */
+    bool Next(FDebugLogRecord& OutRecord);
+
+    // CodeRevision: INC-2025-1232-R1 (Indexed .tlog queries) (2025-12-24 10:00)
+    /** Continue reading at a record offset (e.g. from FTurnLogIndex). Category names seen earlier are kept. */
+    void Seek(int64 InOffset);
+
+    const FString& GetCategoryName(uint32 CategoryId) const;
+    const TMap<uint32, FString>& GetCategoryNames() const { return CategoryNames; }
+
+private:
+    TConstArrayView64<uint8> Bytes;
+    int64 Offset = 0;
+    bool bValidHeader = false;
+    TMap<uint32, FString> CategoryNames;
+};
+
+/**
+ * FDebugLogSink: multi-producer lock-free log sink.
+ *
+ * Producers (any thread, including GLog output) claim a slot in a bounded ring of fixed-size records
+ * with one CAS and copy at most MaxMessageBytes of UTF-8; nothing allocates or locks on that path.
+ * When the ring is full the record is dropped and counted. A background writer drains the ring into
+ * Saved/TurnLogs/Session_<Timestamp>_<NNN>.tlog, rotating at ts.Log.SinkMaxFileMB and keeping at most
+ * ts.Log.SinkMaxFiles files per session. CSV is rendered on demand with ConvertToCSV.
+ */
+class LYRAGAME_API FDebugLogSink : public FRunnable
+{
+public:
+    static constexpr uint32 FileMagic = 0x474F4C54; // "TLOG"
+    static constexpr uint16 FileVersion = 1;
+    static constexpr int32 FileHeaderBytes = 8;
+    static constexpr int32 RecordHeaderBytes = 20;
+    static constexpr int32 MaxMessageBytes = 472;
+
+    /** Capacity is rounded up to a power of two. */
+    explicit FDebugLogSink(int32 InCapacity = 8192);
+    virtual ~FDebugLogSink();
+
+    // Producers -----------------------------------------------------------------
+
+    /**
+     * Enqueue one record stamped with the current time and turn id. Returns false when no session is
+     * open or the ring is full (unless bBlocking, which waits for space; game thread only).
+     */
+    bool Push(EDebugLogRecordKind Kind, FName Category, ELogVerbosity::Type Verbosity, const TCHAR* Message, bool bBlocking = false);
+
+    void SetTurnId(int32 InTurnId) { TurnId.store(InTurnId, std::memory_order_relaxed); }
+    int32 GetTurnId() const { return TurnId.load(std::memory_order_relaxed); }
+
+    // Session control (game thread) -----------------------------------------------
+
+    /** Opens Session_<Timestamp>_000.tlog (existing files of that session are replaced). */
+    void BeginSession(const FString& SessionTimestamp);
+    void EndSession();
+    bool IsSessionOpen() const { return bSessionOpen.load(std::memory_order_relaxed); }
+
+    /** Blocks until everything enqueued before the call is on disk. */
+    bool Flush(double TimeoutSeconds = 5.0);
+
+    uint64 GetRecordCount() const { return RecordCount.load(std::memory_order_relaxed); }
+    uint64 GetDroppedCount() const { return DroppedCount.load(std::memory_order_relaxed); }
+
+    // Files / conversion ----------------------------------------------------------
+
+    static FString GetLogDirectory();
+
+    /** Rotated files of a session, oldest first. */
+    static TArray<FString> FindSessionFiles(const FString& SessionTimestamp);
+
+    /** Render .tlog files (in order) as Type,TurnID,Category,Timestamp,Message CSV. */
+    static bool ConvertToCSV(TConstArrayView<FString> BinaryFiles, const FString& CsvPath, int32* OutRows = nullptr);
+
+    static const TCHAR* GetCSVHeader() { return TEXT("Type,TurnID,Category,Timestamp,Message"); }
+
+    /** One ConvertToCSV row (no line terminator). CategoryName is the raw category of Record.CategoryId. */
+    static FString FormatCSVRow(const FDebugLogRecord& Record, const FString& CategoryName);
+
+    // FRunnable interface ---------------------------------------------------------
+    virtual uint32 Run() override;
+    virtual void Stop() override;
+
+private:
+    struct alignas(64) FSlot
+    {
+        std::atomic<uint64> Sequence{ 0 };
+        double Timestamp = 0.0;
+        int32 TurnId = INDEX_NONE;
+        uint32 CategoryId = 0;
+        uint8 Kind = 0;
+        uint8 Verbosity = 0;
+        uint16 MessageBytes = 0;
+        UTF8CHAR Message[MaxMessageBytes];
+    };
+
+    bool TryEnqueue(EDebugLogRecordKind Kind, uint32 CategoryId, ELogVerbosity::Type Verbosity, const TCHAR* Message);
+
+    // Writer side (writer thread, or the caller when there is no thread)
+    int32 Drain();
+    void WriteRecord(const FSlot& Slot);
+    void OpenSession(const FString& SessionTimestamp);
+    bool OpenFile();
+    void FlushBuffer();
+    void CloseFile();
+
+    TUniquePtr<FSlot[]> Slots;
+    uint64 Capacity = 0;
+    uint64 IndexMask = 0;
+    uint64 WakeMask = 0;
+
+    alignas(64) std::atomic<uint64> EnqueuePos{ 0 };
+    alignas(64) std::atomic<uint64> WrittenPos{ 0 };
+    uint64 DequeuePos = 0;
+
+    std::atomic<int32> TurnId{ INDEX_NONE };
+    std::atomic<bool> bSessionOpen{ false };
+    std::atomic<bool> bStopping{ false };
+    std::atomic<uint64> RecordCount{ 0 };
+    std::atomic<uint64> DroppedCount{ 0 };
+
+    FEvent* WakeEvent = nullptr;
+    FRunnableThread* Thread = nullptr;
+
+    // Writer state
+    TUniquePtr<IFileHandle> File;
+    TArray<uint8> WriteBuffer;
+    TSet<uint32> DefinedCategories;
+    TArray<FString> SessionFiles;
+    FString SessionBase;
+    int32 FileIndex = 0;
+    int64 FileBytes = 0;
+};
@@ -1,5 +1,6 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
+// CodeRevision: INC-2025-1228-R1 (Lock-free binary log sink with a background writer and on-demand CSV) (2025-12-22 10:00)
 // CodeRevision: INC-2025-1120-R9 (Switched to timestamp-based session filenames) (2025-11-20 00:00)
 // CodeRevision: INC-2025-1120-R8 (Fix const-correctness compiler error in GetLogCount) (2025-11-20 00:00)
 // CodeRevision: INC-2025-1120-R7 (Add thread-safety locks to prevent crash in logging) (2025-11-20 00:00)
@@ -15,11 +16,10 @@
 #include "HAL/PlatformFilemanager.h"
 #include "Misc/OutputDeviceRedirector.h"
 #include "Misc/DateTime.h"
+#include "Logging/LogVerbosity.h"
 
 DEFINE_LOG_CATEGORY(LogDebugObserver);
 
-// ★★★ セッションIDの静的カウンター ★★★
-
 UDebugObserverCSV::UDebugObserverCSV()
 {
     PrimaryComponentTick.bCanEverTick = false;
@@ -34,11 +34,24 @@ UDebugObserverCSV::~UDebugObserverCSV()
         GLog->RemoveOutputDevice(this);
         bIsCapturingLogs = false;
     }
+
+    // Writer thread drains and closes the files
+    Sink.Reset();
+}
+
+void UDebugObserverCSV::EnsureSink()
+{
+    if (!Sink)
+    {
+        Sink = MakeUnique<FDebugLogSink>();
+    }
 }
 
 void UDebugObserverCSV::BeginPlay()
 {
     Super::BeginPlay();
+
+    EnsureSink();
     
     // ★★★ ログキャプチャを開始 ★★★
     if (GLog && !bIsCapturingLogs)
@@ -56,6 +69,12 @@ void UDebugObserverCSV::EndPlay(const EEndPlayReason::Type EndPlayReason)
         GLog->RemoveOutputDevice(this);
         bIsCapturingLogs = false;
     }
+
+    if (Sink)
+    {
+        Sink->EndSession();
+        Sink.Reset();
+    }
     
     Super::EndPlay(EndPlayReason);
 }
@@ -63,88 +82,79 @@ void UDebugObserverCSV::EndPlay(const EEndPlayReason::Type EndPlayReason)
 void UDebugObserverCSV::Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const FName& Category)
 {
     // The filter has been removed. All UE_LOG messages are now processed.
-
-    // Category nameから"Log"プレフィックスを除去
-    FString CategoryName = Category.ToString();
-    if (CategoryName.StartsWith(TEXT("Log")))
+    // Hot path: no string building here; the "Log" prefix is stripped when rendering CSV
+    if (FDebugLogSink* LogSink = Sink.Get())
     {
-        CategoryName = CategoryName.Mid(3); // "Log"を除去
+        LogSink->Push(EDebugLogRecordKind::Log, Category, Verbosity, V);
     }
-    
-    // Verbosity levelを文字列に変換
-    const TCHAR* VerbosityString = ToString(Verbosity);
-
-    // CSVに追加
-    LogMessageWithLevel(CategoryName, FString(V), FString(VerbosityString));
 }
 
 void UDebugObserverCSV::OnPhaseStarted_Implementation(FGameplayTag PhaseTag, const TArray<AActor*>& Actors)
 {
-    FScopeLock Lock(&LogLinesCS);
-    LogLines.Add(FString::Printf(TEXT("PhaseStart,%d,%s,%d,%.6f"),
-        LoggingTurnID,
-        *PhaseTag.ToString(),
-        Actors.Num(),
-        FPlatformTime::Seconds()));
+    if (Sink && Sink->IsSessionOpen())
+    {
+        Sink->Push(EDebugLogRecordKind::PhaseStart, PhaseTag.GetTagName(), ELogVerbosity::Log,
+            *FString::Printf(TEXT("Actors=%d"), Actors.Num()));
+    }
 }
 
 void UDebugObserverCSV::OnPhaseCompleted_Implementation(FGameplayTag PhaseTag, float DurationSeconds)
 {
-    FScopeLock Lock(&LogLinesCS);
-    LogLines.Add(FString::Printf(TEXT("PhaseEnd,%d,%s,%.3f"),
-        LoggingTurnID,
-        *PhaseTag.ToString(),
-        DurationSeconds * 1000.0f));
+    if (Sink && Sink->IsSessionOpen())
+    {
+        Sink->Push(EDebugLogRecordKind::PhaseEnd, PhaseTag.GetTagName(), ELogVerbosity::Log,
+            *FString::Printf(TEXT("%.3f"), DurationSeconds * 1000.0f));
+    }
 }
 
 void UDebugObserverCSV::OnIntentGenerated_Implementation(AActor* Enemy, const FEnemyIntent& Intent)
 {
-    FScopeLock Lock(&LogLinesCS);
-    const FString EnemyName = Enemy ? Enemy->GetName() : TEXT("None");
-    LogLines.Add(FString::Printf(TEXT("Intent,%d,%s,%s,%s"),
-        LoggingTurnID,
-        *EnemyName,
-        *Intent.AbilityTag.ToString(),
-        *Intent.NextCell.ToString()));
+    if (Sink && Sink->IsSessionOpen())
+    {
+        const FString EnemyName = Enemy ? Enemy->GetName() : TEXT("None");
+        Sink->Push(EDebugLogRecordKind::Intent, Intent.AbilityTag.GetTagName(), ELogVerbosity::Log,
+            *FString::Printf(TEXT("Enemy=%s Cell=%s"), *EnemyName, *Intent.NextCell.ToString()));
+    }
 }
 
 bool UDebugObserverCSV::SaveToFile(const FString& Filename)
 {
-    const FString ProjectSavedDir = FPaths::ProjectSavedDir();
-    const FString Directory = ProjectSavedDir / TEXT("TurnLogs");
+    const FString Directory = FDebugLogSink::GetLogDirectory();
     IFileManager::Get().MakeDirectory(*Directory, /*Tree*/true);
 
     const FString FilePath = Directory / Filename;
     
     UE_LOG(LogDebugObserver, Log, TEXT("[DebugObserverCSV] Saving CSV to: %s"), *FilePath);
-    
-    TArray<FString> LinesWithHeader;
-    LinesWithHeader.Add(TEXT("Type,TurnID,Category,Timestamp,Message"));
-    
+
+    if (Sink && !Sink->Flush())
     {
-        FScopeLock Lock(&LogLinesCS);
-        LinesWithHeader.Append(LogLines);
+        UE_LOG(LogDebugObserver, Warning, TEXT("[DebugObserverCSV] Flush timed out; CSV may miss the newest records"));
     }
-    
-    if (!FFileHelper::SaveStringArrayToFile(LinesWithHeader, *FilePath))
+
+    int32 Rows = 0;
+    const TArray<FString> BinaryFiles = FDebugLogSink::FindSessionFiles(SessionTimestamp);
+    if (SessionTimestamp.IsEmpty() || !FDebugLogSink::ConvertToCSV(BinaryFiles, FilePath, &Rows))
     {
         UE_LOG(LogDebugObserver, Warning, TEXT("[DebugObserverCSV] Failed to save log: %s"), *FilePath);
         return false;
     }
 
-    UE_LOG(LogDebugObserver, Log, TEXT("[DebugObserverCSV] Successfully saved CSV: %s"), *FilePath);
+    UE_LOG(LogDebugObserver, Log, TEXT("[DebugObserverCSV] Successfully saved CSV: %s (%d rows from %d file(s), %llu dropped)"),
+        *FilePath, Rows, BinaryFiles.Num(), Sink ? Sink->GetDroppedCount() : 0ull);
     return true;
 }
 
 void UDebugObserverCSV::ClearLogs()
 {
-    LogLines.Reset();
+    if (Sink && Sink->IsSessionOpen())
+    {
+        Sink->BeginSession(SessionTimestamp);
+    }
 }
 
 int32 UDebugObserverCSV::GetLogCount() const
 {
-    FScopeLock Lock(&LogLinesCS);
-    return LogLines.Num();
+    return Sink ? static_cast<int32>(FMath::Min<uint64>(Sink->GetRecordCount(), MAX_int32)) : 0;
 }
 
 FString UDebugObserverCSV::GetSessionTimestamp() const
@@ -160,42 +170,29 @@ void UDebugObserverCSV::LogMessage(const FString& Category, const FString& Messa
 
 void UDebugObserverCSV::LogMessageWithLevel(const FString& Category, const FString& Message, const FString& InLogLevel)
 {
-    FScopeLock Lock(&LogLinesCS);
-
-    FString EscapedMessage = Message;
-    EscapedMessage.ReplaceInline(TEXT("\""), TEXT("\"\""));
-    if (EscapedMessage.Contains(TEXT(",")) || EscapedMessage.Contains(TEXT("\"")) || EscapedMessage.Contains(TEXT("\n")))
+    if (Sink && Sink->IsSessionOpen())
     {
-        EscapedMessage = FString::Printf(TEXT("\"%s\""), *EscapedMessage);
+        Sink->Push(EDebugLogRecordKind::Log, FName(*Category), ParseLogVerbosityFromString(InLogLevel), *Message);
     }
-
-    LogLines.Add(FString::Printf(TEXT("%s,%d,%s,%.6f,%s"),
-        *InLogLevel,
-        LoggingTurnID,
-        *Category,
-        FPlatformTime::Seconds(),
-        *EscapedMessage));
 }
 
 void UDebugObserverCSV::SetCurrentTurnForLogging(int32 TurnID)
 {
-    LoggingTurnID = TurnID;
+    if (Sink)
+    {
+        Sink->SetTurnId(TurnID);
+    }
 }
 
 void UDebugObserverCSV::MarkSessionStart()
 {
-    FScopeLock Lock(&LogLinesCS);
-    ClearLogs();
+    EnsureSink();
 
     SessionTimestamp = FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S"));
-    LoggingTurnID = 0; // Reset turn number at session start
+    Sink->SetTurnId(0); // Reset turn number at session start
+    Sink->BeginSession(SessionTimestamp);
     const double Timestamp = FPlatformTime::Seconds();
 
-    LogLines.Add(FString::Printf(TEXT("SessionStart,%d,Session,%.6f,=== SESSION %s STARTED ==="),
-        LoggingTurnID,
-        Timestamp,
-        *SessionTimestamp));
-
     UE_LOG(LogDebugObserver, Log, TEXT("[CSV] Session %s started at %.6f (logs cleared)"), *SessionTimestamp, Timestamp);
 }
 
@@ -207,14 +204,11 @@ void UDebugObserverCSV::MarkSessionEnd()
         return;
     }
     
-    FScopeLock Lock(&LogLinesCS);
     const double Timestamp = FPlatformTime::Seconds();
-    
-    LogLines.Add(FString::Printf(TEXT("SessionEnd,%d,Session,%.6f,=== SESSION %s ENDED ==="),
-        LoggingTurnID,
-        Timestamp,
-        *SessionTimestamp));
-    
     UE_LOG(LogDebugObserver, Log, TEXT("[CSV] Session %s ended at %.6f"), *SessionTimestamp, Timestamp);
-}
 
+    if (Sink)
+    {
+        Sink->EndSession();
+    }
+}
@@ -7,13 +7,14 @@
 #include "Debug/DebugObserverInterface.h"
 #include "Misc/OutputDevice.h"
 #include "Logging/StructuredLog.h"
-#include "HAL/CriticalSection.h"
 #include "Misc/DateTime.h"
+#include "Debug/DebugLogSink.h"
 #include "DebugObserverCSV.generated.h"
 
 // Log category
 DECLARE_LOG_CATEGORY_EXTERN(LogDebugObserver, Log, All);
 
+// CodeRevision: INC-2025-1228-R1 (Lock-free binary log sink with a background writer and on-demand CSV) (2025-12-22 10:00)
 // CodeRevision: INC-2025-1120-R9 (Switched to timestamp-based session filenames) (2025-11-20 00:00)
 // CodeRevision: INC-2025-1120-R8 (Fix const-correctness compiler error in GetLogCount) (2025-11-20 00:00)
 // CodeRevision: INC-2025-1120-R7 (Add thread-safety locks to prevent crash in logging) (2025-11-20 00:00)
@@ -23,6 +24,9 @@ DECLARE_LOG_CATEGORY_EXTERN(LogDebugObserver, Log, All);
 /**
  * Simple CSV logger for turn-system debug information.
  * Can be swapped out in Blueprints by implementing IDebugObserver elsewhere.
+ *
+ * Records go through an FDebugLogSink (lock-free ring + writer thread) into rotating binary files
+ * under Saved/TurnLogs; SaveToFile renders the session as CSV on demand.
  */
 UCLASS(ClassGroup = (Turn), meta = (BlueprintSpawnableComponent))
 class LYRAGAME_API UDebugObserverCSV : public UActorComponent, public IDebugObserver, public FOutputDevice
@@ -39,6 +43,8 @@ public:
 
     // FOutputDevice interface ---------------------------------------------------
     virtual void Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const FName& Category) override;
+    virtual bool CanBeUsedOnAnyThread() const override { return true; }
+    virtual bool CanBeUsedOnMultipleThreads() const override { return true; }
 
     // IDebugObserver interface ------------------------------------------------
     virtual void OnPhaseStarted_Implementation(FGameplayTag PhaseTag, const TArray<AActor*>& Actors) override;
@@ -46,9 +52,11 @@ public:
     virtual void OnIntentGenerated_Implementation(AActor* Enemy, const FEnemyIntent& Intent) override;
 
     // CSV export --------------------------------------------------------------
+    /** Flushes the sink and renders this session's binary logs to Saved/TurnLogs/<Filename>. */
     UFUNCTION(BlueprintCallable, Category = "Turn|Debug")
     bool SaveToFile(const FString& Filename);
 
+    /** Restarts the current session's files. */
     UFUNCTION(BlueprintCallable, Category = "Turn|Debug")
     void ClearLogs();
 
@@ -76,15 +84,13 @@ public:
     void SetCurrentTurnForLogging(int32 TurnID);
 
 private:
-    /** Thread-safe access to LogLines */
-    mutable FCriticalSection LogLinesCS;
+    void EnsureSink();
 
-    UPROPERTY()
-    TArray<FString> LogLines;
+    /** Lock-free record sink; created on BeginPlay / session start (never on the CDO) */
+    TUniquePtr<FDebugLogSink> Sink;
     
     // ★★★ セッション管理 ★★★
     FString SessionTimestamp;
-    int32 LoggingTurnID = -1; // Current turn number for logging
     
     // ★★★ ログキャプチャ用 ★★★
     bool bIsCapturingLogs = false;
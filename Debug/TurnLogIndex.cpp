@@ -0,0 +1,393 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+// CodeRevision: INC-2025-1232-R1 (On-disk index of binary turn logs: by turn, actor, category and phase) (2025-12-24 10:00)
+#include "Debug/TurnLogIndex.h"
+#include "Debug/DebugLogSink.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Unique.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace TurnLogIndexPrivate
+{
+    struct FActorKey
+    {
+        const char* Text;
+        int32 Len;
+    };
+
+    static const FActorKey ActorKeys[] =
+    {
+        { "actor=", 6 },
+        { "Actor=", 6 },
+        { "Enemy=", 6 },
+    };
+
+    static bool IsActorTerminator(UTF8CHAR Char)
+    {
+        return Char == ' ' || Char == ',' || Char == ')' || Char == ']' || Char == '\t' || Char == '\n' || Char == '\r';
+    }
+
+    /** Calls Visit(Start, Len) for every actor token value in a UTF-8 message. */
+    template <typename FunctorType>
+    static void ForEachActorToken(const UTF8CHAR* Message, int32 MessageBytes, FunctorType&& Visit)
+    {
+        const char* Bytes = reinterpret_cast<const char*>(Message);
+        for (const FActorKey& Key : ActorKeys)
+        {
+            for (int32 Pos = 0; Pos + Key.Len < MessageBytes; ++Pos)
+            {
+                if (Bytes[Pos] != Key.Text[0] || FMemory::Memcmp(Bytes + Pos, Key.Text, Key.Len) != 0)
+                {
+                    continue;
+                }
+
+                // Only whole keys ("actor=" but not "reactor=")
+                if (Pos > 0 && FChar::IsAlnum(static_cast<TCHAR>(static_cast<uint8>(Bytes[Pos - 1]))))
+                {
+                    continue;
+                }
+
+                const int32 Start = Pos + Key.Len;
+                int32 End = Start;
+                while (End < MessageBytes && !IsActorTerminator(Message[End]))
+                {
+                    ++End;
+                }
+                if (End > Start)
+                {
+                    Visit(Message + Start, End - Start);
+                }
+                Pos = End;
+            }
+        }
+    }
+
+    /** Slot of Name in Names / Postings, added on first use. */
+    static int32 FindOrAddSlot(TMap<FString, int32>& Slots, TArray<FString>& Names, TArray<TArray<uint32>>& Postings, FString&& Name)
+    {
+        if (const int32* Found = Slots.Find(Name))
+        {
+            return *Found;
+        }
+        const int32 Slot = Names.Add(Name);
+        Postings.AddDefaulted();
+        Slots.Add(MoveTemp(Name), Slot);
+        return Slot;
+    }
+
+    static void AddPosting(TArray<uint32>& Postings, uint32 RecordIndex)
+    {
+        if (Postings.Num() == 0 || Postings.Last() != RecordIndex)
+        {
+            Postings.Add(RecordIndex);
+        }
+    }
+
+    /** Sorted union of the posting lists whose name matches Pattern. */
+    static TArray<uint32> CollectMatching(const TArray<FString>& Names, const TArray<TArray<uint32>>& Postings, const FString& Pattern, bool bAllowLogPrefix)
+    {
+        TArray<uint32> Result;
+        for (int32 Slot = 0; Slot < Names.Num(); ++Slot)
+        {
+            const FString& Name = Names[Slot];
+            bool bMatch = Name.MatchesWildcard(Pattern);
+            if (!bMatch && bAllowLogPrefix && Name.StartsWith(TEXT("Log"), ESearchCase::CaseSensitive))
+            {
+                bMatch = Name.RightChop(3).MatchesWildcard(Pattern);
+            }
+            if (bMatch)
+            {
+                Result.Append(Postings[Slot]);
+            }
+        }
+        Result.Sort();
+        Result.SetNum(Algo::Unique(Result));
+        return Result;
+    }
+
+    /** In-place intersection of two ascending lists. */
+    static void Intersect(TArray<uint32>& InOut, const TArray<uint32>& Other)
+    {
+        int32 Write = 0;
+        int32 OtherIndex = 0;
+        for (int32 Read = 0; Read < InOut.Num() && OtherIndex < Other.Num(); ++Read)
+        {
+            while (OtherIndex < Other.Num() && Other[OtherIndex] < InOut[Read])
+            {
+                ++OtherIndex;
+            }
+            if (OtherIndex < Other.Num() && Other[OtherIndex] == InOut[Read])
+            {
+                InOut[Write++] = InOut[Read];
+            }
+        }
+        InOut.SetNum(Write);
+    }
+}
+
+//------------------------------------------------------------------------------
+// FMappedTurnLog
+//------------------------------------------------------------------------------
+
+FMappedTurnLog::FMappedTurnLog() = default;
+
+FMappedTurnLog::~FMappedTurnLog()
+{
+    Region.Reset();
+    Handle.Reset();
+}
+
+bool FMappedTurnLog::Open(const FString& Path)
+{
+    Region.Reset();
+    Handle.Reset();
+    Loaded.Empty();
+    Bytes = TConstArrayView64<uint8>();
+
+    Handle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*Path));
+    if (Handle && Handle->GetFileSize() > 0)
+    {
+        Region.Reset(Handle->MapRegion());
+    }
+
+    if (Region)
+    {
+        Bytes = TConstArrayView64<uint8>(Region->GetMappedPtr(), Region->GetMappedSize());
+        return true;
+    }
+
+    // No mapping support (or an empty file): files are bounded by ts.Log.SinkMaxFileMB
+    Handle.Reset();
+    if (!FFileHelper::LoadFileToArray(Loaded, *Path))
+    {
+        return false;
+    }
+    Bytes = Loaded;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Build
+//------------------------------------------------------------------------------
+
+bool FTurnLogIndex::Build(TConstArrayView64<uint8> LogBytes)
+{
+    using namespace TurnLogIndexPrivate;
+
+    *this = FTurnLogIndex();
+
+    FDebugLogReader Reader(LogBytes);
+    if (!Reader.IsValid())
+    {
+        return false;
+    }
+    SourceBytes = LogBytes.Num();
+
+    TMap<int32, TArray<uint32>> TurnPostings;
+    TMap<FString, int32> ActorSlots;
+    TMap<FString, int32> PhaseSlots;
+    TMap<uint32, int32> CategorySlotById;
+    TMap<FString, int32> CategorySlots;
+    int32 OpenPhase = INDEX_NONE;
+
+    FDebugLogRecord Record;
+    while (Reader.Next(Record))
+    {
+        const uint32 RecordIndex = static_cast<uint32>(Offsets.Add(Record.Offset));
+
+        TurnPostings.FindOrAdd(Record.TurnId).Add(RecordIndex);
+
+        // Category (ids are per file; names are resolved once per id)
+        const bool bHasCategory = Record.Kind != EDebugLogRecordKind::SessionStart && Record.Kind != EDebugLogRecordKind::SessionEnd;
+        if (bHasCategory)
+        {
+            int32* CategorySlot = CategorySlotById.Find(Record.CategoryId);
+            if (!CategorySlot)
+            {
+                FString Name = Reader.GetCategoryName(Record.CategoryId);
+                CategorySlot = &CategorySlotById.Add(Record.CategoryId, FindOrAddSlot(CategorySlots, Categories, ByCategory, MoveTemp(Name)));
+            }
+            ByCategory[*CategorySlot].Add(RecordIndex);
+        }
+
+        // Phase bracket
+        int32 PhaseSlot = OpenPhase;
+        if (Record.Kind == EDebugLogRecordKind::PhaseStart || Record.Kind == EDebugLogRecordKind::PhaseEnd)
+        {
+            PhaseSlot = FindOrAddSlot(PhaseSlots, Phases, ByPhase, FString(Reader.GetCategoryName(Record.CategoryId)));
+            if (Record.Kind == EDebugLogRecordKind::PhaseStart)
+            {
+                OpenPhase = PhaseSlot;
+            }
+            else if (OpenPhase == PhaseSlot)
+            {
+                OpenPhase = INDEX_NONE;
+            }
+        }
+        else if (Record.Kind == EDebugLogRecordKind::SessionStart)
+        {
+            OpenPhase = INDEX_NONE;
+            PhaseSlot = INDEX_NONE;
+        }
+        if (PhaseSlot != INDEX_NONE)
+        {
+            ByPhase[PhaseSlot].Add(RecordIndex);
+        }
+
+        // Actors named in the message (a record may name several)
+        ForEachActorToken(Record.Message, Record.MessageBytes, [this, &ActorSlots, RecordIndex](const UTF8CHAR* Start, int32 Len)
+        {
+            const FUTF8ToTCHAR Converted(Start, Len);
+            FString Name(Converted.Length(), Converted.Get());
+            if (Name != TEXT("None"))
+            {
+                AddPosting(ByActor[FindOrAddSlot(ActorSlots, Actors, ByActor, MoveTemp(Name))], RecordIndex);
+            }
+        });
+    }
+
+    TurnPostings.KeySort(TLess<int32>());
+    Turns.Reserve(TurnPostings.Num());
+    ByTurn.Reserve(TurnPostings.Num());
+    for (TPair<int32, TArray<uint32>>& Pair : TurnPostings)
+    {
+        Turns.Add(Pair.Key);
+        ByTurn.Add(MoveTemp(Pair.Value));
+    }
+
+    CategoryNames = Reader.GetCategoryNames();
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Query
+//------------------------------------------------------------------------------
+
+TArray<int64> FTurnLogIndex::Query(const FTurnLogQuery& Query) const
+{
+    using namespace TurnLogIndexPrivate;
+
+    TArray<uint32> Matches;
+    bool bFiltered = false;
+    auto Narrow = [&Matches, &bFiltered](TArray<uint32>&& Candidates)
+    {
+        if (!bFiltered)
+        {
+            Matches = MoveTemp(Candidates);
+            bFiltered = true;
+        }
+        else
+        {
+            Intersect(Matches, Candidates);
+        }
+    };
+
+    if (Query.MinTurn != MIN_int32 || Query.MaxTurn != MAX_int32)
+    {
+        TArray<uint32> InRange;
+        for (int32 Slot = Algo::LowerBound(Turns, Query.MinTurn); Slot < Turns.Num() && Turns[Slot] <= Query.MaxTurn; ++Slot)
+        {
+            InRange.Append(ByTurn[Slot]);
+        }
+        InRange.Sort();
+        Narrow(MoveTemp(InRange));
+    }
+    if (!Query.Actor.IsEmpty())
+    {
+        Narrow(CollectMatching(Actors, ByActor, Query.Actor, false));
+    }
+    if (!Query.Category.IsEmpty())
+    {
+        Narrow(CollectMatching(Categories, ByCategory, Query.Category, true));
+    }
+    if (!Query.Phase.IsEmpty())
+    {
+        Narrow(CollectMatching(Phases, ByPhase, Query.Phase, false));
+    }
+
+    const int32 NumMatches = bFiltered ? Matches.Num() : Offsets.Num();
+    const int32 NumResults = Query.Limit > 0 ? FMath::Min(Query.Limit, NumMatches) : NumMatches;
+
+    TArray<int64> Result;
+    Result.Reserve(NumResults);
+    for (int32 i = 0; i < NumResults; ++i)
+    {
+        Result.Add(Offsets[bFiltered ? Matches[i] : i]);
+    }
+    return Result;
+}
+
+const FString& FTurnLogIndex::GetCategoryName(uint32 CategoryId) const
+{
+    static const FString Empty;
+    const FString* Found = CategoryNames.Find(CategoryId);
+    return Found ? *Found : Empty;
+}
+
+//------------------------------------------------------------------------------
+// Persistence
+//------------------------------------------------------------------------------
+
+FString FTurnLogIndex::GetIndexPath(const FString& LogPath)
+{
+    return FPaths::ChangeExtension(LogPath, TEXT("tlidx"));
+}
+
+bool FTurnLogIndex::Serialize(FArchive& Ar)
+{
+    uint32 Magic = FileMagic;
+    uint16 Version = FileVersion;
+    Ar << Magic;
+    Ar << Version;
+    if (Ar.IsError() || Magic != FileMagic || Version != FileVersion)
+    {
+        return false;
+    }
+
+    Ar << SourceBytes;
+    Ar << Offsets;
+    Ar << Turns;
+    Ar << ByTurn;
+    Ar << Actors;
+    Ar << ByActor;
+    Ar << Categories;
+    Ar << ByCategory;
+    Ar << Phases;
+    Ar << ByPhase;
+    Ar << CategoryNames;
+    return !Ar.IsError();
+}
+
+bool FTurnLogIndex::Save(const FString& Path) const
+{
+    TUniquePtr<FArchive> Ar(IFileManager::Get().CreateFileWriter(*Path));
+    if (!Ar)
+    {
+        return false;
+    }
+
+    const bool bWritten = const_cast<FTurnLogIndex*>(this)->Serialize(*Ar);
+    return Ar->Close() && bWritten;
+}
+
+bool FTurnLogIndex::Load(const FString& Path)
+{
+    TUniquePtr<FArchive> Ar(IFileManager::Get().CreateFileReader(*Path));
+    if (!Ar)
+    {
+        return false;
+    }
+
+    FTurnLogIndex Loaded;
+    if (!Loaded.Serialize(*Ar) || Loaded.ByTurn.Num() != Loaded.Turns.Num())
+    {
+        return false;
+    }
+
+    *this = MoveTemp(Loaded);
+    return true;
+}
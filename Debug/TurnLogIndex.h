@@ -0,0 +1,114 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+// CodeRevision: INC-2025-1232-R1 (On-disk index of binary turn logs: by turn, actor, category and phase) (2025-12-24 10:00)
+#include "CoreMinimal.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/** Read-only bytes of one .tlog: memory mapped when the platform supports it, loaded otherwise. */
+class LYRAGAME_API FMappedTurnLog
+{
+public:
+    FMappedTurnLog();
+    ~FMappedTurnLog();
+
+    bool Open(const FString& Path);
+
+    TConstArrayView64<uint8> GetBytes() const { return Bytes; }
+    bool IsMapped() const { return Region.IsValid(); }
+
+private:
+    // Declared before Region so the region is unmapped first
+    TUniquePtr<IMappedFileHandle> Handle;
+    TUniquePtr<IMappedFileRegion> Region;
+    TArray64<uint8> Loaded;
+    TConstArrayView64<uint8> Bytes;
+};
+
+/** Filters of one index query. Unset filters match everything; string filters accept wildcards (*, ?). */
+struct LYRAGAME_API FTurnLogQuery
+{
+    int32 MinTurn = MIN_int32;
+    int32 MaxTurn = MAX_int32;
+
+    // Actor name as written in the message ("actor=", "Actor=", "Enemy=")
+    FString Actor;
+
+    // Log category with or without the "Log" prefix ("TurnCore" matches LogTurnCore)
+    FString Category;
+
+    // Phase tag of the enclosing PhaseStart / PhaseEnd bracket
+    FString Phase;
+
+    // Maximum records returned (0 = all)
+    int32 Limit = 0;
+};
+
+/**
+ * FTurnLogIndex: posting lists over the records of one .tlog (FDebugLogSink output).
+ *
+ * Build makes a single sequential pass with FDebugLogReader and stores, per turn id, actor,
+ * category and phase, the sorted indices of the matching records plus each record's file offset.
+ * Queries intersect the posting lists and return offsets, so only the matching records are
+ * decoded (FDebugLogReader::Seek) from the mapped log. Saved next to the log as <Name>.tlidx.
+ *
+ * Actors are taken from "actor=" (ROGUE_DIAG_EVENT), "Actor=" and "Enemy=" (intents) tokens.
+ * A record belongs to the phase of the last PhaseStart not yet closed by its PhaseEnd; phase
+ * records themselves belong to their own tag.
+ */
+class LYRAGAME_API FTurnLogIndex
+{
+public:
+    static constexpr uint32 FileMagic = 0x58494C54; // "TLIX"
+    static constexpr uint16 FileVersion = 1;
+
+    /** False when LogBytes is not a .tlog. */
+    bool Build(TConstArrayView64<uint8> LogBytes);
+
+    bool Save(const FString& Path) const;
+
+    /** False on a missing, foreign or older-version file. */
+    bool Load(const FString& Path);
+
+    /** Offsets of the matching records, in file order. */
+    TArray<int64> Query(const FTurnLogQuery& Query) const;
+
+    /** Size of the log the index was built from (logs only grow, so a mismatch means stale). */
+    int64 GetSourceBytes() const { return SourceBytes; }
+    int32 GetNumRecords() const { return Offsets.Num(); }
+    const TArray<int32>& GetTurns() const { return Turns; }
+    const TArray<FString>& GetActors() const { return Actors; }
+    const TArray<FString>& GetCategories() const { return Categories; }
+    const TArray<FString>& GetPhases() const { return Phases; }
+
+    /** Name of a FDebugLogRecord::CategoryId of the source log (records read after a Seek). */
+    const FString& GetCategoryName(uint32 CategoryId) const;
+
+    static FString GetIndexPath(const FString& LogPath);
+
+private:
+    bool Serialize(FArchive& Ar);
+
+    int64 SourceBytes = 0;
+
+    // Record index -> byte offset in the log
+    TArray<int64> Offsets;
+
+    // Ascending turn ids; ByTurn[i] lists the records of Turns[i]
+    TArray<int32> Turns;
+    TArray<TArray<uint32>> ByTurn;
+
+    TArray<FString> Actors;
+    TArray<TArray<uint32>> ByActor;
+
+    TArray<FString> Categories;
+    TArray<TArray<uint32>> ByCategory;
+
+    TArray<FString> Phases;
+    TArray<TArray<uint32>> ByPhase;
+
+    TMap<uint32, FString> CategoryNames;
+};
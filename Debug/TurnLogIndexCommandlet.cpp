@@ -0,0 +1,221 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+// CodeRevision: INC-2025-1232-R1 (On-disk index of binary turn logs: by turn, actor, category and phase) (2025-12-24 10:00)
+#include "Debug/TurnLogIndexCommandlet.h"
+#include "Debug/TurnLogIndex.h"
+#include "Debug/DebugLogSink.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY(LogTurnLogIndex);
+
+namespace TurnLogIndexCommandletPrivate
+{
+    static constexpr int32 DefaultLoggedRows = 200;
+
+    /** "40-45" or "40". */
+    static bool ParseTurnRange(const FString& Text, int32& OutMin, int32& OutMax)
+    {
+        FString Left;
+        FString Right;
+        if (Text.Split(TEXT("-"), &Left, &Right) && !Left.IsEmpty())
+        {
+            if (!Left.IsNumeric() || !Right.IsNumeric())
+            {
+                return false;
+            }
+            OutMin = FCString::Atoi(*Left);
+            OutMax = FCString::Atoi(*Right);
+            return OutMin <= OutMax;
+        }
+        if (!Text.IsNumeric())
+        {
+            return false;
+        }
+        OutMin = OutMax = FCString::Atoi(*Text);
+        return true;
+    }
+
+    /** Index of LogPath, loaded when up to date, otherwise built from Bytes and saved. */
+    static bool LoadOrBuildIndex(const FString& LogPath, TConstArrayView64<uint8> Bytes, bool bRebuild, FTurnLogIndex& OutIndex, bool& bOutBuilt)
+    {
+        const FString IndexPath = FTurnLogIndex::GetIndexPath(LogPath);
+        bOutBuilt = false;
+        if (!bRebuild && OutIndex.Load(IndexPath) && OutIndex.GetSourceBytes() == Bytes.Num())
+        {
+            return true;
+        }
+
+        if (!OutIndex.Build(Bytes))
+        {
+            return false;
+        }
+        bOutBuilt = true;
+
+        if (!OutIndex.Save(IndexPath))
+        {
+            UE_LOG(LogTurnLogIndex, Warning, TEXT("[TurnLogIndex] Could not write %s; the index is used in memory only"), *IndexPath);
+        }
+        return true;
+    }
+}
+
+UTurnLogIndexCommandlet::UTurnLogIndexCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = false;
+    LogToConsole = true;
+}
+
+int32 UTurnLogIndexCommandlet::Main(const FString& Params)
+{
+    using namespace TurnLogIndexCommandletPrivate;
+
+    // Inputs
+    TArray<FString> Files;
+    FString Session;
+    FString FileList;
+    if (FParse::Value(*Params, TEXT("Session="), Session))
+    {
+        Files = FDebugLogSink::FindSessionFiles(Session);
+    }
+    else if (FParse::Value(*Params, TEXT("Files="), FileList, false))
+    {
+        FileList.ParseIntoArray(Files, TEXT(","));
+    }
+
+    if (Files.Num() == 0)
+    {
+        UE_LOG(LogTurnLogIndex, Error, TEXT("[TurnLogIndex] No .tlog given (-Session=<Timestamp> under %s, or -Files=A.tlog,B.tlog)"),
+            *FDebugLogSink::GetLogDirectory());
+        return 1;
+    }
+
+    // Query
+    FTurnLogQuery Query;
+    FString Turns;
+    if (FParse::Value(*Params, TEXT("Turns="), Turns) && !ParseTurnRange(Turns, Query.MinTurn, Query.MaxTurn))
+    {
+        UE_LOG(LogTurnLogIndex, Error, TEXT("[TurnLogIndex] Bad -Turns='%s' (expected N or Min-Max)"), *Turns);
+        return 1;
+    }
+    FParse::Value(*Params, TEXT("Actor="), Query.Actor);
+    FParse::Value(*Params, TEXT("Category="), Query.Category);
+    FParse::Value(*Params, TEXT("Phase="), Query.Phase);
+    FParse::Value(*Params, TEXT("Limit="), Query.Limit);
+    const bool bRebuild = FParse::Param(*Params, TEXT("Rebuild"));
+
+    FString OutPath;
+    FParse::Value(*Params, TEXT("Out="), OutPath);
+
+    const bool bHasQuery = !Turns.IsEmpty() || !Query.Actor.IsEmpty() || !Query.Category.IsEmpty() || !Query.Phase.IsEmpty();
+    const int32 MaxRows = Query.Limit > 0 ? Query.Limit : (OutPath.IsEmpty() ? DefaultLoggedRows : MAX_int32);
+
+    TUniquePtr<FArchive> Out;
+    if (bHasQuery && !OutPath.IsEmpty())
+    {
+        Out.Reset(IFileManager::Get().CreateFileWriter(*OutPath));
+        if (!Out)
+        {
+            UE_LOG(LogTurnLogIndex, Error, TEXT("[TurnLogIndex] Could not open %s"), *OutPath);
+            return 1;
+        }
+        FString Header = FDebugLogSink::GetCSVHeader();
+        Header += LINE_TERMINATOR;
+        const FTCHARToUTF8 Converted(*Header, Header.Len());
+        Out->Serialize((void*)Converted.Get(), Converted.Length());
+    }
+
+    int32 TotalMatches = 0;
+    int32 Rows = 0;
+    double IndexSeconds = 0.0;
+    double QuerySeconds = 0.0;
+
+    for (const FString& Path : Files)
+    {
+        FMappedTurnLog Log;
+        if (!Log.Open(Path))
+        {
+            UE_LOG(LogTurnLogIndex, Warning, TEXT("[TurnLogIndex] Could not open %s"), *Path);
+            continue;
+        }
+
+        FTurnLogIndex Index;
+        bool bBuilt = false;
+        const double IndexStart = FPlatformTime::Seconds();
+        if (!LoadOrBuildIndex(Path, Log.GetBytes(), bRebuild, Index, bBuilt))
+        {
+            UE_LOG(LogTurnLogIndex, Warning, TEXT("[TurnLogIndex] %s is not a turn log"), *Path);
+            continue;
+        }
+        const double IndexMs = (FPlatformTime::Seconds() - IndexStart) * 1000.0;
+        IndexSeconds += IndexMs / 1000.0;
+
+        UE_LOG(LogTurnLogIndex, Display, TEXT("[TurnLogIndex] %s: %s index in %.1fms (%d records, %d turns [%d..%d], %d actors, %d categories, %d phases, %s)"),
+            *FPaths::GetCleanFilename(Path), bBuilt ? TEXT("built") : TEXT("loaded"), IndexMs, Index.GetNumRecords(),
+            Index.GetTurns().Num(), Index.GetTurns().Num() > 0 ? Index.GetTurns()[0] : 0, Index.GetTurns().Num() > 0 ? Index.GetTurns().Last() : 0,
+            Index.GetActors().Num(), Index.GetCategories().Num(), Index.GetPhases().Num(), Log.IsMapped() ? TEXT("mapped") : TEXT("loaded"));
+
+        if (!bHasQuery)
+        {
+            continue;
+        }
+
+        // Only the matching records are decoded
+        const double QueryStart = FPlatformTime::Seconds();
+        const TArray<int64> Offsets = Index.Query(Query);
+        TotalMatches += Offsets.Num();
+
+        FDebugLogReader Reader(Log.GetBytes());
+        FDebugLogRecord Record;
+        FString Chunk;
+        for (const int64 Offset : Offsets)
+        {
+            if (Rows >= MaxRows)
+            {
+                break;
+            }
+
+            Reader.Seek(Offset);
+            if (!Reader.Next(Record))
+            {
+                continue;
+            }
+
+            const FString Row = FDebugLogSink::FormatCSVRow(Record, Index.GetCategoryName(Record.CategoryId));
+            if (Out)
+            {
+                Chunk += Row;
+                Chunk += LINE_TERMINATOR;
+            }
+            else
+            {
+                UE_LOG(LogTurnLogIndex, Display, TEXT("%s"), *Row);
+            }
+            ++Rows;
+        }
+        QuerySeconds += FPlatformTime::Seconds() - QueryStart;
+
+        if (Out && Chunk.Len() > 0)
+        {
+            const FTCHARToUTF8 Converted(*Chunk, Chunk.Len());
+            Out->Serialize((void*)Converted.Get(), Converted.Length());
+        }
+    }
+
+    if (!bHasQuery)
+    {
+        UE_LOG(LogTurnLogIndex, Display, TEXT("[TurnLogIndex] %d file(s) indexed in %.2fs"), Files.Num(), IndexSeconds);
+        return 0;
+    }
+
+    const bool bWritten = !Out || Out->Close();
+    const FString Destination = Out ? FString::Printf(TEXT("written to %s"), *OutPath) : FString(TEXT("logged"));
+    UE_LOG(LogTurnLogIndex, Display, TEXT("[TurnLogIndex] %d match(es), %d row(s) %s in %.2fms (index %.2fms)%s"),
+        TotalMatches, Rows, *Destination,
+        QuerySeconds * 1000.0, IndexSeconds * 1000.0, Rows < TotalMatches ? TEXT(" - truncated, use -Limit or -Out") : TEXT(""));
+
+    return bWritten ? 0 : 1;
+}
@@ -0,0 +1,35 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+// CodeRevision: INC-2025-1232-R1 (On-disk index of binary turn logs: by turn, actor, category and phase) (2025-12-24 10:00)
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "TurnLogIndexCommandlet.generated.h"
+
+// Log category
+DECLARE_LOG_CATEGORY_EXTERN(LogTurnLogIndex, Log, All);
+
+/**
+ * UTurnLogIndexCommandlet: indexes binary turn logs (.tlog, see FDebugLogSink) and answers queries
+ * from the index without reading the whole log.
+ *
+ * Usage:
+ *   UnrealEditor-Cmd <Project> -run=TurnLogIndex (-Session=<Timestamp> | -Files=A.tlog,B.tlog) [-Rebuild]
+ *       [-Turns=40-45] [-Actor=BP_Enemy*] [-Category=TurnCore] [-Phase=Phase.Profile.Resolve]
+ *       [-Limit=N] [-Out=Result.csv]
+ *
+ * Each log gets a <Name>.tlidx next to it, rebuilt when missing, stale (the log grew) or with
+ * -Rebuild. Without filters only the indexes are refreshed and summarized. Matches are written
+ * as ts.Log.ExportCSV rows to -Out, or logged (first 200 unless -Limit) otherwise.
+ */
+UCLASS()
+class LYRAGAME_API UTurnLogIndexCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UTurnLogIndexCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
@@ -10,6 +10,11 @@ struct FDungeonResolvedParams;
 class URogueFloorConfigData;
 class UDungeonTemplateAsset;
 struct FRandomStream;
+struct FDungeonFloorGenRequest;
+struct FDungeonFloorGenResult;
+
+// CodeRevision: INC-2025-1225-R1 (Bulk and incremental instance building) (2025-12-20 14:00)
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnDungeonCellChanged, const FIntPoint& /*Cell*/);
 
 UENUM(BlueprintType)
 enum class ECellType : uint8
@@ -48,6 +53,41 @@ struct FIntRectLite
     }
 };
 
+// CodeRevision: INC-2025-1223-R1 (Single-pass union-find grid labelling) (2025-12-19 14:00)
+/**
+ * Connected components of a generated grid, from FDungeonGridBuilder::LabelGrid.
+ *
+ * Two layers, both 4-connected, ids assigned in scan order of each component's first cell:
+ * - Walkable: every non-Wall cell (reachability)
+ * - Room:     Room cells only (room count, room markers)
+ */
+struct LYRAGAME_API FDungeonGridLabels
+{
+    int32 Width = 0;
+    int32 Height = 0;
+
+    // Per cell (index = Y * Width + X), INDEX_NONE outside the layer
+    TArray<int32> WalkableIds;
+    TArray<int32> RoomIds;
+
+    // Per component
+    TArray<int32> WalkableSizes;
+    TArray<int32> RoomSizes;
+    TArray<FIntRectLite> RoomRects;
+
+    int32 WalkableCount = 0;
+
+    int32 NumRooms() const { return RoomSizes.Num(); }
+
+    /** Room component at (X, Y), or INDEX_NONE. */
+    int32 GetRoomId(int32 X, int32 Y) const
+    {
+        return (X >= 0 && Y >= 0 && X < Width && Y < Height && RoomIds.Num() == Width * Height) ? RoomIds[Y * Width + X] : INDEX_NONE;
+    }
+
+    void Reset() { *this = FDungeonGridLabels(); }
+};
+
 USTRUCT(BlueprintType)
 struct FDungeonGenParams
 {
@@ -103,12 +143,38 @@ public:
 
     void Generate(const URogueFloorConfigData* Config, FRandomStream& Rng);
 
+    // CodeRevision: INC-2025-1221-R1 (Grid generation as a pure function over a plain buffer) (2025-12-18 14:00)
+    /**
+     * Game-thread half of generation: pick the template and resolve params into a request that
+     * FDungeonGridBuilder::GenerateFloor can run on any thread. Returns false when the picked
+     * template is not a native preset (Blueprint templates must run through Generate).
+     */
+    static bool MakeGenRequest(const URogueFloorConfigData* Config, FRandomStream& Rng, FDungeonFloorGenRequest& OutRequest);
+
+    /** Commit a grid produced by FDungeonGridBuilder::GenerateFloor. */
+    void ApplyGenerationResult(FDungeonFloorGenResult&& Result);
+
+    /** Bounding rects of the Room clusters of the current grid (room markers). */
+    const TArray<FIntRectLite>& GetGeneratedRoomRects() const { return EnsureGridLabels().RoomRects; }
+
+    // CodeRevision: INC-2025-1223-R1 (Single-pass union-find grid labelling) (2025-12-19 14:00)
+    // CodeRevision: INC-2025-1221-R2 (Re-label lazily after terrain edits change walkability) (2025-12-27 19:00)
+    /** Component labels of the current grid (room ids, sizes, walkable components); rebuilt here after terrain edits. */
+    const FDungeonGridLabels& GetGridLabels() const { return EnsureGridLabels(); }
+
+    /** Room id at a cell, or INDEX_NONE outside rooms. */
+    UFUNCTION(BlueprintCallable, Category="Grid")
+    int32 GetRoomIdAt(int32 X, int32 Y) const { return EnsureGridLabels().GetRoomId(X, Y); }
+
     UFUNCTION(BlueprintCallable, Category="Grid")
     int32 ReturnGridStatus(FVector InputVector) const;
 
     UFUNCTION(BlueprintCallable, Category="Grid")
     void GridChangeVector(FVector InputVector, int32 Value);
 
+    /** Fired by GridChangeVector (gameplay terrain edits) when a cell value actually changes; marks the labels stale when walkability or room membership changes. */
+    FOnDungeonCellChanged OnCellChanged;
+
     UFUNCTION(BlueprintCallable, Category="Grid")
     bool IsInside(int32 X, int32 Y) const;
 
@@ -138,31 +204,13 @@ private:
     float LastGeneratedReachability = 0.0f;
     EMapTemplate LastUsedTemplate = EMapTemplate::NormalBSP;
 
-    FORCEINLINE bool InBounds(int32 X, int32 Y) const { return (X>=0 && Y>=0 && X<GridWidth && Y<GridHeight); }
-    FORCEINLINE int32 Index(int32 X, int32 Y) const { return Y*GridWidth + X; }
-
-    void ResetGrid(ECellType Fill=ECellType::Wall);
-    void EnsureOuterWall();
-
-    void CarveLineX(const FIntPoint& A, const FIntPoint& B, ECellType Type);
-    void CarveLineY(const FIntPoint& A, const FIntPoint& B, ECellType Type);
-    void CarveManhattan_XY(const FIntPoint& A, const FIntPoint& B, ECellType Type);
-
-    void FixDoubleWidthCorridors();
-    void AutoPlaceDoors(const FDungeonResolvedParams& Params);
-    void PlaceDoorIfBoundary(int32 X, int32 Y, const FDungeonResolvedParams& Params);
-    bool IsValidDoorPlacement(int32 X, int32 Y, const FDungeonResolvedParams& Params) const;
-    void PlaceStairsFarthestPair();
-
-    void BSP_Split(const FIntRectLite& Root, FRandomStream& RNG, const FDungeonResolvedParams& Params, TArray<FIntRectLite>& OutLeaves);
-    FIntRectLite MakeRoomInLeaf(const FIntRectLite& Leaf, FRandomStream& RNG, const FDungeonResolvedParams& Params, const TArray<FIntRectLite>& ExistingRooms) const;
+    // Rebuilt on first read after an edit that changes a cell's Wall/Room class (labels ignore the rest)
+    mutable FDungeonGridLabels GridLabels;
+    mutable bool bGridLabelsDirty = false;
 
-    void ConnectCentersWithMST(const TArray<FIntPoint>& Centers, ECellType CorridorType=ECellType::Corridor);
+    const FDungeonGridLabels& EnsureGridLabels() const;
+    void MarkLabelsDirtyIfClassChanged(int32 OldValue, int32 NewValue);
 
-    bool ValidateReachability(float& OutRatio, const FDungeonResolvedParams& Params);
-    bool IsWalkable(int32 X, int32 Y) const;
-    int32 CountWalkable() const;
-    int32 ComputeRoomClusterCount() const;
-
-    bool GenerateFallbackLayout(const FDungeonResolvedParams& Params, FRandomStream& Rng);
+    FORCEINLINE bool InBounds(int32 X, int32 Y) const { return (X>=0 && Y>=0 && X<GridWidth && Y<GridHeight); }
+    FORCEINLINE int32 Index(int32 X, int32 Y) const { return Y*GridWidth + X; }
 };
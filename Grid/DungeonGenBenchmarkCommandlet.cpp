@@ -0,0 +1,334 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+// CodeRevision: INC-2025-1224-R1 (Parallel multi-seed dungeon generation benchmark) (2025-12-20 10:00)
+#include "Grid/DungeonGenBenchmarkCommandlet.h"
+#include "Grid/DungeonGridBuilder.h"
+#include "Data/RogueFloorConfigData.h"
+#include "Data/DungeonTemplateAsset.h"
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+
+DEFINE_LOG_CATEGORY(LogDungeonGenBenchmark);
+
+namespace DungeonGenBenchmarkPrivate
+{
+    static constexpr int32 NumReachBins = 10;
+
+    struct FLayoutEntry
+    {
+        EMapTemplate Layout = EMapTemplate::NormalBSP;
+        const TCHAR* Name = TEXT("");
+    };
+
+    static const FLayoutEntry AllLayouts[] =
+    {
+        { EMapTemplate::NormalBSP,                 TEXT("NormalBSP") },
+        { EMapTemplate::LargeHall,                 TEXT("LargeHall") },
+        { EMapTemplate::FourQuads,                 TEXT("FourQuads") },
+        { EMapTemplate::CentralCrossWithMiniRooms, TEXT("CentralCross") },
+    };
+
+    /** One generated floor. Written by exactly one worker (its own slot). */
+    struct FSample
+    {
+        int32 LayoutSlot = 0;
+        int32 Seed = 0;
+        double Ms = 0.0;
+        int32 Attempts = 0;
+        int32 Rooms = 0;
+        int32 Walkable = 0;
+        float Reachability = 0.0f;
+        bool bFallback = false;
+    };
+
+    struct FLayoutStats
+    {
+        FString Name;
+        int32 Count = 0;
+        double MeanMs = 0.0;
+        double P50Ms = 0.0;
+        double P90Ms = 0.0;
+        double P99Ms = 0.0;
+        double MaxMs = 0.0;
+        double MeanRerolls = 0.0;
+        int32 MaxRerolls = 0;
+        int32 FallbackCount = 0;
+        double MeanRooms = 0.0;
+        double MeanReachability = 0.0;
+        TArray<int32> RerollHistogram;
+        int32 ReachHistogram[NumReachBins] = {};
+    };
+
+    static double Percentile(const TArray<double>& Sorted, double P)
+    {
+        if (Sorted.Num() == 0)
+        {
+            return 0.0;
+        }
+        const int32 Rank = FMath::Clamp(FMath::CeilToInt(P * Sorted.Num()) - 1, 0, Sorted.Num() - 1);
+        return Sorted[Rank];
+    }
+
+    /** Params the live game would use for this layout: the matching template entry, else the config defaults. */
+    static FDungeonResolvedParams ResolveParamsForLayout(const URogueFloorConfigData* Config, EMapTemplate Layout)
+    {
+        for (const FDungeonTemplateConfig& Entry : Config->TemplateConfigs)
+        {
+            const UDungeonTemplateAsset* CDO = Entry.TemplateClass ? Entry.TemplateClass->GetDefaultObject<UDungeonTemplateAsset>() : nullptr;
+            EMapTemplate EntryLayout;
+            if (CDO && CDO->GetNativeLayout(EntryLayout) && EntryLayout == Layout)
+            {
+                return Config->ResolveParamsFor(Entry);
+            }
+        }
+        return Config->ResolveParamsFor(FDungeonTemplateConfig());
+    }
+
+    static FLayoutStats BuildStats(const FString& Name, const TArray<FSample>& Samples, int32 LayoutSlot, int32 MaxReroll)
+    {
+        FLayoutStats Stats;
+        Stats.Name = Name;
+        Stats.RerollHistogram.Init(0, FMath::Max(1, MaxReroll));
+
+        TArray<double> Times;
+        for (const FSample& S : Samples)
+        {
+            if (S.LayoutSlot != LayoutSlot)
+            {
+                continue;
+            }
+
+            ++Stats.Count;
+            Times.Add(S.Ms);
+            Stats.MeanMs += S.Ms;
+            Stats.MeanRooms += S.Rooms;
+            Stats.MeanReachability += S.Reachability;
+
+            const int32 Rerolls = FMath::Max(0, S.Attempts - 1);
+            Stats.MeanRerolls += Rerolls;
+            Stats.MaxRerolls = FMath::Max(Stats.MaxRerolls, Rerolls);
+            ++Stats.RerollHistogram[FMath::Clamp(Rerolls, 0, Stats.RerollHistogram.Num() - 1)];
+
+            Stats.FallbackCount += S.bFallback ? 1 : 0;
+            ++Stats.ReachHistogram[FMath::Clamp(FMath::FloorToInt(S.Reachability * NumReachBins), 0, NumReachBins - 1)];
+        }
+
+        if (Stats.Count > 0)
+        {
+            Stats.MeanMs /= Stats.Count;
+            Stats.MeanRooms /= Stats.Count;
+            Stats.MeanReachability /= Stats.Count;
+            Stats.MeanRerolls /= Stats.Count;
+
+            Times.Sort();
+            Stats.P50Ms = Percentile(Times, 0.50);
+            Stats.P90Ms = Percentile(Times, 0.90);
+            Stats.P99Ms = Percentile(Times, 0.99);
+            Stats.MaxMs = Times.Last();
+        }
+        return Stats;
+    }
+
+    static FString JoinInts(const int32* Values, int32 Num)
+    {
+        FString Out;
+        for (int32 i = 0; i < Num; ++i)
+        {
+            Out += FString::Printf(TEXT("%s%d"), i > 0 ? TEXT(",") : TEXT(""), Values[i]);
+        }
+        return Out;
+    }
+}
+
+UDungeonGenBenchmarkCommandlet::UDungeonGenBenchmarkCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = false;
+    LogToConsole = true;
+}
+
+int32 UDungeonGenBenchmarkCommandlet::Main(const FString& Params)
+{
+    using namespace DungeonGenBenchmarkPrivate;
+
+    int32 NumSeeds = 1000;
+    int32 StartSeed = 1;
+    int32 WidthOverride = 0;
+    int32 HeightOverride = 0;
+    FParse::Value(*Params, TEXT("Seeds="), NumSeeds);
+    FParse::Value(*Params, TEXT("StartSeed="), StartSeed);
+    FParse::Value(*Params, TEXT("Width="), WidthOverride);
+    FParse::Value(*Params, TEXT("Height="), HeightOverride);
+    const bool bWriteSamples = FParse::Param(*Params, TEXT("Samples"));
+    NumSeeds = FMath::Max(1, NumSeeds);
+
+    FString OutDir = FPaths::ProjectSavedDir() / TEXT("DungeonGenBenchmark") / FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S"));
+    FParse::Value(*Params, TEXT("Out="), OutDir);
+
+    // Config: an asset when given, otherwise the class defaults
+    const URogueFloorConfigData* Config = nullptr;
+    FString ConfigPath;
+    if (FParse::Value(*Params, TEXT("Config="), ConfigPath))
+    {
+        Config = LoadObject<URogueFloorConfigData>(nullptr, *ConfigPath);
+        if (!Config)
+        {
+            UE_LOG(LogDungeonGenBenchmark, Error, TEXT("[Benchmark] Could not load URogueFloorConfigData '%s'"), *ConfigPath);
+            return 1;
+        }
+    }
+    else
+    {
+        Config = NewObject<URogueFloorConfigData>(GetTransientPackage());
+    }
+
+    // PickTemplateConfig injects the default presets into an empty config
+    FRandomStream WarmupRng(0);
+    Config->PickTemplateConfig(WarmupRng);
+
+    // Layout selection
+    TArray<FLayoutEntry> Layouts;
+    FString LayoutList;
+    if (FParse::Value(*Params, TEXT("Layouts="), LayoutList, false))
+    {
+        TArray<FString> Names;
+        LayoutList.ParseIntoArray(Names, TEXT(","));
+        for (const FLayoutEntry& Entry : AllLayouts)
+        {
+            if (Names.ContainsByPredicate([&Entry](const FString& N) { return N.Equals(Entry.Name, ESearchCase::IgnoreCase); }))
+            {
+                Layouts.Add(Entry);
+            }
+        }
+    }
+    else
+    {
+        Layouts.Append(AllLayouts, UE_ARRAY_COUNT(AllLayouts));
+    }
+
+    if (Layouts.Num() == 0)
+    {
+        UE_LOG(LogDungeonGenBenchmark, Error, TEXT("[Benchmark] No known layout in '%s'"), *LayoutList);
+        return 1;
+    }
+
+    // Requests are resolved on the game thread; workers only run the pure builder
+    TArray<FDungeonFloorGenRequest> Requests;
+    Requests.Reserve(Layouts.Num() * NumSeeds);
+    TArray<FSample> Samples;
+    Samples.SetNum(Layouts.Num() * NumSeeds);
+    int32 MaxReroll = 1;
+
+    for (int32 LayoutSlot = 0; LayoutSlot < Layouts.Num(); ++LayoutSlot)
+    {
+        FDungeonResolvedParams LayoutParams = ResolveParamsForLayout(Config, Layouts[LayoutSlot].Layout);
+        if (WidthOverride > 0) { LayoutParams.Width = WidthOverride; }
+        if (HeightOverride > 0) { LayoutParams.Height = HeightOverride; }
+        MaxReroll = FMath::Max(MaxReroll, LayoutParams.MaxReroll);
+
+        for (int32 SeedOffset = 0; SeedOffset < NumSeeds; ++SeedOffset)
+        {
+            FDungeonFloorGenRequest& Request = Requests.AddDefaulted_GetRef();
+            Request.Params = LayoutParams;
+            Request.Layout = Layouts[LayoutSlot].Layout;
+            Request.Rng.Initialize(StartSeed + SeedOffset);
+
+            FSample& Sample = Samples[Requests.Num() - 1];
+            Sample.LayoutSlot = LayoutSlot;
+            Sample.Seed = StartSeed + SeedOffset;
+        }
+    }
+
+    UE_LOG(LogDungeonGenBenchmark, Display, TEXT("[Benchmark] Generating %d floors (%d layouts x %d seeds from %d)"),
+        Requests.Num(), Layouts.Num(), NumSeeds, StartSeed);
+
+    // The builder logs every accepted floor and reroll; keep only errors while the workers run
+    const ELogVerbosity::Type PrevVerbosity = LogTemp.GetVerbosity();
+    LogTemp.SetVerbosity(ELogVerbosity::Error);
+
+    const double WallStart = FPlatformTime::Seconds();
+    ParallelFor(Requests.Num(), [&Requests, &Samples](int32 Index)
+    {
+        FDungeonFloorGenResult Result;
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        FDungeonGridBuilder::GenerateFloor(Requests[Index], Result);
+        const uint64 EndCycles = FPlatformTime::Cycles64();
+
+        FSample& Sample = Samples[Index];
+        Sample.Ms = FPlatformTime::ToMilliseconds64(EndCycles - StartCycles);
+        Sample.Attempts = Result.Attempts;
+        Sample.Rooms = Result.RoomCount;
+        Sample.Walkable = Result.WalkableCount;
+        Sample.Reachability = Result.Reachability;
+        Sample.bFallback = Result.bUsedFallback;
+    });
+    const double WallSeconds = FPlatformTime::Seconds() - WallStart;
+
+    LogTemp.SetVerbosity(PrevVerbosity);
+
+    // Summary
+    TArray<FLayoutStats> AllStats;
+    for (int32 LayoutSlot = 0; LayoutSlot < Layouts.Num(); ++LayoutSlot)
+    {
+        AllStats.Add(BuildStats(Layouts[LayoutSlot].Name, Samples, LayoutSlot, MaxReroll));
+    }
+
+    FString Csv = TEXT("Layout,Count,MeanMs,P50Ms,P90Ms,P99Ms,MaxMs,MeanRerolls,MaxRerolls,FallbackCount,FallbackRate,MeanRooms,MeanReachability");
+    for (int32 Bin = 0; Bin < NumReachBins; ++Bin)
+    {
+        Csv += FString::Printf(TEXT(",Reach%d_%d"), Bin * 100 / NumReachBins, (Bin + 1) * 100 / NumReachBins);
+    }
+    Csv += LINE_TERMINATOR;
+
+    FString Json = FString::Printf(TEXT("{\n  \"seeds\": %d,\n  \"startSeed\": %d,\n  \"floors\": %d,\n  \"wallSeconds\": %.3f,\n  \"layouts\": ["),
+        NumSeeds, StartSeed, Requests.Num(), WallSeconds);
+
+    for (int32 i = 0; i < AllStats.Num(); ++i)
+    {
+        const FLayoutStats& S = AllStats[i];
+        const double FallbackRate = S.Count > 0 ? double(S.FallbackCount) / S.Count : 0.0;
+
+        Csv += FString::Printf(TEXT("%s,%d,%.4f,%.4f,%.4f,%.4f,%.4f,%.3f,%d,%d,%.4f,%.2f,%.4f,%s"),
+            *S.Name, S.Count, S.MeanMs, S.P50Ms, S.P90Ms, S.P99Ms, S.MaxMs, S.MeanRerolls, S.MaxRerolls,
+            S.FallbackCount, FallbackRate, S.MeanRooms, S.MeanReachability, *JoinInts(S.ReachHistogram, NumReachBins));
+        Csv += LINE_TERMINATOR;
+
+        Json += FString::Printf(TEXT("%s\n    {\"layout\": \"%s\", \"count\": %d, \"ms\": {\"mean\": %.4f, \"p50\": %.4f, \"p90\": %.4f, \"p99\": %.4f, \"max\": %.4f}, ")
+            TEXT("\"rerolls\": {\"mean\": %.3f, \"max\": %d, \"histogram\": [%s]}, \"fallback\": {\"count\": %d, \"rate\": %.4f}, ")
+            TEXT("\"meanRooms\": %.2f, \"reachability\": {\"mean\": %.4f, \"histogram\": [%s]}}"),
+            i > 0 ? TEXT(",") : TEXT(""), *S.Name, S.Count, S.MeanMs, S.P50Ms, S.P90Ms, S.P99Ms, S.MaxMs,
+            S.MeanRerolls, S.MaxRerolls, *JoinInts(S.RerollHistogram.GetData(), S.RerollHistogram.Num()),
+            S.FallbackCount, FallbackRate, S.MeanRooms, S.MeanReachability, *JoinInts(S.ReachHistogram, NumReachBins));
+
+        UE_LOG(LogDungeonGenBenchmark, Display,
+            TEXT("[Benchmark] %-12s n=%d p50=%.3fms p90=%.3fms p99=%.3fms max=%.3fms rerolls=%.2f fallback=%.1f%% reach=%.1f%%"),
+            *S.Name, S.Count, S.P50Ms, S.P90Ms, S.P99Ms, S.MaxMs, S.MeanRerolls, FallbackRate * 100.0, S.MeanReachability * 100.0);
+    }
+    Json += TEXT("\n  ]\n}\n");
+
+    bool bSaved = FFileHelper::SaveStringToFile(Csv, *(OutDir / TEXT("Summary.csv")));
+    bSaved &= FFileHelper::SaveStringToFile(Json, *(OutDir / TEXT("Summary.json")));
+
+    if (bWriteSamples)
+    {
+        FString SampleCsv = TEXT("Layout,Seed,Ms,Attempts,Rooms,Walkable,Reachability,Fallback");
+        SampleCsv += LINE_TERMINATOR;
+        for (const FSample& S : Samples)
+        {
+            SampleCsv += FString::Printf(TEXT("%s,%d,%.4f,%d,%d,%d,%.4f,%d"),
+                Layouts[S.LayoutSlot].Name, S.Seed, S.Ms, S.Attempts, S.Rooms, S.Walkable, S.Reachability, S.bFallback ? 1 : 0);
+            SampleCsv += LINE_TERMINATOR;
+        }
+        bSaved &= FFileHelper::SaveStringToFile(SampleCsv, *(OutDir / TEXT("Samples.csv")));
+    }
+
+    UE_LOG(LogDungeonGenBenchmark, Display, TEXT("[Benchmark] %d floors in %.2fs, results %s %s"),
+        Requests.Num(), WallSeconds, bSaved ? TEXT("written to") : TEXT("FAILED to write to"), *OutDir);
+
+    return bSaved ? 0 : 1;
+}
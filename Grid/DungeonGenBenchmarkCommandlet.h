@@ -0,0 +1,35 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+// CodeRevision: INC-2025-1224-R1 (Parallel multi-seed dungeon generation benchmark) (2025-12-20 10:00)
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "DungeonGenBenchmarkCommandlet.generated.h"
+
+// Log category
+DECLARE_LOG_CATEGORY_EXTERN(LogDungeonGenBenchmark, Log, All);
+
+/**
+ * UDungeonGenBenchmarkCommandlet: generates many floors per native layout on worker threads and
+ * reports timing percentiles, reroll counts, reachability histograms and fallback frequency.
+ *
+ * Usage:
+ *   UnrealEditor-Cmd <Project> -run=DungeonGenBenchmark [-Seeds=1000] [-StartSeed=1]
+ *       [-Config=/Game/Path/To/FloorConfig] [-Layouts=NormalBSP,LargeHall,FourQuads,CentralCross]
+ *       [-Width=N] [-Height=N] [-Out=Dir] [-Samples]
+ *
+ * Params come from the config asset (per-template overrides included) or the URogueFloorConfigData
+ * defaults. Writes Summary.csv and Summary.json (plus Samples.csv with -Samples) under -Out,
+ * default Saved/DungeonGenBenchmark/<timestamp>.
+ */
+UCLASS()
+class LYRAGAME_API UDungeonGenBenchmarkCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UDungeonGenBenchmarkCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
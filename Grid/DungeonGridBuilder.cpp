@@ -0,0 +1,1009 @@
+// CodeRevision: INC-2025-1221-R1 (Grid generation as a pure function over a plain buffer) (2025-12-18 14:00)
+#include "Grid/DungeonGridBuilder.h"
+#include "Containers/Queue.h"
+#include "Utility/GridUtils.h"
+
+namespace DungeonGridBuilder_Private
+{
+    // CodeRevision: INC-2025-1222-R1 (Kruskal MST over a grid-bucketed neighbour graph) (2025-12-19 10:00)
+    /** Disjoint sets with path halving and union by size. */
+    struct FUnionFind
+    {
+        TArray<int32> Parent;
+        TArray<int32> Size;
+
+        explicit FUnionFind(int32 Num)
+        {
+            Parent.SetNumUninitialized(Num);
+            Size.Init(1, Num);
+            for (int32 i = 0; i < Num; ++i)
+            {
+                Parent[i] = i;
+            }
+        }
+
+        /** New singleton set; returns its id. */
+        int32 Add()
+        {
+            Size.Add(1);
+            return Parent.Add(Parent.Num());
+        }
+
+        int32 Find(int32 X)
+        {
+            while (Parent[X] != X)
+            {
+                Parent[X] = Parent[Parent[X]];
+                X = Parent[X];
+            }
+            return X;
+        }
+
+        bool Union(int32 A, int32 B)
+        {
+            A = Find(A);
+            B = Find(B);
+            if (A == B)
+            {
+                return false;
+            }
+            if (Size[A] < Size[B])
+            {
+                Swap(A, B);
+            }
+            Parent[B] = A;
+            Size[A] += Size[B];
+            return true;
+        }
+    };
+
+    // Plain names so worker threads do not have to go through UEnum reflection
+    static const TCHAR* LayoutName(EMapTemplate Layout)
+    {
+        switch (Layout)
+        {
+        case EMapTemplate::LargeHall:                 return TEXT("LargeHall");
+        case EMapTemplate::FourQuads:                 return TEXT("FourQuads");
+        case EMapTemplate::CentralCrossWithMiniRooms: return TEXT("CentralCross");
+        case EMapTemplate::NormalBSP:
+        default:                                      return TEXT("NormalBSP");
+        }
+    }
+}
+
+FDungeonGridBuilder::FDungeonGridBuilder(TArray<int32>& InCells, int32 InWidth, int32 InHeight)
+    : Cells(InCells)
+    , Width(InWidth)
+    , Height(InHeight)
+{
+}
+
+void FDungeonGridBuilder::GenerateFloor(const FDungeonFloorGenRequest& Request, FDungeonFloorGenResult& Out)
+{
+    const FDungeonResolvedParams& Params = Request.Params;
+
+    Out.Width = Params.Width;
+    Out.Height = Params.Height;
+    Out.CellSize = Params.CellSizeUU;
+    Out.Seed = Request.Rng.GetInitialSeed();
+
+    FRandomStream Rng = Request.Rng;
+    FDungeonGridBuilder Builder(Out.Cells, Out.Width, Out.Height);
+    Builder.Run(Params, Rng,
+        [&Builder, &Params, Layout = Request.Layout](FRandomStream& LayoutRng)
+        {
+            Builder.MakeLayout(Layout, LayoutRng, Params);
+        },
+        DungeonGridBuilder_Private::LayoutName(Request.Layout));
+
+    Out.RoomCount = Builder.RoomCount;
+    Out.WalkableCount = Builder.WalkableCount;
+    Out.Reachability = Builder.Reachability;
+    Out.bUsedFallback = Builder.bUsedFallback;
+    Out.Attempts = Builder.Attempts;
+    Out.Labels = MoveTemp(Builder.Labels);
+}
+
+// CodeRevision: INC-2025-1223-R1 (Single-pass union-find grid labelling) (2025-12-19 14:00)
+void FDungeonGridBuilder::LabelGrid(const TArray<int32>& InCells, int32 InWidth, int32 InHeight, FDungeonGridLabels& OutLabels)
+{
+    OutLabels.Reset();
+
+    if (InWidth <= 0 || InHeight <= 0 || InCells.Num() != InWidth * InHeight)
+    {
+        return;
+    }
+
+    OutLabels.Width = InWidth;
+    OutLabels.Height = InHeight;
+
+    const int32 WallValue = static_cast<int32>(ECellType::Wall);
+    const int32 RoomValue = static_cast<int32>(ECellType::Room);
+    const int32 NumCells = InCells.Num();
+
+    OutLabels.WalkableIds.Init(INDEX_NONE, NumCells);
+    OutLabels.RoomIds.Init(INDEX_NONE, NumCells);
+
+    // Pass 1: provisional labels from the left / up neighbours, merging equivalences as we go
+    DungeonGridBuilder_Private::FUnionFind WalkSets(0);
+    DungeonGridBuilder_Private::FUnionFind RoomSets(0);
+
+    auto LabelCell = [InWidth](TArray<int32>& Ids, DungeonGridBuilder_Private::FUnionFind& Sets, int32 Idx, bool bLeft, bool bUp)
+    {
+        const int32 Left = bLeft ? Ids[Idx - 1] : INDEX_NONE;
+        const int32 Up = bUp ? Ids[Idx - InWidth] : INDEX_NONE;
+
+        if (Left == INDEX_NONE && Up == INDEX_NONE)
+        {
+            Ids[Idx] = Sets.Add();
+        }
+        else if (Left == INDEX_NONE || Up == INDEX_NONE)
+        {
+            Ids[Idx] = (Left != INDEX_NONE) ? Left : Up;
+        }
+        else
+        {
+            Ids[Idx] = Left;
+            Sets.Union(Left, Up);
+        }
+    };
+
+    for (int32 Y = 0; Y < InHeight; ++Y)
+    {
+        for (int32 X = 0; X < InWidth; ++X)
+        {
+            const int32 Idx = Y * InWidth + X;
+            const int32 Cell = InCells[Idx];
+            if (Cell == WallValue)
+            {
+                continue;
+            }
+
+            LabelCell(OutLabels.WalkableIds, WalkSets, Idx,
+                X > 0 && InCells[Idx - 1] != WallValue,
+                Y > 0 && InCells[Idx - InWidth] != WallValue);
+
+            if (Cell == RoomValue)
+            {
+                LabelCell(OutLabels.RoomIds, RoomSets, Idx,
+                    X > 0 && InCells[Idx - 1] == RoomValue,
+                    Y > 0 && InCells[Idx - InWidth] == RoomValue);
+            }
+        }
+    }
+
+    // Pass 2: resolve to roots, compact to scan-order ids, accumulate sizes and room bounds
+    TArray<int32> WalkRootToId;
+    WalkRootToId.Init(INDEX_NONE, WalkSets.Parent.Num());
+    TArray<int32> RoomRootToId;
+    RoomRootToId.Init(INDEX_NONE, RoomSets.Parent.Num());
+
+    for (int32 Y = 0; Y < InHeight; ++Y)
+    {
+        for (int32 X = 0; X < InWidth; ++X)
+        {
+            const int32 Idx = Y * InWidth + X;
+
+            int32& WalkId = OutLabels.WalkableIds[Idx];
+            if (WalkId == INDEX_NONE)
+            {
+                continue;
+            }
+
+            int32& WalkCompact = WalkRootToId[WalkSets.Find(WalkId)];
+            if (WalkCompact == INDEX_NONE)
+            {
+                WalkCompact = OutLabels.WalkableSizes.Add(0);
+            }
+            WalkId = WalkCompact;
+            ++OutLabels.WalkableSizes[WalkId];
+            ++OutLabels.WalkableCount;
+
+            int32& RoomId = OutLabels.RoomIds[Idx];
+            if (RoomId == INDEX_NONE)
+            {
+                continue;
+            }
+
+            int32& RoomCompact = RoomRootToId[RoomSets.Find(RoomId)];
+            if (RoomCompact == INDEX_NONE)
+            {
+                RoomCompact = OutLabels.RoomSizes.Add(0);
+                OutLabels.RoomRects.Emplace(X, Y, X, Y);
+            }
+            RoomId = RoomCompact;
+            ++OutLabels.RoomSizes[RoomId];
+
+            FIntRectLite& Bounds = OutLabels.RoomRects[RoomId];
+            Bounds.X0 = FMath::Min(Bounds.X0, X);
+            Bounds.X1 = FMath::Max(Bounds.X1, X);
+            Bounds.Y1 = FMath::Max(Bounds.Y1, Y);
+        }
+    }
+}
+
+// CodeRevision: INC-2025-1226-R1 (Hidden wall culling and greedy wall merging) (2025-12-21 10:00)
+int32 FDungeonGridBuilder::BuildWallSegments(const TArray<int32>& InCells, int32 InWidth, int32 InHeight, const FDungeonWallMergeSettings& Settings, TArray<FDungeonWallSegment>& OutSegments)
+{
+    OutSegments.Reset();
+
+    if (InWidth <= 0 || InHeight <= 0 || InCells.Num() != InWidth * InHeight)
+    {
+        return 0;
+    }
+
+    // Negative values render as walls too (see UDungeonRenderComponent)
+    const int32 WallValue = static_cast<int32>(ECellType::Wall);
+    auto IsWall = [&InCells, WallValue](int32 Idx)
+    {
+        return InCells[Idx] < 0 || InCells[Idx] == WallValue;
+    };
+
+    // Candidate walls: every wall, or only those touching a walkable cell (8-neighbourhood)
+    TBitArray<> Pending(false, InCells.Num());
+    for (int32 Y = 0; Y < InHeight; ++Y)
+    {
+        for (int32 X = 0; X < InWidth; ++X)
+        {
+            const int32 Idx = Y * InWidth + X;
+            if (!IsWall(Idx))
+            {
+                continue;
+            }
+
+            bool bExposed = !Settings.bCullHidden;
+            for (int32 DY = -1; DY <= 1 && !bExposed; ++DY)
+            {
+                for (int32 DX = -1; DX <= 1 && !bExposed; ++DX)
+                {
+                    const int32 NX = X + DX;
+                    const int32 NY = Y + DY;
+                    if ((DX != 0 || DY != 0) && NX >= 0 && NY >= 0 && NX < InWidth && NY < InHeight)
+                    {
+                        bExposed = !IsWall(NY * InWidth + NX);
+                    }
+                }
+            }
+            Pending[Idx] = bExposed;
+        }
+    }
+
+    const int32 MaxRun = Settings.bMergeRuns ? FMath::Max(1, Settings.MaxRunLength) : 1;
+    int32 Covered = 0;
+
+    // Emit a run in MaxRun-sized pieces
+    auto EmitRun = [&OutSegments, &Covered, MaxRun](const FIntPoint& Start, int32 Length, bool bAlongX)
+    {
+        for (int32 Offset = 0; Offset < Length; Offset += MaxRun)
+        {
+            FDungeonWallSegment& Segment = OutSegments.AddDefaulted_GetRef();
+            Segment.Start = bAlongX ? FIntPoint(Start.X + Offset, Start.Y) : FIntPoint(Start.X, Start.Y + Offset);
+            Segment.Length = FMath::Min(MaxRun, Length - Offset);
+            Segment.bAlongX = bAlongX;
+        }
+        Covered += Length;
+    };
+
+    // Rows: runs of two or more
+    if (MaxRun > 1)
+    {
+        for (int32 Y = 0; Y < InHeight; ++Y)
+        {
+            for (int32 X = 0; X < InWidth; )
+            {
+                int32 End = X;
+                while (End < InWidth && Pending[Y * InWidth + End]) { ++End; }
+
+                if (End - X >= 2)
+                {
+                    for (int32 RunX = X; RunX < End; ++RunX) { Pending[Y * InWidth + RunX] = false; }
+                    EmitRun(FIntPoint(X, Y), End - X, true);
+                }
+                X = FMath::Max(End, X + 1);
+            }
+        }
+    }
+
+    // Columns: whatever the rows left, singles included
+    for (int32 X = 0; X < InWidth; ++X)
+    {
+        for (int32 Y = 0; Y < InHeight; )
+        {
+            int32 End = Y;
+            while (End < InHeight && Pending[End * InWidth + X]) { ++End; }
+
+            if (End > Y)
+            {
+                for (int32 RunY = Y; RunY < End; ++RunY) { Pending[RunY * InWidth + X] = false; }
+                EmitRun(FIntPoint(X, Y), End - Y, false);
+            }
+            Y = FMath::Max(End, Y + 1);
+        }
+    }
+
+    return Covered;
+}
+
+void FDungeonGridBuilder::Run(const FDungeonResolvedParams& Params, FRandomStream& Rng, TFunctionRef<void(FRandomStream&)> CarveLayout, const FString& LayoutName)
+{
+    // Reset cached stats so we do not leak values from previous generations
+    RoomCount = 0;
+    WalkableCount = 0;
+    Reachability = 0.0f;
+    bUsedFallback = false;
+    Attempts = 0;
+    Labels.Reset();
+
+    for (int attempt = 0; attempt < Params.MaxReroll; ++attempt)
+    {
+        Attempts = attempt + 1;
+        ResetGrid(ECellType::Wall);
+        EnsureOuterWall();
+
+        CarveLayout(Rng);
+
+        FixDoubleWidthCorridors();
+        AutoPlaceDoors(Params);
+        PlaceStairsFarthestPair();
+
+        // One labelling pass feeds both the room count and the reachability check
+        LabelGrid(Cells, Width, Height, Labels);
+
+        const int32 ActualRoomCount = Labels.NumRooms();
+        RoomCount = ActualRoomCount;
+        if (ActualRoomCount <= 0 || (Params.MinRooms > 0 && ActualRoomCount < Params.MinRooms))
+        {
+            UE_LOG(LogTemp, Warning,
+                TEXT("Dungeon attempt %d rejected: produced %d rooms (min required=%d) with template %s. Re-rolling..."),
+                attempt + 1,
+                ActualRoomCount,
+                Params.MinRooms,
+                *LayoutName);
+            continue;
+        }
+
+        float reachability = 0.0f;
+        if (ValidateReachability(Labels, reachability, Params))
+        {
+            WalkableCount = Labels.WalkableCount;
+            Reachability = reachability;
+
+            UE_LOG(LogTemp, Log, TEXT("Dungeon GENERATED: Seed=%s Rooms=%d Walkable=%d Reach=%.1f%%"),
+                   *Rng.ToString(), RoomCount, WalkableCount, reachability * 100.0f);
+            return;
+        }
+    }
+
+    UE_LOG(LogTemp, Warning, TEXT("Dungeon FAILED: Seed=%s after %d attempts"),
+           *Rng.ToString(), Params.MaxReroll);
+
+    GenerateFallbackLayout(Params, Rng);
+}
+
+bool FDungeonGridBuilder::MakeLayout(EMapTemplate Layout, FRandomStream& RNG, const FDungeonResolvedParams& Params)
+{
+    switch (Layout)
+    {
+    case EMapTemplate::LargeHall:                 return Make_LargeHall(RNG, Params);
+    case EMapTemplate::FourQuads:                 return Make_FourQuads(RNG, Params);
+    case EMapTemplate::CentralCrossWithMiniRooms: return Make_CentralCrossWithMiniRooms(RNG, Params);
+    case EMapTemplate::NormalBSP:
+    default:                                      return Make_NormalBSP(RNG, Params);
+    }
+}
+
+void FDungeonGridBuilder::ResetGrid(ECellType Fill)
+{
+    Cells.Init(static_cast<int32>(Fill), Width * Height);
+}
+
+void FDungeonGridBuilder::EnsureOuterWall()
+{
+    for (int x = 0; x < Width; ++x) { SetCellXY(x, 0, ECellType::Wall); SetCellXY(x, Height - 1, ECellType::Wall); }
+    for (int y = 0; y < Height; ++y) { SetCellXY(0, y, ECellType::Wall); SetCellXY(Width - 1, y, ECellType::Wall); }
+}
+
+void FDungeonGridBuilder::SetCellXY(int32 X, int32 Y, ECellType Type)
+{
+    if (!InBounds(X, Y)) return;
+    Cells[Index(X, Y)] = static_cast<int32>(Type);
+}
+
+ECellType FDungeonGridBuilder::GetCellXY(int32 X, int32 Y) const
+{
+    if (!InBounds(X, Y)) return ECellType::Wall;
+    return static_cast<ECellType>(Cells[Index(X, Y)]);
+}
+
+void FDungeonGridBuilder::CarveLineX(const FIntPoint& A, const FIntPoint& B, ECellType Type)
+{
+    const int step = (A.X <= B.X) ? 1 : -1;
+    for (int x = A.X; x != B.X + step; x += step) SetCellXY(x, A.Y, Type);
+}
+
+void FDungeonGridBuilder::CarveLineY(const FIntPoint& A, const FIntPoint& B, ECellType Type)
+{
+    const int step = (A.Y <= B.Y) ? 1 : -1;
+    for (int y = A.Y; y != B.Y + step; y += step) SetCellXY(A.X, y, Type);
+}
+
+void FDungeonGridBuilder::CarveManhattan_XY(const FIntPoint& A, const FIntPoint& B, ECellType Type)
+{
+    const FIntPoint M{ B.X, A.Y };
+    CarveLineX(A, M, Type);
+    CarveLineY(M, B, Type);
+}
+
+void FDungeonGridBuilder::FixDoubleWidthCorridors()
+{
+    auto isC = [&](int x, int y) { return InBounds(x, y) && GetCellXY(x, y) == ECellType::Corridor; };
+    for (int y = 1; y < Height; ++y)
+        for (int x = 1; x < Width; ++x)
+            if (isC(x, y) && isC(x - 1, y) && isC(x, y - 1) && isC(x - 1, y - 1))
+                SetCellXY(x, y, ECellType::Wall);
+}
+
+bool FDungeonGridBuilder::IsValidDoorPlacement(int32 X, int32 Y, const FDungeonResolvedParams& Params) const
+{
+    if (!InBounds(X, Y)) return false;
+    const int spacing = Params.MinDoorSpacing;
+    for (int dy = -spacing; dy <= spacing; ++dy)
+        for (int dx = -spacing; dx <= spacing; ++dx)
+        {
+            if (dx == 0 && dy == 0) continue;
+            if (FMath::Abs(dx) + FMath::Abs(dy) > spacing) continue;
+            const int nx = X + dx;
+            const int ny = Y + dy;
+            if (InBounds(nx, ny) && GetCellXY(nx, ny) == ECellType::Door) return false;
+        }
+    return true;
+}
+
+void FDungeonGridBuilder::PlaceDoorIfBoundary(int32 X, int32 Y, const FDungeonResolvedParams& Params)
+{
+    if (!InBounds(X, Y) || GetCellXY(X, Y) != ECellType::Room) return;
+    int adjCorr = 0, adjRoom = 0;
+    const FIntPoint d4[4] = { {1,0},{-1,0},{0,1},{0,-1} };
+    for (auto d : d4)
+    {
+        const int nx = X + d.X, ny = Y + d.Y;
+        if (!InBounds(nx, ny)) continue;
+        const ECellType t = GetCellXY(nx, ny);
+        if (t == ECellType::Corridor) ++adjCorr;
+        if (t == ECellType::Room) ++adjRoom;
+    }
+    if (adjCorr >= 1 && adjRoom >= 1 && IsValidDoorPlacement(X, Y, Params))
+        SetCellXY(X, Y, ECellType::Door);
+}
+
+void FDungeonGridBuilder::AutoPlaceDoors(const FDungeonResolvedParams& Params)
+{
+    for (int y = 1; y < Height - 1; ++y)
+        for (int x = 1; x < Width - 1; ++x)
+            PlaceDoorIfBoundary(x, y, Params);
+}
+
+void FDungeonGridBuilder::PlaceStairsFarthestPair()
+{
+    FIntPoint start{ -1,-1 };
+    for (int y = 0; y < Height && start.X < 0; ++y)
+        for (int x = 0; x < Width; ++x)
+            if (IsWalkable(x, y)) { start = { x,y }; break; }
+    if (start.X < 0) return;
+
+    auto bfs = [&](FIntPoint s, TArray<int32>& dist) -> FIntPoint {
+        dist.Init(-1, Width * Height);
+        TQueue<FIntPoint> q; q.Enqueue(s); dist[Index(s.X, s.Y)] = 0;
+        const FIntPoint d4[4] = { {1,0},{-1,0},{0,1},{0,-1} };
+        FIntPoint last = s;
+        while (!q.IsEmpty()) {
+            FIntPoint p; q.Dequeue(p); last = p;
+            for (auto d : d4) {
+                const int nx = p.X + d.X, ny = p.Y + d.Y;
+                if (!InBounds(nx, ny) || !IsWalkable(nx, ny)) continue;
+                const int idx = Index(nx, ny); if (dist[idx] >= 0) continue;
+                dist[idx] = dist[Index(p.X, p.Y)] + 1; q.Enqueue({ nx,ny });
+            }
+        }
+        return last;
+    };
+
+    TArray<int32> dist1, dist2;
+    const FIntPoint a = bfs(start, dist1);
+    const FIntPoint b = bfs(a, dist2);
+    SetCellXY(a.X, a.Y, ECellType::StairUp);
+    SetCellXY(b.X, b.Y, ECellType::StairDown);
+}
+
+void FDungeonGridBuilder::BSP_Split(const FIntRectLite& Root, FRandomStream& RNG, const FDungeonResolvedParams& Params, TArray<FIntRectLite>& OutLeaves)
+{
+    TArray<FIntRectLite> stack;
+    stack.Reserve(64); // Reserve for BSP split operations
+    stack.Add(Root);
+    const int32 minLeafW = Params.MinRoomSize + 2 * Params.RoomMargin + 2;
+    const int32 minLeafH = Params.MinRoomSize + 2 * Params.RoomMargin + 2;
+
+    while (stack.Num() > 0)
+    {
+        FIntRectLite leaf = stack.Pop();
+        const bool canSplitH = leaf.W() >= 2 * minLeafW;
+        const bool canSplitV = leaf.H() >= 2 * minLeafH;
+        bool doSplit = (canSplitH || canSplitV) && (RNG.FRand() > Params.StopSplitProbability);
+
+        if (!doSplit) { OutLeaves.Add(leaf); continue; }
+
+        const bool splitVertical =
+            (canSplitH && !canSplitV) ? true :
+            (!canSplitH && canSplitV) ? false :
+            (RNG.RandRange(0, 1) == 0);
+
+        if (splitVertical)
+        {
+            const int32 cutMin = leaf.X0 + minLeafW;
+            const int32 cutMax = leaf.X1 - minLeafW;
+            if (cutMin >= cutMax) { OutLeaves.Add(leaf); continue; }
+            const int32 cut = RNG.RandRange(cutMin, cutMax);
+            stack.Add(FIntRectLite(leaf.X0, leaf.Y0, cut, leaf.Y1));
+            stack.Add(FIntRectLite(cut + 1, leaf.Y0, leaf.X1, leaf.Y1));
+        }
+        else
+        {
+            const int32 cutMin = leaf.Y0 + minLeafH;
+            const int32 cutMax = leaf.Y1 - minLeafH;
+            if (cutMin >= cutMax) { OutLeaves.Add(leaf); continue; }
+            const int32 cut = RNG.RandRange(cutMin, cutMax);
+            stack.Add(FIntRectLite(leaf.X0, leaf.Y0, leaf.X1, cut));
+            stack.Add(FIntRectLite(leaf.X0, cut + 1, leaf.X1, leaf.Y1));
+        }
+    }
+}
+
+FIntRectLite FDungeonGridBuilder::MakeRoomInLeaf(const FIntRectLite& Leaf, FRandomStream& RNG, const FDungeonResolvedParams& Params, const TArray<FIntRectLite>& ExistingRooms) const
+{
+    const int32 margin = Params.RoomMargin;
+    const int32 minW = Params.MinRoomSize;
+    const int32 minH = Params.MinRoomSize;
+    const int32 maxW = FMath::Min(Params.MaxRoomSize, Leaf.W() - 2 * margin);
+    const int32 maxH = FMath::Min(Params.MaxRoomSize, Leaf.H() - 2 * margin);
+    if (maxW < minW || maxH < minH) return FIntRectLite();
+
+    for (int attempt = 0; attempt < 10; ++attempt)
+    {
+        const int32 w = RNG.RandRange(minW, maxW);
+        const int32 h = RNG.RandRange(minH, maxH);
+        const int32 rx0 = RNG.RandRange(Leaf.X0 + margin, FMath::Max(Leaf.X0 + margin, Leaf.X1 - margin - w + 1));
+        const int32 ry0 = RNG.RandRange(Leaf.Y0 + margin, FMath::Max(Leaf.Y0 + margin, Leaf.Y1 - margin - h + 1));
+        FIntRectLite room(rx0, ry0, rx0 + w - 1, ry0 + h - 1);
+
+        bool overlaps = false;
+        for (const auto& existing : ExistingRooms)
+            if (room.OverlapsWith(existing, 1)) { overlaps = true; break; }
+
+        if (!overlaps) return room;
+    }
+    return FIntRectLite();
+}
+
+// CodeRevision: INC-2025-1222-R1 (Kruskal MST over a grid-bucketed neighbour graph) (2025-12-19 10:00)
+void FDungeonGridBuilder::BuildCorridorCandidates(const TArray<FIntPoint>& Centers, TArray<FCorridorEdge>& OutEdges)
+{
+    OutEdges.Reset();
+
+    const int32 Num = Centers.Num();
+    if (Num <= 1) return;
+
+    FIntPoint MinP = Centers[0];
+    FIntPoint MaxP = Centers[0];
+    for (const FIntPoint& C : Centers)
+    {
+        MinP = FIntPoint(FMath::Min(MinP.X, C.X), FMath::Min(MinP.Y, C.Y));
+        MaxP = FIntPoint(FMath::Max(MaxP.X, C.X), FMath::Max(MaxP.Y, C.Y));
+    }
+
+    // Bucket size chosen for roughly one center per bucket
+    const int32 SpanX = MaxP.X - MinP.X + 1;
+    const int32 SpanY = MaxP.Y - MinP.Y + 1;
+    const int32 BucketSize = FMath::Max(1, FMath::CeilToInt(FMath::Sqrt(static_cast<float>(SpanX) * static_cast<float>(SpanY) / static_cast<float>(Num))));
+    const int32 BucketsX = (SpanX + BucketSize - 1) / BucketSize;
+    const int32 BucketsY = (SpanY + BucketSize - 1) / BucketSize;
+
+    auto BucketCoord = [&](const FIntPoint& P)
+    {
+        return FIntPoint((P.X - MinP.X) / BucketSize, (P.Y - MinP.Y) / BucketSize);
+    };
+
+    // Counting sort into a flat bucket table (BucketStart[b]..BucketStart[b+1])
+    TArray<int32> BucketStart;
+    BucketStart.Init(0, BucketsX * BucketsY + 1);
+    for (const FIntPoint& C : Centers)
+    {
+        const FIntPoint B = BucketCoord(C);
+        ++BucketStart[B.Y * BucketsX + B.X + 1];
+    }
+    for (int32 b = 0; b < BucketsX * BucketsY; ++b)
+    {
+        BucketStart[b + 1] += BucketStart[b];
+    }
+
+    TArray<int32> BucketItems;
+    BucketItems.SetNumUninitialized(Num);
+    TArray<int32> FillCursor(BucketStart.GetData(), BucketsX * BucketsY);
+    for (int32 i = 0; i < Num; ++i)
+    {
+        const FIntPoint B = BucketCoord(Centers[i]);
+        BucketItems[FillCursor[B.Y * BucketsX + B.X]++] = i;
+    }
+
+    // k nearest (Manhattan) per center: widen the bucket ring until nothing outside it can be closer
+    const int32 K = FMath::Min(CorridorNeighborCount, Num - 1);
+    TArray<TPair<int32, int32>> Nearest; // (Distance, Index)
+    OutEdges.Reserve(Num * K);
+
+    for (int32 i = 0; i < Num; ++i)
+    {
+        const FIntPoint Home = BucketCoord(Centers[i]);
+        Nearest.Reset();
+
+        for (int32 Ring = 0; ; ++Ring)
+        {
+            for (int32 by = Home.Y - Ring; by <= Home.Y + Ring; ++by)
+            {
+                if (by < 0 || by >= BucketsY) continue;
+                for (int32 bx = Home.X - Ring; bx <= Home.X + Ring; ++bx)
+                {
+                    if (bx < 0 || bx >= BucketsX) continue;
+                    if (FMath::Max(FMath::Abs(bx - Home.X), FMath::Abs(by - Home.Y)) != Ring) continue;
+
+                    const int32 Bucket = by * BucketsX + bx;
+                    for (int32 Slot = BucketStart[Bucket]; Slot < BucketStart[Bucket + 1]; ++Slot)
+                    {
+                        const int32 j = BucketItems[Slot];
+                        if (j != i)
+                        {
+                            Nearest.Emplace(FGridUtils::ManhattanDistance(Centers[i], Centers[j]), j);
+                        }
+                    }
+                }
+            }
+
+            const bool bCoveredAll = Home.X - Ring <= 0 && Home.Y - Ring <= 0
+                && Home.X + Ring >= BucketsX - 1 && Home.Y + Ring >= BucketsY - 1;
+            if (Nearest.Num() >= K)
+            {
+                Nearest.Sort();
+                // Anything beyond this ring is at least Ring * BucketSize + 1 away
+                if (bCoveredAll || Nearest[K - 1].Key <= Ring * BucketSize + 1)
+                {
+                    break;
+                }
+            }
+            else if (bCoveredAll)
+            {
+                Nearest.Sort();
+                break;
+            }
+        }
+
+        for (int32 n = 0; n < FMath::Min(K, Nearest.Num()); ++n)
+        {
+            const int32 j = Nearest[n].Value;
+            OutEdges.Add({ FMath::Min(i, j), FMath::Max(i, j), Nearest[n].Key });
+        }
+    }
+
+    // Total order (distance, then indices) keeps Kruskal reproducible; drop the mutual duplicates
+    OutEdges.Sort([](const FCorridorEdge& L, const FCorridorEdge& R)
+    {
+        if (L.Distance != R.Distance) return L.Distance < R.Distance;
+        if (L.A != R.A) return L.A < R.A;
+        return L.B < R.B;
+    });
+
+    int32 Write = 0;
+    for (int32 Read = 0; Read < OutEdges.Num(); ++Read)
+    {
+        if (Write > 0 && OutEdges[Write - 1].A == OutEdges[Read].A && OutEdges[Write - 1].B == OutEdges[Read].B)
+        {
+            continue;
+        }
+        OutEdges[Write++] = OutEdges[Read];
+    }
+    OutEdges.SetNum(Write, EAllowShrinking::No);
+}
+
+void FDungeonGridBuilder::ConnectCentersWithMST(const TArray<FIntPoint>& Centers, ECellType CorridorType, TArray<TArray<int32>>* OutLoopNeighbors)
+{
+    if (OutLoopNeighbors)
+    {
+        OutLoopNeighbors->Reset();
+        OutLoopNeighbors->SetNum(Centers.Num());
+    }
+
+    const int32 Num = Centers.Num();
+    if (Num <= 1) return;
+
+    TArray<FCorridorEdge> candidates;
+    BuildCorridorCandidates(Centers, candidates);
+
+    // Kruskal over the candidate graph
+    DungeonGridBuilder_Private::FUnionFind sets(Num);
+    TArray<FCorridorEdge> tree;
+    tree.Reserve(Num - 1);
+    TBitArray<> inTree(false, candidates.Num());
+
+    for (int32 e = 0; e < candidates.Num() && tree.Num() < Num - 1; ++e)
+    {
+        if (sets.Union(candidates[e].A, candidates[e].B))
+        {
+            tree.Add(candidates[e]);
+            inTree[e] = true;
+        }
+    }
+
+    // The k-nearest graph can split far-apart clusters; bridge them with the closest cross pair
+    while (tree.Num() < Num - 1)
+    {
+        const int32 mainRoot = sets.Find(0);
+        FCorridorEdge best{ INDEX_NONE, INDEX_NONE, TNumericLimits<int32>::Max() };
+        for (int32 u = 0; u < Num; ++u)
+        {
+            if (sets.Find(u) != mainRoot) continue;
+            for (int32 v = 0; v < Num; ++v)
+            {
+                if (sets.Find(v) == mainRoot) continue;
+                const int32 d = FGridUtils::ManhattanDistance(Centers[u], Centers[v]);
+                if (d < best.Distance) { best = { FMath::Min(u, v), FMath::Max(u, v), d }; }
+            }
+        }
+        if (best.A == INDEX_NONE) break;
+        sets.Union(best.A, best.B);
+        tree.Add(best);
+    }
+
+    for (const FCorridorEdge& edge : tree)
+    {
+        CarveManhattan_XY(Centers[edge.A], Centers[edge.B], CorridorType);
+    }
+
+    if (OutLoopNeighbors)
+    {
+        for (int32 e = 0; e < candidates.Num(); ++e)
+        {
+            if (!inTree[e])
+            {
+                (*OutLoopNeighbors)[candidates[e].A].Add(candidates[e].B);
+                (*OutLoopNeighbors)[candidates[e].B].Add(candidates[e].A);
+            }
+        }
+    }
+}
+
+bool FDungeonGridBuilder::Make_NormalBSP(FRandomStream& RNG, const FDungeonResolvedParams& Params)
+{
+    const FIntRectLite root(Params.OuterMargin, Params.OuterMargin,
+        Width - 1 - Params.OuterMargin, Height - 1 - Params.OuterMargin);
+
+    TArray<FIntRectLite> leaves;
+    leaves.Reserve(Params.MaxRooms * 2);
+    BSP_Split(root, RNG, Params, leaves);
+
+    TArray<FIntPoint> centers;
+    centers.Reserve(Params.MaxRooms);
+    TArray<FIntRectLite> rooms;
+    rooms.Reserve(Params.MaxRooms);
+    int32 placed = 0;
+
+    for (auto& leaf : leaves)
+    {
+        if (placed >= Params.MaxRooms) break;
+        FIntRectLite room = MakeRoomInLeaf(leaf, RNG, Params, rooms);
+        if (!room.IsValid()) continue;
+
+        for (int y = room.Y0; y <= room.Y1; ++y)
+            for (int x = room.X0; x <= room.X1; ++x)
+                SetCellXY(x, y, ECellType::Room);
+
+        rooms.Add(room);
+        centers.Add(room.Center());
+        ++placed;
+    }
+
+    if (centers.Num() < Params.MinRooms) return false;
+    RoomCount = centers.Num();
+
+    TArray<TArray<int32>> loopNeighbors;
+    ConnectCentersWithMST(centers, ECellType::Corridor, &loopNeighbors);
+
+    // Loop-backs come from the same neighbour graph, so they stay local instead of crossing the map
+    for (int i = 0; i < centers.Num(); ++i)
+        if (RNG.FRand() < Params.ExtraConnectorChance && loopNeighbors[i].Num() > 0)
+        {
+            const int j = loopNeighbors[i][RNG.RandRange(0, loopNeighbors[i].Num() - 1)];
+            CarveManhattan_XY(centers[i], centers[j], ECellType::Corridor);
+        }
+
+    return true;
+}
+
+bool FDungeonGridBuilder::Make_LargeHall(FRandomStream& RNG, const FDungeonResolvedParams& Params)
+{
+    const int32 w = FMath::Clamp(Params.MaxRoomSize * 3, 6, Width - 2 - 2 * Params.OuterMargin);
+    const int32 h = FMath::Clamp(Params.MaxRoomSize * 3, 6, Height - 2 - 2 * Params.OuterMargin);
+    const int32 ox = (Width - w) / 2;
+    const int32 oy = (Height - h) / 2;
+
+    for (int y = oy; y < oy + h; ++y)
+        for (int x = ox; x < ox + w; ++x)
+            SetCellXY(x, y, ECellType::Room);
+
+    const int32 n = FMath::Clamp(Params.MinRooms / 2, 3, 10);
+    TArray<FIntPoint> centers;
+    centers.Reserve(n + 1);
+    centers.Add({ ox + w / 2, oy + h / 2 });
+    for (int i = 0; i < n; ++i)
+    {
+        const int32 rw = RNG.RandRange(Params.MinRoomSize, Params.MinRoomSize + 2);
+        const int32 rh = RNG.RandRange(Params.MinRoomSize, Params.MinRoomSize + 2);
+        const int32 rx = RNG.RandRange(Params.OuterMargin + 1, Width - rw - Params.OuterMargin - 1);
+        const int32 ry = RNG.RandRange(Params.OuterMargin + 1, Height - rh - Params.OuterMargin - 1);
+
+        for (int y = ry; y < ry + rh; ++y)
+            for (int x = rx; x < rx + rw; ++x)
+                SetCellXY(x, y, ECellType::Room);
+
+        const FIntPoint c{ rx + rw / 2, ry + rh / 2 };
+        centers.Add(c);
+        CarveManhattan_XY(c, centers[0], ECellType::Corridor);
+    }
+
+    RoomCount = centers.Num();
+    return true;
+}
+
+bool FDungeonGridBuilder::Make_FourQuads(FRandomStream& RNG, const FDungeonResolvedParams& Params)
+{
+    const int32 midX = Width / 2;
+    const int32 midY = Height / 2;
+    const int32 margin = FMath::Max(1, Params.RoomMargin);
+
+    auto placeRect = [&](int32 x0, int32 y0, int32 x1, int32 y1) -> FIntPoint
+    {
+        x0 = FMath::Clamp(x0 + margin, Params.OuterMargin + 1, Width - 2);
+        y0 = FMath::Clamp(y0 + margin, Params.OuterMargin + 1, Height - 2);
+        x1 = FMath::Clamp(x1 - margin, Params.OuterMargin + 1, Width - 2);
+        y1 = FMath::Clamp(y1 - margin, Params.OuterMargin + 1, Height - 2);
+
+        const int32 rw = FMath::Clamp(Params.MaxRoomSize, Params.MinRoomSize, (x1 - x0 + 1));
+        const int32 rh = FMath::Clamp(Params.MaxRoomSize, Params.MinRoomSize, (y1 - y0 + 1));
+        const int32 rx = x0 + (x1 - x0 - rw + 1) / 2;
+        const int32 ry = y0 + (y1 - y0 - rh + 1) / 2;
+
+        for (int y = ry; y < ry + rh; ++y)
+            for (int x = rx; x < rx + rw; ++x)
+                SetCellXY(x, y, ECellType::Room);
+
+        return { rx + rw / 2, ry + rh / 2 };
+    };
+
+    TArray<FIntPoint> centers;
+    centers.Reserve(4);
+    centers.Add(placeRect(1, 1, midX - 1, midY - 1));
+    centers.Add(placeRect(midX + 1, 1, Width - 2, midY - 1));
+    centers.Add(placeRect(1, midY + 1, midX - 1, Height - 2));
+    centers.Add(placeRect(midX + 1, midY + 1, Width - 2, Height - 2));
+
+    for (int x = Params.OuterMargin + 1; x < Width - Params.OuterMargin - 1; ++x) SetCellXY(x, midY, ECellType::Corridor);
+    for (int y = Params.OuterMargin + 1; y < Height - Params.OuterMargin - 1; ++y) SetCellXY(midX, y, ECellType::Corridor);
+
+    ConnectCentersWithMST(centers, ECellType::Corridor);
+    RoomCount = 4;
+    return true;
+}
+
+bool FDungeonGridBuilder::Make_CentralCrossWithMiniRooms(FRandomStream& RNG, const FDungeonResolvedParams& Params)
+{
+    const int32 y0 = Height / 2;
+    for (int x = Params.OuterMargin + 1; x < Width - Params.OuterMargin - 1; ++x) SetCellXY(x, y0, ECellType::Corridor);
+
+    const int interval = FMath::Max(Params.MinRoomSize + 2, 6);
+    const int32 EstimatedRooms = (Width - 2 * Params.OuterMargin) / interval + 2;
+
+    TArray<FIntPoint> centers;
+    centers.Reserve(EstimatedRooms);
+
+    for (int x = Params.OuterMargin + 2; x < Width - Params.OuterMargin - 2; x += interval)
+    {
+        const int32 rw = RNG.RandRange(Params.MinRoomSize, FMath::Min(Params.MinRoomSize + 1, Params.MaxRoomSize));
+        const int32 rh = RNG.RandRange(Params.MinRoomSize, FMath::Min(Params.MinRoomSize + 1, Params.MaxRoomSize));
+        const int32 rx = FMath::Clamp(x - rw / 2, Params.OuterMargin + 1, Width - rw - Params.OuterMargin - 1);
+        const int32 side = RNG.RandRange(0, 1) == 0 ? -1 : 1;
+        const int32 ry = FMath::Clamp(y0 + side * (2 + rh), Params.OuterMargin + 1, Height - rh - Params.OuterMargin - 1);
+
+        for (int y = ry; y < ry + rh; ++y)
+            for (int xx = rx; xx < rx + rw; ++xx)
+                SetCellXY(xx, y, ECellType::Room);
+
+        const FIntPoint c{ rx + rw / 2, ry + rh / 2 };
+        centers.Add(c);
+        CarveManhattan_XY(c, { x, y0 }, ECellType::Corridor);
+    }
+
+    RoomCount = centers.Num();
+    return centers.Num() > 0;
+}
+
+bool FDungeonGridBuilder::IsWalkable(int32 X, int32 Y) const
+{
+    const ECellType t = GetCellXY(X, Y);
+    return (t != ECellType::Wall);
+}
+
+bool FDungeonGridBuilder::GenerateFallbackLayout(const FDungeonResolvedParams& Params, FRandomStream& Rng)
+{
+    FDungeonResolvedParams RelaxedParams = Params;
+    RelaxedParams.MinRooms = FMath::Min(Params.MinRooms, 4);
+    RelaxedParams.ReachabilityThreshold = FMath::Min(Params.ReachabilityThreshold, 0.25f);
+
+    ResetGrid(ECellType::Wall);
+    EnsureOuterWall();
+
+    bool bGenerated = Make_CentralCrossWithMiniRooms(Rng, RelaxedParams);
+    if (!bGenerated)
+    {
+        const int32 Margin = FMath::Clamp(RelaxedParams.RoomMargin + 1, 1, 4);
+        const int32 RoomW = FMath::Clamp(Width - (Margin * 2), Params.MinRoomSize, Width - 2);
+        const int32 RoomH = FMath::Clamp(Height - (Margin * 2), Params.MinRoomSize, Height - 2);
+        FillRect(Margin, Margin, RoomW, RoomH, ECellType::Room);
+        RoomCount = 1;
+        bGenerated = true;
+    }
+
+    if (!bGenerated)
+    {
+        return false;
+    }
+    bUsedFallback = true;
+
+    FixDoubleWidthCorridors();
+    AutoPlaceDoors(RelaxedParams);
+    PlaceStairsFarthestPair();
+
+    LabelGrid(Cells, Width, Height, Labels);
+    WalkableCount = Labels.WalkableCount;
+    float ReachValue = 0.0f;
+    if (!ValidateReachability(Labels, ReachValue, RelaxedParams))
+    {
+        ReachValue = FMath::Clamp(ReachValue, 0.0f, 1.0f);
+    }
+    Reachability = ReachValue;
+
+    UE_LOG(LogTemp, Warning,
+        TEXT("Dungeon FALLBACK generated: Rooms=%d Walkable=%d Reach=%.1f%%"),
+        RoomCount,
+        WalkableCount,
+        ReachValue * 100.0f);
+    return true;
+}
+
+bool FDungeonGridBuilder::ValidateReachability(const FDungeonGridLabels& InLabels, float& OutRatio, const FDungeonResolvedParams& Params)
+{
+    // Component ids follow scan order, so id 0 is the component the old BFS started from
+    if (InLabels.WalkableCount == 0 || InLabels.WalkableSizes.Num() == 0) { OutRatio = 0.0f; return false; }
+
+    OutRatio = float(InLabels.WalkableSizes[0]) / float(InLabels.WalkableCount);
+    return OutRatio >= Params.ReachabilityThreshold;
+}
+
+void FDungeonGridBuilder::FillRect(int32 X, int32 Y, int32 W, int32 H, ECellType Type)
+{
+    for (int32 j = Y; j < Y + H; ++j)
+    {
+        for (int32 i = X; i < X + W; ++i)
+        {
+            if (InBounds(i, j))
+            {
+                SetCellXY(i, j, Type);
+            }
+        }
+    }
+}
@@ -0,0 +1,173 @@
+#pragma once
+
+// CodeRevision: INC-2025-1221-R1 (Grid generation as a pure function over a plain buffer) (2025-12-18 14:00)
+#include "CoreMinimal.h"
+#include "Math/RandomStream.h"
+#include "Grid/DungeonFloorGenerator.h"
+#include "Data/DungeonTemplateTypes.h"
+#include "Data/RogueFloorConfigData.h"
+
+/**
+ * Everything needed to generate one floor without touching UObjects.
+ * Built on the game thread (template pick + param resolve), consumed on any thread.
+ */
+struct LYRAGAME_API FDungeonFloorGenRequest
+{
+    FDungeonResolvedParams Params;
+    EMapTemplate Layout = EMapTemplate::NormalBSP;
+
+    // Stream state right after the template pick
+    FRandomStream Rng;
+};
+
+/** Output of FDungeonGridBuilder::GenerateFloor; applied with ADungeonFloorGenerator::ApplyGenerationResult. */
+struct LYRAGAME_API FDungeonFloorGenResult
+{
+    TArray<int32> Cells;
+    int32 Width = 0;
+    int32 Height = 0;
+    int32 CellSize = 100;
+    int32 Seed = 0;
+
+    int32 RoomCount = 0;
+    int32 WalkableCount = 0;
+    float Reachability = 0.0f;
+    bool bUsedFallback = false;
+
+    // CodeRevision: INC-2025-1224-R1 (Generation attempt count for the benchmark commandlet) (2025-12-20 10:00)
+    // Layout attempts made by the reroll loop (1 = accepted first try; MaxReroll when it fell back)
+    int32 Attempts = 0;
+
+    // Component labels of the final grid (room ids, sizes, bounding rects)
+    FDungeonGridLabels Labels;
+
+    bool IsValid() const { return Width > 0 && Height > 0 && Cells.Num() == Width * Height; }
+};
+
+/** Corridor candidate between two room centers (A < B), weighted by Manhattan distance. */
+struct FCorridorEdge
+{
+    int32 A = INDEX_NONE;
+    int32 B = INDEX_NONE;
+    int32 Distance = 0;
+};
+
+// CodeRevision: INC-2025-1226-R1 (Hidden wall culling and greedy wall merging) (2025-12-21 10:00)
+/** A straight run of wall cells rendered as one scaled instance. */
+struct FDungeonWallSegment
+{
+    FIntPoint Start = FIntPoint::ZeroValue;
+    int32 Length = 1;
+    bool bAlongX = true;
+
+    bool operator==(const FDungeonWallSegment& Other) const
+    {
+        return Start == Other.Start && Length == Other.Length && bAlongX == Other.bAlongX;
+    }
+};
+
+struct FDungeonWallMergeSettings
+{
+    // Skip walls with no walkable cell among their 8 neighbours
+    bool bCullHidden = true;
+    // Merge contiguous walls into runs (rows first, leftovers by column)
+    bool bMergeRuns = true;
+    int32 MaxRunLength = 8;
+};
+
+/**
+ * FDungeonGridBuilder: the generation algorithms over a caller-owned cell buffer.
+ *
+ * The builder is a view (it does not own the cells), so ADungeonFloorGenerator runs it over its
+ * GridCells while GenerateFloor runs it over a result buffer on a worker thread. Nothing in here
+ * touches UObjects.
+ */
+class LYRAGAME_API FDungeonGridBuilder
+{
+public:
+    FDungeonGridBuilder(TArray<int32>& InCells, int32 InWidth, int32 InHeight);
+
+    /** Full floor generation (reroll loop + fallback) for a native layout. Thread-safe. */
+    static void GenerateFloor(const FDungeonFloorGenRequest& Request, FDungeonFloorGenResult& Out);
+
+    /**
+     * Two-pass scanline union-find over the cells: walkable and room component ids, sizes and
+     * room bounding rects in one linear pass.
+     */
+    static void LabelGrid(const TArray<int32>& InCells, int32 InWidth, int32 InHeight, FDungeonGridLabels& OutLabels);
+
+    /**
+     * Render preprocessing for walls: drops walls nobody can see and merges the rest into runs.
+     * Returns the number of wall cells covered by OutSegments.
+     */
+    static int32 BuildWallSegments(const TArray<int32>& InCells, int32 InWidth, int32 InHeight, const FDungeonWallMergeSettings& Settings, TArray<FDungeonWallSegment>& OutSegments);
+
+    /**
+     * Reroll loop: carve with CarveLayout, post-process, validate room count and reachability.
+     * Falls back to a simple layout after MaxReroll rejections. Stats are left in the members below.
+     */
+    void Run(const FDungeonResolvedParams& Params, FRandomStream& Rng, TFunctionRef<void(FRandomStream&)> CarveLayout, const FString& LayoutName);
+
+    /** Carve one of the native preset layouts. */
+    bool MakeLayout(EMapTemplate Layout, FRandomStream& RNG, const FDungeonResolvedParams& Params);
+
+    bool Make_NormalBSP(FRandomStream& RNG, const FDungeonResolvedParams& Params);
+    bool Make_LargeHall(FRandomStream& RNG, const FDungeonResolvedParams& Params);
+    bool Make_FourQuads(FRandomStream& RNG, const FDungeonResolvedParams& Params);
+    bool Make_CentralCrossWithMiniRooms(FRandomStream& RNG, const FDungeonResolvedParams& Params);
+
+    FORCEINLINE bool InBounds(int32 X, int32 Y) const { return (X>=0 && Y>=0 && X<Width && Y<Height); }
+    FORCEINLINE int32 Index(int32 X, int32 Y) const { return Y*Width + X; }
+
+    void SetCellXY(int32 X, int32 Y, ECellType Type);
+    ECellType GetCellXY(int32 X, int32 Y) const;
+    void FillRect(int32 X, int32 Y, int32 W, int32 H, ECellType Type);
+
+    int32 RoomCount = 0;
+    int32 WalkableCount = 0;
+    float Reachability = 0.0f;
+    bool bUsedFallback = false;
+    int32 Attempts = 0;
+
+    // Labels of the accepted grid (valid after Run)
+    FDungeonGridLabels Labels;
+
+private:
+    void ResetGrid(ECellType Fill=ECellType::Wall);
+    void EnsureOuterWall();
+
+    void CarveLineX(const FIntPoint& A, const FIntPoint& B, ECellType Type);
+    void CarveLineY(const FIntPoint& A, const FIntPoint& B, ECellType Type);
+    void CarveManhattan_XY(const FIntPoint& A, const FIntPoint& B, ECellType Type);
+
+    void FixDoubleWidthCorridors();
+    void AutoPlaceDoors(const FDungeonResolvedParams& Params);
+    void PlaceDoorIfBoundary(int32 X, int32 Y, const FDungeonResolvedParams& Params);
+    bool IsValidDoorPlacement(int32 X, int32 Y, const FDungeonResolvedParams& Params) const;
+    void PlaceStairsFarthestPair();
+
+    void BSP_Split(const FIntRectLite& Root, FRandomStream& RNG, const FDungeonResolvedParams& Params, TArray<FIntRectLite>& OutLeaves);
+    FIntRectLite MakeRoomInLeaf(const FIntRectLite& Leaf, FRandomStream& RNG, const FDungeonResolvedParams& Params, const TArray<FIntRectLite>& ExistingRooms) const;
+
+    // CodeRevision: INC-2025-1222-R1 (Kruskal MST over a grid-bucketed neighbour graph) (2025-12-19 10:00)
+    /** Candidate graph: each center linked to its CorridorNeighborCount nearest (grid buckets), sorted and deduplicated. */
+    static void BuildCorridorCandidates(const TArray<FIntPoint>& Centers, TArray<FCorridorEdge>& OutEdges);
+
+    /**
+     * Kruskal MST over the candidate graph, carved as Manhattan corridors. Non-tree candidates
+     * per center are returned in OutLoopNeighbors for loop-back connectors.
+     */
+    void ConnectCentersWithMST(const TArray<FIntPoint>& Centers, ECellType CorridorType=ECellType::Corridor, TArray<TArray<int32>>* OutLoopNeighbors=nullptr);
+
+    static constexpr int32 CorridorNeighborCount = 6;
+
+    /** Share of walkable cells in the component of the first walkable cell (scan order). */
+    static bool ValidateReachability(const FDungeonGridLabels& InLabels, float& OutRatio, const FDungeonResolvedParams& Params);
+    bool IsWalkable(int32 X, int32 Y) const;
+
+    bool GenerateFallbackLayout(const FDungeonResolvedParams& Params, FRandomStream& Rng);
+
+    TArray<int32>& Cells;
+    int32 Width = 0;
+    int32 Height = 0;
+};
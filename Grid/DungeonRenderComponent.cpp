@@ -1,14 +1,37 @@
 #include "DungeonRenderComponent.h"
 #include "Components/InstancedStaticMeshComponent.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
 #include "Components/SceneComponent.h"
 #include "Engine/StaticMesh.h"
 #include "Engine/CollisionProfile.h"
 #include "Materials/MaterialInterface.h"
 #include "DrawDebugHelpers.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Kismet/GameplayStatics.h"
+#include "GameFramework/Pawn.h"
+
+// CodeRevision: INC-2025-1225-R1 (Bulk and incremental instance building) (2025-12-20 14:00)
+static int32 GTS_Dungeon_IncrementalRender = 1;
+static FAutoConsoleVariableRef CVarTS_Dungeon_IncrementalRender(
+    TEXT("ts.Dungeon.IncrementalRender"),
+    GTS_Dungeon_IncrementalRender,
+    TEXT("1: re-renders and terrain edits patch only the changed cells. 0: always rebuild every instance."),
+    ECVF_Default);
+
+// CodeRevision: INC-2025-1227-R1 (Chunked HISM rendering with distance streaming) (2025-12-21 14:00)
+static int32 GTS_Dungeon_ChunkedRender = 1;
+static FAutoConsoleVariableRef CVarTS_Dungeon_ChunkedRender(
+    TEXT("ts.Dungeon.ChunkedRender"),
+    GTS_Dungeon_ChunkedRender,
+    TEXT("1: large floors render as streamed HISM chunks (bUseChunkedRendering). 0: always one ISM per mesh category."),
+    ECVF_Default);
 
 UDungeonRenderComponent::UDungeonRenderComponent()
 {
-    PrimaryComponentTick.bCanEverTick = false;
+    // Ticks only while chunked rendering streams chunks around the player
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bStartWithTickEnabled = false;
     bVisualizeComponent = false;
     if (CollisionProfileName.IsNone())
     {
@@ -25,10 +48,22 @@ void UDungeonRenderComponent::BeginPlay()
 
 void UDungeonRenderComponent::OnComponentDestroyed(bool bDestroyingHierarchy)
 {
+    BindFloorGenerator(nullptr);
+    ReleaseAllChunks();
     DestroyISMComponents();
     Super::OnComponentDestroyed(bDestroyingHierarchy);
 }
 
+void UDungeonRenderComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+    if (bChunked)
+    {
+        UpdateChunkStreaming(MaxChunkBuildsPerTick);
+    }
+}
+
 void UDungeonRenderComponent::CreateISMComponents()
 {
     DestroyISMComponents();
@@ -55,19 +90,49 @@ void UDungeonRenderComponent::DestroyISMComponents()
         if (ISM) ISM->DestroyComponent();
     AllISMs.Empty();
     WallISM = FloorISM = CorridorISM = RoomISM = DoorISM = StairISM = nullptr;
+    ResetRenderedState();
+}
+
+bool UDungeonRenderComponent::ISMsMatchMeshSet() const
+{
+    if (AllISMs.Num() == 0) return false;
+
+    auto Matches = [](const UInstancedStaticMeshComponent* ISM, const UStaticMesh* Mesh)
+    {
+        return ISM ? (IsValid(ISM) && ISM->GetStaticMesh() == Mesh) : (Mesh == nullptr);
+    };
+    return Matches(WallISM, MeshSet.WallMesh) && Matches(FloorISM, MeshSet.FloorMesh)
+        && Matches(CorridorISM, MeshSet.CorridorMesh) && Matches(RoomISM, MeshSet.RoomMesh)
+        && Matches(DoorISM, MeshSet.DoorMesh) && Matches(StairISM, MeshSet.StairMesh);
+}
+
+void UDungeonRenderComponent::ResetRenderedState()
+{
+    RenderedCategory.Reset();
+    RenderedInstance.Reset();
+    for (TArray<int32>& Cells : InstanceCells)
+        Cells.Reset();
+    WallSegments.Reset();
+    RenderedWidth = RenderedHeight = 0;
 }
 
 UInstancedStaticMeshComponent* UDungeonRenderComponent::CreateISMComponent(
-    const FString& ComponentName, UStaticMesh* Mesh, UMaterialInterface* Material)
+    const FString& ComponentName, UStaticMesh* Mesh, UMaterialInterface* Material, UClass* ComponentClass)
 {
     if (!Mesh) return nullptr;
     AActor* Owner = GetOwner();
     if (!Owner) return nullptr;
 
-    auto* ISM = NewObject<UInstancedStaticMeshComponent>(Owner, *ComponentName);
+    // Chunks are created and released repeatedly, so names must not collide with components pending destroy
+    if (!ComponentClass) ComponentClass = UInstancedStaticMeshComponent::StaticClass();
+    const FName UniqueName = MakeUniqueObjectName(Owner, ComponentClass, FName(*ComponentName));
+    auto* ISM = NewObject<UInstancedStaticMeshComponent>(Owner, ComponentClass, UniqueName);
     ISM->SetStaticMesh(Mesh);
     if (Material) ISM->SetMaterial(0, Material);
 
+    // Removing an instance moves the last one into its slot, so edits never shift the whole buffer
+    ISM->bSupportRemoveAtSwap = true;
+
     if (bEnableCollision)
     {
         if (!CollisionProfileName.IsNone())
@@ -103,63 +168,401 @@ FVector UDungeonRenderComponent::GridToWorldPosition(int32 GridX, int32 GridY, f
     return FVector(WorldX, WorldY, WorldZ);
 }
 
-void UDungeonRenderComponent::AddInstanceToISM(UInstancedStaticMeshComponent* ISM, int32 GridX, int32 GridY, float Height)
+UInstancedStaticMeshComponent* UDungeonRenderComponent::GetCategoryISM(int32 Category) const
+{
+    switch (Category)
+    {
+        case Cat_Wall:     return WallISM;
+        case Cat_Floor:    return FloorISM;
+        case Cat_Corridor: return CorridorISM;
+        case Cat_Room:     return RoomISM;
+        case Cat_Door:     return DoorISM;
+        case Cat_Stair:    return StairISM;
+        default:           return nullptr;
+    }
+}
+
+int32 UDungeonRenderComponent::GetCellCategory(int32 CellValue) const
+{
+    int32 Category = INDEX_NONE;
+    if (CellValue < 0)
+    {
+        Category = Cat_Wall;
+    }
+    else
+    {
+        switch (static_cast<ECellType>(CellValue))
+        {
+            case ECellType::Wall:      Category = Cat_Wall; break;
+            case ECellType::Floor:     Category = Cat_Floor; break;
+            case ECellType::Corridor:  Category = Cat_Corridor; break;
+            case ECellType::Room:      Category = Cat_Room; break;
+            case ECellType::Door:      Category = Cat_Door; break;
+            case ECellType::StairUp:
+            case ECellType::StairDown: Category = Cat_Stair; break;
+            default: break;
+        }
+    }
+
+    // A category without a mesh renders nothing
+    return (Category != INDEX_NONE && GetCategoryMesh(Category)) ? Category : INDEX_NONE;
+}
+
+UStaticMesh* UDungeonRenderComponent::GetCategoryMesh(int32 Category) const
+{
+    switch (Category)
+    {
+        case Cat_Wall:     return MeshSet.WallMesh;
+        case Cat_Floor:    return MeshSet.FloorMesh;
+        case Cat_Corridor: return MeshSet.CorridorMesh;
+        case Cat_Room:     return MeshSet.RoomMesh;
+        case Cat_Door:     return MeshSet.DoorMesh;
+        case Cat_Stair:    return MeshSet.StairMesh;
+        default:           return nullptr;
+    }
+}
+
+UMaterialInterface* UDungeonRenderComponent::GetCategoryMaterial(int32 Category) const
+{
+    switch (Category)
+    {
+        case Cat_Wall:     return MeshSet.WallMaterial;
+        case Cat_Floor:    return MeshSet.FloorMaterial;
+        case Cat_Corridor: return MeshSet.CorridorMaterial;
+        case Cat_Room:     return MeshSet.RoomMaterial;
+        case Cat_Door:     return MeshSet.DoorMaterial;
+        case Cat_Stair:    return MeshSet.StairMaterial;
+        default:           return nullptr;
+    }
+}
+
+FTransform UDungeonRenderComponent::MakeCellTransform(int32 GridX, int32 GridY, float Height) const
+{
+    return FTransform(FRotator::ZeroRotator, GridToWorldPosition(GridX, GridY, Height), FVector::OneVector);
+}
+
+FTransform UDungeonRenderComponent::MakeWallSegmentTransform(const FDungeonWallSegment& Segment) const
 {
-    if (!ISM) return;
-    FVector Position = GridToWorldPosition(GridX, GridY, Height);
-    FTransform Transform(FRotator::ZeroRotator, Position, FVector::OneVector);
-    ISM->AddInstance(Transform);
+    const FVector Base = GetComponentLocation();
+    const float Span = static_cast<float>(Segment.Length);
+    const float CenterX = Segment.Start.X + (Segment.bAlongX ? Span * 0.5f : 0.5f);
+    const float CenterY = Segment.Start.Y + (Segment.bAlongX ? 0.5f : Span * 0.5f);
+    const FVector Position(Base.X + CenterX * CellSizeUU, Base.Y + CenterY * CellSizeUU, Base.Z);
+    const FVector Scale(Segment.bAlongX ? Span : 1.0f, Segment.bAlongX ? 1.0f : Span, 1.0f);
+    return FTransform(FRotator::ZeroRotator, Position, Scale);
 }
 
 void UDungeonRenderComponent::BuildAllInstances(ADungeonFloorGenerator* FloorGenerator)
 {
     if (!FloorGenerator) return;
 
-    CreateISMComponents();
+    const double StartSeconds = FPlatformTime::Seconds();
+
+    if (!ISMsMatchMeshSet())
+    {
+        CreateISMComponents();
+    }
 
     const int32 W = FloorGenerator->GridWidth;
     const int32 H = FloorGenerator->GridHeight;
     const TArray<int32>& Grid = FloorGenerator->GridCells;
 
+    ResetRenderedState();
+    RenderedWidth = W;
+    RenderedHeight = H;
+    RenderedCategory.Init(INDEX_NONE, W * H);
+    RenderedInstance.Init(INDEX_NONE, W * H);
+
+    // Transforms per category first, then one bulk submit per ISM
+    TArray<FTransform> Transforms[Cat_Num];
     for (int32 Y = 0; Y < H; ++Y)
     {
         for (int32 X = 0; X < W; ++X)
         {
-            const int32 Value = Grid[Y * W + X];
+            const int32 CellIndex = Y * W + X;
+            const int32 Category = GetCellCategory(Grid[CellIndex]);
+            if (Category == INDEX_NONE) continue;
+
+            RenderedCategory[CellIndex] = Category;
+            if (Category == Cat_Wall) continue;
+
+            RenderedInstance[CellIndex] = Transforms[Category].Add(MakeCellTransform(X, Y));
+            InstanceCells[Category].Add(CellIndex);
+        }
+    }
+
+    RebuildWallInstances(FloorGenerator, true);
+
+    for (int32 Category = 0; Category < Cat_Num; ++Category)
+    {
+        if (Category == Cat_Wall) continue;
+
+        if (UInstancedStaticMeshComponent* ISM = GetCategoryISM(Category))
+        {
+            ISM->ClearInstances();
+            if (Transforms[Category].Num() > 0)
+            {
+                ISM->AddInstances(Transforms[Category], /*bShouldReturnIndices=*/false);
+            }
+        }
+    }
+
+    UpdateInstanceStats(StartSeconds, false, W * H);
+}
+
+void UDungeonRenderComponent::RemoveCellInstance(int32 CellIndex)
+{
+    const int32 Category = RenderedCategory[CellIndex];
+    const int32 Instance = RenderedInstance[CellIndex];
+    UInstancedStaticMeshComponent* ISM = GetCategoryISM(Category);
+    if (ISM && Instance != INDEX_NONE)
+    {
+        // Mirror the ISM's remove-at-swap: the last instance takes over the freed slot
+        TArray<int32>& Owners = InstanceCells[Category];
+        ISM->RemoveInstance(Instance);
+        const int32 MovedCell = Owners.Last();
+        Owners.RemoveAtSwap(Instance, EAllowShrinking::No);
+        if (MovedCell != CellIndex)
+        {
+            RenderedInstance[MovedCell] = Instance;
+        }
+    }
+
+    RenderedCategory[CellIndex] = INDEX_NONE;
+    RenderedInstance[CellIndex] = INDEX_NONE;
+}
+
+void UDungeonRenderComponent::PatchCells(ADungeonFloorGenerator* FloorGenerator, const TArray<int32>& CellIndices)
+{
+    if (!FloorGenerator) return;
+
+    const double StartSeconds = FPlatformTime::Seconds();
+    const TArray<int32>& Grid = FloorGenerator->GridCells;
+
+    // Removals first (they renumber via swap), then one bulk add per category
+    TArray<FTransform> Transforms[Cat_Num];
+    TArray<int32> AddedCells[Cat_Num];
+    bool bWallsChanged = false;
+    for (const int32 CellIndex : CellIndices)
+    {
+        const bool bWasWall = RenderedCategory[CellIndex] == Cat_Wall;
+        RemoveCellInstance(CellIndex);
+
+        const int32 Category = GetCellCategory(Grid[CellIndex]);
+        bWallsChanged |= bWasWall != (Category == Cat_Wall);
+        if (Category == INDEX_NONE) continue;
+
+        // Wall exposure depends on the neighbours, so walls are re-segmented below instead
+        if (Category == Cat_Wall)
+        {
+            RenderedCategory[CellIndex] = Cat_Wall;
+            continue;
+        }
+
+        Transforms[Category].Add(MakeCellTransform(CellIndex % RenderedWidth, CellIndex / RenderedWidth));
+        AddedCells[Category].Add(CellIndex);
+    }
+
+    for (int32 Category = 0; Category < Cat_Num; ++Category)
+    {
+        UInstancedStaticMeshComponent* ISM = GetCategoryISM(Category);
+        if (!ISM || Transforms[Category].Num() == 0) continue;
+
+        const TArray<int32> NewIndices = ISM->AddInstances(Transforms[Category], /*bShouldReturnIndices=*/true);
+        for (int32 i = 0; i < AddedCells[Category].Num() && i < NewIndices.Num(); ++i)
+        {
+            const int32 CellIndex = AddedCells[Category][i];
+            RenderedCategory[CellIndex] = Category;
+            RenderedInstance[CellIndex] = NewIndices[i];
+            InstanceCells[Category].Add(CellIndex);
+        }
+    }
+
+    if (bWallsChanged)
+    {
+        RebuildWallInstances(FloorGenerator, false);
+    }
+
+    UpdateInstanceStats(StartSeconds, true, CellIndices.Num());
+}
+
+// CodeRevision: INC-2025-1226-R1 (Hidden wall culling and greedy wall merging) (2025-12-21 10:00)
+void UDungeonRenderComponent::RebuildWallInstances(ADungeonFloorGenerator* FloorGenerator, bool bForce)
+{
+    if (!FloorGenerator || !WallISM) return;
+
+    FDungeonWallMergeSettings Settings;
+    Settings.bCullHidden = bCullHiddenWalls;
+    Settings.bMergeRuns = bMergeWallRuns;
+    Settings.MaxRunLength = MaxWallRunLength;
+
+    TArray<FDungeonWallSegment> NewSegments;
+    const int32 VisibleCells = FDungeonGridBuilder::BuildWallSegments(FloorGenerator->GridCells, RenderedWidth, RenderedHeight, Settings, NewSegments);
+
+    int32 WallCells = 0;
+    for (const int32 Category : RenderedCategory)
+        WallCells += (Category == Cat_Wall) ? 1 : 0;
+    RenderStats.VisibleWallCells = VisibleCells;
+    RenderStats.HiddenWallCells = WallCells - VisibleCells;
+
+    // Most edits leave the segmentation untouched (e.g. a wall deep in rock)
+    if (!bForce && NewSegments == WallSegments) return;
+    WallSegments = MoveTemp(NewSegments);
+
+    TArray<FTransform> Transforms;
+    Transforms.Reserve(WallSegments.Num());
+    for (const FDungeonWallSegment& Segment : WallSegments)
+    {
+        Transforms.Add(MakeWallSegmentTransform(Segment));
+    }
+
+    WallISM->ClearInstances();
+    if (Transforms.Num() > 0)
+    {
+        WallISM->AddInstances(Transforms, /*bShouldReturnIndices=*/false);
+    }
+}
+
+void UDungeonRenderComponent::UpdateInstanceStats(double StartSeconds, bool bIncremental, int32 ChangedCells)
+{
+    RenderStats.LastBuildMs = static_cast<float>((FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+    RenderStats.bLastBuildIncremental = bIncremental;
+    RenderStats.LastChangedCells = ChangedCells;
+
+    RenderStats.WallInstances     = WallSegments.Num();
+    RenderStats.FloorInstances    = InstanceCells[Cat_Floor].Num();
+    RenderStats.CorridorInstances = InstanceCells[Cat_Corridor].Num();
+    RenderStats.RoomInstances     = InstanceCells[Cat_Room].Num();
+    RenderStats.DoorInstances     = InstanceCells[Cat_Door].Num();
+    RenderStats.StairInstances    = InstanceCells[Cat_Stair].Num();
+    RenderStats.TotalInstances    = RenderStats.WallInstances + RenderStats.FloorInstances + RenderStats.CorridorInstances
+                                  + RenderStats.RoomInstances + RenderStats.DoorInstances + RenderStats.StairInstances;
+
+    if (bIncremental)
+        ++RenderStats.IncrementalBuildCount;
+    else
+        ++RenderStats.FullBuildCount;
+
+    // CodeRevision: INC-2025-1225-R2 (Cell/instance map check for incremental patches) (2025-12-27 21:00)
+    // Runs on every terrain edit; stats stay available through GetRenderStats
+    UE_LOG(LogTemp, Verbose, TEXT("[DungeonRenderComponent] %s build: %.2f ms, %d cells, %d instances (Wall=%d Floor=%d Corridor=%d Room=%d Door=%d Stair=%d, WallCells visible=%d hidden=%d)"),
+        bIncremental ? TEXT("Incremental") : TEXT("Full"),
+        RenderStats.LastBuildMs, ChangedCells, RenderStats.TotalInstances,
+        RenderStats.WallInstances, RenderStats.FloorInstances, RenderStats.CorridorInstances,
+        RenderStats.RoomInstances, RenderStats.DoorInstances, RenderStats.StairInstances,
+        RenderStats.VisibleWallCells, RenderStats.HiddenWallCells);
+}
+
+bool UDungeonRenderComponent::ValidateInstanceMaps(FString& OutError) const
+{
+    const int32 NumCells = RenderedWidth * RenderedHeight;
+    if (bChunked || RenderedCategory.Num() != NumCells || RenderedInstance.Num() != NumCells)
+    {
+        OutError = TEXT("no non-chunked render to check");
+        return false;
+    }
+
+    for (int32 Category = 0; Category < Cat_Num; ++Category)
+    {
+        if (Category == Cat_Wall) continue;
+
+        const TArray<int32>& Owners = InstanceCells[Category];
+        const UInstancedStaticMeshComponent* ISM = GetCategoryISM(Category);
+        const int32 ISMCount = ISM ? ISM->GetInstanceCount() : 0;
+        if (Owners.Num() != ISMCount)
+        {
+            OutError = FString::Printf(TEXT("category %d: %d owners, %d instances"), Category, Owners.Num(), ISMCount);
+            return false;
+        }
 
-            if (Value < 0)
+        for (int32 Instance = 0; Instance < Owners.Num(); ++Instance)
+        {
+            const int32 CellIndex = Owners[Instance];
+            if (!RenderedCategory.IsValidIndex(CellIndex) || RenderedCategory[CellIndex] != Category || RenderedInstance[CellIndex] != Instance)
             {
-                AddInstanceToISM(WallISM, X, Y);
-                continue;
+                OutError = FString::Printf(TEXT("category %d instance %d: owner cell %d does not point back"), Category, Instance, CellIndex);
+                return false;
             }
 
-            const ECellType CellType = static_cast<ECellType>(Value);
-            switch (CellType)
+            FTransform InstanceTransform;
+            ISM->GetInstanceTransform(Instance, InstanceTransform, /*bWorldSpace=*/false);
+            const FVector Expected = MakeCellTransform(CellIndex % RenderedWidth, CellIndex / RenderedWidth).GetLocation();
+            if (!FVector2D(InstanceTransform.GetLocation()).Equals(FVector2D(Expected), 0.1))
             {
-                case ECellType::Wall:
-                    AddInstanceToISM(WallISM, X, Y);
-                    break;
-                case ECellType::Floor:
-                    AddInstanceToISM(FloorISM, X, Y);
-                    break;
-                case ECellType::Corridor:
-                    AddInstanceToISM(CorridorISM, X, Y);
-                    break;
-                case ECellType::Room:
-                    AddInstanceToISM(RoomISM, X, Y);
-                    break;
-                case ECellType::Door:
-                    AddInstanceToISM(DoorISM, X, Y);
-                    break;
-                case ECellType::StairUp:
-                case ECellType::StairDown:
-                    AddInstanceToISM(StairISM, X, Y);
-                    break;
-                default:
-                    break;
+                OutError = FString::Printf(TEXT("category %d instance %d: drawn away from cell %d"), Category, Instance, CellIndex);
+                return false;
             }
         }
     }
+
+    for (int32 CellIndex = 0; CellIndex < NumCells; ++CellIndex)
+    {
+        const int32 Category = RenderedCategory[CellIndex];
+        const int32 Instance = RenderedInstance[CellIndex];
+        const bool bInstanced = Category != INDEX_NONE && Category != Cat_Wall;
+        if (bInstanced != (Instance != INDEX_NONE)
+            || (bInstanced && (!InstanceCells[Category].IsValidIndex(Instance) || InstanceCells[Category][Instance] != CellIndex)))
+        {
+            OutError = FString::Printf(TEXT("cell %d: category %d instance %d not owned"), CellIndex, Category, Instance);
+            return false;
+        }
+    }
+
+    OutError.Reset();
+    return true;
+}
+
+void UDungeonRenderComponent::RefreshCells(const TArray<FIntPoint>& Cells)
+{
+    if (bChunked)
+    {
+        RefreshChunkCells(Cells);
+        return;
+    }
+
+    if (!CachedFloorGenerator || RenderedCategory.Num() == 0) return;
+
+    // A different grid size means the cached floor was replaced under us
+    if (CachedFloorGenerator->GridWidth != RenderedWidth || CachedFloorGenerator->GridHeight != RenderedHeight)
+    {
+        BuildAllInstances(CachedFloorGenerator);
+        return;
+    }
+
+    TArray<int32> CellIndices;
+    CellIndices.Reserve(Cells.Num());
+    for (const FIntPoint& Cell : Cells)
+    {
+        if (Cell.X < 0 || Cell.Y < 0 || Cell.X >= RenderedWidth || Cell.Y >= RenderedHeight) continue;
+        CellIndices.AddUnique(Cell.Y * RenderedWidth + Cell.X);
+    }
+
+    if (GTS_Dungeon_IncrementalRender == 0)
+    {
+        BuildAllInstances(CachedFloorGenerator);
+        return;
+    }
+    PatchCells(CachedFloorGenerator, CellIndices);
+}
+
+void UDungeonRenderComponent::BindFloorGenerator(ADungeonFloorGenerator* FloorGenerator)
+{
+    if (CachedFloorGenerator && CellChangedHandle.IsValid())
+    {
+        CachedFloorGenerator->OnCellChanged.Remove(CellChangedHandle);
+    }
+    CellChangedHandle.Reset();
+
+    CachedFloorGenerator = FloorGenerator;
+    if (FloorGenerator)
+    {
+        CellChangedHandle = FloorGenerator->OnCellChanged.AddUObject(this, &UDungeonRenderComponent::HandleCellChanged);
+    }
+}
+
+void UDungeonRenderComponent::HandleCellChanged(const FIntPoint& Cell)
+{
+    RefreshCells({ Cell });
 }
 
 void UDungeonRenderComponent::ExtractDungeonFeatures(ADungeonFloorGenerator* FloorGenerator)
@@ -297,7 +700,11 @@ void UDungeonRenderComponent::RenderDungeonFromFloor(ADungeonFloorGenerator* Flo
             *GetNameSafe(MeshSet.WallMesh));
     }
 
-    CachedFloorGenerator = FloorGenerator;
+    if (CachedFloorGenerator != FloorGenerator || !CellChangedHandle.IsValid())
+    {
+        BindFloorGenerator(FloorGenerator);
+    }
+    const bool bCellSizeChanged = CellSizeUU != FloorGenerator->CellSize;
     CellSizeUU = FloorGenerator->CellSize;
 
     const bool bShouldRender = (GetWorld()->IsGameWorld() && bRenderInGame) ||
@@ -308,7 +715,57 @@ void UDungeonRenderComponent::RenderDungeonFromFloor(ADungeonFloorGenerator* Flo
         return;
     }
 
-    BuildAllInstances(FloorGenerator);
+    // Large floors stream as chunks around the player instead of one ISM per category
+    const int32 NumCells = FloorGenerator->GridWidth * FloorGenerator->GridHeight;
+    if (GTS_Dungeon_ChunkedRender != 0 && bUseChunkedRendering && NumCells >= ChunkedRenderMinCells)
+    {
+        // CodeRevision: INC-2025-1227-R2 (Reuse chunks across same-sized re-renders) (2025-12-27 13:00)
+        // Same grid, chunk size and meshes: keep the chunks and rebuild only the ones whose cells changed
+        const bool bCanReuseChunks = GTS_Dungeon_IncrementalRender != 0 && bChunked && !bCellSizeChanged
+            && ChunkCellSize == FMath::Max(1, ChunkSize) && ChunksMatchMeshSet()
+            && RenderedWidth == FloorGenerator->GridWidth && RenderedHeight == FloorGenerator->GridHeight
+            && RenderedCategory.Num() == NumCells && FloorGenerator->GridCells.Num() == NumCells;
+
+        if (bCanReuseChunks)
+        {
+            PatchChunks(FloorGenerator);
+        }
+        else
+        {
+            DestroyISMComponents();
+            InitChunks(FloorGenerator);
+        }
+    }
+    else
+    {
+        ReleaseAllChunks();
+
+        // Same-sized grid on the same meshes: diff against what is instanced and patch the changed cells
+        const bool bCanPatch = GTS_Dungeon_IncrementalRender != 0 && !bCellSizeChanged && ISMsMatchMeshSet()
+            && RenderedWidth == FloorGenerator->GridWidth && RenderedHeight == FloorGenerator->GridHeight
+            && RenderedCategory.Num() == NumCells && FloorGenerator->GridCells.Num() == NumCells;
+
+        TArray<int32> ChangedCells;
+        if (bCanPatch)
+        {
+            for (int32 CellIndex = 0; CellIndex < NumCells; ++CellIndex)
+            {
+                if (GetCellCategory(FloorGenerator->GridCells[CellIndex]) != RenderedCategory[CellIndex])
+                {
+                    ChangedCells.Add(CellIndex);
+                }
+            }
+        }
+
+        if (bCanPatch && ChangedCells.Num() <= FMath::FloorToInt(NumCells * IncrementalRebuildMaxFraction))
+        {
+            PatchCells(FloorGenerator, ChangedCells);
+        }
+        else
+        {
+            BuildAllInstances(FloorGenerator);
+        }
+    }
     ExtractDungeonFeatures(FloorGenerator);
 
     if (DebugDrawMode != EDebugDrawMode::None)
@@ -327,6 +784,8 @@ void UDungeonRenderComponent::ClearAllInstances()
 {
     for (UInstancedStaticMeshComponent* ISM : AllISMs)
         if (ISM) ISM->ClearInstances();
+    ResetRenderedState();
+    ReleaseAllChunks();
     CachedRoomCenters.Empty();
 }
 
@@ -339,3 +798,443 @@ EDebugDrawMode UDungeonRenderComponent::GetDebugDrawMode() const
 {
     return DebugDrawMode;
 }
+
+//------------------------------------------------------------------------------
+// Chunked rendering
+//------------------------------------------------------------------------------
+
+// CodeRevision: INC-2025-1227-R1 (Chunked HISM rendering with distance streaming) (2025-12-21 14:00)
+void UDungeonRenderComponent::InitChunks(ADungeonFloorGenerator* FloorGenerator)
+{
+    ReleaseAllChunks();
+    if (!FloorGenerator) return;
+
+    const double StartSeconds = FPlatformTime::Seconds();
+    RenderedWidth = FloorGenerator->GridWidth;
+    RenderedHeight = FloorGenerator->GridHeight;
+    ChunkCellSize = FMath::Max(1, ChunkSize);
+
+    // CodeRevision: INC-2025-1227-R2 (Reuse chunks across same-sized re-renders) (2025-12-27 13:00)
+    const TArray<int32>& Grid = FloorGenerator->GridCells;
+    RenderedCategory.Init(INDEX_NONE, RenderedWidth * RenderedHeight);
+    for (int32 CellIndex = 0; CellIndex < RenderedCategory.Num() && CellIndex < Grid.Num(); ++CellIndex)
+    {
+        RenderedCategory[CellIndex] = GetCellCategory(Grid[CellIndex]);
+    }
+    ChunkGridSize = FIntPoint(
+        FMath::DivideAndRoundUp(RenderedWidth, ChunkCellSize),
+        FMath::DivideAndRoundUp(RenderedHeight, ChunkCellSize));
+
+    Chunks.SetNum(ChunkGridSize.X * ChunkGridSize.Y);
+    for (int32 ChunkIndex = 0; ChunkIndex < Chunks.Num(); ++ChunkIndex)
+    {
+        FDungeonRenderChunk& Chunk = Chunks[ChunkIndex];
+        Chunk.Components.SetNum(Cat_Num);
+        Chunk.CategoryInstances.Init(0, Cat_Num);
+        Chunk.Stats.Chunk = FIntPoint(ChunkIndex % ChunkGridSize.X, ChunkIndex / ChunkGridSize.X);
+    }
+
+    AssignWallsToChunks(FloorGenerator);
+    bChunked = true;
+
+    // Everything near the player is built before the floor is shown; the rest streams in on tick
+    UpdateChunkStreaming(TNumericLimits<int32>::Max());
+
+    RenderStats.LastBuildMs = static_cast<float>((FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+    RenderStats.LastChangedCells = RenderedWidth * RenderedHeight;
+    RenderStats.bLastBuildIncremental = false;
+    ++RenderStats.FullBuildCount;
+
+    PrimaryComponentTick.TickInterval = ChunkStreamInterval;
+    SetComponentTickEnabled(true);
+
+    UE_LOG(LogTemp, Log, TEXT("[DungeonRenderComponent] Chunked render: %dx%d chunks of %d cells, %d built up front (%.2f ms)"),
+        ChunkGridSize.X, ChunkGridSize.Y, ChunkCellSize, RenderStats.ChunksBuilt, RenderStats.LastBuildMs);
+}
+
+// CodeRevision: INC-2025-1227-R2 (Reuse chunks across same-sized re-renders) (2025-12-27 13:00)
+void UDungeonRenderComponent::PatchChunks(ADungeonFloorGenerator* FloorGenerator)
+{
+    const double StartSeconds = FPlatformTime::Seconds();
+    const TArray<int32>& Grid = FloorGenerator->GridCells;
+
+    // Cell meshes only touch their own chunk
+    int32 ChangedCells = 0;
+    for (int32 CellIndex = 0; CellIndex < Grid.Num(); ++CellIndex)
+    {
+        const int32 Category = GetCellCategory(Grid[CellIndex]);
+        if (Category == RenderedCategory[CellIndex]) continue;
+
+        RenderedCategory[CellIndex] = Category;
+        const int32 X = CellIndex % RenderedWidth;
+        const int32 Y = CellIndex / RenderedWidth;
+        Chunks[(Y / ChunkCellSize) * ChunkGridSize.X + X / ChunkCellSize].bDirty = true;
+        ++ChangedCells;
+    }
+
+    // Wall pieces that moved dirty their chunks too
+    AssignWallsToChunks(FloorGenerator);
+
+    // Dirty chunks near the player rebuild now and the rest when they stream back in; the new
+    // floor may put the player elsewhere, so hiding and releasing follow the new centre
+    UpdateChunkStreaming(TNumericLimits<int32>::Max());
+
+    RenderStats.LastBuildMs = static_cast<float>((FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+    RenderStats.LastChangedCells = ChangedCells;
+    RenderStats.bLastBuildIncremental = true;
+    ++RenderStats.IncrementalBuildCount;
+
+    UE_LOG(LogTemp, Verbose, TEXT("[DungeonRenderComponent] Chunked re-render: %d changed cell(s), %d chunk(s) built (%.2f ms)"),
+        ChangedCells, RenderStats.ChunksBuilt, RenderStats.LastBuildMs);
+}
+
+bool UDungeonRenderComponent::ChunksMatchMeshSet() const
+{
+    for (const FDungeonRenderChunk& Chunk : Chunks)
+    {
+        for (int32 Category = 0; Category < Chunk.Components.Num(); ++Category)
+        {
+            const UHierarchicalInstancedStaticMeshComponent* HISM = Chunk.Components[Category];
+            if (HISM && (!IsValid(HISM) || HISM->GetStaticMesh() != GetCategoryMesh(Category)))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void UDungeonRenderComponent::ReleaseAllChunks()
+{
+    for (int32 ChunkIndex = 0; ChunkIndex < Chunks.Num(); ++ChunkIndex)
+    {
+        ReleaseChunk(ChunkIndex);
+    }
+    Chunks.Reset();
+    ChunkGridSize = FIntPoint::ZeroValue;
+    RenderStats.ChunksTotal = RenderStats.ChunksBuilt = RenderStats.ChunksVisible = 0;
+
+    if (bChunked)
+    {
+        bChunked = false;
+        SetComponentTickEnabled(false);
+        RenderedCategory.Reset();
+        WallSegments.Reset();
+        RenderedWidth = RenderedHeight = 0;
+    }
+}
+
+void UDungeonRenderComponent::AssignWallsToChunks(ADungeonFloorGenerator* FloorGenerator)
+{
+    FDungeonWallMergeSettings Settings;
+    Settings.bCullHidden = bCullHiddenWalls;
+    Settings.bMergeRuns = bMergeWallRuns;
+    Settings.MaxRunLength = MaxWallRunLength;
+
+    const int32 VisibleCells = FDungeonGridBuilder::BuildWallSegments(FloorGenerator->GridCells, RenderedWidth, RenderedHeight, Settings, WallSegments);
+
+    int32 WallCells = 0;
+    for (const int32 Value : FloorGenerator->GridCells)
+        WallCells += (GetCellCategory(Value) == Cat_Wall) ? 1 : 0;
+    RenderStats.VisibleWallCells = VisibleCells;
+    RenderStats.HiddenWallCells = WallCells - VisibleCells;
+
+    // Keep the previous lists to spot which chunks actually changed
+    TArray<TArray<FDungeonWallSegment>> Previous;
+    Previous.Reserve(Chunks.Num());
+    for (FDungeonRenderChunk& Chunk : Chunks)
+    {
+        Previous.Add(MoveTemp(Chunk.Walls));
+        Chunk.Walls.Reset();
+    }
+
+    // Clip every run at chunk borders so each piece belongs to exactly one chunk
+    for (const FDungeonWallSegment& Segment : WallSegments)
+    {
+        int32 Offset = 0;
+        while (Offset < Segment.Length)
+        {
+            FDungeonWallSegment Piece = Segment;
+            Piece.Start = Segment.bAlongX ? FIntPoint(Segment.Start.X + Offset, Segment.Start.Y) : FIntPoint(Segment.Start.X, Segment.Start.Y + Offset);
+
+            const int32 AlongStart = Segment.bAlongX ? Piece.Start.X : Piece.Start.Y;
+            const int32 ChunkEnd = (AlongStart / ChunkCellSize + 1) * ChunkCellSize;
+            Piece.Length = FMath::Min(Segment.Length - Offset, ChunkEnd - AlongStart);
+
+            const int32 ChunkIndex = (Piece.Start.Y / ChunkCellSize) * ChunkGridSize.X + (Piece.Start.X / ChunkCellSize);
+            Chunks[ChunkIndex].Walls.Add(Piece);
+            Offset += Piece.Length;
+        }
+    }
+
+    for (int32 ChunkIndex = 0; ChunkIndex < Chunks.Num(); ++ChunkIndex)
+    {
+        if (Chunks[ChunkIndex].Walls != Previous[ChunkIndex])
+        {
+            Chunks[ChunkIndex].bDirty = true;
+        }
+    }
+}
+
+void UDungeonRenderComponent::BuildChunk(int32 ChunkIndex)
+{
+    if (!CachedFloorGenerator || !Chunks.IsValidIndex(ChunkIndex)) return;
+
+    const double StartSeconds = FPlatformTime::Seconds();
+    FDungeonRenderChunk& Chunk = Chunks[ChunkIndex];
+    const TArray<int32>& Grid = CachedFloorGenerator->GridCells;
+
+    const int32 X0 = Chunk.Stats.Chunk.X * ChunkCellSize;
+    const int32 Y0 = Chunk.Stats.Chunk.Y * ChunkCellSize;
+    const int32 X1 = FMath::Min(X0 + ChunkCellSize, RenderedWidth);
+    const int32 Y1 = FMath::Min(Y0 + ChunkCellSize, RenderedHeight);
+
+    TArray<FTransform> Transforms[Cat_Num];
+    for (int32 Y = Y0; Y < Y1; ++Y)
+    {
+        for (int32 X = X0; X < X1; ++X)
+        {
+            const int32 Category = GetCellCategory(Grid[Y * RenderedWidth + X]);
+            if (Category != INDEX_NONE && Category != Cat_Wall)
+            {
+                Transforms[Category].Add(MakeCellTransform(X, Y));
+            }
+        }
+    }
+    if (GetCategoryMesh(Cat_Wall))
+    {
+        for (const FDungeonWallSegment& Segment : Chunk.Walls)
+        {
+            Transforms[Cat_Wall].Add(MakeWallSegmentTransform(Segment));
+        }
+    }
+
+    static const TCHAR* CategoryNames[Cat_Num] = { TEXT("Wall"), TEXT("Floor"), TEXT("Corridor"), TEXT("Room"), TEXT("Door"), TEXT("Stair") };
+
+    Chunk.Stats.Instances = 0;
+    for (int32 Category = 0; Category < Cat_Num; ++Category)
+    {
+        TObjectPtr<UHierarchicalInstancedStaticMeshComponent>& HISM = Chunk.Components[Category];
+        if (!HISM && Transforms[Category].Num() > 0)
+        {
+            const FString Name = FString::Printf(TEXT("%sHISM_%d_%d"), CategoryNames[Category], Chunk.Stats.Chunk.X, Chunk.Stats.Chunk.Y);
+            HISM = Cast<UHierarchicalInstancedStaticMeshComponent>(CreateISMComponent(Name, GetCategoryMesh(Category), GetCategoryMaterial(Category),
+                UHierarchicalInstancedStaticMeshComponent::StaticClass()));
+            if (HISM && ChunkCullDistance > 0)
+            {
+                HISM->SetCullDistances(0, ChunkCullDistance);
+            }
+        }
+        if (!HISM) continue;
+
+        HISM->ClearInstances();
+        if (Transforms[Category].Num() > 0)
+        {
+            HISM->AddInstances(Transforms[Category], /*bShouldReturnIndices=*/false);
+        }
+        Chunk.CategoryInstances[Category] = Transforms[Category].Num();
+        Chunk.Stats.Instances += Transforms[Category].Num();
+    }
+
+    // A rebuilt chunk comes back visible; callers re-hide it if needed
+    for (UHierarchicalInstancedStaticMeshComponent* Component : Chunk.Components)
+        if (Component) Component->SetVisibility(true);
+
+    Chunk.bDirty = false;
+    Chunk.Stats.bBuilt = true;
+    Chunk.Stats.bVisible = true;
+    Chunk.Stats.LastBuildMs = static_cast<float>((FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+    ++Chunk.Stats.BuildCount;
+
+    UE_LOG(LogTemp, Verbose, TEXT("[DungeonRenderComponent] Chunk (%d,%d) built: %d instances, %.2f ms"),
+        Chunk.Stats.Chunk.X, Chunk.Stats.Chunk.Y, Chunk.Stats.Instances, Chunk.Stats.LastBuildMs);
+}
+
+void UDungeonRenderComponent::ReleaseChunk(int32 ChunkIndex)
+{
+    if (!Chunks.IsValidIndex(ChunkIndex)) return;
+
+    FDungeonRenderChunk& Chunk = Chunks[ChunkIndex];
+    for (TObjectPtr<UHierarchicalInstancedStaticMeshComponent>& HISM : Chunk.Components)
+    {
+        if (HISM) HISM->DestroyComponent();
+        HISM = nullptr;
+    }
+    for (int32& Count : Chunk.CategoryInstances)
+        Count = 0;
+
+    Chunk.bDirty = true;
+    Chunk.Stats.bBuilt = false;
+    Chunk.Stats.bVisible = false;
+    Chunk.Stats.Instances = 0;
+}
+
+void UDungeonRenderComponent::SetChunkVisible(int32 ChunkIndex, bool bVisible)
+{
+    FDungeonRenderChunk& Chunk = Chunks[ChunkIndex];
+    if (Chunk.Stats.bVisible == bVisible) return;
+
+    for (UHierarchicalInstancedStaticMeshComponent* HISM : Chunk.Components)
+        if (HISM) HISM->SetVisibility(bVisible);
+    Chunk.Stats.bVisible = bVisible;
+}
+
+bool UDungeonRenderComponent::GetStreamingCenterChunk(FIntPoint& OutChunk) const
+{
+    const APawn* Pawn = UGameplayStatics::GetPlayerPawn(this, 0);
+    if (!Pawn || CellSizeUU <= 0.0f) return false;
+
+    const FVector Local = Pawn->GetActorLocation() - GetComponentLocation();
+    OutChunk = FIntPoint(
+        FMath::FloorToInt(Local.X / CellSizeUU) / ChunkCellSize,
+        FMath::FloorToInt(Local.Y / CellSizeUU) / ChunkCellSize);
+    return true;
+}
+
+void UDungeonRenderComponent::UpdateChunkStreaming(int32 BuildBudget)
+{
+    if (!bChunked || Chunks.Num() == 0) return;
+
+    const double StartSeconds = FPlatformTime::Seconds();
+
+    // Without a player (editor preview) every chunk counts as near
+    FIntPoint Center;
+    const bool bHasCenter = GetStreamingCenterChunk(Center);
+
+    TArray<TPair<int32, int32>> ToBuild; // (distance, chunk)
+    for (int32 ChunkIndex = 0; ChunkIndex < Chunks.Num(); ++ChunkIndex)
+    {
+        const FDungeonRenderChunk& Chunk = Chunks[ChunkIndex];
+        const int32 Distance = bHasCenter
+            ? FMath::Max(FMath::Abs(Chunk.Stats.Chunk.X - Center.X), FMath::Abs(Chunk.Stats.Chunk.Y - Center.Y))
+            : 0;
+
+        if (Distance <= ChunkVisibleRadius)
+        {
+            if (!Chunk.Stats.bBuilt || Chunk.bDirty)
+            {
+                ToBuild.Emplace(Distance, ChunkIndex);
+            }
+            else
+            {
+                SetChunkVisible(ChunkIndex, true);
+            }
+        }
+        else if (Distance <= FMath::Max(ChunkReleaseRadius, ChunkVisibleRadius))
+        {
+            if (Chunk.Stats.bBuilt)
+            {
+                SetChunkVisible(ChunkIndex, false);
+            }
+        }
+        else if (Chunk.Stats.bBuilt)
+        {
+            ReleaseChunk(ChunkIndex);
+        }
+    }
+
+    // Nearest first, a few per tick
+    ToBuild.Sort();
+    const int32 NumBuilds = FMath::Min(ToBuild.Num(), FMath::Max(0, BuildBudget));
+    for (int32 i = 0; i < NumBuilds; ++i)
+    {
+        BuildChunk(ToBuild[i].Value);
+    }
+
+    if (NumBuilds > 0)
+    {
+        RenderStats.LastBuildMs = static_cast<float>((FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+        RenderStats.LastChangedCells = 0;
+        RenderStats.bLastBuildIncremental = true;
+    }
+    UpdateChunkRenderStats();
+}
+
+void UDungeonRenderComponent::RefreshChunkCells(const TArray<FIntPoint>& Cells)
+{
+    if (!CachedFloorGenerator) return;
+
+    if (CachedFloorGenerator->GridWidth != RenderedWidth || CachedFloorGenerator->GridHeight != RenderedHeight)
+    {
+        InitChunks(CachedFloorGenerator);
+        return;
+    }
+
+    // Cell meshes only touch the edited cell's chunk
+    for (const FIntPoint& Cell : Cells)
+    {
+        if (Cell.X < 0 || Cell.Y < 0 || Cell.X >= RenderedWidth || Cell.Y >= RenderedHeight) continue;
+        Chunks[(Cell.Y / ChunkCellSize) * ChunkGridSize.X + Cell.X / ChunkCellSize].bDirty = true;
+
+        const int32 CellIndex = Cell.Y * RenderedWidth + Cell.X;
+        if (RenderedCategory.IsValidIndex(CellIndex) && CachedFloorGenerator->GridCells.IsValidIndex(CellIndex))
+        {
+            RenderedCategory[CellIndex] = GetCellCategory(CachedFloorGenerator->GridCells[CellIndex]);
+        }
+    }
+
+    // Wall exposure reaches one cell into neighbouring chunks: re-segment (linear, cheap) and
+    // let AssignWallsToChunks dirty every chunk whose wall pieces changed
+    AssignWallsToChunks(CachedFloorGenerator);
+
+    // Rebuild dirty chunks that are built now; unbuilt ones pick the change up when they stream in
+    int32 NumRebuilt = 0;
+    const double StartSeconds = FPlatformTime::Seconds();
+    for (int32 ChunkIndex = 0; ChunkIndex < Chunks.Num(); ++ChunkIndex)
+    {
+        if (Chunks[ChunkIndex].bDirty && Chunks[ChunkIndex].Stats.bBuilt)
+        {
+            const bool bWasVisible = Chunks[ChunkIndex].Stats.bVisible;
+            BuildChunk(ChunkIndex);
+            SetChunkVisible(ChunkIndex, bWasVisible);
+            ++NumRebuilt;
+        }
+    }
+
+    RenderStats.LastBuildMs = static_cast<float>((FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+    RenderStats.LastChangedCells = Cells.Num();
+    RenderStats.bLastBuildIncremental = true;
+    ++RenderStats.IncrementalBuildCount;
+    UpdateChunkRenderStats();
+
+    UE_LOG(LogTemp, Verbose, TEXT("[DungeonRenderComponent] %d cell edit(s) rebuilt %d chunk(s) in %.2f ms"),
+        Cells.Num(), NumRebuilt, RenderStats.LastBuildMs);
+}
+
+void UDungeonRenderComponent::UpdateChunkRenderStats()
+{
+    int32 PerCategory[Cat_Num] = {};
+    RenderStats.ChunksTotal = Chunks.Num();
+    RenderStats.ChunksBuilt = 0;
+    RenderStats.ChunksVisible = 0;
+
+    for (const FDungeonRenderChunk& Chunk : Chunks)
+    {
+        RenderStats.ChunksBuilt += Chunk.Stats.bBuilt ? 1 : 0;
+        RenderStats.ChunksVisible += Chunk.Stats.bVisible ? 1 : 0;
+        for (int32 Category = 0; Category < Cat_Num && Category < Chunk.CategoryInstances.Num(); ++Category)
+        {
+            PerCategory[Category] += Chunk.CategoryInstances[Category];
+        }
+    }
+
+    RenderStats.WallInstances     = PerCategory[Cat_Wall];
+    RenderStats.FloorInstances    = PerCategory[Cat_Floor];
+    RenderStats.CorridorInstances = PerCategory[Cat_Corridor];
+    RenderStats.RoomInstances     = PerCategory[Cat_Room];
+    RenderStats.DoorInstances     = PerCategory[Cat_Door];
+    RenderStats.StairInstances    = PerCategory[Cat_Stair];
+    RenderStats.TotalInstances    = RenderStats.WallInstances + RenderStats.FloorInstances + RenderStats.CorridorInstances
+                                  + RenderStats.RoomInstances + RenderStats.DoorInstances + RenderStats.StairInstances;
+}
+
+TArray<FDungeonRenderChunkStats> UDungeonRenderComponent::GetChunkStats() const
+{
+    TArray<FDungeonRenderChunkStats> Out;
+    Out.Reserve(Chunks.Num());
+    for (const FDungeonRenderChunk& Chunk : Chunks)
+    {
+        Out.Add(Chunk.Stats);
+    }
+    return Out;
+}
@@ -3,10 +3,12 @@
 #include "CoreMinimal.h"
 #include "Components/SceneComponent.h"
 #include "DungeonFloorGenerator.h"
+#include "DungeonGridBuilder.h"
 #include "EDebugDrawMode.h"
 #include "DungeonRenderComponent.generated.h"
 
 class UInstancedStaticMeshComponent;
+class UHierarchicalInstancedStaticMeshComponent;
 class UStaticMesh;
 class UMaterialInterface;
 
@@ -30,6 +32,71 @@ struct FDungeonMeshSet
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Materials") TObjectPtr<UMaterialInterface> StairMaterial;
 };
 
+// CodeRevision: INC-2025-1225-R1 (Bulk and incremental instance building) (2025-12-20 14:00)
+/** Cost and size of the last instance build; see UDungeonRenderComponent::GetRenderStats. */
+USTRUCT(BlueprintType)
+struct FDungeonRenderStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Stats") float LastBuildMs = 0.0f;
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Stats") bool bLastBuildIncremental = false;
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Stats") int32 LastChangedCells = 0;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Stats") int32 WallInstances = 0;
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Stats") int32 FloorInstances = 0;
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Stats") int32 CorridorInstances = 0;
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Stats") int32 RoomInstances = 0;
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Stats") int32 DoorInstances = 0;
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Stats") int32 StairInstances = 0;
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Stats") int32 TotalInstances = 0;
+
+    // CodeRevision: INC-2025-1226-R1 (Hidden wall culling and greedy wall merging) (2025-12-21 10:00)
+    // Wall cells drawn by the merged segments, and wall cells culled as never visible
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Stats") int32 VisibleWallCells = 0;
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Stats") int32 HiddenWallCells = 0;
+
+    // CodeRevision: INC-2025-1227-R1 (Chunked HISM rendering with distance streaming) (2025-12-21 14:00)
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Stats") int32 ChunksTotal = 0;
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Stats") int32 ChunksBuilt = 0;
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Stats") int32 ChunksVisible = 0;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Stats") int32 FullBuildCount = 0;
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Stats") int32 IncrementalBuildCount = 0;
+};
+
+// CodeRevision: INC-2025-1227-R1 (Chunked HISM rendering with distance streaming) (2025-12-21 14:00)
+/** Per-chunk instance count and build cost; see UDungeonRenderComponent::GetChunkStats. */
+USTRUCT(BlueprintType)
+struct FDungeonRenderChunkStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Stats") FIntPoint Chunk = FIntPoint::ZeroValue;
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Stats") int32 Instances = 0;
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Stats") float LastBuildMs = 0.0f;
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Stats") int32 BuildCount = 0;
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Stats") bool bBuilt = false;
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Stats") bool bVisible = false;
+};
+
+/** One ChunkSize x ChunkSize block of the floor with its own HISM per mesh category. */
+USTRUCT()
+struct FDungeonRenderChunk
+{
+    GENERATED_BODY()
+
+    // Indexed by mesh category; null until built (or when the category has no mesh)
+    UPROPERTY() TArray<TObjectPtr<UHierarchicalInstancedStaticMeshComponent>> Components;
+
+    UPROPERTY(VisibleInstanceOnly, Category="Stats") FDungeonRenderChunkStats Stats;
+
+    // Wall segments clipped to this chunk
+    TArray<FDungeonWallSegment> Walls;
+    TArray<int32> CategoryInstances;
+    bool bDirty = true;
+};
+
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class LYRAGAME_API UDungeonRenderComponent : public USceneComponent
 {
@@ -40,6 +107,7 @@ public:
 
     virtual void BeginPlay() override;
     virtual void OnComponentDestroyed(bool bDestroyingHierarchy) override;
+    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
     UFUNCTION(BlueprintCallable, Category="Dungeon|Rendering")
     void RenderDungeonFromFloor(ADungeonFloorGenerator* FloorGenerator);
@@ -47,6 +115,28 @@ public:
     UFUNCTION(BlueprintCallable, Category="Dungeon|Rendering")
     void ClearAllInstances();
 
+    // CodeRevision: INC-2025-1225-R1 (Bulk and incremental instance building) (2025-12-20 14:00)
+    /** Re-read the given cells from the cached floor and patch only their instances. */
+    UFUNCTION(BlueprintCallable, Category="Dungeon|Rendering")
+    void RefreshCells(const TArray<FIntPoint>& Cells);
+
+    UFUNCTION(BlueprintPure, Category="Dungeon|Rendering")
+    const FDungeonRenderStats& GetRenderStats() const { return RenderStats; }
+
+    // CodeRevision: INC-2025-1225-R2 (Cell/instance map check for incremental patches) (2025-12-27 21:00)
+    /**
+     * Non-chunked mode: true when every cell's instance index, the per-category owner lists and
+     * the ISM instance counts/positions agree. OutError names the first mismatch.
+     */
+    bool ValidateInstanceMaps(FString& OutError) const;
+
+    // CodeRevision: INC-2025-1227-R1 (Chunked HISM rendering with distance streaming) (2025-12-21 14:00)
+    UFUNCTION(BlueprintPure, Category="Dungeon|Rendering")
+    TArray<FDungeonRenderChunkStats> GetChunkStats() const;
+
+    UFUNCTION(BlueprintPure, Category="Dungeon|Rendering")
+    bool IsChunkedRendering() const { return bChunked; }
+
     UFUNCTION(BlueprintCallable, Category="Dungeon|Debug")
     void SetDebugDrawMode(EDebugDrawMode Mode);
 
@@ -61,6 +151,48 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Rendering") bool bRenderInGame = true;
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Rendering") bool bBuildInstancesImmediately = false;
 
+    /** Re-renders that change more than this share of cells rebuild in bulk instead of patching. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Rendering", meta=(ClampMin="0.0", ClampMax="1.0"))
+    float IncrementalRebuildMaxFraction = 0.35f;
+
+    // CodeRevision: INC-2025-1226-R1 (Hidden wall culling and greedy wall merging) (2025-12-21 10:00)
+    /** Skip wall cells with no walkable neighbour (solid rock). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Rendering|Walls") bool bCullHiddenWalls = true;
+
+    /** Merge straight runs of walls into one instance scaled along the run; WallMesh must be a one-cell box. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Rendering|Walls") bool bMergeWallRuns = true;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Rendering|Walls", meta=(ClampMin="1", ClampMax="64", EditCondition="bMergeWallRuns"))
+    int32 MaxWallRunLength = 8;
+
+    // CodeRevision: INC-2025-1227-R1 (Chunked HISM rendering with distance streaming) (2025-12-21 14:00)
+    /** Floors with at least ChunkedRenderMinCells cells are split into chunks with their own HISMs. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Rendering|Chunks") bool bUseChunkedRendering = true;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Rendering|Chunks", meta=(ClampMin="0", EditCondition="bUseChunkedRendering"))
+    int32 ChunkedRenderMinCells = 96 * 96;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Rendering|Chunks", meta=(ClampMin="4", ClampMax="64", EditCondition="bUseChunkedRendering"))
+    int32 ChunkSize = 16;
+
+    /** Chunks within this many chunks of the player (Chebyshev) are built and shown. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Rendering|Chunks", meta=(ClampMin="0", EditCondition="bUseChunkedRendering"))
+    int32 ChunkVisibleRadius = 3;
+
+    /** Built chunks beyond the visible radius are hidden; beyond this one their components are released. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Rendering|Chunks", meta=(ClampMin="0", EditCondition="bUseChunkedRendering"))
+    int32 ChunkReleaseRadius = 5;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Rendering|Chunks", meta=(ClampMin="1", EditCondition="bUseChunkedRendering"))
+    int32 MaxChunkBuildsPerTick = 2;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Rendering|Chunks", meta=(ClampMin="0.0", EditCondition="bUseChunkedRendering"))
+    float ChunkStreamInterval = 0.25f;
+
+    /** Per-instance cull distance for chunk HISMs (0 = never). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Rendering|Chunks", meta=(ClampMin="0", EditCondition="bUseChunkedRendering"))
+    int32 ChunkCullDistance = 0;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Rendering|Collision") bool bEnableCollision = true;
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Rendering|Collision", meta=(EditCondition="bEnableCollision"))
     FName CollisionProfileName = NAME_None;
@@ -84,13 +216,62 @@ private:
     UPROPERTY() TObjectPtr<ADungeonFloorGenerator> CachedFloorGenerator;
     TArray<FIntPoint> CachedRoomCenters;
 
+    // Mesh categories, one ISM each
+    enum ECategory : int32 { Cat_Wall, Cat_Floor, Cat_Corridor, Cat_Room, Cat_Door, Cat_Stair, Cat_Num };
+
+    // What is currently instanced, per cell (index = Y * RenderedWidth + X); when chunked, the
+    // category each cell had at the last render so a same-sized re-render can find dirty chunks
+    TArray<int32> RenderedCategory;   // INDEX_NONE = nothing
+    TArray<int32> RenderedInstance;   // instance index inside that category's ISM
+    // Owning cell of every instance, per category (kept in step with remove-at-swap; walls excluded)
+    TArray<int32> InstanceCells[Cat_Num];
+    // Walls are instanced per merged segment rather than per cell
+    TArray<FDungeonWallSegment> WallSegments;
+    int32 RenderedWidth = 0;
+    int32 RenderedHeight = 0;
+
+    FDungeonRenderStats RenderStats;
+    FDelegateHandle CellChangedHandle;
+
+    // CodeRevision: INC-2025-1227-R1 (Chunked HISM rendering with distance streaming) (2025-12-21 14:00)
+    UPROPERTY(VisibleInstanceOnly, Category="Rendering|Chunks") TArray<FDungeonRenderChunk> Chunks;
+    FIntPoint ChunkGridSize = FIntPoint::ZeroValue;
+    int32 ChunkCellSize = 16;
+    bool bChunked = false;
+
     void CreateISMComponents();
     void DestroyISMComponents();
+    bool ISMsMatchMeshSet() const;
+    void ResetRenderedState();
 
-    UInstancedStaticMeshComponent* CreateISMComponent(const FString& ComponentName, UStaticMesh* Mesh, UMaterialInterface* Material);
-    void AddInstanceToISM(UInstancedStaticMeshComponent* ISM, int32 GridX, int32 GridY, float Height=0.0f);
+    UInstancedStaticMeshComponent* CreateISMComponent(const FString& ComponentName, UStaticMesh* Mesh, UMaterialInterface* Material, UClass* ComponentClass=nullptr);
+    UStaticMesh* GetCategoryMesh(int32 Category) const;
+    UMaterialInterface* GetCategoryMaterial(int32 Category) const;
+    UInstancedStaticMeshComponent* GetCategoryISM(int32 Category) const;
+    int32 GetCellCategory(int32 CellValue) const;
+    FTransform MakeCellTransform(int32 GridX, int32 GridY, float Height=0.0f) const;
+    FTransform MakeWallSegmentTransform(const FDungeonWallSegment& Segment) const;
 
     void BuildAllInstances(ADungeonFloorGenerator* FloorGenerator);
+    void PatchCells(ADungeonFloorGenerator* FloorGenerator, const TArray<int32>& CellIndices);
+    void RemoveCellInstance(int32 CellIndex);
+    void RebuildWallInstances(ADungeonFloorGenerator* FloorGenerator, bool bForce);
+    void UpdateInstanceStats(double StartSeconds, bool bIncremental, int32 ChangedCells);
+    void BindFloorGenerator(ADungeonFloorGenerator* FloorGenerator);
+    void HandleCellChanged(const FIntPoint& Cell);
+
+    void InitChunks(ADungeonFloorGenerator* FloorGenerator);
+    void PatchChunks(ADungeonFloorGenerator* FloorGenerator);
+    bool ChunksMatchMeshSet() const;
+    void ReleaseAllChunks();
+    void AssignWallsToChunks(ADungeonFloorGenerator* FloorGenerator);
+    void BuildChunk(int32 ChunkIndex);
+    void ReleaseChunk(int32 ChunkIndex);
+    void SetChunkVisible(int32 ChunkIndex, bool bVisible);
+    void UpdateChunkStreaming(int32 BuildBudget);
+    bool GetStreamingCenterChunk(FIntPoint& OutChunk) const;
+    void RefreshChunkCells(const TArray<FIntPoint>& Cells);
+    void UpdateChunkRenderStats();
     void ExtractDungeonFeatures(ADungeonFloorGenerator* FloorGenerator);
 
     void DrawDebugGrid();
@@ -6,9 +6,25 @@
 #include "GenericTeamAgentInterface.h"
 #include "Kismet/GameplayStatics.h"
 #include "Utility/GridUtils.h"
+// CodeRevision: INC-2025-1229-R1 (Reservation/commit diagnostics as gated structured events) (2025-12-22 14:00)
+#include "Utility/ProjectDiagnostics.h"
+// CodeRevision: INC-2025-1231-R1 (Flight recorder of recent turns: reservation outcomes) (2025-12-23 14:00)
+#include "Turn/TurnFlightRecorderSubsystem.h"
 
 DEFINE_LOG_CATEGORY(LogGridOccupancy);
 
+namespace GridOccupancyPrivate
+{
+    static void RecordReservation(const UObject* WorldContext, ETurnFlightRecordKind Kind, const AActor* Actor,
+        const FIntPoint& Cell, const FIntPoint* CurrentCell, FName Reason = NAME_None)
+    {
+        if (UTurnFlightRecorderSubsystem* Recorder = UTurnFlightRecorderSubsystem::Get(WorldContext))
+        {
+            Recorder->Record(Kind, Actor, Cell, CurrentCell ? *CurrentCell : FIntPoint(-1, -1), Reason);
+        }
+    }
+}
+
 void UGridOccupancySubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
     Super::Initialize(Collection);
@@ -119,9 +135,8 @@ bool UGridOccupancySubsystem::UpdateActorCell(AActor* Actor, FIntPoint NewCell)
             {
                 // CodeRevision: INC-2025-1156-R1 (Disable Perfect Swap - Strict Reservation Enforcement) (2025-11-20 11:30)
                 // We strictly reject moves into cells reserved by others. Swapping is not allowed.
-                UE_LOG(LogGridOccupancy, Warning,
-                    TEXT("[GridOccupancy] REJECT by foreign reservation: %s -> (%d,%d) reserved by %s"),
-                    *GetNameSafe(Actor), NewCell.X, NewCell.Y, *GetNameSafe(ForeignReserver));
+                ROGUE_DIAG_EVENT(Occupancy, LogGridOccupancy, Warning, TEXT("RejectForeignReservation"), CurrentTurnId, Actor, NewCell,
+                    *FString::Printf(TEXT("reserver=%s"), *GetNameSafe(ForeignReserver)));
                 return false;
             }
         }
@@ -144,9 +159,8 @@ bool UGridOccupancySubsystem::UpdateActorCell(AActor* Actor, FIntPoint NewCell)
             // ★★★ Two-phase commit: follower must wait until owner commits ★★★
             if (bOccupantWillLeave && !bOccupantCommitted)
             {
-                UE_LOG(LogGridOccupancy, Verbose,
-                    TEXT("[GridOccupancy] REJECT (follower before owner commit): %s -> (%d,%d), occupant=%s will leave but not committed yet"),
-                    *GetNameSafe(Actor), NewCell.X, NewCell.Y, *GetNameSafe(ExistingActor));
+                ROGUE_DIAG_EVENT(Occupancy, LogGridOccupancy, Verbose, TEXT("RejectBeforeOwnerCommit"), CurrentTurnId, Actor, NewCell,
+                    *FString::Printf(TEXT("occupant=%s"), *GetNameSafe(ExistingActor)));
                 return false; // Follower arrived before leader's commit; reject for now
             }
 
@@ -162,10 +176,8 @@ bool UGridOccupancySubsystem::UpdateActorCell(AActor* Actor, FIntPoint NewCell)
             }
             else
             {
-                UE_LOG(LogGridOccupancy, Log,
-                    TEXT("[GridOccupancy] ACCEPT (reserved + occupant committed): %s -> (%d,%d) - was occupied by %s (left to %s)"),
-                    *GetNameSafe(Actor), NewCell.X, NewCell.Y, *GetNameSafe(ExistingActor),
-                    *GetReservedCellForActor(ExistingActor).ToString());
+                ROGUE_DIAG_EVENT(Occupancy, LogGridOccupancy, Log, TEXT("AcceptAfterOwnerCommit"), CurrentTurnId, Actor, NewCell,
+                    *FString::Printf(TEXT("occupant=%s occupant_to=%s"), *GetNameSafe(ExistingActor), *GetReservedCellForActor(ExistingActor).ToString()));
             }
         }
     }
@@ -184,8 +196,7 @@ bool UGridOccupancySubsystem::UpdateActorCell(AActor* Actor, FIntPoint NewCell)
     // ★★★ Two-phase commit: mark the move as committed so followers can proceed ★★★
     CommittedThisTick.Add(Actor);
 
-    UE_LOG(LogGridOccupancy, Log, TEXT("[GridOccupancy] COMMIT: %s -> (%d,%d)"),
-        *GetNameSafe(Actor), NewCell.X, NewCell.Y);
+    ROGUE_DIAG_EVENT(Occupancy, LogGridOccupancy, Log, TEXT("Commit"), CurrentTurnId, Actor, NewCell);
 
     return true;
 }
@@ -232,14 +243,14 @@ void UGridOccupancySubsystem::OccupyCell(const FIntPoint& Cell, AActor* Actor)
     OccupiedCells.Add(Cell, Actor);
     ActorToCell.Add(Actor, Cell);
 
-    UE_LOG(LogGridOccupancy, Verbose, TEXT("[GridOccupancy] Cell (%d, %d) occupied by %s"),
+    ROGUE_DIAG(Occupancy, LogGridOccupancy, Verbose, TEXT("[GridOccupancy] Cell (%d, %d) occupied by %s"),
         Cell.X, Cell.Y, *GetNameSafe(Actor));
 }
 
 void UGridOccupancySubsystem::ReleaseCell(const FIntPoint& Cell)
 {
     OccupiedCells.Remove(Cell);
-    UE_LOG(LogGridOccupancy, Verbose, TEXT("[GridOccupancy] Cell (%d, %d) released"),
+    ROGUE_DIAG(Occupancy, LogGridOccupancy, Verbose, TEXT("[GridOccupancy] Cell (%d, %d) released"),
         Cell.X, Cell.Y);
 }
 
@@ -319,18 +330,18 @@ bool UGridOccupancySubsystem::ReserveCellForActor(AActor* Actor, const FIntPoint
                         const int32 ChebDist = FGridUtils::ChebyshevDistance(*FollowerCellPtr, Cell);
                         if (ChebDist > 1)
                         {
-                            UE_LOG(LogGridOccupancy, Warning,
-                                TEXT("[GridOccupancy] REJECT FOLLOW-UP: %s -> (%d,%d) distance=%d (must be <=1)"),
-                                *GetNameSafe(Actor), Cell.X, Cell.Y, ChebDist);
+                            ROGUE_DIAG_EVENT(Occupancy, LogGridOccupancy, Warning, TEXT("RejectFollowUp"), CurrentTurnId, Actor, Cell,
+                                *FString::Printf(TEXT("distance=%d"), ChebDist));
+                            GridOccupancyPrivate::RecordReservation(this, ETurnFlightRecordKind::ReserveReject, Actor, Cell,
+                                FollowerCellPtr, TEXT("RejectFollowUp"));
                             return false;
                         }
                     }
 
                     // Follow-up compression: allow this as a "SoftHold" override.
-                    UE_LOG(LogGridOccupancy, Log,
-                        TEXT("[GridOccupancy] ALLOW FOLLOW-UP: %s -> (%d,%d) following %s who moves to (%d,%d) [SOFTHOLD -> ALLOW]"),
-                        *GetNameSafe(Actor), Cell.X, Cell.Y, *GetNameSafe(OriginOwner),
-                        OriginOwnerDestReservation->Cell.X, OriginOwnerDestReservation->Cell.Y);
+                    ROGUE_DIAG_EVENT(Occupancy, LogGridOccupancy, Log, TEXT("AllowFollowUp"), CurrentTurnId, Actor, Cell,
+                        *FString::Printf(TEXT("leader=%s leader_to=(%d,%d)"), *GetNameSafe(OriginOwner),
+                            OriginOwnerDestReservation->Cell.X, OriginOwnerDestReservation->Cell.Y));
                     // Continue and allow reservation (overwriting the OriginHold)
                 }
                 else
@@ -339,6 +350,8 @@ bool UGridOccupancySubsystem::ReserveCellForActor(AActor* Actor, const FIntPoint
                     UE_LOG(LogGridOccupancy, Error,
                         TEXT("[GridOccupancy] REJECT RESERVATION: %s cannot reserve (%d,%d) - OriginHold by %s (TurnId=%d) [HARDHOLD -> BLOCKED]"),
                         *GetNameSafe(Actor), Cell.X, Cell.Y, *GetNameSafe(OriginOwner), ExistingInfo->TurnId);
+                    GridOccupancyPrivate::RecordReservation(this, ETurnFlightRecordKind::ReserveReject, Actor, Cell,
+                        ActorToCell.Find(Actor), TEXT("OriginHold"));
                     return false;  // Block reservation to prevent backstab
                 }
             }
@@ -347,6 +360,8 @@ bool UGridOccupancySubsystem::ReserveCellForActor(AActor* Actor, const FIntPoint
                 UE_LOG(LogGridOccupancy, Error,
                     TEXT("[GridOccupancy] REJECT RESERVATION: %s cannot reserve (%d,%d) - already reserved by %s (TurnId=%d)"),
                     *GetNameSafe(Actor), Cell.X, Cell.Y, *GetNameSafe(ExistingInfo->Owner.Get()), ExistingInfo->TurnId);
+                GridOccupancyPrivate::RecordReservation(this, ETurnFlightRecordKind::ReserveReject, Actor, Cell,
+                    ActorToCell.Find(Actor), TEXT("AlreadyReserved"));
                 return false;  // Reservation denied - another actor already reserved this cell
             }
         }
@@ -365,8 +380,8 @@ bool UGridOccupancySubsystem::ReserveCellForActor(AActor* Actor, const FIntPoint
     ReservedCells.Add(Cell, DestInfo);
     ActorToReservation.Add(Actor, DestInfo);
 
-    UE_LOG(LogGridOccupancy, Log, TEXT("[GridOccupancy] RESERVE DEST: %s -> (%d, %d) (TurnId=%d)"),
-        *GetNameSafe(Actor), Cell.X, Cell.Y, CurrentTurnId);
+    ROGUE_DIAG_EVENT(Occupancy, LogGridOccupancy, Log, TEXT("ReserveDest"), CurrentTurnId, Actor, Cell);
+    GridOccupancyPrivate::RecordReservation(this, ETurnFlightRecordKind::ReserveOk, Actor, Cell, &CurrentCell);
 
     // ★★★ OriginHold implementation: place an OriginHold reservation on the origin cell ★★★
     // ★★★ OriginHold implementation: place an OriginHold reservation on the origin cell ★★★
@@ -510,23 +525,20 @@ bool UGridOccupancySubsystem::TryReserveCell(AActor* Actor, const FIntPoint& Cel
     {
         if (Owner != Actor)
         {
-            UE_LOG(LogGridOccupancy, Warning,
-                TEXT("[Reserve] FAIL: (%d,%d) already reserved by %s (attempt by %s)"),
-                Cell.X, Cell.Y, *GetNameSafe(Owner), *GetNameSafe(Actor));
+            ROGUE_DIAG_EVENT(Occupancy, LogGridOccupancy, Warning, TEXT("ReserveFail"), TurnId, Actor, Cell,
+                *FString::Printf(TEXT("owner=%s"), *GetNameSafe(Owner)));
+            GridOccupancyPrivate::RecordReservation(this, ETurnFlightRecordKind::ReserveReject, Actor, Cell,
+                ActorToCell.Find(Actor), TEXT("ReserveFail"));
             return false; // Exclusive reservation - first come first served
         }
         // Already reserved by this actor - OK
-        UE_LOG(LogGridOccupancy, Verbose,
-            TEXT("[Reserve] ALREADY OWNED: %s -> (%d,%d)"),
-            *GetNameSafe(Actor), Cell.X, Cell.Y);
+        ROGUE_DIAG_EVENT(Occupancy, LogGridOccupancy, Verbose, TEXT("ReserveAlreadyOwned"), TurnId, Actor, Cell);
         return true;
     }
 
     // Reserve the cell
     ReserveCellForActor(Actor, Cell);
-    UE_LOG(LogGridOccupancy, Log,
-        TEXT("[Reserve] OK: %s -> (%d,%d) TurnId=%d"),
-        *GetNameSafe(Actor), Cell.X, Cell.Y, TurnId);
+    ROGUE_DIAG_EVENT(Occupancy, LogGridOccupancy, Log, TEXT("Reserve"), TurnId, Actor, Cell);
     return true;
 }
 
@@ -569,9 +581,7 @@ void UGridOccupancySubsystem::MarkReservationCommitted(AActor* Actor, int32 Turn
                 CellInfoPtr->bCommitted = true;
             }
 
-            UE_LOG(LogGridOccupancy, Log,
-                TEXT("[GridOccupancy] MarkCommitted: %s -> (%d,%d) TurnId=%d"),
-                *GetNameSafe(Actor), InfoPtr->Cell.X, InfoPtr->Cell.Y, TurnId);
+            ROGUE_DIAG_EVENT(Occupancy, LogGridOccupancy, Log, TEXT("MarkCommitted"), TurnId, Actor, InfoPtr->Cell);
         }
     }
 }
@@ -585,7 +595,7 @@ void UGridOccupancySubsystem::PurgeOutdatedReservations(int32 InCurrentTurnId)
     {
         if (It.Value().TurnId != InCurrentTurnId)
         {
-            UE_LOG(LogGridOccupancy, Verbose,
+            ROGUE_DIAG(Occupancy, LogGridOccupancy, Verbose,
                 TEXT("[GridOccupancy] Purging outdated reservation: Cell=(%d,%d) TurnId=%d (Current=%d)"),
                 It.Key().X, It.Key().Y, It.Value().TurnId, InCurrentTurnId);
             It.RemoveCurrent();
@@ -604,7 +614,7 @@ void UGridOccupancySubsystem::PurgeOutdatedReservations(int32 InCurrentTurnId)
 
     if (PurgedCount > 0)
     {
-        UE_LOG(LogGridOccupancy, Log,
+        ROGUE_DIAG(Occupancy, LogGridOccupancy, Log,
             TEXT("[GridOccupancy] PurgeOutdatedReservations: Removed %d old reservations (CurrentTurnId=%d)"),
             PurgedCount, InCurrentTurnId);
     }
@@ -107,6 +107,12 @@ public:
     UFUNCTION(BlueprintPure, Category = "Turn|Occupancy")
     TMap<FIntPoint, AActor*> GetAllOccupiedCells() const;
 
+    // CodeRevision: INC-2025-1214-R1 (Copy-free occupancy view for per-turn scans) (2025-12-15 14:00)
+    /**
+     * Read-only view of Cell -> Actor without building a copy (entries may hold stale weak pointers).
+     */
+    const TMap<FIntPoint, TWeakObjectPtr<AActor>>& GetOccupiedCellMap() const { return OccupiedCells; }
+
     // NOTE: IsWalkable is removed; walkability is unified in PathFinder
     // UFUNCTION(BlueprintPure, Category = "Turn|Occupancy")
     // bool IsWalkable(const FIntPoint& Cell) const;
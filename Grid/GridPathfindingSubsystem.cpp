@@ -13,6 +13,8 @@
 #include "Grid/DungeonFloorGenerator.h"
 #include "Utility/GridUtils.h"
 #include "../Utility/ProjectDiagnostics.h"
+// CodeRevision: INC-2025-1230-R1 (Turn pipeline CPU profiling: trace scopes, STAT counters, rolling percentiles, Chrome trace export) (2025-12-23 10:00)
+#include "Turn/TurnProfilerSubsystem.h"
 
 // CodeRevision: INC-2025-00027-R1 (Create UGridPathfindingSubsystem - Phase 2) (2025-11-16 00:00)
 // Grid pathfinding functionality migrated from AGridPathfindingLibrary to UWorldSubsystem
@@ -224,16 +226,17 @@ int32 UGridPathfindingSubsystem::ReturnGridStatus(const FVector& InputVector) co
     FIntPoint GridPos = WorldToGridInternal(InputVector);
     int32 Cost = GetGridCost(GridPos.X, GridPos.Y);
 
-    // Log level adaptation: Walkable=VeryVerbose, Blocked=Warning, Invalid=Error
+    // Log level adaptation: Walkable=VeryVerbose, Blocked=Verbose, Invalid=Error
+    // CodeRevision: INC-2025-1229-R1 (Per-query lines through the gated Grid channel; blocked is a normal answer) (2025-12-22 14:00)
     if (Cost >= 0)
     {
-        UE_LOG(LogGridPathfinding, VeryVerbose,
+        ROGUE_DIAG(Grid, LogGridPathfinding, VeryVerbose,
             TEXT("[ReturnGridStatus] Walkable World:%s -> Grid:(%d,%d) Cost:%d"),
             *InputVector.ToCompactString(), GridPos.X, GridPos.Y, Cost);
     }
     else if (Cost == -1)
     {
-        UE_LOG(LogGridPathfinding, Warning,
+        ROGUE_DIAG(Grid, LogGridPathfinding, Verbose,
             TEXT("[ReturnGridStatus] Blocked World:%s -> Grid:(%d,%d) Cost:%d"),
             *InputVector.ToCompactString(), GridPos.X, GridPos.Y, Cost);
     }
@@ -278,6 +281,8 @@ bool UGridPathfindingSubsystem::FindPath(
     int32 SearchLimit,
     bool bHeavyDiagonal) const
 {
+    TURN_PROFILE_SCOPE(this, FindPath);
+
     OutWorldPath.Reset();
 
     const int32 Num = GridWidth * GridHeight;
@@ -295,7 +300,12 @@ bool UGridPathfindingSubsystem::FindPath(
     const int32 EndId = ToIndex(E.X, E.Y, GridWidth);
 
     if (GridCells[StartId] < 0 || GridCells[EndId] < 0)
+    {
+        ROGUE_DIAG(Grid, LogGridPathfinding, Verbose,
+            TEXT("[FindPath] Endpoint blocked: (%d,%d)=%d -> (%d,%d)=%d"),
+            S.X, S.Y, GridCells[StartId], E.X, E.Y, GridCells[EndId]);
         return false;
+    }
 
     TArray<int32> G;
     G.Init(INT_MAX, Num);
@@ -354,7 +364,11 @@ bool UGridPathfindingSubsystem::FindPath(
     while (!Open.empty())
     {
         if (++Expanded > SearchLimit)
+        {
+            ROGUE_DIAG(Grid, LogGridPathfinding, Verbose,
+                TEXT("[FindPath] Search limit %d hit: (%d,%d) -> (%d,%d)"), SearchLimit, S.X, S.Y, E.X, E.Y);
             return false;
+        }
 
         const int32 Cur = Open.top().Id;
         Open.pop();
@@ -423,6 +437,8 @@ bool UGridPathfindingSubsystem::FindPath(
         }
     }
 
+    ROGUE_DIAG(Grid, LogGridPathfinding, Verbose,
+        TEXT("[FindPath] No path: (%d,%d) -> (%d,%d) after %d expansions"), S.X, S.Y, E.X, E.Y, Expanded);
     return false;
 }
 
@@ -435,6 +451,8 @@ bool UGridPathfindingSubsystem::FindPathIgnoreEndpoints(
     int32 SearchLimit,
     bool bHeavyDiagonal) const
 {
+    TURN_PROFILE_SCOPE(this, FindPath);
+
     OutWorldPath.Reset();
 
     const int32 Num = GridWidth * GridHeight;
@@ -0,0 +1,157 @@
+// CodeRevision: INC-2025-1234-R1 (Per-room free-cell spawn sampler) (2025-12-25 10:00)
+#include "Grid/RoomSpawnSampler.h"
+
+//------------------------------------------------------------------------------
+// Build
+//------------------------------------------------------------------------------
+
+void FRoomSpawnSampler::Build(const FDungeonGridLabels& Labels)
+{
+    Reset();
+
+    const int32 NumRoomIds = Labels.NumRooms();
+    if (NumRoomIds == 0 || Labels.RoomIds.Num() != Labels.Width * Labels.Height)
+    {
+        return;
+    }
+
+    RoomRects = Labels.RoomRects;
+
+    // Counting sort by room id: starts from the component sizes, then one scatter pass in scan order
+    RoomStarts.SetNumUninitialized(NumRoomIds + 1);
+    int32 Total = 0;
+    for (int32 RoomId = 0; RoomId < NumRoomIds; ++RoomId)
+    {
+        RoomStarts[RoomId] = Total;
+        Total += Labels.RoomSizes[RoomId];
+    }
+    RoomStarts[NumRoomIds] = Total;
+
+    Cells.SetNumUninitialized(Total);
+    TArray<int32> Cursor(RoomStarts.GetData(), NumRoomIds);
+    for (int32 Y = 0; Y < Labels.Height; ++Y)
+    {
+        const int32* Row = Labels.RoomIds.GetData() + Y * Labels.Width;
+        for (int32 X = 0; X < Labels.Width; ++X)
+        {
+            if (Row[X] != INDEX_NONE)
+            {
+                Cells[Cursor[Row[X]]++] = FIntPoint(X, Y);
+            }
+        }
+    }
+}
+
+void FRoomSpawnSampler::Reset()
+{
+    RoomStarts.Reset();
+    Cells.Reset();
+    RoomRects.Reset();
+}
+
+TConstArrayView<FIntPoint> FRoomSpawnSampler::GetRoomCells(int32 RoomId) const
+{
+    if (RoomId < 0 || RoomId >= NumRooms())
+    {
+        return {};
+    }
+    return TConstArrayView<FIntPoint>(Cells.GetData() + RoomStarts[RoomId], RoomStarts[RoomId + 1] - RoomStarts[RoomId]);
+}
+
+int32 FRoomSpawnSampler::FindRoom(const FIntRectLite& CellRect) const
+{
+    for (int32 RoomId = 0; RoomId < RoomRects.Num(); ++RoomId)
+    {
+        const FIntRectLite& Rect = RoomRects[RoomId];
+        if (Rect.X0 == CellRect.X0 && Rect.Y0 == CellRect.Y0 && Rect.X1 == CellRect.X1 && Rect.Y1 == CellRect.Y1)
+        {
+            return RoomId;
+        }
+    }
+
+    const FIntPoint Center = CellRect.Center();
+    for (int32 RoomId = 0; RoomId < RoomRects.Num(); ++RoomId)
+    {
+        if (RoomRects[RoomId].Contains(Center.X, Center.Y))
+        {
+            return RoomId;
+        }
+    }
+    return INDEX_NONE;
+}
+
+//------------------------------------------------------------------------------
+// Sample
+//------------------------------------------------------------------------------
+
+int32 FRoomSpawnSampler::Sample(int32 RoomId, int32 Count, float MinSpacing, FRandomStream& Rng,
+    TFunctionRef<bool(const FIntPoint&)> IsFree, TArray<FIntPoint>& OutCells)
+{
+    if (RoomId < 0 || RoomId >= NumRooms())
+    {
+        return 0;
+    }
+
+    // The room's slice is shuffled in place; any order is as good as the scan order for the next call
+    const TArrayView<FIntPoint> Pool(Cells.GetData() + RoomStarts[RoomId], RoomStarts[RoomId + 1] - RoomStarts[RoomId]);
+    return SampleFrom(Pool, RoomRects[RoomId], Count, MinSpacing, Rng, IsFree, OutCells);
+}
+
+int32 FRoomSpawnSampler::SampleFrom(TArrayView<FIntPoint> Pool, const FIntRectLite& Bounds, int32 Count, float MinSpacing,
+    FRandomStream& Rng, TFunctionRef<bool(const FIntPoint&)> IsFree, TArray<FIntPoint>& OutCells)
+{
+    if (Count <= 0 || Pool.Num() == 0 || !Bounds.IsValid())
+    {
+        return 0;
+    }
+
+    // Cells within MinSpacing of an accepted cell (only when spacing rules out neighbours)
+    const bool bSpaced = MinSpacing > 1.0f;
+    const int32 Reach = bSpaced ? FMath::CeilToInt(MinSpacing) - 1 : 0;
+    const float SpacingSq = MinSpacing * MinSpacing;
+    TBitArray<> Blocked;
+    if (bSpaced)
+    {
+        Blocked.Init(false, Bounds.W() * Bounds.H());
+    }
+
+    int32 Accepted = 0;
+    for (int32 Drawn = 0; Drawn < Pool.Num() && Accepted < Count; ++Drawn)
+    {
+        const int32 Pick = Rng.RandRange(Drawn, Pool.Num() - 1);
+        Swap(Pool[Drawn], Pool[Pick]);
+        const FIntPoint Cell = Pool[Drawn];
+
+        if (bSpaced && Blocked[(Cell.Y - Bounds.Y0) * Bounds.W() + (Cell.X - Bounds.X0)])
+        {
+            continue;
+        }
+        if (!IsFree(Cell))
+        {
+            continue;
+        }
+
+        OutCells.Add(Cell);
+        ++Accepted;
+
+        if (bSpaced)
+        {
+            const int32 MinX = FMath::Max(Bounds.X0, Cell.X - Reach);
+            const int32 MaxX = FMath::Min(Bounds.X1, Cell.X + Reach);
+            const int32 MinY = FMath::Max(Bounds.Y0, Cell.Y - Reach);
+            const int32 MaxY = FMath::Min(Bounds.Y1, Cell.Y + Reach);
+            for (int32 Y = MinY; Y <= MaxY; ++Y)
+            {
+                for (int32 X = MinX; X <= MaxX; ++X)
+                {
+                    if (static_cast<float>(FMath::Square(X - Cell.X) + FMath::Square(Y - Cell.Y)) < SpacingSq)
+                    {
+                        Blocked[(Y - Bounds.Y0) * Bounds.W() + (X - Bounds.X0)] = true;
+                    }
+                }
+            }
+        }
+    }
+
+    return Accepted;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+// CodeRevision: INC-2025-1234-R1 (Per-room free-cell spawn sampler) (2025-12-25 10:00)
+#include "CoreMinimal.h"
+#include "Math/RandomStream.h"
+#include "Grid/DungeonFloorGenerator.h"
+
+/**
+ * Room cells of a generated floor, grouped per room id for spawn placement.
+ *
+ * Built once per floor from FDungeonGridLabels (one counting pass over the grid). Sampling is
+ * without replacement: every draw is one swap of a partial Fisher-Yates shuffle over the room's
+ * cell list, so each cell is examined at most once and N spawns cost O(N) draws with no retries.
+ * Draws that fail the caller's filter (occupied, terrain edited since generation, too close to the
+ * player) or the spacing test are consumed, and a short result means the room really is full.
+ */
+struct LYRAGAME_API FRoomSpawnSampler
+{
+    /** Group the Room cells of Labels by room id. */
+    void Build(const FDungeonGridLabels& Labels);
+
+    void Reset();
+
+    bool IsBuilt() const { return RoomStarts.Num() > 0; }
+    int32 NumRooms() const { return RoomRects.Num(); }
+
+    /** Cells of RoomId in their current (partially shuffled) order. */
+    TConstArrayView<FIntPoint> GetRoomCells(int32 RoomId) const;
+
+    /** Room whose bounding rect is CellRect (room markers), else the room containing its center; INDEX_NONE if none. */
+    int32 FindRoom(const FIntRectLite& CellRect) const;
+
+    /**
+     * Append up to Count cells of RoomId that pass IsFree to OutCells.
+     * MinSpacing > 1 keeps accepted cells at least that many cells apart (Poisson-disk).
+     * Returns the number of cells appended.
+     */
+    int32 Sample(int32 RoomId, int32 Count, float MinSpacing, FRandomStream& Rng,
+        TFunctionRef<bool(const FIntPoint&)> IsFree, TArray<FIntPoint>& OutCells);
+
+    /** Same draw over an arbitrary cell pool (reordered in place); Bounds must contain every cell of Pool. */
+    static int32 SampleFrom(TArrayView<FIntPoint> Pool, const FIntRectLite& Bounds, int32 Count, float MinSpacing,
+        FRandomStream& Rng, TFunctionRef<bool(const FIntPoint&)> IsFree, TArray<FIntPoint>& OutCells);
+
+private:
+    // Room cells grouped by room id: RoomId's cells are Cells[RoomStarts[RoomId] .. RoomStarts[RoomId + 1])
+    TArray<int32> RoomStarts;
+    TArray<FIntPoint> Cells;
+    TArray<FIntRectLite> RoomRects;
+};
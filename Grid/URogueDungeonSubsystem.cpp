@@ -8,10 +8,19 @@
 #include "Grid/DungeonRenderComponent.h"
 #include "Grid/AABB.h"
 #include "Components/BoxComponent.h"
-#include "Containers/Queue.h"
+#include "Turn/TurnReplaySubsystem.h"
+#include "HAL/IConsoleManager.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogRogueDungeon, Log, All);
 
+// CodeRevision: INC-2025-1221-R1 (Background generation of the next floor) (2025-12-18 14:00)
+static int32 GTS_Dungeon_Prefetch = 1;
+static FAutoConsoleVariableRef CVarTS_Dungeon_Prefetch(
+    TEXT("ts.Dungeon.Prefetch"),
+    GTS_Dungeon_Prefetch,
+    TEXT("Generate the next floor's grid on a worker thread while the current floor is played (0 = off)."),
+    ECVF_Default);
+
 void URogueDungeonSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
@@ -70,13 +79,28 @@ void URogueDungeonSubsystem::StartGenerate(const URogueFloorConfigData* Cfg)
         return;
     }
 
+    // CodeRevision: INC-2025-1216-R1 (Route the floor seed through the turn replay recorder) (2025-12-16 10:00)
+    // URogueFloorConfigData has no seed field: fresh seed per floor, or the recorded one while replaying.
     FRandomStream Rng;
-    Rng.GenerateNewSeed(); // URogueFloorConfigData にはシード設定がないため、常に新しいシードを生成
+    if (UTurnReplaySubsystem* Replay = GetWorld() ? GetWorld()->GetSubsystem<UTurnReplaySubsystem>() : nullptr)
+    {
+        Rng.Initialize(Replay->AcquireFloorSeed());
+    }
+    else
+    {
+        Rng.GenerateNewSeed();
+    }
+    FloorGenerator->Seed = Rng.GetInitialSeed();
 
     UE_LOG(LogTemp, Display, TEXT("[RogueSubsystem] Generate START (Seed=%d, Map=%dx%d, Cell=%d)"), Rng.GetCurrentSeed(), Cfg->Width, Cfg->Height, Cfg->CellSizeUU);
 
     FloorGenerator->Generate(Cfg, Rng);
-    
+
+    FinishGenerate(Cfg);
+}
+
+void URogueDungeonSubsystem::FinishGenerate(const URogueFloorConfigData* Cfg)
+{
     RebuildRoomMarkers();
 
     EnsureRenderComponent();
@@ -96,6 +120,90 @@ void URogueDungeonSubsystem::StartGenerate(const URogueFloorConfigData* Cfg)
 
     // 既存のデリゲートも維持（後方互換性）
     OnGridReady.Broadcast(this);
+
+    // CodeRevision: INC-2025-1221-R1 (Background generation of the next floor) (2025-12-18 14:00)
+    KickFloorPrefetch(Cfg, CurrentFloorIndex + 1);
+}
+
+//------------------------------------------------------------------------------
+// Next-floor prefetch
+//------------------------------------------------------------------------------
+
+void URogueDungeonSubsystem::KickFloorPrefetch(const URogueFloorConfigData* Cfg, int32 FloorIndex)
+{
+    CancelFloorPrefetch();
+
+    UWorld* World = GetWorld();
+    if (GTS_Dungeon_Prefetch == 0 || !Cfg || !World || !World->GetAuthGameMode())
+    {
+        return;
+    }
+
+    // Recorded runs draw the floor seed (and reseed the global RNG) at the transition itself
+    if (const UTurnReplaySubsystem* Replay = World->GetSubsystem<UTurnReplaySubsystem>(); Replay && Replay->IsCapturing())
+    {
+        return;
+    }
+
+    FRandomStream Rng;
+    Rng.GenerateNewSeed();
+
+    FDungeonFloorGenRequest Request;
+    if (!ADungeonFloorGenerator::MakeGenRequest(Cfg, Rng, Request))
+    {
+        UE_LOG(LogRogueDungeon, Verbose, TEXT("[RogueSubsystem] Prefetch skipped for floor %d: picked template is not a native preset"), FloorIndex);
+        return;
+    }
+
+    Prefetch.FloorIndex = FloorIndex;
+    Prefetch.Config = Cfg;
+    Prefetch.StartSeconds = FPlatformTime::Seconds();
+    Prefetch.Task = UE::Tasks::Launch(UE_SOURCE_LOCATION,
+        [Request = MoveTemp(Request)]()
+        {
+            FDungeonFloorGenResult Result;
+            FDungeonGridBuilder::GenerateFloor(Request, Result);
+            return Result;
+        },
+        UE::Tasks::ETaskPriority::BackgroundNormal);
+
+    UE_LOG(LogRogueDungeon, Log, TEXT("[RogueSubsystem] Prefetch started for floor %d (Seed=%d)"), FloorIndex, Rng.GetInitialSeed());
+}
+
+bool URogueDungeonSubsystem::TakeFloorPrefetch(const URogueFloorConfigData* Cfg, int32 FloorIndex, FDungeonFloorGenResult& OutResult)
+{
+    const UTurnReplaySubsystem* Replay = GetWorld() ? GetWorld()->GetSubsystem<UTurnReplaySubsystem>() : nullptr;
+    const bool bUsable = Prefetch.Task.IsValid()
+        && Prefetch.FloorIndex == FloorIndex
+        && Prefetch.Config.Get() == Cfg
+        && !(Replay && Replay->IsCapturing());
+
+    if (!bUsable)
+    {
+        if (Prefetch.Task.IsValid())
+        {
+            UE_LOG(LogRogueDungeon, Log, TEXT("[RogueSubsystem] Prefetch for floor %d discarded (requested floor %d)"), Prefetch.FloorIndex, FloorIndex);
+        }
+        CancelFloorPrefetch();
+        return false;
+    }
+
+    const bool bWasReady = Prefetch.Task.IsCompleted();
+    const double WaitStart = FPlatformTime::Seconds();
+    OutResult = MoveTemp(Prefetch.Task.GetResult());
+    const double Now = FPlatformTime::Seconds();
+
+    UE_LOG(LogRogueDungeon, Log, TEXT("[RogueSubsystem] Prefetch committed for floor %d (Ready=%d, Waited=%.2fms, Age=%.2fms)"),
+        FloorIndex, bWasReady ? 1 : 0, (Now - WaitStart) * 1000.0, (Now - Prefetch.StartSeconds) * 1000.0);
+
+    CancelFloorPrefetch();
+    return OutResult.IsValid();
+}
+
+void URogueDungeonSubsystem::CancelFloorPrefetch()
+{
+    // The task owns copies of its inputs, so dropping the handle is safe even while it runs
+    Prefetch = FRogueFloorPrefetch();
 }
 
 UDungeonRenderComponent* URogueDungeonSubsystem::GetRenderComponent()
@@ -158,6 +266,22 @@ void URogueDungeonSubsystem::TransitionToFloor(int32 FloorIndex)
     // Destroy existing room markers before generating new floor
     DestroyRoomMarkers();
 
+    // CodeRevision: INC-2025-1221-R1 (Background generation of the next floor) (2025-12-18 14:00)
+    // The grid was generated while the previous floor was played: only commit it here
+    CurrentFloorIndex = FloorIndex;
+    FDungeonFloorGenResult Prefetched;
+    if (TakeFloorPrefetch(Config, FloorIndex, Prefetched))
+    {
+        EnsureFloorGenerator();
+        if (FloorGenerator && IsValid(FloorGenerator))
+        {
+            FloorGenerator->Seed = Prefetched.Seed;
+            FloorGenerator->ApplyGenerationResult(MoveTemp(Prefetched));
+            FinishGenerate(Config);
+            return;
+        }
+    }
+
     // Start generation with the config (seed can be modified based on FloorIndex if needed)
     StartGenerate(Config);
 }
@@ -266,102 +390,42 @@ void URogueDungeonSubsystem::RebuildRoomMarkers()
         return;
     }
 
-    const int32 Width = FloorGenerator->GridWidth;
-    const int32 Height = FloorGenerator->GridHeight;
+    // CodeRevision: INC-2025-1221-R1 (Room rects come with the generated grid) (2025-12-18 14:00)
+    // Room clusters are labelled during generation (possibly on a worker); only the actor spawns remain here
     const int32 CellSize = FloorGenerator->CellSize;
-    const TArray<int32>& Grid = FloorGenerator->GridCells;
-
-    if (Width <= 0 || Height <= 0 || Grid.Num() != Width * Height)
+    for (const FIntRectLite& Rect : FloorGenerator->GetGeneratedRoomRects())
     {
-        return;
-    }
-
-    const int32 RoomValue = static_cast<int32>(ECellType::Room);
-    TArray<uint8> Visited;
-    Visited.Init(0, Grid.Num());
-
-    auto IndexOf = [Width](int32 X, int32 Y)
-    {
-        return Y * Width + X;
-    };
+        const int32 MinX = Rect.X0;
+        const int32 MaxX = Rect.X1;
+        const int32 MinY = Rect.Y0;
+        const int32 MaxY = Rect.Y1;
+
+        const float TileSize = static_cast<float>(CellSize);
+        const float CenterX = (static_cast<float>(MinX + MaxX + 1) * 0.5f) * TileSize;
+        const float CenterY = (static_cast<float>(MinY + MaxY + 1) * 0.5f) * TileSize;
+        const FVector SpawnLocation(CenterX, CenterY, FloorGenerator->GetActorLocation().Z);
+
+        const float HalfWidth = static_cast<float>(MaxX - MinX + 1) * 0.5f * TileSize;
+        const float HalfHeight = static_cast<float>(MaxY - MinY + 1) * 0.5f * TileSize;
+        const FVector BoxExtent(HalfWidth, HalfHeight, TileSize * 0.5f);
+
+        FActorSpawnParameters Params;
+        Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        AAABB* RoomActor = World->SpawnActor<AAABB>(AAABB::StaticClass(), SpawnLocation, FRotator::ZeroRotator, Params);
+        if (!RoomActor)
+        {
+            continue;
+        }
 
-    for (int32 Y = 0; Y < Height; ++Y)
-    {
-        for (int32 X = 0; X < Width; ++X)
+        if (RoomActor->Box)
         {
-            const int32 Index = IndexOf(X, Y);
-            if (Visited[Index] || Grid[Index] != RoomValue)
-            {
-                continue;
-            }
-
-            int32 MinX = X;
-            int32 MaxX = X;
-            int32 MinY = Y;
-            int32 MaxY = Y;
-
-            TQueue<FIntPoint> Queue;
-            Queue.Enqueue(FIntPoint(X, Y));
-            Visited[Index] = 1;
-
-            while (!Queue.IsEmpty())
-            {
-                FIntPoint Current;
-                Queue.Dequeue(Current);
-
-                MinX = FMath::Min(MinX, Current.X);
-                MaxX = FMath::Max(MaxX, Current.X);
-                MinY = FMath::Min(MinY, Current.Y);
-                MaxY = FMath::Max(MaxY, Current.Y);
-
-                static const FIntPoint Directions[4] = { {1, 0}, {-1, 0}, {0, 1}, {0, -1} };
-                for (const FIntPoint& Dir : Directions)
-                {
-                    const int32 NX = Current.X + Dir.X;
-                    const int32 NY = Current.Y + Dir.Y;
-                    if (NX < 0 || NX >= Width || NY < 0 || NY >= Height)
-                    {
-                        continue;
-                    }
-
-                    const int32 NeighborIdx = IndexOf(NX, NY);
-                    if (Visited[NeighborIdx] || Grid[NeighborIdx] != RoomValue)
-                    {
-                        continue;
-                    }
-
-                    Visited[NeighborIdx] = 1;
-                    Queue.Enqueue(FIntPoint(NX, NY));
-                }
-            }
-
-            const float TileSize = static_cast<float>(CellSize);
-            const float CenterX = (static_cast<float>(MinX + MaxX + 1) * 0.5f) * TileSize;
-            const float CenterY = (static_cast<float>(MinY + MaxY + 1) * 0.5f) * TileSize;
-            const FVector SpawnLocation(CenterX, CenterY, FloorGenerator->GetActorLocation().Z);
-
-            const float HalfWidth = static_cast<float>(MaxX - MinX + 1) * 0.5f * TileSize;
-            const float HalfHeight = static_cast<float>(MaxY - MinY + 1) * 0.5f * TileSize;
-            const FVector BoxExtent(HalfWidth, HalfHeight, TileSize * 0.5f);
-
-            FActorSpawnParameters Params;
-            Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-            AAABB* RoomActor = World->SpawnActor<AAABB>(AAABB::StaticClass(), SpawnLocation, FRotator::ZeroRotator, Params);
-            if (!RoomActor)
-            {
-                continue;
-            }
-
-            if (RoomActor->Box)
-            {
-                RoomActor->Box->SetBoxExtent(BoxExtent, true);
-                RoomActor->Box->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-            }
-            RoomActor->SetActorHiddenInGame(true);
-            RoomActor->SetActorEnableCollision(false);
-
-            RoomMarkers.Add(RoomActor);
+            RoomActor->Box->SetBoxExtent(BoxExtent, true);
+            RoomActor->Box->SetCollisionEnabled(ECollisionEnabled::NoCollision);
         }
+        RoomActor->SetActorHiddenInGame(true);
+        RoomActor->SetActorEnableCollision(false);
+
+        RoomMarkers.Add(RoomActor);
     }
 }
 
@@ -386,6 +450,7 @@ void URogueDungeonSubsystem::Deinitialize()
 {
 	UE_LOG(LogRogueDungeon, Log, TEXT("[URogueDungeonSubsystem] Deinitialize called - Cleaning up"));
 
+    CancelFloorPrefetch();
     DestroyRoomMarkers();
     RoomMarkers.Reset();
     FloorGenerator = nullptr;
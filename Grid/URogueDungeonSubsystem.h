@@ -2,6 +2,8 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
+#include "Tasks/Task.h"
+#include "Grid/DungeonGridBuilder.h"
 
 class ADungeonFloorGenerator;
 class URogueFloorConfigData; // Use the RogueFloorConfigData Asset
@@ -12,6 +14,16 @@ class AAABB;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnGridReady, URogueDungeonSubsystem*, DungeonSubsystem);
 
+// CodeRevision: INC-2025-1221-R1 (Background generation of the next floor) (2025-12-18 14:00)
+/** Next floor generated on a worker thread while the player is still on the current one. */
+struct FRogueFloorPrefetch
+{
+    int32 FloorIndex = INDEX_NONE;
+    TWeakObjectPtr<const URogueFloorConfigData> Config;
+    UE::Tasks::TTask<FDungeonFloorGenResult> Task;
+    double StartSeconds = 0.0;
+};
+
 UCLASS()
 class LYRAGAME_API URogueDungeonSubsystem : public UWorldSubsystem
 {
@@ -41,10 +53,13 @@ public:
     /** 生成済みダンジョンから検出した部屋マーカーを取得（生成されていない場合は空配列） */
     void GetGeneratedRooms(TArray<AAABB*>& OutRooms) const;
 
-    /** 指定されたフロアに遷移（新しいダンジョンを生成） */
+    /** 指定されたフロアに遷移（新しいダンジョンを生成）。先読み済みならその結果を確定するだけ */
     UFUNCTION(BlueprintCallable, Category="Rogue|Dungeon")
     void TransitionToFloor(int32 FloorIndex);
 
+    UFUNCTION(BlueprintPure, Category="Rogue|Dungeon")
+    int32 GetCurrentFloorIndex() const { return CurrentFloorIndex; }
+
     virtual void Initialize(FSubsystemCollectionBase& Collection) override;
     virtual void Deinitialize() override;
 
@@ -71,6 +86,17 @@ protected:
     /** Starts the actual generation process using a loaded config asset. */
     void StartGenerate(const URogueFloorConfigData* Cfg);
 
+    /** Room markers, rendering and OnGridReady for the grid now held by FloorGenerator; then prefetch the next floor. */
+    void FinishGenerate(const URogueFloorConfigData* Cfg);
+
+    // Next-floor prefetch (ts.Dungeon.Prefetch)
+    void KickFloorPrefetch(const URogueFloorConfigData* Cfg, int32 FloorIndex);
+    bool TakeFloorPrefetch(const URogueFloorConfigData* Cfg, int32 FloorIndex, FDungeonFloorGenResult& OutResult);
+    void CancelFloorPrefetch();
+
+    int32 CurrentFloorIndex = 0;
+    FRogueFloorPrefetch Prefetch;
+
     void RebuildRoomMarkers();
     void DestroyRoomMarkers();
 };
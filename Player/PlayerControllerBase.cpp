@@ -9,6 +9,7 @@
 // CodeRevision: INC-2025-00032-R1 (Add TurnFlowCoordinator include for GetCurrentTurnIndex() replacement) (2025-01-XX XX:XX)
 #include "Turn/PlayerInputProcessor.h"
 #include "Turn/TurnFlowCoordinator.h"
+#include "Turn/PlayerTravelSubsystem.h"
 #include "EnhancedInputComponent.h"
 #include "EnhancedInputSubsystems.h"
 #include "Camera/PlayerCameraManager.h"
@@ -834,6 +835,12 @@ void APlayerControllerBase::Server_SubmitCommand_Implementation(const FPlayerCom
 
     UE_LOG(LogTemp, Log, TEXT("[Server] WindowId validated: %d"), Command.WindowId);
 
+    // CodeRevision: INC-2025-1218-R1 (Any manual command interrupts travel) (2025-12-17 10:00)
+    if (UPlayerTravelSubsystem* Travel = GetWorld()->GetSubsystem<UPlayerTravelSubsystem>())
+    {
+        Travel->CancelTravel(TEXT("PlayerInput"));
+    }
+
     UPlayerInputProcessor* InputProcServer = GetWorld() ? GetWorld()->GetSubsystem<UPlayerInputProcessor>() : nullptr;
     if (!InputProcServer || !InputProcServer->IsInputOpen_Server(CachedTurnManager.Get()))
     {
@@ -1031,6 +1038,32 @@ void APlayerControllerBase::GridSmokeTest()
     }
 }
 
+// CodeRevision: INC-2025-1218-R1 (Travel / auto-explore console entry points) (2025-12-17 10:00)
+void APlayerControllerBase::TravelTo(int32 X, int32 Y)
+{
+    Server_BeginTravel(FIntPoint(X, Y), false);
+}
+
+void APlayerControllerBase::AutoExplore()
+{
+    Server_BeginTravel(FIntPoint(-1, -1), true);
+}
+
+void APlayerControllerBase::Server_BeginTravel_Implementation(FIntPoint Destination, bool bExplore)
+{
+    UPlayerTravelSubsystem* Travel = GetWorld() ? GetWorld()->GetSubsystem<UPlayerTravelSubsystem>() : nullptr;
+    if (!Travel)
+    {
+        UE_LOG(LogTemp, Error, TEXT("[Server] UPlayerTravelSubsystem not found"));
+        return;
+    }
+
+    const FDashStopConfig StopConfig;
+    const bool bStarted = bExplore ? Travel->BeginAutoExplore(StopConfig) : Travel->BeginTravel(Destination, StopConfig);
+    UE_LOG(LogTemp, Log, TEXT("[Server] %s request %s"),
+        bExplore ? TEXT("AutoExplore") : TEXT("TravelTo"), bStarted ? TEXT("started") : TEXT("refused"));
+}
+
 void APlayerControllerBase::Client_NotifyMoveRejected_Implementation()
 {
     UE_LOG(LogTemp, Warning, TEXT("[Client] MOVE REJECTED RPC RECEIVED"));
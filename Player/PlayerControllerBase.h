@@ -48,6 +48,15 @@ public:
     UFUNCTION(Exec)
     void GridSmokeTest();
 
+    // CodeRevision: INC-2025-1218-R1 (Travel / auto-explore console entry points) (2025-12-17 10:00)
+    /** Walk to grid cell (X,Y) over several turns (stops on enemies in view / dash stop conditions) */
+    UFUNCTION(Exec)
+    void TravelTo(int32 X, int32 Y);
+
+    /** Walk to the nearest unvisited cells until the floor is explored or something interrupts */
+    UFUNCTION(Exec)
+    void AutoExplore();
+
     // CodeRevision: INC-2025-00030-R2 (Migrate to UGridPathfindingSubsystem) (2025-11-17 00:40)
     /** グリッドパスファインダーへの参照（UnitManagerからアクセス可能） */
     UPROPERTY(BlueprintReadWrite, Category = "TBS|Turn")
@@ -231,6 +240,10 @@ protected:
     UFUNCTION(Server, Reliable)
     void Server_TurnFacing(FVector2D Direction); // そのまま（使うなら）
 
+    /** Start travel (bExplore=false, to Destination) or auto-explore on the server */
+    UFUNCTION(Server, Reliable)
+    void Server_BeginTravel(FIntPoint Destination, bool bExplore);
+
 protected:
     /** 最後に入力された向き変更方向 */
     UPROPERTY(BlueprintReadWrite, Category = "TBS|Input")
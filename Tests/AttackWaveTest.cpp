@@ -0,0 +1,116 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Turn/AttackPhaseExecutorSubsystem.h"
+#include "Abilities/GameplayAbilityTargetTypes.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+// CodeRevision: INC-2025-1212-R2 (Attacks that only share a target play in the same wave) (2025-12-27 17:00)
+namespace AttackWaveTestPrivate
+{
+    static FResolvedAction MakeAttack(AActor* Attacker, const FIntPoint& Cell, AActor* Target, const FIntPoint& TargetCell)
+    {
+        FResolvedAction Action;
+        Action.Actor = Attacker;
+        Action.CurrentCell = Cell;
+        Action.NextCell = TargetCell;
+        if (Target)
+        {
+            FGameplayAbilityTargetData_ActorArray* Data = new FGameplayAbilityTargetData_ActorArray();
+            Data->TargetActorArray.Add(Target);
+            Action.TargetData.Add(Data);
+        }
+        return Action;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Wave grouping: shared targets play together, dependent attacks keep their order
+//------------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAttackWaveGroupingTest, "Rogue.Turn.AttackWaves.Grouping", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAttackWaveGroupingTest::RunTest(const FString& Parameters)
+{
+    using namespace AttackWaveTestPrivate;
+
+    UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+    if (!World)
+    {
+        AddError(TEXT("Failed to create world"));
+        return false;
+    }
+
+    AActor* Player = World->SpawnActor<AActor>();
+    const FIntPoint PlayerCell(10, 10);
+
+    TArray<AActor*> Enemies;
+    TArray<FIntPoint> EnemyCells;
+    for (int32 Index = 0; Index < 10; ++Index)
+    {
+        Enemies.Add(World->SpawnActor<AActor>());
+        EnemyCells.Add(FIntPoint(2 + Index, 2));
+    }
+
+    // Ten enemies on the player: one wave, dispatched in queue order
+    TArray<FResolvedAction> Attacks;
+    for (int32 Index = 0; Index < Enemies.Num(); ++Index)
+    {
+        Attacks.Add(MakeAttack(Enemies[Index], EnemyCells[Index], Player, PlayerCell));
+    }
+
+    TArray<TArray<int32>> Waves;
+    UAttackPhaseExecutorSubsystem::BuildAttackWaves(Attacks, /*bSequential*/false, Waves);
+    TestEqual(TEXT("same-target attacks share one wave"), Waves.Num(), 1);
+    if (Waves.Num() == 1)
+    {
+        TestEqual(TEXT("every attack in the wave"), Waves[0].Num(), Enemies.Num());
+        bool bInOrder = true;
+        for (int32 Index = 0; Index < Waves[0].Num(); ++Index)
+        {
+            bInOrder &= Waves[0][Index] == Index;
+        }
+        TestTrue(TEXT("wave keeps queue order"), bInOrder);
+    }
+
+    // Strict mode still plays them one by one
+    UAttackPhaseExecutorSubsystem::BuildAttackWaves(Attacks, /*bSequential*/true, Waves);
+    TestEqual(TEXT("sequential mode: one wave per attack"), Waves.Num(), Enemies.Num());
+
+    // Same attacker twice: the second swing waits for the first
+    Attacks.Reset();
+    Attacks.Add(MakeAttack(Enemies[0], EnemyCells[0], Player, PlayerCell));
+    Attacks.Add(MakeAttack(Enemies[1], EnemyCells[1], Player, PlayerCell));
+    Attacks.Add(MakeAttack(Enemies[0], EnemyCells[0], Player, PlayerCell));
+    UAttackPhaseExecutorSubsystem::BuildAttackWaves(Attacks, false, Waves);
+    TestEqual(TEXT("repeated attacker splits the waves"), Waves.Num(), 2);
+    if (Waves.Num() == 2)
+    {
+        TestEqual(TEXT("first wave: both first swings"), Waves[0], TArray<int32>({ 0, 1 }));
+        TestEqual(TEXT("second wave: the repeat"), Waves[1], TArray<int32>({ 2 }));
+    }
+
+    // An attack on another attacker waits for that attacker's own attack
+    Attacks.Reset();
+    Attacks.Add(MakeAttack(Enemies[1], EnemyCells[1], Player, PlayerCell));
+    Attacks.Add(MakeAttack(Enemies[2], EnemyCells[2], Enemies[1], EnemyCells[1]));
+    Attacks.Add(MakeAttack(Enemies[3], EnemyCells[3], Player, PlayerCell));
+    UAttackPhaseExecutorSubsystem::BuildAttackWaves(Attacks, false, Waves);
+    TestEqual(TEXT("attacker-as-target splits the waves"), Waves.Num(), 2);
+    if (Waves.Num() == 2)
+    {
+        TestEqual(TEXT("independent attacks first"), Waves[0], TArray<int32>({ 0, 2 }));
+        TestEqual(TEXT("dependent attack after"), Waves[1], TArray<int32>({ 1 }));
+    }
+
+    // No known target: runs alone and keeps its place in the order
+    Attacks.Reset();
+    Attacks.Add(MakeAttack(Enemies[4], EnemyCells[4], Player, PlayerCell));
+    Attacks.Add(MakeAttack(Enemies[5], EnemyCells[5], nullptr, FIntPoint(-1, -1)));
+    Attacks.Add(MakeAttack(Enemies[6], EnemyCells[6], Player, PlayerCell));
+    UAttackPhaseExecutorSubsystem::BuildAttackWaves(Attacks, false, Waves);
+    TestEqual(TEXT("untargeted attack is exclusive"), Waves.Num(), 3);
+
+    World->DestroyWorld(false);
+    return true;
+}
@@ -0,0 +1,158 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Turn/CooperativePlannerSubsystem.h"
+#include "Turn/DistanceFieldSubsystem.h"
+#include "Grid/GridPathfindingSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+// CodeRevision: INC-2025-1210-R3 (Per-turn planner summary behind the AI diagnostics channel) (2025-12-27 16:00)
+namespace CooperativePlannerTestPrivate
+{
+    static constexpr int32 GridSize = 12;
+
+    /** GridSize x GridSize walls; Open decides which cells are walkable. */
+    template<typename FOpenFn>
+    static void InitGrid(UGridPathfindingSubsystem* GridPathfinding, FOpenFn Open)
+    {
+        TArray<int32> GridCosts;
+        GridCosts.Init(-1, GridSize * GridSize);
+        for (int32 Y = 0; Y < GridSize; ++Y)
+        {
+            for (int32 X = 0; X < GridSize; ++X)
+            {
+                if (Open(X, Y))
+                {
+                    GridCosts[Y * GridSize + X] = 0;
+                }
+            }
+        }
+        GridPathfinding->InitializeGrid(GridCosts, FVector(GridSize, GridSize, 0), 100);
+    }
+
+    static TArray<FReservationEntry> MakeMovers(UWorld* World, const TArray<FIntPoint>& Cells)
+    {
+        TArray<FReservationEntry> Movers;
+        for (int32 Index = 0; Index < Cells.Num(); ++Index)
+        {
+            FReservationEntry& Mover = Movers.AddDefaulted_GetRef();
+            Mover.Actor = World->SpawnActor<AActor>();
+            Mover.CurrentCell = Cells[Index];
+            Mover.GenerationOrder = Index;
+        }
+        return Movers;
+    }
+
+    /** Cell of Plan at T; movers rest on their last cell until the window closes. */
+    static FIntPoint CellAt(const FCooperativePlan& Plan, int32 T)
+    {
+        return Plan.Route.IsValidIndex(T) ? Plan.Route[T] : Plan.Route.Last();
+    }
+}
+
+//------------------------------------------------------------------------------
+// Planned routes never share a cell or swap, and followers move into vacated cells
+//------------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCooperativePlannerReservationTest, "Rogue.Turn.CooperativePlanner.Reservations", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FCooperativePlannerReservationTest::RunTest(const FString& Parameters)
+{
+    using namespace CooperativePlannerTestPrivate;
+
+    UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+    if (!World)
+    {
+        AddError(TEXT("Failed to create world"));
+        return false;
+    }
+
+    UGridPathfindingSubsystem* GridPathfinding = World->GetSubsystem<UGridPathfindingSubsystem>();
+    UDistanceFieldSubsystem* DistanceField = World->GetSubsystem<UDistanceFieldSubsystem>();
+    UCooperativePlannerSubsystem* Planner = World->GetSubsystem<UCooperativePlannerSubsystem>();
+    if (!GridPathfinding || !DistanceField || !Planner)
+    {
+        AddError(TEXT("Failed to get subsystems"));
+        World->DestroyWorld(false);
+        return false;
+    }
+
+    const int32 Window = Planner->PlanningWindow;
+
+    // Open room: six movers packed together converge on the player past a held cell
+    InitGrid(GridPathfinding, [](int32 X, int32 Y) { return X > 0 && Y > 0 && X < GridSize - 1 && Y < GridSize - 1; });
+    const FIntPoint Goal(9, 6);
+    DistanceField->UpdateDistanceField(Goal);
+
+    const TArray<FReservationEntry> Crowd = MakeMovers(World, {
+        FIntPoint(2, 4), FIntPoint(3, 4), FIntPoint(2, 5), FIntPoint(3, 5), FIntPoint(2, 6), FIntPoint(3, 6) });
+    const TSet<FIntPoint> StaticBlocked = { FIntPoint(7, 6), FIntPoint(7, 5) };
+
+    TArray<FCooperativePlan> Plans;
+    const int32 NumMoving = Planner->PlanCooperativeRoutes(Crowd, Goal, StaticBlocked, Plans);
+    TestEqual(TEXT("one plan per mover"), Plans.Num(), Crowd.Num());
+    TestTrue(TEXT("the crowd advances"), NumMoving > 0);
+
+    bool bStartsAtMover = true;
+    bool bSingleSteps = true;
+    bool bAvoidsBlocked = true;
+    bool bNoVertexConflict = true;
+    bool bNoSwap = true;
+    for (int32 A = 0; A < Plans.Num(); ++A)
+    {
+        if (Plans[A].Route.Num() == 0)
+        {
+            AddError(FString::Printf(TEXT("mover %d has no route"), A));
+            continue;
+        }
+        bStartsAtMover &= Plans[A].Route[0] == Crowd[A].CurrentCell;
+
+        for (int32 T = 0; T <= Window; ++T)
+        {
+            const FIntPoint Cell = CellAt(Plans[A], T);
+            bAvoidsBlocked &= Cell != Goal && (T == 0 || !StaticBlocked.Contains(Cell));
+            if (T > 0)
+            {
+                const FIntPoint Step = Cell - CellAt(Plans[A], T - 1);
+                bSingleSteps &= FMath::Abs(Step.X) <= 1 && FMath::Abs(Step.Y) <= 1;
+            }
+
+            for (int32 B = A + 1; B < Plans.Num(); ++B)
+            {
+                if (Plans[B].Route.Num() == 0) continue;
+                bNoVertexConflict &= Cell != CellAt(Plans[B], T);
+                if (T > 0)
+                {
+                    bNoSwap &= !(Cell == CellAt(Plans[B], T - 1) && CellAt(Plans[A], T - 1) == CellAt(Plans[B], T));
+                }
+            }
+        }
+    }
+    TestTrue(TEXT("routes start on the mover's cell"), bStartsAtMover);
+    TestTrue(TEXT("one cell per turn"), bSingleSteps);
+    TestTrue(TEXT("routes avoid held cells and the player"), bAvoidsBlocked);
+    TestTrue(TEXT("no two movers reserve the same cell and turn"), bNoVertexConflict);
+    TestTrue(TEXT("no head-on swaps"), bNoSwap);
+    TestEqual(TEXT("route kept for inspection"), Planner->GetPlannedRoute(Crowd[0].Actor).Num(), Plans[0].Route.Num());
+
+    // One-wide corridor: the front mover plans first and the ones behind follow into its cell
+    InitGrid(GridPathfinding, [](int32 X, int32 Y) { return Y == 5 && X > 0 && X < GridSize - 1; });
+    const FIntPoint CorridorGoal(10, 5);
+    DistanceField->UpdateDistanceField(CorridorGoal);
+
+    const TArray<FReservationEntry> Queue = MakeMovers(World, { FIntPoint(3, 5), FIntPoint(5, 5), FIntPoint(4, 5) });
+    const int32 QueueMoving = Planner->PlanCooperativeRoutes(Queue, CorridorGoal, TSet<FIntPoint>(), Plans);
+    TestEqual(TEXT("the whole queue moves"), QueueMoving, 3);
+    TestEqual(TEXT("front mover steps forward"), Plans[1].GetNextCell(), FIntPoint(6, 5));
+    TestEqual(TEXT("second mover takes the vacated cell"), Plans[2].GetNextCell(), FIntPoint(5, 5));
+    TestEqual(TEXT("last mover follows"), Plans[0].GetNextCell(), FIntPoint(4, 5));
+
+    // A held cell ahead stops the queue instead of letting anyone through it
+    const TSet<FIntPoint> Wall = { FIntPoint(6, 5) };
+    const int32 BlockedMoving = Planner->PlanCooperativeRoutes(Queue, CorridorGoal, Wall, Plans);
+    TestEqual(TEXT("nobody moves past a held corridor cell"), BlockedMoving, 0);
+    TestEqual(TEXT("front mover holds"), Plans[1].GetNextCell(), FIntPoint(5, 5));
+
+    World->DestroyWorld(false);
+    return true;
+}
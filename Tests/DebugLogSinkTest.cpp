@@ -0,0 +1,106 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Guid.h"
+#include "HAL/FileManager.h"
+#include "Async/ParallelFor.h"
+#include "Debug/DebugLogSink.h"
+
+// CodeRevision: INC-2025-1228-R1 (Lock-free binary log sink with a background writer and on-demand CSV) (2025-12-22 10:00)
+
+//------------------------------------------------------------------------------
+// Many producers -> one session file set -> same records back, CSV rendered
+//------------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDebugLogSinkRoundTripTest, "Rogue.Debug.LogSink.RoundTrip", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDebugLogSinkRoundTripTest::RunTest(const FString& Parameters)
+{
+    const FString Session = FString::Printf(TEXT("Test-%s"), *FGuid::NewGuid().ToString(EGuidFormats::Digits));
+    const int32 Producers = 4;
+    const int32 PerProducer = 500;
+    const FName Category(TEXT("LogSinkTest"));
+
+    FDebugLogSink Sink;
+    TestFalse(TEXT("no session -> rejected"), Sink.Push(EDebugLogRecordKind::Log, Category, ELogVerbosity::Log, TEXT("early")));
+
+    Sink.BeginSession(Session);
+    Sink.SetTurnId(7);
+
+    ParallelFor(Producers, [&Sink, Category, PerProducer](int32 Producer)
+    {
+        for (int32 Index = 0; Index < PerProducer; ++Index)
+        {
+            Sink.Push(EDebugLogRecordKind::Log, Category, ELogVerbosity::Warning, *FString::Printf(TEXT("P%d #%d"), Producer, Index), /*bBlocking*/true);
+        }
+    });
+
+    const FString Long = FString::ChrN(FDebugLogSink::MaxMessageBytes + 100, TEXT('x'));
+    Sink.Push(EDebugLogRecordKind::Log, Category, ELogVerbosity::Log, *Long);
+    Sink.Push(EDebugLogRecordKind::Intent, FName(TEXT("AI.Intent.Move")), ELogVerbosity::Log, TEXT("Enemy=BP_Enemy_0 Cell=caf\u00e9"));
+    Sink.EndSession();
+    TestTrue(TEXT("flushed"), Sink.Flush());
+    TestEqual(TEXT("nothing dropped"), Sink.GetDroppedCount(), static_cast<uint64>(0));
+
+    const TArray<FString> Files = FDebugLogSink::FindSessionFiles(Session);
+    TestEqual(TEXT("one file"), Files.Num(), 1);
+
+    int32 Warnings = 0;
+    int32 SessionMarkers = 0;
+    bool bTurnStamped = true;
+    FString Truncated;
+    FString Intent;
+    for (const FString& Path : Files)
+    {
+        TArray<uint8> Bytes;
+        FFileHelper::LoadFileToArray(Bytes, *Path);
+
+        FDebugLogReader Reader(Bytes);
+        TestTrue(TEXT("header valid"), Reader.IsValid());
+
+        FDebugLogRecord Record;
+        while (Reader.Next(Record))
+        {
+            switch (Record.Kind)
+            {
+            case EDebugLogRecordKind::Log:
+                TestEqual(TEXT("category name"), Reader.GetCategoryName(Record.CategoryId), FString(TEXT("LogSinkTest")));
+                if (Record.Verbosity == ELogVerbosity::Warning)
+                {
+                    ++Warnings;
+                    bTurnStamped &= Record.TurnId == 7;
+                }
+                else
+                {
+                    Truncated = Record.GetMessage();
+                }
+                break;
+            case EDebugLogRecordKind::Intent:
+                Intent = Record.GetMessage();
+                break;
+            default:
+                ++SessionMarkers;
+                break;
+            }
+        }
+    }
+
+    TestEqual(TEXT("every producer record"), Warnings, Producers * PerProducer);
+    TestTrue(TEXT("turn id stamped"), bTurnStamped);
+    TestEqual(TEXT("session start + end"), SessionMarkers, 2);
+    TestEqual(TEXT("long message truncated"), Truncated.Len(), FDebugLogSink::MaxMessageBytes);
+    TestEqual(TEXT("UTF-8 round trip"), Intent, FString(TEXT("Enemy=BP_Enemy_0 Cell=caf\u00e9")));
+
+    const FString CsvPath = FDebugLogSink::GetLogDirectory() / FString::Printf(TEXT("Session_%s.csv"), *Session);
+    int32 Rows = 0;
+    TestTrue(TEXT("CSV written"), FDebugLogSink::ConvertToCSV(Files, CsvPath, &Rows));
+    TestEqual(TEXT("CSV rows"), Rows, Producers * PerProducer + 4);
+
+    for (const FString& Path : Files)
+    {
+        IFileManager::Get().Delete(*Path);
+    }
+    IFileManager::Get().Delete(*CsvPath);
+
+    return true;
+}
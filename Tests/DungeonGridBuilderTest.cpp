@@ -0,0 +1,246 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Tasks/Task.h"
+#include "Grid/DungeonGridBuilder.h"
+#include "Grid/DungeonFloorGenerator.h"
+#include "Engine/World.h"
+
+// CodeRevision: INC-2025-1221-R1 (Grid generation as a pure function over a plain buffer) (2025-12-18 14:00)
+namespace DungeonGridBuilderTestPrivate
+{
+    static FDungeonFloorGenRequest MakeRequest(EMapTemplate Layout, int32 Seed)
+    {
+        FDungeonFloorGenRequest Request;
+        Request.Layout = Layout;
+        Request.Params.Width = 64;
+        Request.Params.Height = 64;
+        Request.Params.MinRooms = 4;
+        Request.Rng.Initialize(Seed);
+        return Request;
+    }
+
+    static int32 CountCells(const FDungeonFloorGenResult& Result, ECellType Type)
+    {
+        int32 Count = 0;
+        for (const int32 Cell : Result.Cells)
+        {
+            Count += (Cell == static_cast<int32>(Type)) ? 1 : 0;
+        }
+        return Count;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Same request -> same grid, on the game thread and on a worker
+//------------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDungeonGridBuilderDeterminismTest, "Rogue.Dungeon.GridBuilder.Determinism", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDungeonGridBuilderDeterminismTest::RunTest(const FString& Parameters)
+{
+    using namespace DungeonGridBuilderTestPrivate;
+
+    const EMapTemplate Layouts[] = { EMapTemplate::NormalBSP, EMapTemplate::LargeHall, EMapTemplate::FourQuads, EMapTemplate::CentralCrossWithMiniRooms };
+
+    for (const EMapTemplate Layout : Layouts)
+    {
+        const FDungeonFloorGenRequest Request = MakeRequest(Layout, 4242);
+
+        FDungeonFloorGenResult Local;
+        FDungeonGridBuilder::GenerateFloor(Request, Local);
+
+        UE::Tasks::TTask<FDungeonFloorGenResult> Task = UE::Tasks::Launch(UE_SOURCE_LOCATION, [Request]()
+        {
+            FDungeonFloorGenResult Result;
+            FDungeonGridBuilder::GenerateFloor(Request, Result);
+            return Result;
+        });
+        const FDungeonFloorGenResult& Worker = Task.GetResult();
+
+        const FString Name = FString::Printf(TEXT("Layout %d"), static_cast<int32>(Layout));
+        TestTrue(*(Name + TEXT(" result valid")), Local.IsValid());
+        TestEqual(*(Name + TEXT(" seed")), Local.Seed, 4242);
+        TestTrue(*(Name + TEXT(" worker grid matches")), Local.Cells == Worker.Cells);
+        TestEqual(*(Name + TEXT(" room rects match")), Local.Labels.RoomRects.Num(), Worker.Labels.RoomRects.Num());
+        TestEqual(*(Name + TEXT(" one StairDown")), CountCells(Local, ECellType::StairDown), 1);
+        TestEqual(*(Name + TEXT(" one StairUp")), CountCells(Local, ECellType::StairUp), 1);
+        TestTrue(*(Name + TEXT(" has rooms")), Local.Labels.RoomRects.Num() > 0);
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Mega floor: hundreds of rooms, one seed -> one layout
+//------------------------------------------------------------------------------
+
+// CodeRevision: INC-2025-1222-R1 (Kruskal MST over a grid-bucketed neighbour graph) (2025-12-19 10:00)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDungeonGridBuilderMegaFloorTest, "Rogue.Dungeon.GridBuilder.MegaFloor", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDungeonGridBuilderMegaFloorTest::RunTest(const FString& Parameters)
+{
+    using namespace DungeonGridBuilderTestPrivate;
+
+    FDungeonFloorGenRequest Request = MakeRequest(EMapTemplate::NormalBSP, 777);
+    Request.Params.Width = 256;
+    Request.Params.Height = 256;
+    Request.Params.MinRoomSize = 3;
+    Request.Params.MaxRoomSize = 6;
+    Request.Params.MinRooms = 100;
+    Request.Params.MaxRooms = 600;
+    Request.Params.StopSplitProbability = 0.0f;
+    Request.Params.ExtraConnectorChance = 0.25f;
+
+    FDungeonFloorGenResult First;
+    FDungeonFloorGenResult Second;
+    FDungeonGridBuilder::GenerateFloor(Request, First);
+    FDungeonGridBuilder::GenerateFloor(Request, Second);
+
+    TestTrue(TEXT("result valid"), First.IsValid());
+    TestFalse(TEXT("no fallback"), First.bUsedFallback);
+    TestTrue(TEXT("same seed -> same grid"), First.Cells == Second.Cells);
+    TestTrue(TEXT("hundreds of rooms"), First.RoomCount >= 100);
+    TestTrue(TEXT("rooms reachable"), First.Reachability >= Request.Params.ReachabilityThreshold);
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Labeler: a U-shaped room must merge into one component on the second pass
+//------------------------------------------------------------------------------
+
+// CodeRevision: INC-2025-1223-R1 (Single-pass union-find grid labelling) (2025-12-19 14:00)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDungeonGridBuilderLabelsTest, "Rogue.Dungeon.GridBuilder.Labels", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDungeonGridBuilderLabelsTest::RunTest(const FString& Parameters)
+{
+    // # = Wall, R = Room, C = Corridor
+    const TCHAR* Rows[] =
+    {
+        TEXT("#######"),
+        TEXT("#R#R#R#"),
+        TEXT("#RRR#C#"),
+        TEXT("#####R#"),
+        TEXT("#######"),
+    };
+    const int32 Width = 7;
+    const int32 Height = UE_ARRAY_COUNT(Rows);
+
+    TArray<int32> Cells;
+    for (const TCHAR* Row : Rows)
+    {
+        for (int32 X = 0; X < Width; ++X)
+        {
+            const ECellType Type = Row[X] == TEXT('R') ? ECellType::Room : (Row[X] == TEXT('C') ? ECellType::Corridor : ECellType::Wall);
+            Cells.Add(static_cast<int32>(Type));
+        }
+    }
+
+    FDungeonGridLabels Labels;
+    FDungeonGridBuilder::LabelGrid(Cells, Width, Height, Labels);
+
+    TestEqual(TEXT("walkable cells"), Labels.WalkableCount, 8);
+    TestEqual(TEXT("walkable components"), Labels.WalkableSizes.Num(), 2);
+    TestEqual(TEXT("first walkable component"), Labels.WalkableSizes[0], 5);
+    TestEqual(TEXT("room components"), Labels.NumRooms(), 3);
+    TestEqual(TEXT("U room size"), Labels.RoomSizes[0], 5);
+    TestEqual(TEXT("U room rect"), Labels.RoomRects[0].X1, 3);
+    TestTrue(TEXT("corridor splits the right rooms"), Labels.GetRoomId(5, 1) != Labels.GetRoomId(5, 3));
+    TestEqual(TEXT("corridor is not a room"), Labels.GetRoomId(5, 2), static_cast<int32>(INDEX_NONE));
+
+    // CodeRevision: INC-2025-1221-R2 (Re-label lazily after terrain edits change walkability) (2025-12-27 19:00)
+    // Terrain edits on a live floor: labels follow walkability and room changes, ignore the rest
+    UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+    if (!World)
+    {
+        AddError(TEXT("Failed to create world"));
+        return false;
+    }
+
+    ADungeonFloorGenerator* Floor = World->SpawnActor<ADungeonFloorGenerator>();
+    FDungeonFloorGenResult Result;
+    Result.Cells = Cells;
+    Result.Width = Width;
+    Result.Height = Height;
+    Result.Labels = Labels;
+    Floor->ApplyGenerationResult(MoveTemp(Result));
+    TestEqual(TEXT("applied labels"), Floor->GetGridLabels().NumRooms(), 3);
+
+    const auto CellCenter = [Floor](int32 X, int32 Y)
+    {
+        return FVector((X + 0.5f) * Floor->CellSize, (Y + 0.5f) * Floor->CellSize, 0.0f);
+    };
+
+    // Walling off the U's middle cell splits it in two
+    Floor->GridChangeVector(CellCenter(2, 2), static_cast<int32>(ECellType::Wall));
+    TestEqual(TEXT("wall splits the U room"), Floor->GetGridLabels().NumRooms(), 4);
+    TestEqual(TEXT("walkable cells after the wall"), Floor->GetGridLabels().WalkableCount, 7);
+    TestEqual(TEXT("wall cell has no room"), Floor->GetRoomIdAt(2, 2), static_cast<int32>(INDEX_NONE));
+    TestTrue(TEXT("U halves are separate rooms"), Floor->GetRoomIdAt(1, 1) != Floor->GetRoomIdAt(3, 1));
+
+    // Opening the corridor cell into a room joins the right rooms
+    Floor->GridChangeVector(CellCenter(5, 2), static_cast<int32>(ECellType::Room));
+    TestEqual(TEXT("room cell joins the right rooms"), Floor->GetRoomIdAt(5, 1), Floor->GetRoomIdAt(5, 3));
+    TestEqual(TEXT("room rects follow"), Floor->GetGeneratedRoomRects().Num(), Floor->GetGridLabels().NumRooms());
+
+    // Room -> Door keeps walkability but leaves the room layer
+    Floor->GridChangeVector(CellCenter(5, 2), static_cast<int32>(ECellType::Door));
+    TestTrue(TEXT("door splits the right rooms again"), Floor->GetRoomIdAt(5, 1) != Floor->GetRoomIdAt(5, 3));
+    TestEqual(TEXT("door stays walkable"), Floor->GetGridLabels().WalkableCount, 7);
+
+    World->DestroyWorld(false);
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Wall segments: buried rock is culled, exposed runs are merged
+//------------------------------------------------------------------------------
+
+// CodeRevision: INC-2025-1226-R1 (Hidden wall culling and greedy wall merging) (2025-12-21 10:00)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDungeonGridBuilderWallSegmentsTest, "Rogue.Dungeon.GridBuilder.WallSegments", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDungeonGridBuilderWallSegmentsTest::RunTest(const FString& Parameters)
+{
+    // Row 4 only touches walls, so it is never visible
+    const TCHAR* Rows[] =
+    {
+        TEXT("######"),
+        TEXT("#....#"),
+        TEXT("#....#"),
+        TEXT("######"),
+        TEXT("######"),
+    };
+    const int32 Width = 6;
+    const int32 Height = UE_ARRAY_COUNT(Rows);
+
+    TArray<int32> Cells;
+    for (const TCHAR* Row : Rows)
+    {
+        for (int32 X = 0; X < Width; ++X)
+        {
+            Cells.Add(static_cast<int32>(Row[X] == TEXT('#') ? ECellType::Wall : ECellType::Floor));
+        }
+    }
+
+    FDungeonWallMergeSettings Settings;
+    TArray<FDungeonWallSegment> Segments;
+
+    TestEqual(TEXT("culled: visible wall cells"), FDungeonGridBuilder::BuildWallSegments(Cells, Width, Height, Settings, Segments), 16);
+    TestEqual(TEXT("culled + merged: segments"), Segments.Num(), 4);
+
+    Settings.MaxRunLength = 4;
+    FDungeonGridBuilder::BuildWallSegments(Cells, Width, Height, Settings, Segments);
+    TestEqual(TEXT("runs split at MaxRunLength"), Segments.Num(), 6);
+
+    Settings.MaxRunLength = 8;
+    Settings.bCullHidden = false;
+    TestEqual(TEXT("unculled: every wall cell"), FDungeonGridBuilder::BuildWallSegments(Cells, Width, Height, Settings, Segments), 22);
+    TestEqual(TEXT("unculled + merged: segments"), Segments.Num(), 5);
+
+    Settings.bCullHidden = true;
+    Settings.bMergeRuns = false;
+    FDungeonGridBuilder::BuildWallSegments(Cells, Width, Height, Settings, Segments);
+    TestEqual(TEXT("unmerged: one segment per visible wall"), Segments.Num(), 16);
+
+    return true;
+}
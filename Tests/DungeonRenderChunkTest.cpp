@@ -0,0 +1,141 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Grid/DungeonFloorGenerator.h"
+#include "Grid/DungeonRenderComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+
+// CodeRevision: INC-2025-1227-R2 (Reuse chunks across same-sized re-renders) (2025-12-27 13:00)
+namespace DungeonRenderChunkTestPrivate
+{
+    static constexpr int32 GridSize = 64;
+    static constexpr int32 ChunkCells = 16;
+    static constexpr int32 ChunksPerSide = GridSize / ChunkCells;
+
+    static FDungeonRenderChunkStats GetChunk(const UDungeonRenderComponent* Render, int32 ChunkX, int32 ChunkY)
+    {
+        const TArray<FDungeonRenderChunkStats> Stats = Render->GetChunkStats();
+        const int32 Index = ChunkY * ChunksPerSide + ChunkX;
+        return Stats.IsValidIndex(Index) ? Stats[Index] : FDungeonRenderChunkStats();
+    }
+
+    static void MovePawnToCell(APawn* Pawn, int32 CellX, int32 CellY)
+    {
+        Pawn->SetActorLocation(FVector((CellX + 0.5f) * 100.0f, (CellY + 0.5f) * 100.0f, 0.0f));
+    }
+}
+
+//------------------------------------------------------------------------------
+// Chunks stream around the player, hide, release, and survive same-sized re-renders
+//------------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDungeonRenderChunkStreamingTest, "Rogue.Dungeon.Render.ChunkStreaming", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDungeonRenderChunkStreamingTest::RunTest(const FString& Parameters)
+{
+    using namespace DungeonRenderChunkTestPrivate;
+
+    UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+    if (!World)
+    {
+        AddError(TEXT("Failed to create world"));
+        return false;
+    }
+
+    UStaticMesh* Cube = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+    if (!Cube)
+    {
+        AddError(TEXT("Failed to load cube mesh"));
+        World->DestroyWorld(false);
+        return false;
+    }
+
+    // 64x64 floor ringed by walls -> 4x4 chunks of 16 cells
+    ADungeonFloorGenerator* Floor = World->SpawnActor<ADungeonFloorGenerator>();
+    Floor->GridWidth = GridSize;
+    Floor->GridHeight = GridSize;
+    Floor->CellSize = 100;
+    Floor->GridCells.Init(static_cast<int32>(ECellType::Floor), GridSize * GridSize);
+    for (int32 i = 0; i < GridSize; ++i)
+    {
+        Floor->GridCells[i] = static_cast<int32>(ECellType::Wall);
+        Floor->GridCells[(GridSize - 1) * GridSize + i] = static_cast<int32>(ECellType::Wall);
+        Floor->GridCells[i * GridSize] = static_cast<int32>(ECellType::Wall);
+        Floor->GridCells[i * GridSize + GridSize - 1] = static_cast<int32>(ECellType::Wall);
+    }
+
+    AActor* Owner = World->SpawnActor<AActor>();
+    UDungeonRenderComponent* Render = NewObject<UDungeonRenderComponent>(Owner);
+    Owner->SetRootComponent(Render);
+    Render->MeshSet.FloorMesh = Cube;
+    Render->MeshSet.WallMesh = Cube;
+    Render->bUseChunkedRendering = true;
+    Render->ChunkedRenderMinCells = 0;
+    Render->ChunkSize = ChunkCells;
+    Render->ChunkVisibleRadius = 0;
+    Render->ChunkReleaseRadius = 1;
+    Render->MaxChunkBuildsPerTick = ChunksPerSide * ChunksPerSide;
+    Render->RegisterComponent();
+
+    // Streaming centre is the first player's pawn
+    APlayerController* Controller = World->SpawnActor<APlayerController>();
+    APawn* Pawn = World->SpawnActor<APawn>();
+    Controller->SetPawn(Pawn);
+    MovePawnToCell(Pawn, 8, 8);
+
+    Render->RenderDungeonFromFloor(Floor);
+    TestTrue(TEXT("large floor renders chunked"), Render->IsChunkedRendering());
+    TestEqual(TEXT("one full build"), Render->GetRenderStats().FullBuildCount, 1);
+    TestTrue(TEXT("player chunk built and shown"), GetChunk(Render, 0, 0).bBuilt && GetChunk(Render, 0, 0).bVisible);
+    TestFalse(TEXT("neighbour outside the visible radius not built"), GetChunk(Render, 1, 1).bBuilt);
+    TestEqual(TEXT("only the player chunk built"), Render->GetRenderStats().ChunksBuilt, 1);
+
+    // One chunk over: the old chunk is hidden but kept
+    const float DeltaTime = 1.0f / 60.0f;
+    MovePawnToCell(Pawn, 24, 24);
+    Render->TickComponent(DeltaTime, LEVELTICK_All, nullptr);
+    TestTrue(TEXT("new player chunk built and shown"), GetChunk(Render, 1, 1).bBuilt && GetChunk(Render, 1, 1).bVisible);
+    TestTrue(TEXT("previous chunk kept"), GetChunk(Render, 0, 0).bBuilt);
+    TestFalse(TEXT("previous chunk hidden"), GetChunk(Render, 0, 0).bVisible);
+
+    // Far corner: both earlier chunks are past the release radius
+    MovePawnToCell(Pawn, 56, 56);
+    Render->TickComponent(DeltaTime, LEVELTICK_All, nullptr);
+    TestFalse(TEXT("far chunk released"), GetChunk(Render, 0, 0).bBuilt);
+    TestFalse(TEXT("second chunk released"), GetChunk(Render, 1, 1).bBuilt);
+    TestTrue(TEXT("corner chunk built"), GetChunk(Render, 3, 3).bBuilt);
+    TestEqual(TEXT("released chunks leave one built"), Render->GetRenderStats().ChunksBuilt, 1);
+
+    // Same floor again: nothing is released or rebuilt
+    const int32 CornerBuilds = GetChunk(Render, 3, 3).BuildCount;
+    Render->RenderDungeonFromFloor(Floor);
+    TestEqual(TEXT("unchanged re-render is not a full build"), Render->GetRenderStats().FullBuildCount, 1);
+    TestEqual(TEXT("unchanged re-render touches no cells"), Render->GetRenderStats().LastChangedCells, 0);
+    TestEqual(TEXT("unchanged chunk not rebuilt"), GetChunk(Render, 3, 3).BuildCount, CornerBuilds);
+
+    // One cell in the corner chunk and one in a released chunk: only the built one rebuilds now
+    Floor->GridCells[50 * GridSize + 50] = static_cast<int32>(ECellType::Wall);
+    Floor->GridCells[4 * GridSize + 4] = static_cast<int32>(ECellType::Wall);
+    Render->RenderDungeonFromFloor(Floor);
+    TestEqual(TEXT("patched re-render is not a full build"), Render->GetRenderStats().FullBuildCount, 1);
+    TestEqual(TEXT("both changed cells found"), Render->GetRenderStats().LastChangedCells, 2);
+    TestEqual(TEXT("dirty corner chunk rebuilt once"), GetChunk(Render, 3, 3).BuildCount, CornerBuilds + 1);
+    TestFalse(TEXT("released chunk stays released"), GetChunk(Render, 0, 0).bBuilt);
+
+    // The released chunk picks the edit up when the player comes back
+    MovePawnToCell(Pawn, 8, 8);
+    Render->TickComponent(DeltaTime, LEVELTICK_All, nullptr);
+    TestTrue(TEXT("returning chunk rebuilt"), GetChunk(Render, 0, 0).bBuilt && GetChunk(Render, 0, 0).bVisible);
+    TestFalse(TEXT("corner chunk released again"), GetChunk(Render, 3, 3).bBuilt);
+
+    // A different chunk size cannot reuse the chunks
+    Render->ChunkSize = ChunkCells * 2;
+    Render->RenderDungeonFromFloor(Floor);
+    TestEqual(TEXT("new chunk size is a full build"), Render->GetRenderStats().FullBuildCount, 2);
+    TestEqual(TEXT("2x2 chunks"), Render->GetRenderStats().ChunksTotal, 4);
+
+    World->DestroyWorld(false);
+    return true;
+}
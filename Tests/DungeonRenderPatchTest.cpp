@@ -0,0 +1,153 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Grid/DungeonFloorGenerator.h"
+#include "Grid/DungeonRenderComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+
+// CodeRevision: INC-2025-1225-R2 (Cell/instance map check for incremental patches) (2025-12-27 21:00)
+namespace DungeonRenderPatchTestPrivate
+{
+    static constexpr int32 GridSize = 16;
+
+    static int32 CountCells(const ADungeonFloorGenerator* Floor, ECellType Type)
+    {
+        int32 Count = 0;
+        for (const int32 Cell : Floor->GridCells)
+        {
+            Count += (Cell == static_cast<int32>(Type)) ? 1 : 0;
+        }
+        return Count;
+    }
+
+    static FVector CellCenter(const ADungeonFloorGenerator* Floor, int32 X, int32 Y)
+    {
+        return FVector((X + 0.5f) * Floor->CellSize, (Y + 0.5f) * Floor->CellSize, 0.0f);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Incremental patches keep the cell <-> instance maps in step with the ISMs
+//------------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDungeonRenderPatchMapsTest, "Rogue.Dungeon.Render.PatchInstanceMaps", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDungeonRenderPatchMapsTest::RunTest(const FString& Parameters)
+{
+    using namespace DungeonRenderPatchTestPrivate;
+
+    UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+    if (!World)
+    {
+        AddError(TEXT("Failed to create world"));
+        return false;
+    }
+
+    UStaticMesh* Cube = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+    IConsoleVariable* IncrementalCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("ts.Dungeon.IncrementalRender"));
+    if (!Cube || !IncrementalCVar)
+    {
+        AddError(TEXT("Failed to load cube mesh or find ts.Dungeon.IncrementalRender"));
+        World->DestroyWorld(false);
+        return false;
+    }
+    const int32 OriginalIncremental = IncrementalCVar->GetInt();
+    IncrementalCVar->Set(1, ECVF_SetByCode);
+
+    // 16x16 floor ringed by walls with a room in the middle
+    ADungeonFloorGenerator* Floor = World->SpawnActor<ADungeonFloorGenerator>();
+    Floor->GridWidth = GridSize;
+    Floor->GridHeight = GridSize;
+    Floor->CellSize = 100;
+    Floor->GridCells.Init(static_cast<int32>(ECellType::Floor), GridSize * GridSize);
+    for (int32 i = 0; i < GridSize; ++i)
+    {
+        Floor->SetCellXY(i, 0, ECellType::Wall);
+        Floor->SetCellXY(i, GridSize - 1, ECellType::Wall);
+        Floor->SetCellXY(0, i, ECellType::Wall);
+        Floor->SetCellXY(GridSize - 1, i, ECellType::Wall);
+    }
+    Floor->FillRect(5, 5, 6, 6, ECellType::Room);
+
+    AActor* Owner = World->SpawnActor<AActor>();
+    UDungeonRenderComponent* Render = NewObject<UDungeonRenderComponent>(Owner);
+    Owner->SetRootComponent(Render);
+    Render->MeshSet.WallMesh = Cube;
+    Render->MeshSet.FloorMesh = Cube;
+    Render->MeshSet.CorridorMesh = Cube;
+    Render->MeshSet.RoomMesh = Cube;
+    Render->MeshSet.DoorMesh = Cube;
+    Render->MeshSet.StairMesh = Cube;
+    Render->bUseChunkedRendering = false;
+    Render->RegisterComponent();
+
+    Render->RenderDungeonFromFloor(Floor);
+    TestFalse(TEXT("small floor renders per category"), Render->IsChunkedRendering());
+
+    // Reports the first mismatch under What
+    FString Error;
+    const auto CheckMaps = [this, Render, &Error](const TCHAR* What)
+    {
+        const bool bConsistent = Render->ValidateInstanceMaps(Error);
+        if (!bConsistent)
+        {
+            AddError(FString::Printf(TEXT("%s: %s"), What, *Error));
+        }
+        return bConsistent;
+    };
+
+    CheckMaps(TEXT("full build"));
+    TestEqual(TEXT("floor instances"), Render->GetRenderStats().FloorInstances, CountCells(Floor, ECellType::Floor));
+
+    // First floor instance walled off: the last one is swapped into its slot
+    Floor->GridChangeVector(CellCenter(Floor, 1, 1), static_cast<int32>(ECellType::Wall));
+    CheckMaps(TEXT("remove-at-swap"));
+    TestEqual(TEXT("one floor instance fewer"), Render->GetRenderStats().FloorInstances, CountCells(Floor, ECellType::Floor));
+
+    // Now-last floor instance (the swapped one came from the far corner) changes category: no swap
+    Floor->GridChangeVector(CellCenter(Floor, GridSize - 3, GridSize - 2), static_cast<int32>(ECellType::Door));
+    CheckMaps(TEXT("last instance removal"));
+    TestEqual(TEXT("door instance added"), Render->GetRenderStats().DoorInstances, 1);
+
+    // Wall opened back up: appended at the end
+    Floor->GridChangeVector(CellCenter(Floor, 1, 1), static_cast<int32>(ECellType::Floor));
+    CheckMaps(TEXT("re-added cell"));
+
+    // A batch of mixed edits patched together, several removals renumbering the same ISM
+    const TArray<FIntPoint> Batch = { FIntPoint(2, 1), FIntPoint(3, 1), FIntPoint(5, 5), FIntPoint(10, 10), FIntPoint(7, 7), FIntPoint(14, 1), FIntPoint(0, 5) };
+    const ECellType BatchTypes[] = { ECellType::Corridor, ECellType::Wall, ECellType::Floor, ECellType::StairDown, ECellType::Corridor, ECellType::Room, ECellType::Floor };
+    for (int32 i = 0; i < Batch.Num(); ++i)
+    {
+        Floor->GridCells[Batch[i].Y * GridSize + Batch[i].X] = static_cast<int32>(BatchTypes[i]);
+    }
+    Render->RefreshCells(Batch);
+    CheckMaps(TEXT("batched patch"));
+
+    // Random edits: every patch leaves the maps consistent and the counts match the grid
+    FRandomStream Rng(1225);
+    bool bAllConsistent = true;
+    for (int32 Edit = 0; Edit < 300 && bAllConsistent; ++Edit)
+    {
+        const int32 X = Rng.RandRange(0, GridSize - 1);
+        const int32 Y = Rng.RandRange(0, GridSize - 1);
+        const int32 Type = Rng.RandRange(0, static_cast<int32>(ECellType::StairDown));
+        Floor->GridChangeVector(CellCenter(Floor, X, Y), Type);
+        bAllConsistent = CheckMaps(*FString::Printf(TEXT("edit %d at (%d,%d) -> %d"), Edit, X, Y, Type));
+    }
+    TestTrue(TEXT("random edits keep the maps consistent"), bAllConsistent);
+
+    const FDungeonRenderStats& Stats = Render->GetRenderStats();
+    TestEqual(TEXT("floor count matches the grid"), Stats.FloorInstances, CountCells(Floor, ECellType::Floor));
+    TestEqual(TEXT("corridor count matches the grid"), Stats.CorridorInstances, CountCells(Floor, ECellType::Corridor));
+    TestEqual(TEXT("room count matches the grid"), Stats.RoomInstances, CountCells(Floor, ECellType::Room));
+    TestEqual(TEXT("door count matches the grid"), Stats.DoorInstances, CountCells(Floor, ECellType::Door));
+    TestEqual(TEXT("stair count matches the grid"), Stats.StairInstances,
+        CountCells(Floor, ECellType::StairUp) + CountCells(Floor, ECellType::StairDown));
+    TestEqual(TEXT("edits never fell back to a full build"), Stats.FullBuildCount, 1);
+
+    IncrementalCVar->Set(OriginalIncremental, ECVF_SetByCode);
+    World->DestroyWorld(false);
+    return true;
+}
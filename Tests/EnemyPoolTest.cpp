@@ -0,0 +1,100 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Character/UnitManager.h"
+#include "Character/EnemyUnitBase.h"
+#include "Grid/AABB.h"
+#include "Grid/GridPathfindingSubsystem.h"
+#include "Grid/GridOccupancySubsystem.h"
+#include "Turn/StableActorRegistry.h"
+#include "Components/BoxComponent.h"
+#include "Engine/World.h"
+
+// CodeRevision: INC-2025-1220-R2 (Pooled enemies rejoin the floor like fresh spawns) (2025-12-26 13:00)
+
+//------------------------------------------------------------------------------
+// Enemies reused from the pool get the same floor setup as fresh spawns
+//------------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEnemyPoolReuseTest, "Rogue.Units.EnemyPool.Reuse", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEnemyPoolReuseTest::RunTest(const FString& Parameters)
+{
+    UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+    if (!World)
+    {
+        AddError(TEXT("Failed to create world"));
+        return false;
+    }
+
+    UGridPathfindingSubsystem* GridPathfinding = World->GetSubsystem<UGridPathfindingSubsystem>();
+    UGridOccupancySubsystem* Occupancy = World->GetSubsystem<UGridOccupancySubsystem>();
+    UStableActorRegistry* Registry = World->GetSubsystem<UStableActorRegistry>();
+    if (!GridPathfinding || !Occupancy || !Registry)
+    {
+        AddError(TEXT("Failed to get subsystems"));
+        World->DestroyWorld(false);
+        return false;
+    }
+
+    // 12x12 open floor with one unlabelled room covering cells (3,3)-(8,8)
+    const int32 Size = 12;
+    TArray<int32> GridCosts;
+    GridCosts.Init(0, Size * Size);
+    GridPathfinding->InitializeGrid(GridCosts, FVector(Size, Size, 0), 100);
+
+    const FVector RoomMin = GridPathfinding->GridToWorldCenter(FIntPoint(3, 3));
+    const FVector RoomMax = GridPathfinding->GridToWorldCenter(FIntPoint(8, 8));
+    AAABB* Room = World->SpawnActor<AAABB>();
+    Room->SetActorLocation((RoomMin + RoomMax) * 0.5f);
+    Room->Box->SetBoxExtent(FVector((RoomMax.X - RoomMin.X) * 0.5f + 50.0f, (RoomMax.Y - RoomMin.Y) * 0.5f + 50.0f, 50.0f));
+
+    AUnitManager* UnitManager = World->SpawnActor<AUnitManager>();
+    UnitManager->PathFinder = GridPathfinding;
+    UnitManager->EnemyUnitClass = AEnemyUnitBase::StaticClass();
+    UnitManager->bUseEnemyPool = true;
+
+    const TArray<AAABB*> Rooms = { Room };
+    const int32 NumEnemies = 3;
+
+    // Floor 1: fresh spawns
+    UnitManager->BuildUnits(Rooms);
+    TestEqual(TEXT("floor 1 spawned"), UnitManager->SpawnEnemyUnits(NumEnemies), NumEnemies);
+
+    TArray<AEnemyUnitBase*> FirstFloor;
+    for (AUnitBase* Unit : UnitManager->AllUnits)
+    {
+        if (AEnemyUnitBase* Enemy = Cast<AEnemyUnitBase>(Unit))
+        {
+            FirstFloor.Add(Enemy);
+        }
+    }
+    TestEqual(TEXT("floor 1 enemies in AllUnits"), FirstFloor.Num(), NumEnemies);
+
+    // Floor 2: BuildUnits parks every enemy in the pool, then the spawn reuses them
+    UnitManager->BuildUnits(Rooms);
+    TestEqual(TEXT("enemies parked in the pool"), UnitManager->GetPooledEnemyCount(), NumEnemies);
+    for (AEnemyUnitBase* Enemy : FirstFloor)
+    {
+        TestFalse(TEXT("pooled enemy left the registry"), Registry->GetStableID(Enemy).IsValid());
+    }
+
+    TestEqual(TEXT("floor 2 spawned"), UnitManager->SpawnEnemyUnits(NumEnemies), NumEnemies);
+    TestEqual(TEXT("pool drained"), UnitManager->GetPooledEnemyCount(), 0);
+    TestEqual(TEXT("floor 2 enemies in AllUnits"), UnitManager->AllUnits.Num(), NumEnemies);
+
+    for (AEnemyUnitBase* Enemy : FirstFloor)
+    {
+        const FString Name = Enemy->GetName();
+        TestTrue(FString::Printf(TEXT("%s reused"), *Name), UnitManager->AllUnits.Contains(Enemy));
+        TestFalse(FString::Printf(TEXT("%s active"), *Name), Enemy->IsInPool());
+        TestEqual(FString::Printf(TEXT("%s team"), *Name), Enemy->Team, 2);
+        TestEqual(FString::Printf(TEXT("%s stat block team"), *Name), Enemy->StatBlock.Team, 2);
+        TestTrue(FString::Printf(TEXT("%s re-registered"), *Name), Registry->GetStableID(Enemy).IsValid());
+
+        const FIntPoint Cell = GridPathfinding->WorldToGrid(Enemy->GetActorLocation());
+        TestTrue(FString::Printf(TEXT("%s occupies its cell"), *Name), Occupancy->GetActorAtCell(Cell) == Enemy);
+    }
+
+    World->DestroyWorld(false);
+    return true;
+}
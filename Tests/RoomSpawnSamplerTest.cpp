@@ -0,0 +1,109 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Grid/DungeonGridBuilder.h"
+#include "Grid/RoomSpawnSampler.h"
+
+// CodeRevision: INC-2025-1234-R1 (Per-room free-cell spawn sampler) (2025-12-25 10:00)
+namespace RoomSpawnSamplerTestPrivate
+{
+    static constexpr int32 Width = 12;
+    static constexpr int32 Height = 8;
+
+    /** Two rooms joined by a corridor: A = (1,1)-(4,4), B = (7,1)-(10,5). */
+    static FDungeonGridLabels MakeLabels()
+    {
+        TArray<int32> Cells;
+        Cells.Init(static_cast<int32>(ECellType::Wall), Width * Height);
+        auto Fill = [&Cells](int32 X0, int32 Y0, int32 X1, int32 Y1, ECellType Type)
+        {
+            for (int32 Y = Y0; Y <= Y1; ++Y)
+            {
+                for (int32 X = X0; X <= X1; ++X)
+                {
+                    Cells[Y * Width + X] = static_cast<int32>(Type);
+                }
+            }
+        };
+        Fill(1, 1, 4, 4, ECellType::Room);
+        Fill(7, 1, 10, 5, ECellType::Room);
+        Fill(5, 2, 6, 2, ECellType::Corridor);
+
+        FDungeonGridLabels Labels;
+        FDungeonGridBuilder::LabelGrid(Cells, Width, Height, Labels);
+        return Labels;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Per-room cell lists, draws without replacement, filter and Poisson-disk spacing
+//------------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRoomSpawnSamplerTest, "Rogue.Dungeon.SpawnSampler.Rooms", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRoomSpawnSamplerTest::RunTest(const FString& Parameters)
+{
+    using namespace RoomSpawnSamplerTestPrivate;
+
+    FRoomSpawnSampler Sampler;
+    Sampler.Build(MakeLabels());
+    TestEqual(TEXT("rooms"), Sampler.NumRooms(), 2);
+
+    const int32 RoomA = Sampler.FindRoom(FIntRectLite(1, 1, 4, 4));
+    const int32 RoomB = Sampler.FindRoom(FIntRectLite(7, 1, 10, 5));
+    TestTrue(TEXT("rooms found by marker rect"), RoomA != INDEX_NONE && RoomB != INDEX_NONE && RoomA != RoomB);
+    TestEqual(TEXT("room containing the center"), Sampler.FindRoom(FIntRectLite(2, 2, 3, 3)), RoomA);
+    TestEqual(TEXT("no room"), Sampler.FindRoom(FIntRectLite(5, 6, 6, 7)), INDEX_NONE);
+    if (RoomA == INDEX_NONE || RoomB == INDEX_NONE)
+    {
+        return false;
+    }
+
+    TestEqual(TEXT("room A cells"), Sampler.GetRoomCells(RoomA).Num(), 16);
+    TestEqual(TEXT("room B cells"), Sampler.GetRoomCells(RoomB).Num(), 20);
+
+    FRandomStream Rng(1234);
+    auto AnyCell = [](const FIntPoint&) { return true; };
+
+    // Asking for more than the room holds returns every cell once
+    TArray<FIntPoint> Drawn;
+    TestEqual(TEXT("short result when the room is full"), Sampler.Sample(RoomA, 20, 0.0f, Rng, AnyCell, Drawn), 16);
+    TSet<FIntPoint> Unique(Drawn);
+    TestEqual(TEXT("no cell drawn twice"), Unique.Num(), 16);
+    bool bInside = true;
+    for (const FIntPoint& Cell : Drawn)
+    {
+        bInside &= FIntRectLite(1, 1, 4, 4).Contains(Cell.X, Cell.Y);
+    }
+    TestTrue(TEXT("cells stay in their room"), bInside);
+
+    // Filtered cells are skipped, not retried
+    Drawn.Reset();
+    int32 Calls = 0;
+    auto NotFirstColumn = [&Calls](const FIntPoint& Cell) { ++Calls; return Cell.X != 7; };
+    TestEqual(TEXT("filtered draw"), Sampler.Sample(RoomB, 15, 0.0f, Rng, NotFirstColumn, Drawn), 15);
+    TestTrue(TEXT("filter honoured"), !Drawn.ContainsByPredicate([](const FIntPoint& Cell) { return Cell.X == 7; }));
+    TestTrue(TEXT("each cell examined at most once"), Calls <= 20);
+
+    // Poisson-disk spacing
+    Drawn.Reset();
+    const float Spacing = 2.5f;
+    const int32 Spaced = Sampler.Sample(RoomB, 20, Spacing, Rng, AnyCell, Drawn);
+    TestTrue(TEXT("spacing leaves fewer spawns"), Spaced > 1 && Spaced < 20);
+    bool bSpaced = true;
+    for (int32 I = 0; I < Drawn.Num(); ++I)
+    {
+        for (int32 J = I + 1; J < Drawn.Num(); ++J)
+        {
+            bSpaced &= FMath::Square(Drawn[I].X - Drawn[J].X) + FMath::Square(Drawn[I].Y - Drawn[J].Y) >= Spacing * Spacing;
+        }
+    }
+    TestTrue(TEXT("spawns at least MinSpacing apart"), bSpaced);
+
+    // Arbitrary pools (rooms without labels)
+    TArray<FIntPoint> Pool = { FIntPoint(0, 0), FIntPoint(1, 0), FIntPoint(0, 1), FIntPoint(1, 1) };
+    Drawn.Reset();
+    TestEqual(TEXT("pool draw"), FRoomSpawnSampler::SampleFrom(Pool, FIntRectLite(0, 0, 1, 1), 3, 0.0f, Rng, AnyCell, Drawn), 3);
+    TestEqual(TEXT("pool draw unique"), TSet<FIntPoint>(Drawn).Num(), 3);
+
+    return true;
+}
@@ -0,0 +1,247 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Turn/TurboSimulationSubsystem.h"
+#include "Grid/GridPathfindingSubsystem.h"
+#include "Grid/GridOccupancySubsystem.h"
+#include "AI/Enemy/EnemyThinkerBase.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+// CodeRevision: INC-2025-1213-R2 (Turbo simulation applies attack damage through the melee GAS path) (2025-12-26 11:00)
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "AbilitySystem/Attributes/LyraHealthSet.h"
+#include "GameplayEffect.h"
+
+// Run headless with: -nullrhi -ExecCmds="ts.Turbo.Turns 100000; Automation RunTests Rogue.Simulation.Turbo; Quit"
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTurboSimulationTest, "Rogue.Simulation.Turbo", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FTurboSimulationTest::RunTest(const FString& Parameters)
+{
+    // Create a temporary world
+    UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+    if (!World)
+    {
+        AddError(TEXT("Failed to create world"));
+        return false;
+    }
+
+    UGridPathfindingSubsystem* GridPathfinding = World->GetSubsystem<UGridPathfindingSubsystem>();
+    UGridOccupancySubsystem* Occupancy = World->GetSubsystem<UGridOccupancySubsystem>();
+    UTurboSimulationSubsystem* Turbo = World->GetSubsystem<UTurboSimulationSubsystem>();
+
+    if (!GridPathfinding || !Occupancy || !Turbo)
+    {
+        AddError(TEXT("Failed to get subsystems"));
+        World->DestroyWorld(false);
+        return false;
+    }
+
+    // 40x40 open room with a wall ring
+    const int32 Size = 40;
+    TArray<int32> GridCosts;
+    GridCosts.Init(0, Size * Size);
+    for (int32 i = 0; i < Size; ++i)
+    {
+        GridCosts[i] = -1;
+        GridCosts[(Size - 1) * Size + i] = -1;
+        GridCosts[i * Size] = -1;
+        GridCosts[i * Size + Size - 1] = -1;
+    }
+    GridPathfinding->InitializeGrid(GridCosts, FVector(Size, Size, 0), 100);
+
+    // Player in the middle, 12 enemies along the left side
+    AActor* Player = World->SpawnActor<AActor>();
+
+    TArray<AActor*> Enemies;
+    for (int32 i = 0; i < 12; ++i)
+    {
+        AActor* Enemy = World->SpawnActor<AActor>();
+        UEnemyThinkerBase* Thinker = NewObject<UEnemyThinkerBase>(Enemy);
+        Thinker->RegisterComponent();
+        Enemies.Add(Enemy);
+    }
+
+    auto PlaceUnits = [&]()
+    {
+        Occupancy->UnregisterActor(Player);
+        for (AActor* Enemy : Enemies)
+        {
+            Occupancy->UnregisterActor(Enemy);
+        }
+
+        Occupancy->UpdateActorCell(Player, FIntPoint(20, 20));
+        for (int32 i = 0; i < Enemies.Num(); ++i)
+        {
+            Occupancy->UpdateActorCell(Enemies[i], FIntPoint(3 + (i % 2), 5 + i * 2));
+        }
+    };
+
+    FTurboSimConfig Config;
+    Config.NumTurns = UTurboSimulationSubsystem::GetDefaultTurnCount();
+    Config.Seed = 1234;
+    Config.PlayerPolicy = ETurboPlayerPolicy::Random;
+
+    PlaceUnits();
+    const FTurboSimStats Stats = Turbo->RunTurbo(Player, Enemies, Config);
+
+    AddInfo(FString::Printf(TEXT("Turns=%d Wall=%.3fs TurnsPerSec=%.1f EnemyMoves=%d Attacks=%d Rejected=%d Hash=0x%08X"),
+        Stats.TurnsSimulated, Stats.WallSeconds, Stats.TurnsPerSecond,
+        Stats.EnemyMoves, Stats.EnemyAttacks, Stats.RejectedCommits, static_cast<uint32>(Stats.StateHash)));
+
+    TestEqual(TEXT("All requested turns simulated"), Stats.TurnsSimulated, Config.NumTurns);
+    TestTrue(TEXT("Enemies moved"), Stats.EnemyMoves > 0);
+    TestEqual(TEXT("No resolved move rejected at commit"), Stats.RejectedCommits, 0);
+
+    // Units never stack
+    TSet<FIntPoint> Cells;
+    Cells.Add(Occupancy->GetCellOfActor(Player));
+    for (AActor* Enemy : Enemies)
+    {
+        const FIntPoint Cell = Occupancy->GetCellOfActor(Enemy);
+        TestFalse(FString::Printf(TEXT("Unique cell (%d,%d)"), Cell.X, Cell.Y), Cells.Contains(Cell));
+        Cells.Add(Cell);
+    }
+
+    // Same seed from the same start => same final hash
+    PlaceUnits();
+    const FTurboSimStats Replay = Turbo->RunTurbo(Player, Enemies, Config);
+    TestEqual(TEXT("Turbo run is deterministic for a fixed seed"), Replay.StateHash, Stats.StateHash);
+
+    World->DestroyWorld(false);
+    return true;
+}
+
+// CodeRevision: INC-2025-1213-R2 (Turbo simulation applies attack damage through the melee GAS path) (2025-12-26 11:00)
+namespace TurboSimulationTestPrivate
+{
+    /** Unit with an ASC and ULyraHealthSet so attacks land through the GameplayEffect path. */
+    static AActor* SpawnCombatUnit(UWorld* World, float Health, bool bEnemy)
+    {
+        AActor* Unit = World->SpawnActor<AActor>();
+        UAbilitySystemComponent* ASC = NewObject<UAbilitySystemComponent>(Unit);
+        ASC->RegisterComponent();
+        ASC->InitAbilityActorInfo(Unit, Unit);
+        ASC->AddAttributeSetSubobject(NewObject<ULyraHealthSet>(Unit));
+        ASC->SetNumericAttributeBase(ULyraHealthSet::GetMaxHealthAttribute(), Health);
+        ASC->SetNumericAttributeBase(ULyraHealthSet::GetHealthAttribute(), Health);
+
+        if (bEnemy)
+        {
+            UEnemyThinkerBase* Thinker = NewObject<UEnemyThinkerBase>(Unit);
+            Thinker->RegisterComponent();
+        }
+        return Unit;
+    }
+
+    static float GetHealth(const AActor* Unit)
+    {
+        const UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Unit);
+        const ULyraHealthSet* HealthSet = ASC ? ASC->GetSet<ULyraHealthSet>() : nullptr;
+        return HealthSet ? HealthSet->GetHealth() : -1.0f;
+    }
+
+    /** Instant Health -Amount (stands in for the melee ability's damage effect). */
+    static UGameplayEffect* MakeDamageEffect(float Amount)
+    {
+        UGameplayEffect* Effect = NewObject<UGameplayEffect>(GetTransientPackage());
+        Effect->DurationPolicy = EGameplayEffectDurationType::Instant;
+
+        FGameplayModifierInfo Modifier;
+        Modifier.Attribute = ULyraHealthSet::GetHealthAttribute();
+        Modifier.ModifierOp = EGameplayModOp::Additive;
+        Modifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(-Amount));
+        Effect->Modifiers.Add(Modifier);
+        return Effect;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Attacks apply damage, dead enemies leave the grid, a dead player ends the run
+//------------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTurboSimulationCombatTest, "Rogue.Simulation.Turbo.Combat", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FTurboSimulationCombatTest::RunTest(const FString& Parameters)
+{
+    using namespace TurboSimulationTestPrivate;
+
+    UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+    if (!World)
+    {
+        AddError(TEXT("Failed to create world"));
+        return false;
+    }
+
+    UGridPathfindingSubsystem* GridPathfinding = World->GetSubsystem<UGridPathfindingSubsystem>();
+    UGridOccupancySubsystem* Occupancy = World->GetSubsystem<UGridOccupancySubsystem>();
+    UTurboSimulationSubsystem* Turbo = World->GetSubsystem<UTurboSimulationSubsystem>();
+    if (!GridPathfinding || !Occupancy || !Turbo)
+    {
+        AddError(TEXT("Failed to get subsystems"));
+        World->DestroyWorld(false);
+        return false;
+    }
+
+    // 12x12 open room with a wall ring
+    const int32 Size = 12;
+    TArray<int32> GridCosts;
+    GridCosts.Init(0, Size * Size);
+    for (int32 i = 0; i < Size; ++i)
+    {
+        GridCosts[i] = -1;
+        GridCosts[(Size - 1) * Size + i] = -1;
+        GridCosts[i * Size] = -1;
+        GridCosts[i * Size + Size - 1] = -1;
+    }
+    GridPathfinding->InitializeGrid(GridCosts, FVector(Size, Size, 0), 100);
+
+    FTurboSimConfig Config;
+    Config.NumTurns = 50;
+    Config.Seed = 99;
+    Config.PlayerPolicy = ETurboPlayerPolicy::Scripted;
+    Config.ScriptedDirections = { FIntPoint(1, 0) };
+    Config.DamageEffectOverride = MakeDamageEffect(40.0f);
+
+    // (1) The player bumps the enemy on its right until it dies; both enemies hit back
+    {
+        AActor* Player = SpawnCombatUnit(World, 1000.0f, false);
+        AActor* Target = SpawnCombatUnit(World, 100.0f, true);
+        AActor* Flanker = SpawnCombatUnit(World, 100.0f, true);
+        Occupancy->UpdateActorCell(Player, FIntPoint(5, 5));
+        Occupancy->UpdateActorCell(Target, FIntPoint(6, 5));
+        Occupancy->UpdateActorCell(Flanker, FIntPoint(5, 6));
+
+        const FTurboSimStats Stats = Turbo->RunTurbo(Player, { Target, Flanker }, Config);
+
+        TestTrue(TEXT("player attacked"), Stats.PlayerAttacks >= 3);
+        TestTrue(TEXT("enemies attacked"), Stats.EnemyAttacks > 0);
+        TestTrue(TEXT("bumped enemy killed"), Stats.EnemiesKilled >= 1);
+        TestTrue(TEXT("dead enemy at 0 health"), GetHealth(Target) <= 0.0f);
+        TestTrue(TEXT("dead enemy left the grid"), Occupancy->GetActorAtCell(FIntPoint(6, 5)) != Target);
+        TestTrue(TEXT("player took damage"), GetHealth(Player) < 1000.0f);
+        TestEqual(TEXT("player survived"), Stats.PlayerDeathTurn, -1);
+        TestEqual(TEXT("every adjacent attack applied damage"), Stats.AttacksWithoutDamage, 0);
+
+        Occupancy->UnregisterActor(Player);
+        Occupancy->UnregisterActor(Flanker);
+    }
+
+    // (2) A fragile player dies and the run stops on that turn
+    {
+        AActor* Player = SpawnCombatUnit(World, 50.0f, false);
+        AActor* EnemyA = SpawnCombatUnit(World, 1000.0f, true);
+        AActor* EnemyB = SpawnCombatUnit(World, 1000.0f, true);
+        Occupancy->UpdateActorCell(Player, FIntPoint(5, 5));
+        Occupancy->UpdateActorCell(EnemyA, FIntPoint(6, 5));
+        Occupancy->UpdateActorCell(EnemyB, FIntPoint(4, 5));
+
+        const FTurboSimStats Stats = Turbo->RunTurbo(Player, { EnemyA, EnemyB }, Config);
+
+        TestTrue(TEXT("player died"), Stats.PlayerDeathTurn >= 0);
+        TestEqual(TEXT("run stopped on the death turn"), Stats.TurnsSimulated, Stats.PlayerDeathTurn + 1);
+        TestTrue(TEXT("player at 0 health"), GetHealth(Player) <= 0.0f);
+    }
+
+    World->DestroyWorld(false);
+    return true;
+}
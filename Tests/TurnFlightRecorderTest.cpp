@@ -0,0 +1,115 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+#include "Turn/TurnFlightRecorderSubsystem.h"
+
+// CodeRevision: INC-2025-1231-R2 (Thread-safe automatic dumps; ring split out for tests) (2025-12-27 10:00)
+
+//------------------------------------------------------------------------------
+// Ring: wrap-around order, CSV columns, automatic dump cap and per-record cost
+//------------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTurnFlightRecordRingTest, "Rogue.Turn.FlightRecorder.Ring", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FTurnFlightRecordRingTest::RunTest(const FString& Parameters)
+{
+    FTurnFlightRecordRing Ring;
+    TestFalse(TEXT("uninitialized ring is disabled"), Ring.IsEnabled());
+
+    // 12 records into 8 slots: turns 5..12 survive, oldest overwritten first
+    Ring.Init(8);
+    for (int32 Turn = 1; Turn <= 12; ++Turn)
+    {
+        FTurnFlightRecord& Record = Ring.Append(ETurnFlightRecordKind::Intent, Turn, Turn * 0.5);
+        Record.Actor = FName(*FString::Printf(TEXT("Enemy%d"), Turn));
+        Record.CellX = static_cast<int16>(Turn);
+        Record.CellY = 2;
+        Record.TargetX = static_cast<int16>(Turn + 1);
+        Record.TargetY = 3;
+        Record.Detail = FName(TEXT("AI.Intent.Move"));
+        Record.Value = Turn * 10;
+    }
+
+    TestEqual(TEXT("ring holds capacity records"), Ring.Num(), 8);
+    TestEqual(TEXT("age 0 is the newest"), Ring.GetRecord(0).TurnId, 12);
+    TestEqual(TEXT("oldest surviving record"), Ring.GetRecord(7).TurnId, 5);
+
+    // A reused slot starts clean
+    FTurnFlightRecord& Marker = Ring.Append(ETurnFlightRecordKind::TurnEnd, 13, 7.0);
+    TestTrue(TEXT("reused slot cleared"), Marker.Actor.IsNone() && Marker.Detail.IsNone() && Marker.CellX == -1 && Marker.Value == 0);
+    TestEqual(TEXT("oldest after another wrap"), Ring.GetRecord(7).TurnId, 6);
+
+    TArray<FString> Lines;
+    Ring.ToCSV().ParseIntoArrayLines(Lines);
+    TestEqual(TEXT("header + one line per record"), Lines.Num(), 9);
+    if (Lines.Num() == 9)
+    {
+        TestEqual(TEXT("header"), Lines[0], FString(TEXT("TurnID,Timestamp,Kind,Actor,Cell,Target,Detail,Value")));
+
+        TArray<FString> Columns;
+        Lines[1].ParseIntoArray(Columns, TEXT(","), /*InCullEmpty*/false);
+        TestEqual(TEXT("column count"), Columns.Num(), 8);
+        if (Columns.Num() == 8)
+        {
+            TestEqual(TEXT("oldest row first: TurnID"), Columns[0], FString(TEXT("6")));
+            TestEqual(TEXT("Timestamp"), Columns[1], FString(TEXT("3.000000")));
+            TestEqual(TEXT("Kind"), Columns[2], FString(TEXT("Intent")));
+            TestEqual(TEXT("Actor"), Columns[3], FString(TEXT("Enemy6")));
+            TestEqual(TEXT("Cell"), Columns[4], FString(TEXT("6:2")));
+            TestEqual(TEXT("Target"), Columns[5], FString(TEXT("7:3")));
+            TestEqual(TEXT("Detail"), Columns[6], FString(TEXT("AI.Intent.Move")));
+            TestEqual(TEXT("Value"), Columns[7], FString(TEXT("60")));
+        }
+
+        TestEqual(TEXT("newest row last, empty actor/detail"), Lines[8], FString(TEXT("13,7.000000,TurnEnd,,-1:-1,-1:-1,,0")));
+    }
+
+    // Automatic dumps stop at the cap; raising the cap allows more
+    FTurnFlightDumpBudget Budget;
+    int32 Granted = 0;
+    for (int32 Attempt = 0; Attempt < 5; ++Attempt)
+    {
+        Granted += Budget.TryConsume(3) ? 1 : 0;
+    }
+    TestEqual(TEXT("cap of 3 grants 3 dumps"), Granted, 3);
+    TestEqual(TEXT("used count"), Budget.GetUsed(), 3);
+    TestFalse(TEXT("cap of 0 grants nothing more"), Budget.TryConsume(0));
+    TestTrue(TEXT("raised cap grants another"), Budget.TryConsume(4));
+
+    // Overhead: a busy turn records ~1000 entries (commands, intents, reservations, resolved actions,
+    // barrier events, phases). Their cost must stay under 1% of a 60 Hz frame.
+    const int32 RecordsPerTurn = 1000;
+    const int32 Turns = 64;
+    const double FrameBudgetSeconds = 1.0 / 60.0;
+    FTurnFlightRecordRing BigRing;
+    BigRing.Init(16384);
+    const FName Actor(TEXT("Enemy"));
+    const FName Detail(TEXT("AI.Intent.Move"));
+
+    double WorstTurnSeconds = 0.0;
+    double TotalSeconds = 0.0;
+    for (int32 Turn = 0; Turn < Turns; ++Turn)
+    {
+        const double Start = FPlatformTime::Seconds();
+        for (int32 Index = 0; Index < RecordsPerTurn; ++Index)
+        {
+            FTurnFlightRecord& Record = BigRing.Append(ETurnFlightRecordKind::Intent, Turn, FPlatformTime::Seconds());
+            Record.Actor = Actor;
+            Record.Detail = Detail;
+            Record.CellX = static_cast<int16>(Index & 63);
+            Record.CellY = static_cast<int16>(Index >> 6);
+            Record.Value = Index;
+        }
+        const double Elapsed = FPlatformTime::Seconds() - Start;
+        TotalSeconds += Elapsed;
+        WorstTurnSeconds = FMath::Max(WorstTurnSeconds, Elapsed);
+    }
+
+    const double AverageTurnSeconds = TotalSeconds / Turns;
+    AddInfo(FString::Printf(TEXT("%d records/turn: avg %.1f us (%.3f%% of frame), worst %.1f us"),
+        RecordsPerTurn, AverageTurnSeconds * 1e6, AverageTurnSeconds / FrameBudgetSeconds * 100.0, WorstTurnSeconds * 1e6));
+    TestTrue(TEXT("recording a turn costs under 1% of a 60 Hz frame"), AverageTurnSeconds < FrameBudgetSeconds * 0.01);
+    TestEqual(TEXT("big ring wrapped"), BigRing.Num(), 16384);
+
+    return true;
+}
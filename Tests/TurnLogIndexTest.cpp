@@ -0,0 +1,111 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Guid.h"
+#include "HAL/FileManager.h"
+#include "Debug/DebugLogSink.h"
+#include "Debug/TurnLogIndex.h"
+
+// CodeRevision: INC-2025-1232-R1 (On-disk index of binary turn logs: by turn, actor, category and phase) (2025-12-24 10:00)
+
+//------------------------------------------------------------------------------
+// Sink session -> index -> save / load -> filtered queries decode only the matching records
+//------------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTurnLogIndexQueryTest, "Rogue.Debug.LogIndex.Query", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FTurnLogIndexQueryTest::RunTest(const FString& Parameters)
+{
+    const FString Session = FString::Printf(TEXT("Test-%s"), *FGuid::NewGuid().ToString(EGuidFormats::Digits));
+    const FName Phase(TEXT("Phase.Test.Think"));
+    const int32 NumTurns = 10;
+
+    // Per turn: a phase bracket around a diag event and an intent, then an unbracketed log line
+    FDebugLogSink Sink;
+    Sink.BeginSession(Session);
+    for (int32 Turn = 1; Turn <= NumTurns; ++Turn)
+    {
+        Sink.SetTurnId(Turn);
+        Sink.Push(EDebugLogRecordKind::PhaseStart, Phase, ELogVerbosity::Log, TEXT("Actors=2"), /*bBlocking*/true);
+        Sink.Push(EDebugLogRecordKind::Log, FName(TEXT("LogTurnCore")), ELogVerbosity::Log,
+            *FString::Printf(TEXT("[Event] event=Reserve turn=%d actor=BP_Enemy_0 cell=(1,2)"), Turn), true);
+        Sink.Push(EDebugLogRecordKind::Intent, FName(TEXT("AI.Intent.Move")), ELogVerbosity::Log, TEXT("Enemy=BP_Enemy_1 Cell=X=3 Y=4"), true);
+        Sink.Push(EDebugLogRecordKind::PhaseEnd, Phase, ELogVerbosity::Log, TEXT("1.000"), true);
+        Sink.Push(EDebugLogRecordKind::Log, FName(TEXT("LogGridOccupancy")), ELogVerbosity::Warning, TEXT("Actor=BP_Enemy_0, reactor=Bogus"), true);
+    }
+    Sink.EndSession();
+    TestTrue(TEXT("flushed"), Sink.Flush());
+
+    const TArray<FString> Files = FDebugLogSink::FindSessionFiles(Session);
+    TestEqual(TEXT("one file"), Files.Num(), 1);
+    if (Files.Num() != 1)
+    {
+        return false;
+    }
+
+    // Scoped so the mapping is released before the files are deleted
+    const FString IndexPath = FTurnLogIndex::GetIndexPath(Files[0]);
+    {
+        FMappedTurnLog Log;
+        TestTrue(TEXT("log opened"), Log.Open(Files[0]));
+
+        FTurnLogIndex Built;
+        TestTrue(TEXT("index built"), Built.Build(Log.GetBytes()));
+        TestEqual(TEXT("records (+ session start / end)"), Built.GetNumRecords(), NumTurns * 5 + 2);
+        TestEqual(TEXT("actors"), Built.GetActors().Num(), 2);
+        TestFalse(TEXT("partial keys ignored"), Built.GetActors().Contains(TEXT("Bogus")));
+
+        TestTrue(TEXT("index saved"), Built.Save(IndexPath));
+
+        FTurnLogIndex Index;
+        TestTrue(TEXT("index loaded"), Index.Load(IndexPath));
+        TestEqual(TEXT("source size"), Index.GetSourceBytes(), Log.GetBytes().Num());
+
+        FTurnLogQuery Query;
+        Query.MinTurn = 4;
+        Query.MaxTurn = 6;
+        Query.Actor = TEXT("BP_Enemy_0");
+        const TArray<int64> EnemyTurns = Index.Query(Query);
+        TestEqual(TEXT("actor in turns 4-6"), EnemyTurns.Num(), 6);
+        TestTrue(TEXT("loaded == built"), EnemyTurns == Built.Query(Query));
+
+        FDebugLogReader Reader(Log.GetBytes());
+        FDebugLogRecord Record;
+        bool bAllMatch = EnemyTurns.Num() > 0;
+        for (const int64 Offset : EnemyTurns)
+        {
+            Reader.Seek(Offset);
+            bAllMatch &= Reader.Next(Record) && Record.TurnId >= 4 && Record.TurnId <= 6 && Record.GetMessage().Contains(TEXT("BP_Enemy_0"));
+        }
+        TestTrue(TEXT("seeked records match"), bAllMatch);
+        if (EnemyTurns.Num() > 0)
+        {
+            Reader.Seek(EnemyTurns[0]);
+            Reader.Next(Record);
+            TestEqual(TEXT("category after seek"), Index.GetCategoryName(Record.CategoryId), FString(TEXT("LogTurnCore")));
+        }
+
+        Query.Actor = TEXT("BP_Enemy_*");
+        TestEqual(TEXT("actor wildcard"), Index.Query(Query).Num(), 9);
+
+        FTurnLogQuery ByCategory;
+        ByCategory.Category = TEXT("TurnCore");
+        TestEqual(TEXT("category without Log prefix"), Index.Query(ByCategory).Num(), NumTurns);
+        ByCategory.Category = TEXT("LogTurnCore");
+        TestEqual(TEXT("category with Log prefix"), Index.Query(ByCategory).Num(), NumTurns);
+
+        FTurnLogQuery ByPhase;
+        ByPhase.Phase = Phase.ToString();
+        TestEqual(TEXT("records inside the phase bracket"), Index.Query(ByPhase).Num(), NumTurns * 4);
+
+        ByPhase.Limit = 3;
+        TestEqual(TEXT("limit"), Index.Query(ByPhase).Num(), 3);
+    }
+
+    for (const FString& Path : Files)
+    {
+        IFileManager::Get().Delete(*Path);
+    }
+    IFileManager::Get().Delete(*IndexPath);
+
+    return true;
+}
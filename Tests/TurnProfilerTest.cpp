@@ -0,0 +1,147 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Turn/TurnProfilerSubsystem.h"
+#include "Engine/World.h"
+
+// CodeRevision: INC-2025-1230-R1 (Turn pipeline CPU profiling: trace scopes, STAT counters, rolling percentiles, Chrome trace export) (2025-12-23 10:00)
+
+//------------------------------------------------------------------------------
+// Rolling window: nearest-rank percentiles over the last N turns, valid Chrome trace
+//------------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTurnProfileWindowTest, "Rogue.Turn.Profiler.Window", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FTurnProfileWindowTest::RunTest(const FString& Parameters)
+{
+    FTurnProfileWindow Window(20);
+
+    // Turn N spends N ms resolving and makes N FindPath calls; even turns also wait on the barrier.
+    // Only the last 20 turns (11..30) stay in the window.
+    double Now = 100.0;
+    for (int32 Turn = 1; Turn <= 30; ++Turn)
+    {
+        Window.AddTime(ETurnProfilePhase::Resolve, Now, Turn / 1000.0);
+        for (int32 Call = 0; Call < Turn; ++Call)
+        {
+            Window.AddTime(ETurnProfilePhase::FindPath, Now, 0.0001);
+        }
+        if (Turn % 2 == 0)
+        {
+            Window.AddTime(ETurnProfilePhase::BarrierWait, Now + 0.01, 0.005);
+        }
+        Now += 0.1;
+        Window.CommitTurn(Turn, Now);
+    }
+
+    TestEqual(TEXT("window keeps the last N turns"), Window.Num(), 20);
+    TestEqual(TEXT("newest turn"), Window.GetSample(0).TurnId, 30);
+    TestEqual(TEXT("oldest turn"), Window.GetSample(19).TurnId, 11);
+
+    const FTurnProfilePhaseStats Resolve = Window.ComputeStats(ETurnProfilePhase::Resolve);
+    TestEqual(TEXT("resolve turns"), Resolve.Turns, 20);
+    TestEqual(TEXT("resolve p50"), Resolve.P50Ms, 20.0, 1e-6);
+    TestEqual(TEXT("resolve p95"), Resolve.P95Ms, 29.0, 1e-6);
+    TestEqual(TEXT("resolve max"), Resolve.MaxMs, 30.0, 1e-6);
+
+    const FTurnProfilePhaseStats FindPath = Window.ComputeStats(ETurnProfilePhase::FindPath);
+    TestEqual(TEXT("findpath calls per turn"), FindPath.MeanCalls, 20.5, 1e-6);
+
+    const FTurnProfilePhaseStats Barrier = Window.ComputeStats(ETurnProfilePhase::BarrierWait);
+    TestEqual(TEXT("barrier only counts turns that waited"), Barrier.Turns, 10);
+
+    const FTurnProfilePhaseStats Think = Window.ComputeStats(ETurnProfilePhase::Think);
+    TestEqual(TEXT("untouched phase"), Think.Turns, 0);
+
+    TSharedPtr<FJsonObject> Trace;
+    TestTrue(TEXT("chrome trace parses"), FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Window.ToChromeTraceJson()), Trace) && Trace.IsValid());
+    if (Trace.IsValid())
+    {
+        const TArray<TSharedPtr<FJsonValue>>* Events = nullptr;
+        TestTrue(TEXT("traceEvents"), Trace->TryGetArrayField(TEXT("traceEvents"), Events));
+
+        int32 PhaseSlices = 0;
+        int32 FindPathCounters = 0;
+        bool bOnlyStampedTurns = true;
+        for (const TSharedPtr<FJsonValue>& Value : *Events)
+        {
+            const TSharedPtr<FJsonObject> Event = Value->AsObject();
+            FString Category;
+            FString Type;
+            Event->TryGetStringField(TEXT("cat"), Category);
+            Event->TryGetStringField(TEXT("ph"), Type);
+            if (Category == TEXT("phase"))
+            {
+                ++PhaseSlices;
+                bOnlyStampedTurns &= Event->GetObjectField(TEXT("args"))->GetIntegerField(TEXT("turn")) >= 1;
+            }
+            else if (Type == TEXT("C"))
+            {
+                ++FindPathCounters;
+            }
+        }
+
+        // Event ring holds 20 * EventsPerTurn scopes, so every non-FindPath scope of all 30 turns is kept
+        TestEqual(TEXT("resolve + barrier slices"), PhaseSlices, 30 + 15);
+        TestTrue(TEXT("slices carry their turn"), bOnlyStampedTurns);
+        TestEqual(TEXT("one FindPath counter per windowed turn"), FindPathCounters, 20);
+
+        const TSharedPtr<FJsonObject>* Phases = nullptr;
+        TestTrue(TEXT("stats in otherData"), Trace->GetObjectField(TEXT("otherData"))->TryGetObjectField(TEXT("phases"), Phases));
+        TestEqual(TEXT("exported p95"), (*Phases)->GetObjectField(TEXT("Resolve"))->GetNumberField(TEXT("p95_ms")), 29.0, 1e-3);
+    }
+
+    Window.Reset();
+    TestEqual(TEXT("reset"), Window.Num(), 0);
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Phase scopes opened while speculating are timed as Speculate, not as the turn's phases
+//------------------------------------------------------------------------------
+
+// CodeRevision: INC-2025-1230-R2 (One phase scope for profiler and replay; speculative planning timed separately) (2025-12-27 11:00)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTurnProfileSpeculationTest, "Rogue.Turn.Profiler.Speculation", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FTurnProfileSpeculationTest::RunTest(const FString& Parameters)
+{
+    UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+    if (!World)
+    {
+        AddError(TEXT("Failed to create world"));
+        return false;
+    }
+
+    UTurnProfilerSubsystem* Profiler = World->GetSubsystem<UTurnProfilerSubsystem>();
+    if (!Profiler || !Profiler->IsEnabled())
+    {
+        AddError(TEXT("Profiler missing or ts.Profile.Window is 0"));
+        World->DestroyWorld(false);
+        return false;
+    }
+    Profiler->ResetWindow();
+
+    {
+        TURN_PROFILE_SCOPE(World, Speculate);
+        for (int32 Plan = 0; Plan < 9; ++Plan)
+        {
+            TURN_PROFILE_SCOPE(World, Observe);
+            TURN_PROFILE_SCOPE(World, Think);
+        }
+    }
+    {
+        TURN_PROFILE_SCOPE(World, Think);
+    }
+    Profiler->NoteTurnCompleted(1, {});
+
+    const FTurnProfileSample& Sample = Profiler->GetWindow().GetSample(0);
+    TestEqual(TEXT("one speculation scope"), Sample.Calls[static_cast<int32>(ETurnProfilePhase::Speculate)], 1);
+    TestEqual(TEXT("only the real Think is counted"), Sample.Calls[static_cast<int32>(ETurnProfilePhase::Think)], 1);
+    TestEqual(TEXT("speculative Observe not counted"), Sample.Calls[static_cast<int32>(ETurnProfilePhase::Observe)], 0);
+
+    World->DestroyWorld(false);
+    return true;
+}
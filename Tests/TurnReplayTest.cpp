@@ -0,0 +1,190 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Tests/AutomationCommon.h"
+#include "Turn/TurnReplaySubsystem.h"
+#include "Utility/RogueGameplayTags.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+namespace TurnReplayTestPrivate
+{
+    static const TCHAR* ReplayExtension = TEXT(".turnreplay");
+    static constexpr double ReplayTimeoutSeconds = 1800.0;
+
+    static FString GetReplayDirectory()
+    {
+        return FPaths::ProjectSavedDir() / TEXT("TurnReplays");
+    }
+
+    static UWorld* FindGameWorld()
+    {
+        for (const FWorldContext& Context : GEngine->GetWorldContexts())
+        {
+            if ((Context.WorldType == EWorldType::Game || Context.WorldType == EWorldType::PIE) && Context.World())
+            {
+                return Context.World();
+            }
+        }
+        return nullptr;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Record format round trip
+//------------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTurnReplayFormatTest, "Rogue.Replay.RecordFormat", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FTurnReplayFormatTest::RunTest(const FString& Parameters)
+{
+    FTurnReplayRecord Record;
+    Record.MapName = TEXT("/Game/Maps/TestMap");
+    Record.FloorSeeds = { 1234, -99 };
+
+    FPlayerCommand Move;
+    Move.CommandTag = RogueGameplayTags::InputTag_Move;
+    Move.Direction = FVector(1.0, -1.0, 0.0);
+    Move.TurnId = 7;
+    Record.Commands.Add(Move);
+
+    FPlayerCommand Attack;
+    Attack.CommandTag = RogueGameplayTags::InputTag_Attack;
+    Attack.TargetCell = FIntPoint(12, 9);
+    Attack.TurnId = 8;
+    Record.Commands.Add(Attack);
+
+    FTurnReplayFrame Frame;
+    Frame.ResolveHash = 0x1234ABCD;
+    Frame.StateHash = -5;
+    Frame.PhaseMicros = { 1.f, 2.f, 3.f, 4.f, 5.f };
+    Record.Frames.Add(Frame);
+
+    const FString Path = FPaths::AutomationTransientDir() / TEXT("RecordFormat.turnreplay");
+    if (!TestTrue(TEXT("Record saved"), Record.SaveToFile(Path)))
+    {
+        return false;
+    }
+
+    FTurnReplayRecord Loaded;
+    if (!TestTrue(TEXT("Record loaded"), Loaded.LoadFromFile(Path)))
+    {
+        return false;
+    }
+    IFileManager::Get().Delete(*Path);
+
+    TestEqual(TEXT("Map"), Loaded.MapName, Record.MapName);
+    TestEqual(TEXT("Floor seeds"), Loaded.FloorSeeds, Record.FloorSeeds);
+    if (TestEqual(TEXT("Command count"), Loaded.Commands.Num(), Record.Commands.Num()))
+    {
+        for (int32 Index = 0; Index < Record.Commands.Num(); ++Index)
+        {
+            TestEqual(TEXT("Command tag"), Loaded.Commands[Index].CommandTag, Record.Commands[Index].CommandTag);
+            TestEqual(TEXT("Command cell"), Loaded.Commands[Index].TargetCell, Record.Commands[Index].TargetCell);
+            TestEqual(TEXT("Command direction"), Loaded.Commands[Index].Direction, Record.Commands[Index].Direction);
+            TestEqual(TEXT("Command turn"), Loaded.Commands[Index].TurnId, Record.Commands[Index].TurnId);
+        }
+    }
+    if (TestEqual(TEXT("Frame count"), Loaded.Frames.Num(), 1))
+    {
+        TestEqual(TEXT("Resolve hash"), Loaded.Frames[0].ResolveHash, Frame.ResolveHash);
+        TestEqual(TEXT("State hash"), Loaded.Frames[0].StateHash, Frame.StateHash);
+        TestEqual(TEXT("Phase timings"), Loaded.Frames[0].PhaseMicros, Frame.PhaseMicros);
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Recorded sessions (one test per Saved/TurnReplays/*.turnreplay)
+//------------------------------------------------------------------------------
+
+// Polls the replay world until the replayer reports completion, then reports digests and per-phase timings.
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(FWaitForTurnReplayCommand, FAutomationTestBase*, Test, double, StartSeconds);
+
+bool FWaitForTurnReplayCommand::Update()
+{
+    using namespace TurnReplayTestPrivate;
+
+    UWorld* World = FindGameWorld();
+    UTurnReplaySubsystem* Replay = World ? World->GetSubsystem<UTurnReplaySubsystem>() : nullptr;
+
+    if (!Replay || Replay->GetMode() != ETurnReplayMode::Replaying || !Replay->IsReplayFinished())
+    {
+        if (FPlatformTime::Seconds() - StartSeconds > ReplayTimeoutSeconds)
+        {
+            Test->AddError(TEXT("Replay did not finish before the timeout"));
+            return true;
+        }
+        return false;
+    }
+
+    const FTurnReplayResult& Result = Replay->GetReplayResult();
+    const int32 NumFrames = Replay->GetRecord().Frames.Num();
+
+    Test->AddInfo(FString::Printf(TEXT("Turns=%d/%d Commands=%d Rejected=%d Mismatches=%d"),
+        Result.TurnsVerified, NumFrames, Result.CommandsSubmitted, Result.CommandsRejected, Result.HashMismatches));
+
+    for (int32 PhaseIndex = 0; PhaseIndex < NumTurnCorePhases; ++PhaseIndex)
+    {
+        const double TotalMs = Result.PhaseTotalMs[PhaseIndex];
+        Test->AddInfo(FString::Printf(TEXT("Phase %-8s total=%9.3fms mean=%8.1fus max=%8.3fms"),
+            *UEnum::GetDisplayValueAsText(static_cast<ETurnProfilePhase>(PhaseIndex)).ToString(),
+            TotalMs,
+            Result.TurnsVerified > 0 ? TotalMs * 1000.0 / Result.TurnsVerified : 0.0,
+            Result.PhaseMaxMs[PhaseIndex]));
+    }
+
+    Test->TestEqual(TEXT("Every recorded turn replayed"), Result.TurnsVerified, NumFrames);
+    Test->TestEqual(TEXT("Recorded commands accepted on replay"), Result.CommandsRejected, 0);
+    if (Result.HashMismatches > 0)
+    {
+        Test->AddError(FString::Printf(TEXT("%d turn(s) diverged; first at turn %d"), Result.HashMismatches, Result.FirstMismatchTurn));
+    }
+    return true;
+}
+
+// Run headless with: -game -nullrhi -ExecCmds="Automation RunTests Rogue.Replay.Recorded; Quit"
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FTurnReplayRecordedTest, "Rogue.Replay.Recorded", EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+void FTurnReplayRecordedTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+    using namespace TurnReplayTestPrivate;
+
+    TArray<FString> Files;
+    IFileManager::Get().FindFiles(Files, *(GetReplayDirectory() / (FString(TEXT("*")) + ReplayExtension)), true, false);
+    Files.Sort();
+
+    for (const FString& File : Files)
+    {
+        OutBeautifiedNames.Add(FPaths::GetBaseFilename(File));
+        OutTestCommands.Add(GetReplayDirectory() / File);
+    }
+}
+
+bool FTurnReplayRecordedTest::RunTest(const FString& Parameters)
+{
+    FTurnReplayRecord Record;
+    if (!Record.LoadFromFile(Parameters))
+    {
+        AddError(FString::Printf(TEXT("Failed to load replay %s"), *Parameters));
+        return false;
+    }
+
+    AddInfo(FString::Printf(TEXT("Replaying %s on %s (Seeds=%d Commands=%d Turns=%d)"),
+        *FPaths::GetCleanFilename(Parameters), *Record.MapName,
+        Record.FloorSeeds.Num(), Record.Commands.Num(), Record.Frames.Num()));
+
+    // Picked up by the replay subsystem of the world AutomationOpenMap creates.
+    UTurnReplaySubsystem::QueueReplay(Record);
+    if (!AutomationOpenMap(Record.MapName))
+    {
+        AddError(FString::Printf(TEXT("Failed to open %s"), *Record.MapName));
+        return false;
+    }
+
+    ADD_LATENT_AUTOMATION_COMMAND(FWaitForTurnReplayCommand(this, FPlatformTime::Seconds()));
+    return true;
+}
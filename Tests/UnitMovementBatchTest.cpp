@@ -0,0 +1,242 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Character/UnitMovementComponent.h"
+#include "Character/UnitMovementManagerSubsystem.h"
+#include "Turn/PlayerTravelSubsystem.h"
+#include "Grid/GridPathfindingSubsystem.h"
+#include "Grid/GridOccupancySubsystem.h"
+#include "Components/SceneComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+
+// CodeRevision: INC-2025-1233-R2 (Seed every batched step from the actor's current transform) (2025-12-26 15:00)
+namespace UnitMovementBatchTestPrivate
+{
+    static UUnitMovementComponent* AddMover(AActor* Unit, const FVector& Location)
+    {
+        USceneComponent* Root = NewObject<USceneComponent>(Unit);
+        Unit->SetRootComponent(Root);
+        Root->RegisterComponent();
+        Unit->SetActorLocation(Location);
+
+        UUnitMovementComponent* Mover = NewObject<UUnitMovementComponent>(Unit);
+        Mover->RegisterComponent();
+        return Mover;
+    }
+
+    static UUnitMovementComponent* SpawnMover(UWorld* World, const FVector& Location)
+    {
+        return AddMover(World->SpawnActor<AActor>(), Location);
+    }
+
+    static IConsoleVariable* BatchedCVar()
+    {
+        return IConsoleManager::Get().FindConsoleVariable(TEXT("ts.Movement.Batched"));
+    }
+
+    static void SetBatched(bool bBatched)
+    {
+        if (IConsoleVariable* CVar = BatchedCVar())
+        {
+            CVar->Set(bBatched ? 1 : 0, ECVF_SetByCode);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Batched manager update matches the per-component tick frame for frame
+//------------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnitMovementBatchParityTest, "Rogue.Movement.Batched.Parity", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUnitMovementBatchParityTest::RunTest(const FString& Parameters)
+{
+    using namespace UnitMovementBatchTestPrivate;
+
+    UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+    if (!World)
+    {
+        AddError(TEXT("Failed to create world"));
+        return false;
+    }
+
+    UUnitMovementManagerSubsystem* Manager = World->GetSubsystem<UUnitMovementManagerSubsystem>();
+    if (!Manager || !BatchedCVar())
+    {
+        AddError(TEXT("Failed to get subsystems"));
+        World->DestroyWorld(false);
+        return false;
+    }
+
+    const int32 OriginalBatched = BatchedCVar()->GetInt();
+    const FVector Start(50.0f, 50.0f, 90.0f);
+    const TArray<FVector> Path = { FVector(350.0f, 50.0f, 90.0f), FVector(350.0f, 350.0f, 90.0f), FVector(650.0f, 450.0f, 90.0f) };
+
+    UUnitMovementComponent* Batched = SpawnMover(World, Start);
+    UUnitMovementComponent* PerComponent = SpawnMover(World, Start);
+    AActor* BatchedUnit = Batched->GetOwner();
+    AActor* PerComponentUnit = PerComponent->GetOwner();
+
+    SetBatched(true);
+    Batched->MoveUnit(Path);
+    SetBatched(false);
+    PerComponent->MoveUnit(Path);
+    SetBatched(true);
+    TestEqual(TEXT("only the batched mover is registered"), Manager->Num(), 1);
+
+    const float DeltaTime = 1.0f / 60.0f;
+    const int32 MaxFrames = 600;
+    bool bSamePose = true;
+    bool bSameState = true;
+    int32 Frame = 0;
+    for (; Frame < MaxFrames && (Batched->IsMoving() || PerComponent->IsMoving()); ++Frame)
+    {
+        // Writes from outside the movement code between frames (eviction snap, Z correction, stat speed)
+        if (Frame == 20)
+        {
+            const FVector Nudge(0.0f, 30.0f, -5.0f);
+            BatchedUnit->SetActorLocation(BatchedUnit->GetActorLocation() + Nudge);
+            PerComponentUnit->SetActorLocation(PerComponentUnit->GetActorLocation() + Nudge);
+        }
+        if (Frame == 40)
+        {
+            Batched->SetMoveSpeed(520.0f);
+            PerComponent->SetMoveSpeed(520.0f);
+        }
+
+        const FVector BeforeStep = BatchedUnit->GetActorLocation();
+        Manager->Tick(DeltaTime);
+        PerComponent->TickComponent(DeltaTime, LEVELTICK_All, nullptr);
+
+        if (Frame == 20)
+        {
+            TestTrue(TEXT("batched step starts from the externally moved location"),
+                FVector::Dist(BatchedUnit->GetActorLocation(), BeforeStep) <= Batched->GetMoveSpeed() * DeltaTime + KINDA_SMALL_NUMBER);
+        }
+
+        bSamePose &= BatchedUnit->GetActorLocation().Equals(PerComponentUnit->GetActorLocation(), 0.01f);
+        bSamePose &= BatchedUnit->GetActorRotation().Equals(PerComponentUnit->GetActorRotation(), 0.01f);
+        bSameState &= Batched->IsMoving() == PerComponent->IsMoving();
+        bSameState &= FMath::IsNearlyEqual(Batched->GetMoveSpeedAnim(), PerComponent->GetMoveSpeedAnim());
+    }
+
+    AddInfo(FString::Printf(TEXT("Frames=%d Batched=%s PerComponent=%s"), Frame,
+        *BatchedUnit->GetActorLocation().ToString(), *PerComponentUnit->GetActorLocation().ToString()));
+    TestTrue(TEXT("both movers finished"), !Batched->IsMoving() && !PerComponent->IsMoving());
+    TestTrue(TEXT("same location and rotation every frame"), bSamePose);
+    TestTrue(TEXT("same moving state and anim speed every frame"), bSameState);
+    TestEqual(TEXT("finished mover unregistered"), Manager->Num(), 0);
+
+    // Switching to per-component ticks while batched hands the mover back to the component
+    Batched->MoveUnit(Path);
+    TestEqual(TEXT("registered again"), Manager->Num(), 1);
+    SetBatched(false);
+    Batched->MoveUnit(Path);
+    TestEqual(TEXT("fallback move leaves the manager"), Manager->Num(), 0);
+    BatchedCVar()->Set(OriginalBatched, ECVF_SetByCode);
+
+    World->DestroyWorld(false);
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Travel playback speed-up moves only the traveling player, batched or not
+//------------------------------------------------------------------------------
+
+// CodeRevision: INC-2025-1218-R2 (Travel speed-up applies only to the traveling player) (2025-12-27 18:00)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnitMovementTravelSpeedTest, "Rogue.Movement.TravelSpeedScale", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUnitMovementTravelSpeedTest::RunTest(const FString& Parameters)
+{
+    using namespace UnitMovementBatchTestPrivate;
+
+    UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+    if (!World)
+    {
+        AddError(TEXT("Failed to create world"));
+        return false;
+    }
+
+    UUnitMovementManagerSubsystem* Manager = World->GetSubsystem<UUnitMovementManagerSubsystem>();
+    UPlayerTravelSubsystem* Travel = World->GetSubsystem<UPlayerTravelSubsystem>();
+    UGridPathfindingSubsystem* GridPathfinding = World->GetSubsystem<UGridPathfindingSubsystem>();
+    UGridOccupancySubsystem* Occupancy = World->GetSubsystem<UGridOccupancySubsystem>();
+    IConsoleVariable* ScaleCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("ts.Travel.MoveSpeedScale"));
+    if (!Manager || !Travel || !GridPathfinding || !Occupancy || !ScaleCVar || !BatchedCVar())
+    {
+        AddError(TEXT("Failed to get subsystems"));
+        World->DestroyWorld(false);
+        return false;
+    }
+
+    const int32 OriginalBatched = BatchedCVar()->GetInt();
+    const float OriginalScale = ScaleCVar->GetFloat();
+    ScaleCVar->Set(4.0f, ECVF_SetByCode);
+
+    // Open 12x12 floor; the player travels along row 2 with no enemy in view
+    const int32 Size = 12;
+    TArray<int32> GridCosts;
+    GridCosts.Init(0, Size * Size);
+    GridPathfinding->InitializeGrid(GridCosts, FVector(Size, Size, 0), 100);
+
+    APlayerController* Controller = World->SpawnActor<APlayerController>();
+    APawn* PlayerPawn = World->SpawnActor<APawn>();
+    Controller->SetPawn(PlayerPawn);
+    Occupancy->UpdateActorCell(PlayerPawn, FIntPoint(2, 2));
+
+    const FVector PlayerStart = GridPathfinding->GridToWorldCenter(FIntPoint(2, 2));
+    const FVector EnemyStart = GridPathfinding->GridToWorldCenter(FIntPoint(2, 8));
+    UUnitMovementComponent* PlayerMover = AddMover(PlayerPawn, PlayerStart);
+    UUnitMovementComponent* EnemyMover = SpawnMover(World, EnemyStart);
+    AActor* Enemy = EnemyMover->GetOwner();
+
+    TestEqual(TEXT("no speed-up before travel"), Travel->GetMoveSpeedScale(PlayerPawn), 1.0f);
+    TestTrue(TEXT("travel starts"), Travel->BeginTravel(FIntPoint(9, 2), FDashStopConfig()));
+    TestTrue(TEXT("traveling pawn is the player"), Travel->GetTravelingPawn() == PlayerPawn);
+    TestEqual(TEXT("player sped up"), Travel->GetMoveSpeedScale(PlayerPawn), 4.0f);
+    TestEqual(TEXT("other units keep their speed"), Travel->GetMoveSpeedScale(Enemy), 1.0f);
+
+    // One frame of both movers toward a far waypoint: the player covers four times the distance
+    const float DeltaTime = 1.0f / 60.0f;
+    const FVector Far(0.0f, 5000.0f, 0.0f);
+    for (const bool bBatched : { true, false })
+    {
+        SetBatched(bBatched);
+        PlayerPawn->SetActorLocation(PlayerStart);
+        Enemy->SetActorLocation(EnemyStart);
+        PlayerMover->MoveUnit({ PlayerStart + Far });
+        EnemyMover->MoveUnit({ EnemyStart + Far });
+
+        if (bBatched)
+        {
+            Manager->Tick(DeltaTime);
+        }
+        else
+        {
+            PlayerMover->TickComponent(DeltaTime, LEVELTICK_All, nullptr);
+            EnemyMover->TickComponent(DeltaTime, LEVELTICK_All, nullptr);
+        }
+
+        const FString Mode = bBatched ? TEXT("batched") : TEXT("per-component");
+        const double PlayerStep = FVector::Dist(PlayerPawn->GetActorLocation(), PlayerStart);
+        const double EnemyStep = FVector::Dist(Enemy->GetActorLocation(), EnemyStart);
+        TestTrue(FString::Printf(TEXT("%s: enemy moves at its own speed"), *Mode),
+            FMath::IsNearlyEqual(EnemyStep, static_cast<double>(EnemyMover->GetMoveSpeed() * DeltaTime), 0.01));
+        TestTrue(FString::Printf(TEXT("%s: player moves four times as far"), *Mode),
+            FMath::IsNearlyEqual(PlayerStep, EnemyStep * 4.0, 0.05));
+        TestTrue(FString::Printf(TEXT("%s: anim speed follows"), *Mode),
+            FMath::IsNearlyEqual(PlayerMover->GetMoveSpeedAnim(), EnemyMover->GetMoveSpeedAnim() * 4.0f, 0.01f));
+    }
+
+    // Travel over: back to normal pace
+    Travel->CancelTravel(TEXT("Test"));
+    TestEqual(TEXT("no speed-up after travel"), Travel->GetMoveSpeedScale(PlayerPawn), 1.0f);
+
+    BatchedCVar()->Set(OriginalBatched, ECVF_SetByCode);
+    ScaleCVar->Set(OriginalScale, ECVF_SetByCode);
+    World->DestroyWorld(false);
+    return true;
+}
@@ -7,9 +7,116 @@
 #include "AbilitySystemGlobals.h"
 #include "Utility/RogueGameplayTags.h"
 #include "Turn/TurnActionBarrierSubsystem.h"
+#include "Abilities/GameplayAbilityTargetTypes.h"
 
 DEFINE_LOG_CATEGORY(LogAttackPhase);
 
+// CodeRevision: INC-2025-1212-R1 (Dispatch non-interfering attacks concurrently in waves) (2025-12-14 17:00)
+static int32 GTS_Attack_ParallelWaves = 1;
+static FAutoConsoleVariableRef CVarTS_Attack_ParallelWaves(
+	TEXT("ts.Attack.ParallelWaves"),
+	GTS_Attack_ParallelWaves,
+	TEXT("Group non-interfering enemy attacks into concurrently dispatched waves.\n")
+	TEXT("0: Strict sequential (one attack at a time, original order)\n")
+	TEXT("1: Waves (attacks with disjoint attackers play together, including several on one target; default)"),
+	ECVF_Default
+);
+
+namespace AttackPhaseExecutorPrivate
+{
+	// CodeRevision: INC-2025-1212-R2 (Attacks that only share a target play in the same wave) (2025-12-27 17:00)
+	/**
+	 * What an attack touches. The attacker and its cell are owned (animated, moved, retargeted);
+	 * targets only receive hits, so several attacks may share one.
+	 */
+	struct FAttackFootprint
+	{
+		TArray<const AActor*, TInlineAllocator<2>> OwnedActors;
+		TArray<FIntPoint, TInlineAllocator<2>> OwnedCells;
+		TArray<const AActor*, TInlineAllocator<4>> TargetActors;
+		TArray<FIntPoint, TInlineAllocator<2>> TargetCells;
+
+		// Target unknown -> may touch anything, must run alone and in order
+		bool bExclusive = false;
+	};
+
+	static FAttackFootprint MakeFootprint(const FResolvedAction& Action)
+	{
+		FAttackFootprint Footprint;
+
+		if (const AActor* Attacker = Action.Actor.Get())
+		{
+			Footprint.OwnedActors.Add(Attacker);
+		}
+		if (Action.CurrentCell != FIntPoint(-1, -1))
+		{
+			Footprint.OwnedCells.Add(Action.CurrentCell);
+		}
+
+		bool bHasTarget = false;
+		for (int32 i = 0; i < Action.TargetData.Num(); ++i)
+		{
+			const FGameplayAbilityTargetData* Data = Action.TargetData.Get(i);
+			if (!Data)
+			{
+				continue;
+			}
+			for (const TWeakObjectPtr<AActor>& Target : Data->GetActors())
+			{
+				if (const AActor* TargetActor = Target.Get())
+				{
+					Footprint.TargetActors.AddUnique(TargetActor);
+					bHasTarget = true;
+				}
+			}
+			if (Data->HasHitResult())
+			{
+				if (const AActor* HitActor = Data->GetHitResult()->GetActor())
+				{
+					Footprint.TargetActors.AddUnique(HitActor);
+					bHasTarget = true;
+				}
+			}
+		}
+
+		if (Action.NextCell != FIntPoint(-1, -1) && Action.NextCell != Action.CurrentCell)
+		{
+			Footprint.TargetCells.AddUnique(Action.NextCell);
+			bHasTarget = true;
+		}
+
+		Footprint.bExclusive = !bHasTarget;
+		return Footprint;
+	}
+
+	template<typename ElementType, typename AllocA, typename AllocB>
+	static bool Overlaps(const TArray<ElementType, AllocA>& A, const TArray<ElementType, AllocB>& B)
+	{
+		for (const ElementType& Element : A)
+		{
+			if (B.Contains(Element))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	static bool Interferes(const FAttackFootprint& A, const FAttackFootprint& B)
+	{
+		if (A.bExclusive || B.bExclusive)
+		{
+			return true;
+		}
+
+		// Same attacker or cell, or one attack hits the other's attacker: keep the order.
+		// Two attacks on the same target do not depend on each other; both hits land either way.
+		return Overlaps(A.OwnedActors, B.OwnedActors) || Overlaps(A.OwnedCells, B.OwnedCells)
+			|| Overlaps(A.OwnedActors, B.TargetActors) || Overlaps(B.OwnedActors, A.TargetActors)
+			|| Overlaps(A.OwnedCells, B.TargetCells) || Overlaps(B.OwnedCells, A.TargetCells);
+	}
+}
+
 //--------------------------------------------------------------------------
 // Subsystem Lifecycle
 //--------------------------------------------------------------------------
@@ -19,18 +126,22 @@ void UAttackPhaseExecutorSubsystem::Initialize(FSubsystemCollectionBase& Collect
 	Super::Initialize(Collection);
 
 	CurrentIndex = 0;
+	CurrentWave = 0;
 	TurnId = -1;
 	Queue.Empty();
+	Waves.Empty();
 
 	UE_LOG(LogAttackPhase, Log, TEXT("[AttackPhaseExecutor] Initialized"));
 }
 
 void UAttackPhaseExecutorSubsystem::Deinitialize()
 {
-	UnbindCurrentASC();
+	UnbindAllASCs();
 
 	Queue.Empty();
+	Waves.Empty();
 	CurrentIndex = 0;
+	CurrentWave = 0;
 	TurnId = -1;
 
 	UE_LOG(LogAttackPhase, Log, TEXT("[AttackPhaseExecutor] Deinitialized"));
@@ -46,11 +157,13 @@ void UAttackPhaseExecutorSubsystem::BeginSequentialAttacks(
 	int32 InTurnId)
 {
 	// Ensure we are not still bound to a previous ASC
-	UnbindCurrentASC();
+	UnbindAllASCs();
 
 	Queue = AttackActions;
 	TurnId = InTurnId;
 	CurrentIndex = 0;
+	CurrentWave = 0;
+	Waves.Reset();
 
 	UE_LOG(LogAttackPhase, Log,
 		TEXT("[Turn %d] BeginSequentialAttacks: %d attacks queued"),
@@ -81,7 +194,7 @@ void UAttackPhaseExecutorSubsystem::BeginSequentialAttacks(
 				if (Action.Actor.IsValid())
 				{
 					AActor* Attacker = Action.Actor.Get();
-					FGuid ActionId = Barrier->RegisterAction(Attacker, TurnId);
+					FTurnActionHandle ActionId = Barrier->RegisterAction(Attacker, TurnId);
 					Action.BarrierActionId = ActionId;
 
 					UE_LOG(LogAttackPhase, Verbose,
@@ -105,6 +218,7 @@ void UAttackPhaseExecutorSubsystem::BeginSequentialAttacks(
 		}
 	}
 
+	BuildWaves(GTS_Attack_ParallelWaves == 0);
 	DispatchNext();
 }
 
@@ -118,37 +232,130 @@ void UAttackPhaseExecutorSubsystem::NotifyAttackCompleted(AActor* Attacker)
 	}
 
 	// Reuse the same completion path as the ASC event callback
-	OnAbilityCompleted(nullptr);
+	UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Attacker);
+	if (!ASC && WaitingASCs.Num() == 1)
+	{
+		// Legacy callers without an attacker: only unambiguous while a single attack is in flight
+		for (const TPair<TWeakObjectPtr<UAbilitySystemComponent>, FDelegateHandle>& Pair : WaitingASCs)
+		{
+			ASC = Pair.Key.Get();
+		}
+	}
+	CompleteInFlight(ASC);
 }
 
 //--------------------------------------------------------------------------
 // Internal execution pipeline
 //--------------------------------------------------------------------------
 
+void UAttackPhaseExecutorSubsystem::BuildWaves(bool bSequential)
+{
+	// CodeRevision: INC-2025-1212-R2 (Attacks that only share a target play in the same wave) (2025-12-27 17:00)
+	BuildAttackWaves(Queue, bSequential, Waves);
+
+	UE_LOG(LogAttackPhase, Log,
+		TEXT("[Turn %d] BuildWaves: %d attacks -> %d waves (%s)"),
+		TurnId, Queue.Num(), Waves.Num(), bSequential ? TEXT("Sequential") : TEXT("Parallel"));
+}
+
+void UAttackPhaseExecutorSubsystem::BuildAttackWaves(const TArray<FResolvedAction>& Attacks, bool bSequential, TArray<TArray<int32>>& OutWaves)
+{
+	using namespace AttackPhaseExecutorPrivate;
+
+	OutWaves.Reset();
+	if (Attacks.Num() == 0)
+	{
+		return;
+	}
+
+	if (bSequential)
+	{
+		for (int32 i = 0; i < Attacks.Num(); ++i)
+		{
+			OutWaves.AddDefaulted_GetRef().Add(i);
+		}
+	}
+	else
+	{
+		// Layer the dependency DAG: an attack goes one wave after the latest earlier attack it
+		// interferes with, so every dependent pair keeps its original relative order.
+		TArray<FAttackFootprint> Footprints;
+		Footprints.Reserve(Attacks.Num());
+		for (const FResolvedAction& Action : Attacks)
+		{
+			Footprints.Add(MakeFootprint(Action));
+		}
+
+		TArray<int32> WaveOf;
+		WaveOf.SetNumZeroed(Attacks.Num());
+
+		for (int32 i = 0; i < Attacks.Num(); ++i)
+		{
+			for (int32 j = 0; j < i; ++j)
+			{
+				if (WaveOf[j] >= WaveOf[i] && Interferes(Footprints[i], Footprints[j]))
+				{
+					WaveOf[i] = WaveOf[j] + 1;
+				}
+			}
+
+			if (WaveOf[i] >= OutWaves.Num())
+			{
+				OutWaves.SetNum(WaveOf[i] + 1);
+			}
+			OutWaves[WaveOf[i]].Add(i);
+		}
+	}
+}
+
 void UAttackPhaseExecutorSubsystem::DispatchNext()
 {
-	if (CurrentIndex >= Queue.Num())
+	if (CurrentWave >= Waves.Num())
 	{
 		UE_LOG(LogAttackPhase, Log,
-			TEXT("[Turn %d] All %d attacks completed"),
-			TurnId, Queue.Num());
+			TEXT("[Turn %d] All %d attacks completed (%d waves)"),
+			TurnId, Queue.Num(), Waves.Num());
 
-		UnbindCurrentASC();
+		UnbindAllASCs();
 		OnFinished.Broadcast(TurnId);
 		return;
 	}
 
-	const FResolvedAction& Action = Queue[CurrentIndex];
+	const TArray<int32>& Wave = Waves[CurrentWave];
+
+	UE_LOG(LogAttackPhase, Log,
+		TEXT("[Turn %d] Dispatching wave %d/%d (%d attacks)"),
+		TurnId, CurrentWave + 1, Waves.Num(), Wave.Num());
+
+	// Abilities may complete synchronously inside HandleGameplayEvent; defer advancing until the
+	// whole wave has been sent.
+	bDispatchingWave = true;
+	for (const int32 QueueIndex : Wave)
+	{
+		if (!DispatchAttack(QueueIndex))
+		{
+			++CurrentIndex;
+		}
+	}
+	bDispatchingWave = false;
+
+	if (WaitingASCs.Num() == 0)
+	{
+		++CurrentWave;
+		DispatchNext();
+	}
+}
+
+bool UAttackPhaseExecutorSubsystem::DispatchAttack(int32 QueueIndex)
+{
+	const FResolvedAction& Action = Queue[QueueIndex];
 
 	if (!Action.Actor.IsValid())
 	{
 		UE_LOG(LogAttackPhase, Warning,
 			TEXT("[Turn %d] Invalid actor at index %d, skipping"),
-			TurnId, CurrentIndex);
-
-		++CurrentIndex;
-		DispatchNext();
-		return;
+			TurnId, QueueIndex);
+		return false;
 	}
 
 	AActor* Attacker = Action.Actor.Get();
@@ -160,10 +367,7 @@ void UAttackPhaseExecutorSubsystem::DispatchNext()
 		UE_LOG(LogAttackPhase, Warning,
 			TEXT("[Turn %d] %s has no ASC, skipping"),
 			TurnId, *GetNameSafe(Attacker));
-
-		++CurrentIndex;
-		DispatchNext();
-		return;
+		return false;
 	}
 
 	BindASC(ASC);
@@ -209,26 +413,25 @@ void UAttackPhaseExecutorSubsystem::DispatchNext()
 	if (TriggeredCount > 0)
 	{
 		UE_LOG(LogAttackPhase, Log,
-			TEXT("[Turn %d] Dispatched attack %d/%d: %s (Tag=%s)"),
+			TEXT("[Turn %d] Dispatched attack %d/%d: %s (Tag=%s, Wave=%d)"),
 			TurnId,
-			CurrentIndex + 1,
+			QueueIndex + 1,
 			Queue.Num(),
 			*GetNameSafe(Attacker),
-			TEXT("GameplayEvent.Intent.Attack"));
+			TEXT("GameplayEvent.Intent.Attack"),
+			CurrentWave + 1);
+		return true;
 	}
-	else
-	{
-		UE_LOG(LogAttackPhase, Warning,
-			TEXT("[Turn %d] %s: %s failed to trigger any abilities"),
-			TurnId,
-			*GetNameSafe(Attacker),
-			TEXT("GameplayEvent.Intent.Attack"));
 
-		// No ability fired; treat as completed and move on.
-		UnbindCurrentASC();
-		++CurrentIndex;
-		DispatchNext();
-	}
+	UE_LOG(LogAttackPhase, Warning,
+		TEXT("[Turn %d] %s: %s failed to trigger any abilities"),
+		TurnId,
+		*GetNameSafe(Attacker),
+		TEXT("GameplayEvent.Intent.Attack"));
+
+	// No ability fired; treat as completed.
+	UnbindASC(ASC);
+	return false;
 }
 
 //--------------------------------------------------------------------------
@@ -243,39 +446,55 @@ void UAttackPhaseExecutorSubsystem::BindASC(UAbilitySystemComponent* ASC)
 		return;
 	}
 
-	// Ensure we are not still bound to an old ASC
-	UnbindCurrentASC();
+	// Ensure we are not still bound to this ASC from an earlier attack
+	UnbindASC(ASC);
 
-	WaitingASC = ASC;
-
-	AbilityCompletedHandle = ASC->GenericGameplayEventCallbacks.FindOrAdd(
+	const FDelegateHandle Handle = ASC->GenericGameplayEventCallbacks.FindOrAdd(
 		RogueGameplayTags::Gameplay_Event_Turn_Ability_Completed
-	).AddUObject(this, &UAttackPhaseExecutorSubsystem::OnAbilityCompleted);
+	).AddUObject(this, &UAttackPhaseExecutorSubsystem::OnAbilityCompleted, TWeakObjectPtr<UAbilitySystemComponent>(ASC));
+
+	WaitingASCs.Add(ASC, Handle);
 
 	UE_LOG(LogAttackPhase, Verbose,
-		TEXT("[Turn %d] Bound to ASC: %s"),
-		TurnId, *GetNameSafe(ASC->GetOwner()));
+		TEXT("[Turn %d] Bound to ASC: %s (InFlight=%d)"),
+		TurnId, *GetNameSafe(ASC->GetOwner()), WaitingASCs.Num());
 }
 
-void UAttackPhaseExecutorSubsystem::UnbindCurrentASC()
+void UAttackPhaseExecutorSubsystem::UnbindASC(UAbilitySystemComponent* ASC)
 {
-	if (WaitingASC.IsValid() && AbilityCompletedHandle.IsValid())
+	FDelegateHandle Handle;
+	if (!ASC || !WaitingASCs.RemoveAndCopyValue(ASC, Handle))
 	{
-		if (UAbilitySystemComponent* ASC = WaitingASC.Get())
-		{
-			ASC->GenericGameplayEventCallbacks.FindOrAdd(
-				RogueGameplayTags::Gameplay_Event_Turn_Ability_Completed
-			).Remove(AbilityCompletedHandle);
+		return;
+	}
 
-			UE_LOG(LogAttackPhase, Verbose,
-				TEXT("[Turn %d] Unbound from ASC: %s"),
-				TurnId, *GetNameSafe(ASC->GetOwner()));
-		}
+	if (Handle.IsValid())
+	{
+		ASC->GenericGameplayEventCallbacks.FindOrAdd(
+			RogueGameplayTags::Gameplay_Event_Turn_Ability_Completed
+		).Remove(Handle);
+
+		UE_LOG(LogAttackPhase, Verbose,
+			TEXT("[Turn %d] Unbound from ASC: %s"),
+			TurnId, *GetNameSafe(ASC->GetOwner()));
+	}
+}
+
+void UAttackPhaseExecutorSubsystem::UnbindAllASCs()
+{
+	TArray<TWeakObjectPtr<UAbilitySystemComponent>> Bound;
+	WaitingASCs.GetKeys(Bound);
 
-		AbilityCompletedHandle.Reset();
+	for (const TWeakObjectPtr<UAbilitySystemComponent>& WeakASC : Bound)
+	{
+		if (UAbilitySystemComponent* ASC = WeakASC.Get())
+		{
+			UnbindASC(ASC);
+		}
 	}
 
-	WaitingASC.Reset();
+	// Stale (destroyed) ASCs: nothing left to unbind
+	WaitingASCs.Reset();
 }
 
 //--------------------------------------------------------------------------
@@ -283,28 +502,48 @@ void UAttackPhaseExecutorSubsystem::UnbindCurrentASC()
 //--------------------------------------------------------------------------
 
 void UAttackPhaseExecutorSubsystem::OnAbilityCompleted(
-	const FGameplayEventData* Payload)
+	const FGameplayEventData* Payload,
+	TWeakObjectPtr<UAbilitySystemComponent> SourceASC)
 {
 	UE_LOG(LogAttackPhase, Log,
-		TEXT("[Turn %d] Ability completed at index %d"),
-		TurnId, CurrentIndex);
+		TEXT("[Turn %d] Ability completed: %s (Wave %d)"),
+		TurnId, SourceASC.IsValid() ? *GetNameSafe(SourceASC->GetOwner()) : TEXT("null"), CurrentWave + 1);
 
-	UnbindCurrentASC();
+	CompleteInFlight(SourceASC.Get());
+}
+
+void UAttackPhaseExecutorSubsystem::CompleteInFlight(UAbilitySystemComponent* ASC)
+{
+	if (!ASC || !WaitingASCs.Contains(ASC))
+	{
+		// Duplicate / unrelated completion
+		UE_LOG(LogAttackPhase, Verbose,
+			TEXT("[Turn %d] Ignoring completion from non-waiting ASC: %s"),
+			TurnId, ASC ? *GetNameSafe(ASC->GetOwner()) : TEXT("null"));
+		return;
+	}
+
+	UnbindASC(ASC);
 	++CurrentIndex;
-	DispatchNext();
+
+	if (WaitingASCs.Num() == 0 && !bDispatchingWave)
+	{
+		++CurrentWave;
+		DispatchNext();
+	}
 }
 
 //--------------------------------------------------------------------------
 // Barrier integration helpers
 //--------------------------------------------------------------------------
 
-FGuid UAttackPhaseExecutorSubsystem::GetActionIdForActor(AActor* Actor) const
+FTurnActionHandle UAttackPhaseExecutorSubsystem::GetActionIdForActor(AActor* Actor) const
 {
 	if (!Actor)
 	{
 		UE_LOG(LogAttackPhase, Warning,
 			TEXT("[GetActionIdForActor] Actor is null"));
-		return FGuid();
+		return FTurnActionHandle();
 	}
 
 	for (const FResolvedAction& Action : Queue)
@@ -319,5 +558,5 @@ FGuid UAttackPhaseExecutorSubsystem::GetActionIdForActor(AActor* Actor) const
 		TEXT("[GetActionIdForActor] Actor %s not found in attack queue"),
 		*GetNameSafe(Actor));
 
-	return FGuid();
+	return FTurnActionHandle();
 }
@@ -31,6 +31,13 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(
  * - ASC完了イベント購読による決定論的な逐次実行
  * - タイムアウト/ポーリングを排除し、無限ループを撲滅
  *
+ * 【INC-2025-1212】Wave execution
+ * - Attacks whose footprints (attacker + target actors/cells) are disjoint are grouped into waves
+ *   that are dispatched together; dependent attacks keep their original relative order.
+ * - Attacks that only share a target (ten enemies hitting the player) are independent and go in
+ *   one wave, dispatched in queue order; an attack on another attacker waits for that attack.
+ * - ts.Attack.ParallelWaves 0 restores the strict one-at-a-time order (order-sensitive effects).
+ *
  * 使用例:
  *   AttackPhaseExecutor->BeginSequentialAttacks(ResolvedAttacks, TurnId);
  *   → OnFinished イベント購読で次フェーズへ遷移
@@ -57,6 +64,7 @@ public:
 	 *
 	 * キューに登録された攻撃を順番に実行し、各攻撃の完了を
 	 * ASC完了イベント購読で監視。すべて完了時に OnFinished を発火。
+	 * Non-interfering attacks are dispatched concurrently in waves (see ts.Attack.ParallelWaves).
 	 *
 	 * @param AttackActions 攻撃アクション配列（ResolvedAction）
 	 * @param InTurnId ターンID
@@ -91,6 +99,12 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Turn|Exec")
 	bool IsExecuting() const { return CurrentIndex < Queue.Num(); }
 
+	/**
+	 * Number of waves built for the current queue (== attack count in sequential mode)
+	 */
+	UFUNCTION(BlueprintPure, Category = "Turn|Exec")
+	int32 GetWaveCount() const { return Waves.Num(); }
+
 	/**
 	 * キューに残っている攻撃数
 	 */
@@ -105,7 +119,14 @@ public:
 	 * ★★★ BUGFIX [INC-2025-TIMING]: Allows GA_AttackBase to retrieve its ActionId ★★★
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Turn|Exec")
-	FGuid GetActionIdForActor(AActor* Actor) const;
+	FTurnActionHandle GetActionIdForActor(AActor* Actor) const;
+
+	// CodeRevision: INC-2025-1212-R2 (Attacks that only share a target play in the same wave) (2025-12-27 17:00)
+	/**
+	 * Group Attacks into waves of mutually non-interfering attacks (indices into Attacks, in
+	 * dispatch order). bSequential puts every attack into its own wave.
+	 */
+	static void BuildAttackWaves(const TArray<FResolvedAction>& Attacks, bool bSequential, TArray<TArray<int32>>& OutWaves);
 
 private:
 	//--------------------------------------------------------------------------
@@ -113,10 +134,22 @@ private:
 	//--------------------------------------------------------------------------
 
 	/**
-	 * 次の攻撃を送出
+	 * Group the queue into waves of mutually non-interfering attacks.
+	 * bSequential puts every attack into its own wave (strict order).
+	 */
+	void BuildWaves(bool bSequential);
+
+	/**
+	 * 次のウェーブを送出
 	 */
 	void DispatchNext();
 
+	/**
+	 * Dispatch one attack of the current wave
+	 * @return true if an ability was triggered and its completion is awaited
+	 */
+	bool DispatchAttack(int32 QueueIndex);
+
 	/**
 	 * ASC完了イベントのバインド
 	 *
@@ -129,17 +162,21 @@ private:
 	 *
 	 * GA_Attackが SendCompletionEvent() を呼ぶと、この関数が実行される。
 	 *
-	 * @param EventTag 完了イベントタグ（Turn.Ability.Completed）
 	 * @param Payload イベントペイロード
+	 * @param SourceASC 完了イベントを送ってきたASC
+	 */
+	void OnAbilityCompleted(const FGameplayEventData* Payload, TWeakObjectPtr<UAbilitySystemComponent> SourceASC);
+
+	/**
+	 * Mark one in-flight attack of the current wave as finished and advance when the wave drains
 	 */
-	void OnAbilityCompleted(const FGameplayEventData* Payload);
+	void CompleteInFlight(UAbilitySystemComponent* ASC);
 
 	/**
 	 * デリゲート解除
-	 *
-	 * 次の攻撃に移る前、または完了時に既存のバインドを解除
 	 */
-	void UnbindCurrentASC();
+	void UnbindASC(UAbilitySystemComponent* ASC);
+	void UnbindAllASCs();
 
 	//--------------------------------------------------------------------------
 	// 内部状態
@@ -149,16 +186,21 @@ private:
 	UPROPERTY()
 	TArray<FResolvedAction> Queue;
 
-	/** 現在のインデックス */
+	/** 完了（またはスキップ）した攻撃数 */
 	int32 CurrentIndex = 0;
 
 	/** ターンID */
 	int32 TurnId = -1;
 
-	/** 現在待機中のASC */
-	UPROPERTY()
-	TWeakObjectPtr<UAbilitySystemComponent> WaitingASC;
+	/** Queue indices per wave, in dispatch order */
+	TArray<TArray<int32>> Waves;
+
+	/** Wave currently in flight */
+	int32 CurrentWave = 0;
+
+	/** True while a wave is being dispatched (synchronous completions are deferred) */
+	bool bDispatchingWave = false;
 
-	/** ASC完了イベントのデリゲートハンドル */
-	FDelegateHandle AbilityCompletedHandle;
+	/** 現在待機中のASC → 完了イベントのデリゲートハンドル */
+	TMap<TWeakObjectPtr<UAbilitySystemComponent>, FDelegateHandle> WaitingASCs;
 };
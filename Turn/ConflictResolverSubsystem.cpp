@@ -1,4 +1,5 @@
 #include "Turn/ConflictResolverSubsystem.h"
+#include "Turn/TurnFrameArena.h"
 #include "Utility/RogueGameplayTags.h"
 #include "Grid/GridOccupancySubsystem.h"
 #include "EngineUtils.h"
@@ -6,6 +7,10 @@
 #include "Templates/Tuple.h"
 // CodeRevision: INC-2025-1148-R1 (Allow rerouting moves off blocked attack tiles instead of forced WAIT when a closer tile exists) (2025-11-20 15:30)
 #include "Turn/DistanceFieldSubsystem.h"
+// CodeRevision: INC-2025-1229-R1 (Resolver diagnostics through gated ROGUE_DIAG channels) (2025-12-22 14:00)
+#include "Utility/ProjectDiagnostics.h"
+// CodeRevision: INC-2025-1230-R1 (Turn pipeline CPU profiling: trace scopes, STAT counters, rolling percentiles, Chrome trace export) (2025-12-23 10:00)
+#include "Turn/TurnProfilerSubsystem.h"
 
 DEFINE_LOG_CATEGORY(LogConflictResolver);
 
@@ -21,7 +26,8 @@ void UConflictResolverSubsystem::Deinitialize()
 
 void UConflictResolverSubsystem::ClearReservations()
 {
-    ReservationTable.Empty();
+    // CodeRevision: INC-2025-1214-R1 (Keep table slack across turns) (2025-12-15 14:00)
+    ReservationTable.Reset();
 }
 
 void UConflictResolverSubsystem::AddReservation(const FReservationEntry& Entry)
@@ -39,6 +45,17 @@ void UConflictResolverSubsystem::AddReservation(const FReservationEntry& Entry)
 
 TArray<FResolvedAction> UConflictResolverSubsystem::ResolveAllConflicts()
 {
+    TArray<FResolvedAction> Actions;
+    ResolveAllConflictsInto(Actions);
+    return Actions;
+}
+
+// CodeRevision: INC-2025-1214-R3 (No hidden arena fallback; resolve outputs filled into reused caller arrays) (2025-12-27 12:00)
+void UConflictResolverSubsystem::ResolveAllConflictsInto(TArray<FResolvedAction>& OutActions)
+{
+    TURN_PROFILE_SCOPE(this, ResolveConflicts);
+    FTurnFrameArenaScope ArenaScope(this);  // CodeRevision: INC-2025-1214-R2 (2025-12-26 12:00)
+
     // ========================================================================
     // CONTRACT (Priority 2): Count input reservations for invariant check
     // ========================================================================
@@ -51,10 +68,11 @@ TArray<FResolvedAction> UConflictResolverSubsystem::ResolveAllConflicts()
         NumReservations += Contenders.Num();
     }
 
-    UE_LOG(LogConflictResolver, Log,
+    ROGUE_DIAG(Turn, LogConflictResolver, Log,
         TEXT("[ResolveAllConflicts] START: NumReservations=%d"), NumReservations);
 
-    TArray<FResolvedAction> OptimisticActions;
+    OutActions.Reset();
+    OutActions.Reserve(NumReservations);
 
     // ------------------------------------------------------------------------
     // Resolve GridOccupancy and current TurnId
@@ -79,7 +97,7 @@ TArray<FResolvedAction> UConflictResolverSubsystem::ResolveAllConflicts()
         return false;
     }();
 
-    UE_LOG(LogConflictResolver, Log,
+    ROGUE_DIAG(Turn, LogConflictResolver, Log,
         TEXT("[ResolveAllConflicts] Mode: %s"),
         bSequentialAttackMode ? TEXT("Sequential") : TEXT("Simultaneous"));
 
@@ -96,7 +114,9 @@ TArray<FResolvedAction> UConflictResolverSubsystem::ResolveAllConflicts()
     // Assumption: one reservation per actor per turn. If this changes,
     // swap detection and invariants must be revisited.
     // ========================================================================
-    TMap<AActor*, TPair<FIntPoint, FIntPoint>> ActorMoves;
+    // CodeRevision: INC-2025-1214-R1 (Resolver scratch lives in the turn frame arena) (2025-12-15 14:00)
+    TTurnFrameMap<AActor*, TPair<FIntPoint, FIntPoint>> ActorMoves;
+    ActorMoves.Reserve(NumReservations);
 
     for (const auto& Pair : ReservationTable)
     {
@@ -131,7 +151,7 @@ TArray<FResolvedAction> UConflictResolverSubsystem::ResolveAllConflicts()
     }
 
     // Detect A<->B swaps
-    TSet<AActor*> SwapActors;  // actors participating in perfect swap pairs
+    TTurnFrameSet<AActor*> SwapActors;  // actors participating in perfect swap pairs
     for (const auto& PairA : ActorMoves)
     {
         AActor* ActorA = PairA.Key;
@@ -161,10 +181,9 @@ TArray<FResolvedAction> UConflictResolverSubsystem::ResolveAllConflicts()
                 SwapActors.Add(ActorA);
                 SwapActors.Add(ActorB);
 
-                UE_LOG(LogConflictResolver, Warning,
-                    TEXT("[SWAP DETECTED] %s (%d,%d)->(%d,%d) <=> %s (%d,%d)->(%d,%d)"),
-                    *GetNameSafe(ActorA), CurrentA.X, CurrentA.Y, NextA.X, NextA.Y,
-                    *GetNameSafe(ActorB), CurrentB.X, CurrentB.Y, NextB.X, NextB.Y);
+                ROGUE_DIAG_EVENT(Turn, LogConflictResolver, Warning, TEXT("SwapDetected"), CurrentTurnId, ActorA, NextA,
+                    *FString::Printf(TEXT("from=(%d,%d) other=%s other_from=(%d,%d) other_to=(%d,%d)"),
+                        CurrentA.X, CurrentA.Y, *GetNameSafe(ActorB), CurrentB.X, CurrentB.Y, NextB.X, NextB.Y));
             }
         }
     }
@@ -184,7 +203,8 @@ TArray<FResolvedAction> UConflictResolverSubsystem::ResolveAllConflicts()
     // ========================================================================
 
     // Phase A-1: Build the set of actors that made reservations this turn.
-    TSet<AActor*> ActorsWithReservationsThisTurn;
+    TTurnFrameSet<AActor*> ActorsWithReservationsThisTurn;
+    ActorsWithReservationsThisTurn.Reserve(NumReservations);
     for (const auto& Pair : ReservationTable)
     {
         const TArray<FReservationEntry>& Contenders = Pair.Value;
@@ -197,22 +217,20 @@ TArray<FResolvedAction> UConflictResolverSubsystem::ResolveAllConflicts()
         }
     }
 
-    UE_LOG(LogConflictResolver, Log,
+    ROGUE_DIAG(Turn, LogConflictResolver, Log,
         TEXT("[StaticBlockers] Found %d actors with reservations this turn"),
         ActorsWithReservationsThisTurn.Num());
 
     // Phase A-2: Scan GridOccupancy for cells occupied by actors that have
     // NO reservation this turn → these become StationaryBlockers.
-    TMap<FIntPoint, AActor*> StationaryBlockers;  // Key = Cell, Value = Stationary actor
+    TTurnFrameMap<FIntPoint, AActor*> StationaryBlockers;  // Key = Cell, Value = Stationary actor
 
     if (GridOccupancy)
     {
-        TMap<FIntPoint, AActor*> AllOccupiedCells = GridOccupancy->GetAllOccupiedCells();
-
-        for (const auto& OccPair : AllOccupiedCells)
+        for (const auto& OccPair : GridOccupancy->GetOccupiedCellMap())
         {
             const FIntPoint& Cell = OccPair.Key;
-            AActor* Occupant = OccPair.Value;
+            AActor* Occupant = OccPair.Value.Get();
 
             if (Occupant && IsValid(Occupant))
             {
@@ -229,7 +247,7 @@ TArray<FResolvedAction> UConflictResolverSubsystem::ResolveAllConflicts()
                         StationaryBlockers.Add(ReservedDest, Occupant);
                         bIsMovingExternal = true;
 
-                        UE_LOG(LogConflictResolver, Verbose,
+                        ROGUE_DIAG(Turn, LogConflictResolver, Verbose,
                             TEXT("[StaticBlockers] External mover %s blocks DEST (%d,%d) instead of current (%d,%d)"),
                             *GetNameSafe(Occupant), ReservedDest.X, ReservedDest.Y, Cell.X, Cell.Y);
                     }
@@ -239,7 +257,7 @@ TArray<FResolvedAction> UConflictResolverSubsystem::ResolveAllConflicts()
                         // This actor is not moving this turn and blocks the cell.
                         StationaryBlockers.Add(Cell, Occupant);
 
-                        UE_LOG(LogConflictResolver, Verbose,
+                        ROGUE_DIAG(Turn, LogConflictResolver, Verbose,
                             TEXT("[StaticBlockers] Stationary blocker %s at cell (%d,%d)"),
                             *GetNameSafe(Occupant), Cell.X, Cell.Y);
                     }
@@ -248,12 +266,12 @@ TArray<FResolvedAction> UConflictResolverSubsystem::ResolveAllConflicts()
         }
     }
 
-    UE_LOG(LogConflictResolver, Log,
+    ROGUE_DIAG(Turn, LogConflictResolver, Log,
         TEXT("[StaticBlockers] Total stationary blockers detected: %d"),
         StationaryBlockers.Num());
 
     // ========================================================================
-    // Phase B: Per-cell conflict resolution (OptimisticActions)
+    // Phase B: Per-cell conflict resolution (OutActions)
     //
     // For each reserved cell:
     //   1) If a GridOccupancy-based stationary blocker exists:
@@ -264,10 +282,11 @@ TArray<FResolvedAction> UConflictResolverSubsystem::ResolveAllConflicts()
     //        - If only one contender → direct success (no conflict).
     //        - If multiple contenders:
     //            - In Sequential mode: ATTACK beats MOVE for the same cell.
-    //            - Otherwise: pick a winner (currently random tie-break).
+    //            - Otherwise: pick the highest score; exact ties keep the
+    //              first-registered contender (no RNG, replay-stable).
     //            - Losers are converted to WAIT.
     //
-    // The result of Phase B is OptimisticActions: a 1:1 mapping from
+    // The result of Phase B is OutActions: a 1:1 mapping from
     // reservations to resolved actions, but not yet revalidated against
     // "stationary cells" emitted by other actions.
     // ========================================================================
@@ -298,11 +317,9 @@ TArray<FResolvedAction> UConflictResolverSubsystem::ResolveAllConflicts()
                     FResolvedAction SelfWait = CreateWaitAction(Blocked);
                     SelfWait.AbilityTag       = WaitTag;
                     SelfWait.FinalAbilityTag  = WaitTag;
-                    SelfWait.ResolutionReason = FString::Printf(
-                        TEXT("Success: Stationary unit holds its own cell (%d,%d)"),
-                        Cell.X, Cell.Y);
+                    SelfWait.SetResolution(EResolutionReason::HoldsOwnCell, Cell);
 
-                    OptimisticActions.Add(SelfWait);
+                    OutActions.Add(MoveTemp(SelfWait));
                     continue;
                 }
 
@@ -315,15 +332,12 @@ TArray<FResolvedAction> UConflictResolverSubsystem::ResolveAllConflicts()
                     FResolvedAction WaitAction = CreateWaitAction(Blocked);
                     WaitAction.AbilityTag       = WaitTag;
                     WaitAction.FinalAbilityTag  = WaitTag;
-                    WaitAction.ResolutionReason = FString::Printf(
-                        TEXT("Blocked by non-moving unit at cell (%d,%d)"),
-                        Cell.X, Cell.Y);
+                    WaitAction.SetResolution(EResolutionReason::BlockedByStationary, Cell);
 
-                    OptimisticActions.Add(WaitAction);
+                    OutActions.Add(MoveTemp(WaitAction));
 
-                    UE_LOG(LogConflictResolver, Warning,
-                        TEXT("[StaticBlockers] %s blocked by stationary %s at (%d,%d)"),
-                        *GetNameSafe(Blocked.Actor), *GetNameSafe(StationaryBlocker), Cell.X, Cell.Y);
+                    ROGUE_DIAG_EVENT(Turn, LogConflictResolver, Warning, TEXT("BlockedByStationary"), CurrentTurnId, Blocked.Actor, Cell,
+                        *FString::Printf(TEXT("blocker=%s"), *GetNameSafe(StationaryBlocker)));
                 }
             }
 
@@ -358,7 +372,7 @@ TArray<FResolvedAction> UConflictResolverSubsystem::ResolveAllConflicts()
 
                 AActor* WinnerActorPtr = Winner.Actor;
 
-                // ResolutionReason for non-conflict actions
+                // Resolution reason for non-conflict actions
                 if (SwapActors.Contains(WinnerActorPtr))
                 {
                     // CodeRevision: INC-2025-1148-R2 (Forbid swaps to prevent GridOccupancy deadlocks) (2025-11-20 19:05)
@@ -369,25 +383,14 @@ TArray<FResolvedAction> UConflictResolverSubsystem::ResolveAllConflicts()
                     Action.NextCell        = Action.CurrentCell;
                     Action.AbilityTag      = WaitTag;
                     Action.FinalAbilityTag = WaitTag;
-                    Action.ResolutionReason = TEXT("Conflict: Swap move forbidden (GridOccupancy deadlock prevention)");
+                    Action.SetResolution(EResolutionReason::SwapForbidden, Winner.Cell);
 
-                    UE_LOG(LogConflictResolver, Warning,
-                        TEXT("[SWAP REJECTED] %s at (%d,%d)->(%d,%d) forced to WAIT"),
-                        *GetNameSafe(WinnerActorPtr),
-                        Winner.CurrentCell.X, Winner.CurrentCell.Y,
-                        Winner.Cell.X, Winner.Cell.Y);
-                }
-                else if (Winner.AbilityTag.MatchesTag(AttackTag))
-                {
-                    Action.ResolutionReason = TEXT("Success: Attack (no conflict)");
-                }
-                else if (Winner.AbilityTag.MatchesTag(MoveTag))
-                {
-                    Action.ResolutionReason = TEXT("Success: Move (no conflict)");
+                    ROGUE_DIAG_EVENT(Turn, LogConflictResolver, Warning, TEXT("SwapRejected"), CurrentTurnId, WinnerActorPtr, Winner.Cell,
+                        *FString::Printf(TEXT("from=(%d,%d)"), Winner.CurrentCell.X, Winner.CurrentCell.Y));
                 }
                 else
                 {
-                    Action.ResolutionReason = TEXT("Success: Action (no conflict)");
+                    Action.SetResolution(EResolutionReason::NoConflict);
                 }
 
                 // Mark the winner's reservation as committed for this turn
@@ -396,7 +399,7 @@ TArray<FResolvedAction> UConflictResolverSubsystem::ResolveAllConflicts()
                     GridOccupancy->MarkReservationCommitted(WinnerActorPtr, CurrentTurnId);
                 }
 
-                OptimisticActions.Add(Action);
+                OutActions.Add(MoveTemp(Action));
             }
         }
         else
@@ -404,16 +407,19 @@ TArray<FResolvedAction> UConflictResolverSubsystem::ResolveAllConflicts()
             // ----------------------------------------------------------------
             // CONFLICT: More than one actor wants this cell.
             // ----------------------------------------------------------------
-            FString ContenderNames;
-            for (const FReservationEntry& E : Contenders)
+            if (ROGUE_DIAG_ACTIVE(Turn, LogConflictResolver, Warning))
             {
-                ContenderNames += FString::Printf(TEXT("%s(%s) "), *GetNameSafe(E.Actor), *E.AbilityTag.ToString());
+                FString ContenderNames;
+                for (const FReservationEntry& E : Contenders)
+                {
+                    ContenderNames += FString::Printf(TEXT("%s(%s) "), *GetNameSafe(E.Actor), *E.AbilityTag.ToString());
+                }
+                UE_LOG(LogConflictResolver, Warning,
+                    TEXT("Conflict at cell (%d,%d) with %d contenders: %s. Resolving..."),
+                    Cell.X, Cell.Y, Contenders.Num(), *ContenderNames);
             }
-            UE_LOG(LogConflictResolver, Warning,
-                TEXT("Conflict at cell (%d,%d) with %d contenders: %s. Resolving..."),
-                Cell.X, Cell.Y, Contenders.Num(), *ContenderNames);
 
-            const auto ApplySwapRejection = [&](const FReservationEntry& Entry, FResolvedAction& Action, const FString& Reason) -> bool
+            const auto ApplySwapRejection = [&](const FReservationEntry& Entry, FResolvedAction& Action, int32 SwapDetail) -> bool
             {
                 if (Entry.Actor == nullptr || !IsValid(Entry.Actor))
                 {
@@ -430,13 +436,10 @@ TArray<FResolvedAction> UConflictResolverSubsystem::ResolveAllConflicts()
                 Action.NextCell        = Action.CurrentCell;
                 Action.AbilityTag      = WaitTag;
                 Action.FinalAbilityTag = WaitTag;
-                Action.ResolutionReason = Reason;
+                Action.SetResolution(EResolutionReason::SwapForbidden, Cell, SwapDetail);
 
-                UE_LOG(LogConflictResolver, Warning,
-                    TEXT("[SWAP REJECTED] %s at (%d,%d)->(%d,%d) forced to WAIT"),
-                    *GetNameSafe(Entry.Actor),
-                    Entry.CurrentCell.X, Entry.CurrentCell.Y,
-                    Entry.Cell.X, Entry.Cell.Y);
+                ROGUE_DIAG_EVENT(Turn, LogConflictResolver, Warning, TEXT("SwapRejected"), CurrentTurnId, Entry.Actor, Entry.Cell,
+                    *FString::Printf(TEXT("from=(%d,%d)"), Entry.CurrentCell.X, Entry.CurrentCell.Y));
 
                 return true;
             };
@@ -498,7 +501,7 @@ TArray<FResolvedAction> UConflictResolverSubsystem::ResolveAllConflicts()
                 {
                     bAttackWonConflict = true;
 
-                    UE_LOG(LogConflictResolver, Log,
+                    ROGUE_DIAG(Turn, LogConflictResolver, Log,
                         TEXT("[Sequential] Attack entry locks cell (%d,%d), blocking %d other contender(s)"),
                         Cell.X, Cell.Y, Contenders.Num() - 1);
                 }
@@ -563,22 +566,14 @@ TArray<FResolvedAction> UConflictResolverSubsystem::ResolveAllConflicts()
 
             AActor* WinnerActorPtr = Winner.Actor;
 
-            const bool bWinnerSwapRejected = ApplySwapRejection(
-                Winner,
-                WinnerAction,
-                FString::Printf(
-                    TEXT("Conflict: Swap move forbidden at cell (%d,%d)"),
-                    Cell.X, Cell.Y));
+            const bool bWinnerSwapRejected = ApplySwapRejection(Winner, WinnerAction, 0);
 
             if (!bWinnerSwapRejected)
             {
-                WinnerAction.ResolutionReason = FString::Printf(
-                    TEXT("Won contest for cell (%d,%d)"),
-                    Cell.X, Cell.Y);
+                WinnerAction.SetResolution(EResolutionReason::WonContest, Cell);
 
-                UE_LOG(LogConflictResolver, Log,
-                    TEXT("Winner for (%d,%d) is %s"),
-                    Cell.X, Cell.Y, *GetNameSafe(WinnerActorPtr));
+                ROGUE_DIAG_EVENT(Turn, LogConflictResolver, Log, TEXT("WonContest"), CurrentTurnId, WinnerActorPtr, Cell,
+                    *FString::Printf(TEXT("contenders=%d"), Contenders.Num()));
             }
 
             if (GridOccupancy)
@@ -586,7 +581,7 @@ TArray<FResolvedAction> UConflictResolverSubsystem::ResolveAllConflicts()
                 GridOccupancy->MarkReservationCommitted(WinnerActorPtr, CurrentTurnId);
             }
 
-            OptimisticActions.Add(WinnerAction);
+            OutActions.Add(MoveTemp(WinnerAction));
 
             // Losers → WAIT actions (or REROUTE)
             for (int32 i = 0; i < Contenders.Num(); ++i)
@@ -622,77 +617,23 @@ TArray<FResolvedAction> UConflictResolverSubsystem::ResolveAllConflicts()
                     LoserAction.AbilityTag      = WaitTag;
                     LoserAction.FinalAbilityTag = WaitTag;
 
-                    const bool bLoserSwapRejected = ApplySwapRejection(
-                        Loser,
-                        LoserAction,
-                        FString::Printf(
-                            TEXT("Conflict: Swap move forbidden (non-winning contender) at cell (%d,%d)"),
-                            Cell.X, Cell.Y));
+                    const bool bLoserSwapRejected = ApplySwapRejection(Loser, LoserAction, 1);
 
                     if (!bLoserSwapRejected && bAttackWonConflict && !Loser.AbilityTag.MatchesTag(AttackTag))
                     {
                         // In Sequential mode, MOVE lost to ATTACK.
-                        LoserAction.ResolutionReason = FString::Printf(
-                            TEXT("LostConflict: Cell (%d,%d) locked by attacker (Sequential)"),
-                            Cell.X, Cell.Y);
+                        LoserAction.SetResolution(EResolutionReason::LostToAttacker, Cell);
                     }
                     else if (!bLoserSwapRejected)
                     {
                         // Generic conflict loss (Simultaneous or Attack vs Attack).
-                        LoserAction.ResolutionReason = FString::Printf(
-                            TEXT("LostConflict: Cell (%d,%d) occupied by higher priority"),
-                            Cell.X, Cell.Y);
+                        LoserAction.SetResolution(EResolutionReason::LostToHigherPriority, Cell);
                     }
 
-                    OptimisticActions.Add(LoserAction);
+                    ROGUE_DIAG_EVENT(Turn, LogConflictResolver, Log, TEXT("LostContest"), CurrentTurnId, Loser.Actor, Cell,
+                        *FString::Printf(TEXT("reason=\"%s\""), *LoserAction.DescribeResolution()));
 
-                    UE_LOG(LogConflictResolver, Log,
-                        TEXT("Loser for (%d,%d) is %s, will wait. Reason: %s"),
-                        Cell.X, Cell.Y,
-                        *GetNameSafe(Loser.Actor),
-                        *LoserAction.ResolutionReason);
-                }
-                {
-                    FResolvedAction LoserAction;
-                    LoserAction.Actor        = Loser.Actor;
-                    LoserAction.SourceActor  = Loser.Actor;
-                    LoserAction.CurrentCell  = Loser.CurrentCell;
-                    LoserAction.NextCell     = Loser.CurrentCell; // stays in place
-                    LoserAction.bIsWait      = true;
-                    // For losers, the final behavior is WAIT; the original intent
-                    // is no longer relevant for movement resolution.
-                    LoserAction.AbilityTag      = WaitTag;
-                    LoserAction.FinalAbilityTag = WaitTag;
-
-                    const bool bLoserSwapRejected = ApplySwapRejection(
-                        Loser,
-                        LoserAction,
-                        FString::Printf(
-                            TEXT("Conflict: Swap move forbidden (non-winning contender) at cell (%d,%d)"),
-                            Cell.X, Cell.Y));
-
-                    if (!bLoserSwapRejected && bAttackWonConflict && !Loser.AbilityTag.MatchesTag(AttackTag))
-                    {
-                        // In Sequential mode, MOVE lost to ATTACK.
-                        LoserAction.ResolutionReason = FString::Printf(
-                            TEXT("LostConflict: Cell (%d,%d) locked by attacker (Sequential)"),
-                            Cell.X, Cell.Y);
-                    }
-                    else if (!bLoserSwapRejected)
-                    {
-                        // Generic conflict loss (Simultaneous or Attack vs Attack).
-                        LoserAction.ResolutionReason = FString::Printf(
-                            TEXT("LostConflict: Cell (%d,%d) occupied by higher priority"),
-                            Cell.X, Cell.Y);
-                    }
-
-                    OptimisticActions.Add(LoserAction);
-
-                    UE_LOG(LogConflictResolver, Log,
-                        TEXT("Loser for (%d,%d) is %s, will wait. Reason: %s"),
-                        Cell.X, Cell.Y,
-                        *GetNameSafe(Loser.Actor),
-                        *LoserAction.ResolutionReason);
+                    OutActions.Add(MoveTemp(LoserAction));
                 }
             }
         }
@@ -701,7 +642,7 @@ TArray<FResolvedAction> UConflictResolverSubsystem::ResolveAllConflicts()
     // ========================================================================
     // Phase C: Revalidation against stationary cells (Priority 2.1)
     //
-    // At this point, OptimisticActions is a 1:1 mapping from reservations to
+    // At this point, OutActions is a 1:1 mapping from reservations to
     // actions. However, some MOVE winners may be trying to enter a cell that
     // is effectively stationary (e.g., a WAIT result).
     //
@@ -725,7 +666,10 @@ TArray<FResolvedAction> UConflictResolverSubsystem::ResolveAllConflicts()
 
     bool bChanged = false;
     int32 IterationCount = 0;
-    const int32 MaxIterations = OptimisticActions.Num() + 2; // Safety cap
+    const int32 MaxIterations = OutActions.Num() + 2; // Safety cap
+
+    // Reused across iterations so the loop does not keep carving new arena ranges.
+    TTurnFrameSet<FIntPoint> StationaryCells;
 
     do
     {
@@ -733,8 +677,8 @@ TArray<FResolvedAction> UConflictResolverSubsystem::ResolveAllConflicts()
         IterationCount++;
 
         // 1. Collect all cells that are currently effectively stationary
-        TSet<FIntPoint> StationaryCells;
-        for (const FResolvedAction& Action : OptimisticActions)
+        StationaryCells.Reset();
+        for (const FResolvedAction& Action : OutActions)
         {
             // A stationary attack is defined as "attack that does not move"
             const bool bIsStationaryAttack =
@@ -747,12 +691,12 @@ TArray<FResolvedAction> UConflictResolverSubsystem::ResolveAllConflicts()
             }
         }
 
-        UE_LOG(LogConflictResolver, Verbose,
+        ROGUE_DIAG(Turn, LogConflictResolver, Verbose,
             TEXT("[ResolveAllConflicts] Phase C Iteration %d: %d stationary cells"),
             IterationCount, StationaryCells.Num());
 
         // 2. Check for moves into stationary cells
-        for (FResolvedAction& Action : OptimisticActions)
+        for (FResolvedAction& Action : OutActions)
         {
             if (Action.bIsWait)
             {
@@ -771,9 +715,8 @@ TArray<FResolvedAction> UConflictResolverSubsystem::ResolveAllConflicts()
                 {
                     AActor* ActorPtr = Action.Actor.Get();
 
-                    UE_LOG(LogConflictResolver, Warning,
-                        TEXT("[ResolveAllConflicts] Revalidation (Iter %d): %s move to (%d,%d) blocked by stationary unit"),
-                        IterationCount, *GetNameSafe(ActorPtr), TargetCell.X, TargetCell.Y);
+                    ROGUE_DIAG_EVENT(Turn, LogConflictResolver, Warning, TEXT("BlockedOnRevalidation"), CurrentTurnId, ActorPtr, TargetCell,
+                        *FString::Printf(TEXT("iteration=%d"), IterationCount));
 
                     bool bRerouted = false;
 
@@ -785,20 +728,7 @@ TArray<FResolvedAction> UConflictResolverSubsystem::ResolveAllConflicts()
                         Action.NextCell        = Action.CurrentCell;
                         Action.AbilityTag      = WaitTag;
                         Action.FinalAbilityTag = WaitTag;
-                        Action.ResolutionReason = FString::Printf(
-                            TEXT("LostConflict: Target cell (%d,%d) blocked by stationary unit (Revalidation Iter %d)"),
-                            TargetCell.X, TargetCell.Y, IterationCount);
-                        
-                        bChanged = true; // State changed, need another pass
-                    }
-                    {
-                        Action.bIsWait         = true;
-                        Action.NextCell        = Action.CurrentCell;
-                        Action.AbilityTag      = WaitTag;
-                        Action.FinalAbilityTag = WaitTag;
-                        Action.ResolutionReason = FString::Printf(
-                            TEXT("LostConflict: Target cell (%d,%d) blocked by stationary unit (Revalidation Iter %d)"),
-                            TargetCell.X, TargetCell.Y, IterationCount);
+                        Action.SetResolution(EResolutionReason::BlockedOnRevalidation, TargetCell, IterationCount);
                         
                         bChanged = true; // State changed, need another pass
                     }
@@ -815,34 +745,34 @@ TArray<FResolvedAction> UConflictResolverSubsystem::ResolveAllConflicts()
             MaxIterations);
     }
 
-    UE_LOG(LogConflictResolver, Log,
+    ROGUE_DIAG(Turn, LogConflictResolver, Log,
         TEXT("[ResolveAllConflicts] Generated %d final actions after %d iterations"),
-        OptimisticActions.Num(), IterationCount);
+        OutActions.Num(), IterationCount);
 
-    for (int32 i = 0; i < OptimisticActions.Num(); ++i)
+    if (ROGUE_DIAG_ACTIVE(Turn, LogConflictResolver, Verbose))
     {
-        const FResolvedAction& Action = OptimisticActions[i];
-        UE_LOG(LogConflictResolver, Verbose,
-            TEXT("[ResolvedAction %d] SourceActor=%s, Actor=%s, From=(%d,%d), To=(%d,%d), bIsWait=%d, Reason=\"%s\""),
-            i,
-            *GetNameSafe(Action.SourceActor),
-            *GetNameSafe(Action.Actor.Get()),
-            Action.CurrentCell.X, Action.CurrentCell.Y,
-            Action.NextCell.X, Action.NextCell.Y,
-            Action.bIsWait ? 1 : 0,
-            *Action.ResolutionReason);
+        for (int32 i = 0; i < OutActions.Num(); ++i)
+        {
+            const FResolvedAction& Action = OutActions[i];
+            UE_LOG(LogConflictResolver, Verbose,
+                TEXT("[ResolvedAction %d] SourceActor=%s, Actor=%s, From=(%d,%d), To=(%d,%d), bIsWait=%d, Reason=\"%s\""),
+                i,
+                *GetNameSafe(Action.SourceActor),
+                *GetNameSafe(Action.Actor.Get()),
+                Action.CurrentCell.X, Action.CurrentCell.Y,
+                Action.NextCell.X, Action.NextCell.Y,
+                Action.bIsWait ? 1 : 0,
+                *Action.DescribeResolution());
+        }
     }
 
-    // Use OptimisticActions as the final result
-    TArray<FResolvedAction>& FinalActions = OptimisticActions;
-
     // ========================================================================
     // CONTRACT (Priority 2): INVARIANT 1 - Intent Non-Disappearance
     //
     // The number of input reservations and output actions must match. This
     // guarantees that no intent silently disappears inside the resolver.
     // ========================================================================
-    const int32 NumResolved = FinalActions.Num();
+    const int32 NumResolved = OutActions.Num();
 
     checkf(
         NumReservations == NumResolved,
@@ -851,15 +781,19 @@ TArray<FResolvedAction> UConflictResolverSubsystem::ResolveAllConflicts()
         NumReservations, NumResolved
     );
 
-    UE_LOG(LogConflictResolver, Log,
+    ROGUE_DIAG(Turn, LogConflictResolver, Log,
         TEXT("[ResolveAllConflicts] END: Contract validated (%d reservations = %d actions)"),
         NumReservations, NumResolved);
-
-    return FinalActions;
 }
 
 // Stub implementation for this function, as it's in the header
 int32 UConflictResolverSubsystem::GetActionTier(const FGameplayTag& AbilityTag) const
+{
+    return GetActionTierForTag(AbilityTag);
+}
+
+// CodeRevision: INC-2025-1210-R2 (Planner and resolver rank movers from one priority source) (2025-12-26 10:00)
+int32 UConflictResolverSubsystem::GetActionTierForTag(const FGameplayTag& AbilityTag)
 {
     if (AbilityTag.MatchesTag(RogueGameplayTags::AI_Intent_Attack)) return 3;
     if (AbilityTag.MatchesTag(RogueGameplayTags::AI_Intent_Move))   return 1; // Dash etc. would sit between if needed.
@@ -867,6 +801,34 @@ int32 UConflictResolverSubsystem::GetActionTier(const FGameplayTag& AbilityTag)
     return 0;
 }
 
+int32 UConflictResolverSubsystem::ReadGenerationOrder(const AActor* Actor)
+{
+    static const FName GenName(TEXT("GenerationOrder"));
+
+    if (!Actor)
+    {
+        return TNumericLimits<int32>::Max();
+    }
+
+    if (const FIntProperty* Prop = FindFProperty<FIntProperty>(Actor->GetClass(), GenName))
+    {
+        if (const int32* ValuePtr = Prop->ContainerPtrToValuePtr<int32>(Actor))
+        {
+            const int32 Order = *ValuePtr;
+            return Order >= 0 ? Order : TNumericLimits<int32>::Max();
+        }
+    }
+
+    return TNumericLimits<int32>::Max();
+}
+
+void UConflictResolverSubsystem::AssignPriority(FReservationEntry& Entry)
+{
+    Entry.ActionTier = GetActionTierForTag(Entry.AbilityTag);
+    Entry.BasePriority = DefaultBasePriority;
+    Entry.GenerationOrder = ReadGenerationOrder(Entry.Actor.Get());
+}
+
 // CodeRevision: INC-2025-1125-R1 (Cache TurnManager to scope sequential checks)
 AGameTurnManagerBase* UConflictResolverSubsystem::ResolveTurnManager() const
 {
@@ -905,7 +867,7 @@ UGridOccupancySubsystem* UConflictResolverSubsystem::ResolveGridOccupancy() cons
 }
 
 // Priority 2.1: Helper to create a WAIT action from a reservation entry.
-// ResolutionReason must be filled by the caller.
+// The resolution reason must be filled by the caller.
 FResolvedAction UConflictResolverSubsystem::CreateWaitAction(const FReservationEntry& Entry)
 {
     FResolvedAction WaitAction;
@@ -917,6 +879,6 @@ FResolvedAction UConflictResolverSubsystem::CreateWaitAction(const FReservationE
     WaitAction.AbilityTag   = RogueGameplayTags::AI_Intent_Wait;
     WaitAction.FinalAbilityTag = RogueGameplayTags::AI_Intent_Wait;
 
-    // ResolutionReason is intentionally left empty here and must be set by caller.
+    // Reason is intentionally left as None here and must be set by caller.
     return WaitAction;
 }
@@ -46,7 +46,7 @@ public:
      *   1. Intent Non-Disappearance: Input reservation count MUST equal output action count.
      *      - Enforced by checkf() at function end to prevent silent intent loss
      *      - Every reservation becomes exactly one FResolvedAction (success, fallback, or wait)
-     *   2. ResolutionReason Completeness: All actions MUST have ResolutionReason set.
+     *   2. Reason Completeness: All actions MUST have a Reason code set (text via DescribeResolution()).
      *      - Explains why each action was resolved as-is (success, lost conflict, fallback, etc.)
      *      - Used for debugging and UI feedback
      *
@@ -58,7 +58,7 @@ public:
      *     - Move losers receive reason: "Cell locked by attacker (Sequential)"
      *   SIMULTANEOUS MODE (all MOVE entries):
      *     - No attack priority - all reservations are moves
-     *     - Winner selected by action tier priority or random tie-breaking
+     *     - Winner selected by action tier priority; exact ties keep registration order (no RNG)
      *     - Move losers receive reason: "Cell occupied by higher priority"
      *
      * @return Array of FResolvedAction, guaranteed to have same count as input reservations
@@ -66,12 +66,32 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Turn|Resolve")
     TArray<FResolvedAction> ResolveAllConflicts();
 
+    // CodeRevision: INC-2025-1214-R3 (No hidden arena fallback; resolve outputs filled into reused caller arrays) (2025-12-27 12:00)
+    /** C++ body of ResolveAllConflicts: resets OutActions and fills it, reusing its allocation. */
+    void ResolveAllConflictsInto(TArray<FResolvedAction>& OutActions);
+
     /**
      * 行動タグからTierを取得(Attack=3, Dash=2, Move=1, Wait=0)
      */
     UFUNCTION(BlueprintPure, Category = "Turn|Resolve")
     int32 GetActionTier(const FGameplayTag& AbilityTag) const;
 
+    // CodeRevision: INC-2025-1210-R2 (Planner and resolver rank movers from one priority source) (2025-12-26 10:00)
+    /** Base priority every AI reservation is registered with. */
+    static constexpr int32 DefaultBasePriority = 100;
+
+    static int32 GetActionTierForTag(const FGameplayTag& AbilityTag);
+
+    /** Blueprint "GenerationOrder" of Actor (MAX_int32 when absent or negative). */
+    static int32 ReadGenerationOrder(const AActor* Actor);
+
+    /**
+     * ActionTier / BasePriority / GenerationOrder of Entry from its AbilityTag and Actor.
+     * CoreResolveIntents and the cooperative planner both fill entries through this, so planned
+     * move order and resolver winners rank units the same way.
+     */
+    static void AssignPriority(FReservationEntry& Entry);
+
 private:
     // 予約テーブル: Key=(TimeSlot, Cell), Value=競争者リスト
     TMap<TPair<int32, FIntPoint>, TArray<FReservationEntry>> ReservationTable;
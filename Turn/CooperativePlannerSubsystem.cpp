@@ -0,0 +1,448 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+// CodeRevision: INC-2025-1210-R1 (Add WHCA* cooperative planner for enemy movement) (2025-12-14 10:00)
+#include "Turn/CooperativePlannerSubsystem.h"
+#include "Turn/DistanceFieldSubsystem.h"
+#include "Grid/GridPathfindingSubsystem.h"
+#include "Utility/GridUtils.h"
+#include "Utility/ProjectDiagnostics.h"  // CodeRevision: INC-2025-1210-R3 (2025-12-27 16:00)
+#include "Algo/Reverse.h"
+
+DEFINE_LOG_CATEGORY(LogCooperativePlanner);
+
+//-----------------------------------------------------------------------------
+// Console variables
+//-----------------------------------------------------------------------------
+
+// Cooperative (WHCA*) planning for enemy move intents
+static int32 GTS_Enemy_CooperativePlanning = 0;
+static FAutoConsoleVariableRef CVarTS_Enemy_CooperativePlanning(
+    TEXT("ts.Enemy.CooperativePlanning"),
+    GTS_Enemy_CooperativePlanning,
+    TEXT("Plan enemy moves with windowed cooperative A* (space-time reservations).\n")
+    TEXT("0: Off (default, per-enemy DistanceField step + ConflictResolver arbitration)\n")
+    TEXT("1: On  (collision-free multi-turn routes, resolver mostly confirms)"),
+    ECVF_Default
+);
+
+namespace CooperativePlannerPrivate
+{
+    // Same cost units as the DistanceField (straight=10, diagonal=14) so the field is an exact heuristic.
+    static constexpr int32 StraightCost = 10;
+    static constexpr int32 DiagonalCost = 14;
+    static constexpr int32 WaitCost     = 10;
+
+    static const FIntPoint StepDirs[] =
+    {
+        { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 },
+        { 1, 1 }, { 1, -1 }, { -1, 1 }, { -1, -1 }
+    };
+
+    struct FSpaceTimeNode
+    {
+        FIntPoint Cell;
+        int32 T = 0;
+        int32 G = 0;
+        int32 F = 0;
+        int32 Parent = INDEX_NONE;
+    };
+
+    struct FOpenEntry
+    {
+        int32 NodeIndex = INDEX_NONE;
+        int32 F = 0;
+        int32 T = 0;
+    };
+
+    struct FOpenEntryLess
+    {
+        bool operator()(const FOpenEntry& A, const FOpenEntry& B) const
+        {
+            // min-heap on F; prefer deeper nodes on ties so the search commits to a route
+            return (A.F != B.F) ? (A.F < B.F) : (A.T > B.T);
+        }
+    };
+}
+
+void UCooperativePlannerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    DistanceField = GetWorld()->GetSubsystem<UDistanceFieldSubsystem>();
+    PathFinder    = GetWorld()->GetSubsystem<UGridPathfindingSubsystem>();
+
+    UE_LOG(LogCooperativePlanner, Log, TEXT("[CoopPlanner] Initialized (Window=%d)"), PlanningWindow);
+}
+
+void UCooperativePlannerSubsystem::Deinitialize()
+{
+    Reservations.Empty();
+    LastRoutes.Empty();
+    Super::Deinitialize();
+}
+
+bool UCooperativePlannerSubsystem::IsCooperativePlanningEnabled()
+{
+    return GTS_Enemy_CooperativePlanning != 0;
+}
+
+//-----------------------------------------------------------------------------
+// Planning pass
+//-----------------------------------------------------------------------------
+
+int32 UCooperativePlannerSubsystem::PlanCooperativeRoutes(
+    const TArray<FReservationEntry>& Movers,
+    const FIntPoint& GoalCell,
+    const TSet<FIntPoint>& StaticBlocked,
+    TArray<FCooperativePlan>& OutPlans)
+{
+    Reservations.Reset();
+    LastRoutes.Reset();
+    OutPlans.Reset();
+    OutPlans.SetNum(Movers.Num());
+
+    // Subsystems may initialize in any order; refill lazily.
+    if (!DistanceField)
+    {
+        DistanceField = GetWorld()->GetSubsystem<UDistanceFieldSubsystem>();
+    }
+    if (!PathFinder)
+    {
+        PathFinder = GetWorld()->GetSubsystem<UGridPathfindingSubsystem>();
+    }
+
+    if (!DistanceField || !PathFinder)
+    {
+        UE_LOG(LogCooperativePlanner, Error,
+            TEXT("[CoopPlanner] Missing subsystems (DistanceField=%d, PathFinder=%d)"),
+            DistanceField != nullptr, PathFinder != nullptr);
+        return 0;
+    }
+
+    // Every mover holds its start cell at T=0; unplanned movers may still be there at T=1.
+    TSet<FIntPoint> UnplannedStarts;
+    TArray<int32> Order;
+    TArray<int32> StartDistances;
+    Order.Reserve(Movers.Num());
+    StartDistances.SetNumUninitialized(Movers.Num());
+
+    for (int32 Index = 0; Index < Movers.Num(); ++Index)
+    {
+        const FReservationEntry& Mover = Movers[Index];
+        Reservations.Add(MakeKey(Mover.CurrentCell, 0), Index);
+        UnplannedStarts.Add(Mover.CurrentCell);
+        StartDistances[Index] = Heuristic(Mover.CurrentCell);
+        Order.Add(Index);
+    }
+
+    Order.Sort([&Movers, &StartDistances](int32 A, int32 B)
+    {
+        if (HasHigherPriority(Movers[A], Movers[B], StartDistances[A], StartDistances[B]))
+        {
+            return true;
+        }
+        if (HasHigherPriority(Movers[B], Movers[A], StartDistances[B], StartDistances[A]))
+        {
+            return false;
+        }
+        return A < B;
+    });
+
+    int32 NumMoving = 0;
+    int32 NumFailed = 0;
+
+    for (const int32 MoverIndex : Order)
+    {
+        const FReservationEntry& Mover = Movers[MoverIndex];
+        FCooperativePlan& Plan = OutPlans[MoverIndex];
+        Plan.Actor = Mover.Actor;
+
+        UnplannedStarts.Remove(Mover.CurrentCell);
+
+        if (!PlanSingle(MoverIndex, Mover, GoalCell, StaticBlocked, UnplannedStarts, Plan))
+        {
+            // Hold position for the whole window so others route around us.
+            Plan.bFound = false;
+            Plan.Route.Init(Mover.CurrentCell, 1);
+            ++NumFailed;
+        }
+
+        ReserveRoute(MoverIndex, Plan.Route);
+        LastRoutes.Add(Mover.Actor.Get(), Plan.Route);
+
+        if (Plan.GetNextCell() != Mover.CurrentCell)
+        {
+            ++NumMoving;
+        }
+
+        ROGUE_DIAG(AI, LogCooperativePlanner, Verbose,
+            TEXT("[CoopPlanner] %s (%d,%d) -> (%d,%d) Found=%d RouteLen=%d"),
+            *GetNameSafe(Mover.Actor),
+            Mover.CurrentCell.X, Mover.CurrentCell.Y,
+            Plan.GetNextCell().X, Plan.GetNextCell().Y,
+            Plan.bFound ? 1 : 0, Plan.Route.Num());
+    }
+
+    // CodeRevision: INC-2025-1210-R3 (Per-turn planner summary behind the AI diagnostics channel) (2025-12-27 16:00)
+    ROGUE_DIAG(AI, LogCooperativePlanner, Log,
+        TEXT("[CoopPlanner] Planned %d movers toward (%d,%d): Moving=%d, Holding=%d, NoRoute=%d, Reservations=%d"),
+        Movers.Num(), GoalCell.X, GoalCell.Y,
+        NumMoving, Movers.Num() - NumMoving, NumFailed, Reservations.Num());
+
+    return NumMoving;
+}
+
+TArray<FIntPoint> UCooperativePlannerSubsystem::GetPlannedRoute(AActor* Actor) const
+{
+    if (const TArray<FIntPoint>* Route = LastRoutes.Find(Actor))
+    {
+        return *Route;
+    }
+    return TArray<FIntPoint>();
+}
+
+//-----------------------------------------------------------------------------
+// Ordering
+//-----------------------------------------------------------------------------
+
+bool UCooperativePlannerSubsystem::HasHigherPriority(
+    const FReservationEntry& A,
+    const FReservationEntry& B,
+    int32 DistA,
+    int32 DistB)
+{
+    if (A.ActionTier != B.ActionTier)
+    {
+        return A.ActionTier > B.ActionTier;
+    }
+    if (A.BasePriority != B.BasePriority)
+    {
+        return A.BasePriority > B.BasePriority;
+    }
+
+    // Front-line units plan first so units queued behind them can follow into vacated cells.
+    if (DistA != DistB)
+    {
+        return DistA < DistB;
+    }
+    if (A.DistanceReduction != B.DistanceReduction)
+    {
+        return A.DistanceReduction > B.DistanceReduction;
+    }
+    return A.GenerationOrder < B.GenerationOrder;
+}
+
+//-----------------------------------------------------------------------------
+// Single-mover space-time A*
+//-----------------------------------------------------------------------------
+
+bool UCooperativePlannerSubsystem::PlanSingle(
+    int32 MoverIndex,
+    const FReservationEntry& Mover,
+    const FIntPoint& GoalCell,
+    const TSet<FIntPoint>& StaticBlocked,
+    const TSet<FIntPoint>& UnplannedStarts,
+    FCooperativePlan& OutPlan) const
+{
+    using namespace CooperativePlannerPrivate;
+
+    const FIntPoint Start = Mover.CurrentCell;
+    const int32 StartH = Heuristic(Start);
+    if (StartH == TNumericLimits<int32>::Max())
+    {
+        // Not covered by the distance field; let the greedy path handle it.
+        return false;
+    }
+
+    const int32 Window = FMath::Max(1, PlanningWindow);
+
+    auto IsGoal = [&GoalCell](const FIntPoint& Cell)
+    {
+        return FGridUtils::ChebyshevDistance(Cell, GoalCell) <= 1;
+    };
+
+    // A mover at the goal stops there; it must be able to hold the cell until the window ends.
+    auto CanHoldUntilWindowEnd = [&](const FIntPoint& Cell, int32 FromT)
+    {
+        for (int32 T = FromT + 1; T <= Window; ++T)
+        {
+            if (!IsFree(Cell, T, MoverIndex))
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    auto IsBlockedAt = [&](const FIntPoint& Cell, int32 T)
+    {
+        if (StaticBlocked.Contains(Cell) || Cell == GoalCell)
+        {
+            return true;
+        }
+        // Movers that have not been planned yet may still be standing on their start cell.
+        if (T == 1 && Cell != Start && UnplannedStarts.Contains(Cell))
+        {
+            return true;
+        }
+        return !IsFree(Cell, T, MoverIndex);
+    };
+
+    TArray<FSpaceTimeNode> Nodes;
+    TArray<FOpenEntry> Open;
+    TSet<FIntVector> Closed;
+    Nodes.Reserve(256);
+    Open.Reserve(256);
+
+    Nodes.Add({ Start, 0, 0, StartH, INDEX_NONE });
+    Open.HeapPush({ 0, StartH, 0 }, FOpenEntryLess{});
+
+    int32 Expansions = 0;
+    int32 TerminalIndex = INDEX_NONE;
+
+    while (Open.Num() > 0)
+    {
+        FOpenEntry Entry;
+        Open.HeapPop(Entry, FOpenEntryLess{});
+
+        const FSpaceTimeNode Current = Nodes[Entry.NodeIndex];
+        const FIntVector Key = MakeKey(Current.Cell, Current.T);
+        if (Closed.Contains(Key))
+        {
+            continue;
+        }
+        Closed.Add(Key);
+
+        if (Current.T >= Window || (IsGoal(Current.Cell) && CanHoldUntilWindowEnd(Current.Cell, Current.T)))
+        {
+            TerminalIndex = Entry.NodeIndex;
+            break;
+        }
+
+        if (++Expansions > MaxExpansionsPerMover)
+        {
+            UE_LOG(LogCooperativePlanner, Warning,
+                TEXT("[CoopPlanner] %s expansion limit reached (%d)"),
+                *GetNameSafe(Mover.Actor), MaxExpansionsPerMover);
+            break;
+        }
+
+        const int32 NextT = Current.T + 1;
+
+        auto PushSuccessor = [&](const FIntPoint& Next, int32 StepCost)
+        {
+            if (Closed.Contains(MakeKey(Next, NextT)))
+            {
+                return;
+            }
+            const int32 H = Heuristic(Next);
+            if (H == TNumericLimits<int32>::Max())
+            {
+                return;
+            }
+            const int32 G = Current.G + StepCost;
+            const int32 NodeIndex = Nodes.Add({ Next, NextT, G, G + H, Entry.NodeIndex });
+            Open.HeapPush({ NodeIndex, G + H, NextT }, FOpenEntryLess{});
+        };
+
+        // Wait in place
+        if (!IsBlockedAt(Current.Cell, NextT))
+        {
+            PushSuccessor(Current.Cell, WaitCost);
+        }
+
+        for (const FIntPoint& Dir : StepDirs)
+        {
+            const FIntPoint Next = Current.Cell + Dir;
+
+            if (!CanStep(Current.Cell, Next))
+            {
+                continue;
+            }
+            if (IsBlockedAt(Next, NextT) || IsSwap(Current.Cell, Next, Current.T, MoverIndex))
+            {
+                continue;
+            }
+
+            const bool bDiagonal = (Dir.X != 0 && Dir.Y != 0);
+            PushSuccessor(Next, bDiagonal ? DiagonalCost : StraightCost);
+        }
+    }
+
+    if (TerminalIndex == INDEX_NONE)
+    {
+        return false;
+    }
+
+    // Reconstruct Route[0..T]
+    OutPlan.Route.Reset();
+    for (int32 NodeIndex = TerminalIndex; NodeIndex != INDEX_NONE; NodeIndex = Nodes[NodeIndex].Parent)
+    {
+        OutPlan.Route.Add(Nodes[NodeIndex].Cell);
+    }
+    Algo::Reverse(OutPlan.Route);
+    OutPlan.bFound = true;
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Reservation table helpers
+//-----------------------------------------------------------------------------
+
+bool UCooperativePlannerSubsystem::IsFree(const FIntPoint& Cell, int32 T, int32 MoverIndex) const
+{
+    const int32* Owner = Reservations.Find(MakeKey(Cell, T));
+    return !Owner || *Owner == MoverIndex;
+}
+
+bool UCooperativePlannerSubsystem::IsSwap(const FIntPoint& From, const FIntPoint& To, int32 T, int32 MoverIndex) const
+{
+    // Head-on swap: someone at To at T moves into From at T+1.
+    const int32* OwnerAtTo = Reservations.Find(MakeKey(To, T));
+    if (!OwnerAtTo || *OwnerAtTo == MoverIndex)
+    {
+        return false;
+    }
+    const int32* OwnerAtFromNext = Reservations.Find(MakeKey(From, T + 1));
+    return OwnerAtFromNext && *OwnerAtFromNext == *OwnerAtTo;
+}
+
+bool UCooperativePlannerSubsystem::CanStep(const FIntPoint& From, const FIntPoint& To) const
+{
+    if (!PathFinder->IsCellWalkableIgnoringActor(To, nullptr))
+    {
+        return false;
+    }
+
+    // Same corner rule as UGridPathfindingSubsystem::IsMoveValid: both shoulders must be walkable.
+    const FIntPoint Delta = To - From;
+    if (Delta.X != 0 && Delta.Y != 0)
+    {
+        return PathFinder->IsCellWalkableIgnoringActor(From + FIntPoint(Delta.X, 0), nullptr) &&
+               PathFinder->IsCellWalkableIgnoringActor(From + FIntPoint(0, Delta.Y), nullptr);
+    }
+    return true;
+}
+
+int32 UCooperativePlannerSubsystem::Heuristic(const FIntPoint& Cell) const
+{
+    const int32 Dist = DistanceField->GetDistance(Cell);
+    return Dist >= 0 ? Dist : TNumericLimits<int32>::Max();
+}
+
+void UCooperativePlannerSubsystem::ReserveRoute(int32 MoverIndex, const TArray<FIntPoint>& Route)
+{
+    const int32 Window = FMath::Max(1, PlanningWindow);
+
+    for (int32 T = 0; T < Route.Num(); ++T)
+    {
+        Reservations.Add(MakeKey(Route[T], T), MoverIndex);
+    }
+
+    // The mover rests on its last cell until the window closes.
+    const FIntPoint Last = Route.Last();
+    for (int32 T = Route.Num(); T <= Window; ++T)
+    {
+        Reservations.Add(MakeKey(Last, T), MoverIndex);
+    }
+}
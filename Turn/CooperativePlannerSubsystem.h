@@ -0,0 +1,128 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "TurnSystemTypes.h"
+#include "CooperativePlannerSubsystem.generated.h"
+
+// Log category
+DECLARE_LOG_CATEGORY_EXTERN(LogCooperativePlanner, Log, All);
+
+class UDistanceFieldSubsystem;
+class UGridPathfindingSubsystem;
+
+/**
+ * Result of one cooperative planning pass for a single mover.
+ */
+USTRUCT(BlueprintType)
+struct LYRAGAME_API FCooperativePlan
+{
+    GENERATED_BODY()
+
+    // Actor the route was planned for
+    UPROPERTY(BlueprintReadOnly, Category = "Planner")
+    TWeakObjectPtr<AActor> Actor;
+
+    // Route in grid cells, index = time step (Route[0] is the start cell)
+    UPROPERTY(BlueprintReadOnly, Category = "Planner")
+    TArray<FIntPoint> Route;
+
+    // False if no collision-free route was found inside the window (actor holds its cell)
+    UPROPERTY(BlueprintReadOnly, Category = "Planner")
+    bool bFound = false;
+
+    /** Cell to occupy after the first step (start cell when waiting). */
+    FIntPoint GetNextCell() const
+    {
+        return Route.Num() > 1 ? Route[1] : (Route.Num() == 1 ? Route[0] : FIntPoint(-1, -1));
+    }
+};
+
+/**
+ * UCooperativePlannerSubsystem: Windowed Hierarchical Cooperative A* (WHCA*) for enemy movement.
+ *
+ * - Movers are planned one by one in FReservationEntry priority order.
+ * - Each plan is a space-time A* over (Cell, Turn) limited to PlanningWindow turns.
+ * - The DistanceField (Dijkstra from the player) is used as the abstract "true distance"
+ *   heuristic, which is what makes the search hierarchical.
+ * - Planned routes are written into a space-time reservation table so lower-priority movers
+ *   route around them (vertex conflicts and head-on swaps are both excluded).
+ *
+ * The result is a set of next steps that the ConflictResolver can confirm instead of arbitrate.
+ * Enabled via ts.Enemy.CooperativePlanning; the per-enemy greedy path is kept as the default.
+ */
+UCLASS()
+class LYRAGAME_API UCooperativePlannerSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    /** True when ts.Enemy.CooperativePlanning is enabled. */
+    static bool IsCooperativePlanningEnabled();
+
+    /**
+     * Plan collision-free routes for all movers.
+     *
+     * @param Movers        One reservation per mover; CurrentCell = start, priority fields are used for ordering
+     * @param GoalCell      Player cell the movers approach (never entered)
+     * @param StaticBlocked Cells held for the whole window (attackers, stationary units, the player)
+     * @param OutPlans      One plan per mover, in the same order as Movers
+     * @return Number of movers whose planned first step is a real move
+     */
+    int32 PlanCooperativeRoutes(
+        const TArray<FReservationEntry>& Movers,
+        const FIntPoint& GoalCell,
+        const TSet<FIntPoint>& StaticBlocked,
+        TArray<FCooperativePlan>& OutPlans);
+
+    /** Route planned for Actor in the last pass (empty if none). */
+    UFUNCTION(BlueprintPure, Category = "Turn|Planner")
+    TArray<FIntPoint> GetPlannedRoute(AActor* Actor) const;
+
+    /** Number of turns each route looks ahead. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Turn|Planner", meta = (ClampMin = 1, ClampMax = 16))
+    int32 PlanningWindow = 4;
+
+    /** Upper bound for expanded space-time nodes per mover (freeze protection). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Turn|Planner", meta = (ClampMin = 64))
+    int32 MaxExpansionsPerMover = 2048;
+
+private:
+    // Space-time key: (X, Y, Turn)
+    static FORCEINLINE FIntVector MakeKey(const FIntPoint& Cell, int32 T) { return FIntVector(Cell.X, Cell.Y, T); }
+
+    /** Planner ordering derived from reservation priorities (higher first). */
+    static bool HasHigherPriority(const FReservationEntry& A, const FReservationEntry& B, int32 DistA, int32 DistB);
+
+    bool PlanSingle(
+        int32 MoverIndex,
+        const FReservationEntry& Mover,
+        const FIntPoint& GoalCell,
+        const TSet<FIntPoint>& StaticBlocked,
+        const TSet<FIntPoint>& UnplannedStarts,
+        FCooperativePlan& OutPlan) const;
+
+    bool IsFree(const FIntPoint& Cell, int32 T, int32 MoverIndex) const;
+    bool IsSwap(const FIntPoint& From, const FIntPoint& To, int32 T, int32 MoverIndex) const;
+    bool CanStep(const FIntPoint& From, const FIntPoint& To) const;
+    int32 Heuristic(const FIntPoint& Cell) const;
+
+    void ReserveRoute(int32 MoverIndex, const TArray<FIntPoint>& Route);
+
+    // Space-time reservation table: (X, Y, T) -> mover index
+    TMap<FIntVector, int32> Reservations;
+
+    // Routes from the last planning pass (debug / inspection)
+    TMap<TWeakObjectPtr<AActor>, TArray<FIntPoint>> LastRoutes;
+
+    UPROPERTY(Transient)
+    TObjectPtr<UDistanceFieldSubsystem> DistanceField = nullptr;
+
+    UPROPERTY(Transient)
+    TObjectPtr<UGridPathfindingSubsystem> PathFinder = nullptr;
+};
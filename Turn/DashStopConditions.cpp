@@ -2,10 +2,11 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "DashStopConditions.h"
+#include "Turn/DashStopMaskSubsystem.h"
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
-#include "Kismet/GameplayStatics.h"
 
+// CodeRevision: INC-2025-1219-R1 (Evaluate dashes with one masked ray scan over per-turn bit planes) (2025-12-17 14:00)
 int32 UDashStopEvaluator::CalculateAllowedDashSteps(
     AActor* Actor,
     const FIntPoint& StartCell,
@@ -19,79 +20,47 @@ int32 UDashStopEvaluator::CalculateAllowedDashSteps(
     }
 
     UWorld* World = Actor->GetWorld();
-    if (!World)
+    UDashStopMaskSubsystem* Masks = World ? World->GetSubsystem<UDashStopMaskSubsystem>() : nullptr;
+    if (!Masks)
     {
         return 0;
     }
 
-    // �����o�H���擾
-    TArray<FIntPoint> Path = GetLinePath(StartCell, TargetCell, ProposedK);
+    // Same ray as GetLinePath: 8-way direction towards the target, ending early on the target.
+    const FIntPoint Delta = TargetCell - StartCell;
+    const FIntPoint Direction(FMath::Clamp(Delta.X, -1, 1), FMath::Clamp(Delta.Y, -1, 1));
 
-    // �e�^�C��Œ�~�������`�F�b�N
-    for (int32 t = 0; t < Path.Num(); ++t)
+    int32 MaxSteps = FMath::Min(ProposedK, FMath::Max(1, Config.MaxDashDistance));
+    const int32 TargetDistance = FMath::Max(FMath::Abs(Delta.X), FMath::Abs(Delta.Y));
+    if (StartCell + Direction * TargetDistance == TargetCell)
     {
-        const FIntPoint& CurrentCell = Path[t];
-
-        // �G�אڃ`�F�b�N
-        if (Config.bStopOnEnemyAdjacent && HasAdjacentEnemy(CurrentCell, World))
-        {
-            UE_LOG(LogTemp, Log, TEXT("[DashStop] Stopped at step %d (EnemyAdjacent)"), t + 1);
-            return t + 1;
-        }
-
-        // �댯�^�C��`�F�b�N
-        if (Config.bStopOnDangerTile && IsDangerTile(CurrentCell, World))
-        {
-            UE_LOG(LogTemp, Log, TEXT("[DashStop] Stopped at step %d (DangerTile)"), t);
-            return FMath::Max(0, t);
-        }
-
-        // ��Q���`�F�b�N
-        if (Config.bStopOnObstacle && IsObstacle(CurrentCell, World))
-        {
-            UE_LOG(LogTemp, Log, TEXT("[DashStop] Stopped at step %d (Obstacle)"), t);
-            return FMath::Max(0, t);
-        }
+        MaxSteps = FMath::Min(MaxSteps, TargetDistance);
     }
 
-    // ��~�����ɊY�����Ȃ��ꍇ�͒�Ēʂ�
-    return ProposedK;
+    const int32 Allowed = Masks->ScanDash(StartCell, Direction, MaxSteps, Config);
+    if (Allowed < MaxSteps)
+    {
+        UE_LOG(LogTemp, Verbose, TEXT("[DashStop] Stopped after %d/%d steps"), Allowed, MaxSteps);
+    }
+    return Allowed;
 }
 
 bool UDashStopEvaluator::HasAdjacentEnemy(const FIntPoint& Cell, UWorld* World)
 {
-    if (!World)
-    {
-        return false;
-    }
-
-    // TODO: Phase 3�㔼�Ŏ���
-    // 8�����̗אڃ}�X�ɓG�����邩�`�F�b�N
-    return false;
+    UDashStopMaskSubsystem* Masks = World ? World->GetSubsystem<UDashStopMaskSubsystem>() : nullptr;
+    return Masks && Masks->IsEnemyAdjacent(Cell);
 }
 
 bool UDashStopEvaluator::IsDangerTile(const FIntPoint& Cell, UWorld* World)
 {
-    if (!World)
-    {
-        return false;
-    }
-
-    // TODO: Phase 3�㔼�Ŏ���
-    // �댯�^�C��i㩁A�n�ⓙ�j�̔���
-    return false;
+    UDashStopMaskSubsystem* Masks = World ? World->GetSubsystem<UDashStopMaskSubsystem>() : nullptr;
+    return Masks && Masks->IsDanger(Cell);
 }
 
 bool UDashStopEvaluator::IsObstacle(const FIntPoint& Cell, UWorld* World)
 {
-    if (!World)
-    {
-        return false;
-    }
-
-    // TODO: Phase 3�㔼�Ŏ���
-    // ��Q���i�ǁA�����j�̔���
-    return false;
+    UDashStopMaskSubsystem* Masks = World ? World->GetSubsystem<UDashStopMaskSubsystem>() : nullptr;
+    return Masks && Masks->IsBlocked(Cell);
 }
 
 TArray<FIntPoint> UDashStopEvaluator::GetLinePath(
@@ -0,0 +1,250 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+// CodeRevision: INC-2025-1219-R1 (Per-turn dash stop bitmasks) (2025-12-17 14:00)
+#include "Turn/DashStopMaskSubsystem.h"
+#include "Turn/TurnFlowCoordinator.h"
+#include "Turn/UnitTurnStateSubsystem.h"
+#include "Grid/GridPathfindingSubsystem.h"
+#include "Grid/GridOccupancySubsystem.h"
+#include "Grid/URogueDungeonSubsystem.h"
+#include "Engine/World.h"
+
+DEFINE_LOG_CATEGORY(LogDashStopMask);
+
+void UDashStopMaskSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    // The danger layer belongs to one floor.
+    if (URogueDungeonSubsystem* DungeonSys = Collection.InitializeDependency<URogueDungeonSubsystem>())
+    {
+        DungeonSys->OnGridReady.AddDynamic(this, &UDashStopMaskSubsystem::HandleGridReady);
+    }
+
+    UE_LOG(LogDashStopMask, Log, TEXT("[DashStopMask] Initialized"));
+}
+
+void UDashStopMaskSubsystem::Deinitialize()
+{
+    if (UWorld* World = GetWorld())
+    {
+        if (URogueDungeonSubsystem* DungeonSys = World->GetSubsystem<URogueDungeonSubsystem>())
+        {
+            DungeonSys->OnGridReady.RemoveDynamic(this, &UDashStopMaskSubsystem::HandleGridReady);
+        }
+    }
+
+    Super::Deinitialize();
+}
+
+void UDashStopMaskSubsystem::HandleGridReady(URogueDungeonSubsystem* InDungeonSys)
+{
+    DangerTiles.Reset();
+    bMasksDirty = true;
+}
+
+void UDashStopMaskSubsystem::SetDangerTile(const FIntPoint& Cell, bool bDanger)
+{
+    const bool bChanged = bDanger ? !DangerTiles.Contains(Cell) : DangerTiles.Contains(Cell);
+    if (!bChanged)
+    {
+        return;
+    }
+
+    if (bDanger)
+    {
+        DangerTiles.Add(Cell);
+    }
+    else
+    {
+        DangerTiles.Remove(Cell);
+    }
+
+    // Patch the current plane directly so a layer change does not cost a full rebuild.
+    if (!bMasksDirty && IsInGrid(Cell) && DangerMask.Num() == Width * Height)
+    {
+        DangerMask[ToIndex(Cell)] = bDanger;
+    }
+}
+
+void UDashStopMaskSubsystem::ClearDangerTiles()
+{
+    DangerTiles.Reset();
+    bMasksDirty = true;
+}
+
+//------------------------------------------------------------------------------
+// Queries
+//------------------------------------------------------------------------------
+
+bool UDashStopMaskSubsystem::IsBlocked(const FIntPoint& Cell)
+{
+    EnsureMasks();
+    return !IsInGrid(Cell) || BlockedMask[ToIndex(Cell)];
+}
+
+bool UDashStopMaskSubsystem::IsDanger(const FIntPoint& Cell)
+{
+    EnsureMasks();
+    return IsInGrid(Cell) && DangerMask[ToIndex(Cell)];
+}
+
+bool UDashStopMaskSubsystem::IsEnemyAdjacent(const FIntPoint& Cell)
+{
+    EnsureMasks();
+    return IsInGrid(Cell) && EnemyAdjacentMask[ToIndex(Cell)];
+}
+
+int32 UDashStopMaskSubsystem::ScanDash(const FIntPoint& Start, const FIntPoint& Direction, int32 MaxSteps, const FDashStopConfig& Config)
+{
+    EnsureMasks();
+
+    const FIntPoint Step(FMath::Clamp(Direction.X, -1, 1), FMath::Clamp(Direction.Y, -1, 1));
+    if (MaxSteps <= 0 || Step == FIntPoint::ZeroValue || Width == 0 || Height == 0)
+    {
+        return 0;
+    }
+
+    // Clip the ray to the grid once so the loop only needs the flat index.
+    int32 Steps = MaxSteps;
+    if (Step.X > 0) { Steps = FMath::Min(Steps, Width - 1 - Start.X); }
+    if (Step.X < 0) { Steps = FMath::Min(Steps, Start.X); }
+    if (Step.Y > 0) { Steps = FMath::Min(Steps, Height - 1 - Start.Y); }
+    if (Step.Y < 0) { Steps = FMath::Min(Steps, Start.Y); }
+    if (!IsInGrid(Start) || Steps <= 0)
+    {
+        return 0;
+    }
+
+    const int32 Stride = Step.Y * Width + Step.X;
+    int32 Index = ToIndex(Start);
+
+    for (int32 StepIndex = 0; StepIndex < Steps; ++StepIndex)
+    {
+        Index += Stride;
+
+        if ((Config.bStopOnObstacle && BlockedMask[Index]) || (Config.bStopOnDangerTile && DangerMask[Index]))
+        {
+            return StepIndex;
+        }
+
+        if (Config.bStopOnEnemyAdjacent && EnemyAdjacentMask[Index])
+        {
+            return StepIndex + 1;
+        }
+    }
+
+    // Without obstacle stops the ray may run off the grid; it still ends at the edge.
+    return Steps;
+}
+
+//------------------------------------------------------------------------------
+// Rebuild
+//------------------------------------------------------------------------------
+
+void UDashStopMaskSubsystem::EnsureMasks()
+{
+    UWorld* World = GetWorld();
+    const UGridPathfindingSubsystem* PathFinder = World ? World->GetSubsystem<UGridPathfindingSubsystem>() : nullptr;
+    const UGridOccupancySubsystem* Occupancy = World ? World->GetSubsystem<UGridOccupancySubsystem>() : nullptr;
+    const UTurnFlowCoordinator* TFC = World ? World->GetSubsystem<UTurnFlowCoordinator>() : nullptr;
+
+    int32 GridWidth = 0;
+    int32 GridHeight = 0;
+    int32 TileSize = 0;
+    if (PathFinder && PathFinder->IsInitialized())
+    {
+        PathFinder->GetGridInfo(GridWidth, GridHeight, TileSize);
+    }
+
+    const int32 TurnId = TFC ? TFC->GetCurrentTurnId() : INDEX_NONE;
+    if (!bMasksDirty && TurnId == MasksTurnId && GridWidth == Width && GridHeight == Height)
+    {
+        return;
+    }
+
+    Width = GridWidth;
+    Height = GridHeight;
+    MasksTurnId = TurnId;
+    bMasksDirty = false;
+
+    const int32 NumCells = Width * Height;
+    BlockedMask.Init(false, NumCells);
+    DangerMask.Init(false, NumCells);
+    EnemyAdjacentMask.Init(false, NumCells);
+
+    if (NumCells == 0)
+    {
+        return;
+    }
+
+    // Walkability plane
+    for (int32 Y = 0; Y < Height; ++Y)
+    {
+        for (int32 X = 0; X < Width; ++X)
+        {
+            if (PathFinder->GetGridCost(X, Y) < 0)
+            {
+                BlockedMask[Y * Width + X] = true;
+            }
+        }
+    }
+
+    // Occupancy
+    if (Occupancy)
+    {
+        for (const TPair<FIntPoint, TWeakObjectPtr<AActor>>& Pair : Occupancy->GetOccupiedCellMap())
+        {
+            if (Pair.Value.IsValid() && IsInGrid(Pair.Key))
+            {
+                BlockedMask[ToIndex(Pair.Key)] = true;
+            }
+        }
+    }
+
+    // Danger layer
+    for (const FIntPoint& Cell : DangerTiles)
+    {
+        if (IsInGrid(Cell))
+        {
+            DangerMask[ToIndex(Cell)] = true;
+        }
+    }
+
+    // Enemy adjacency: dilate every enemy cell by one in all 8 directions
+    int32 NumEnemies = 0;
+    const UUnitTurnStateSubsystem* UnitState = World->GetSubsystem<UUnitTurnStateSubsystem>();
+    if (UnitState && Occupancy)
+    {
+        for (const TWeakObjectPtr<AActor>& EnemyRef : UnitState->GetCachedEnemyRefs())
+        {
+            AActor* Enemy = EnemyRef.Get();
+            if (!IsValid(Enemy))
+            {
+                continue;
+            }
+
+            const FIntPoint EnemyCell = Occupancy->GetCellOfActor(Enemy);
+            if (!IsInGrid(EnemyCell))
+            {
+                continue;
+            }
+            ++NumEnemies;
+
+            const int32 MinX = FMath::Max(0, EnemyCell.X - 1);
+            const int32 MaxX = FMath::Min(Width - 1, EnemyCell.X + 1);
+            const int32 MinY = FMath::Max(0, EnemyCell.Y - 1);
+            const int32 MaxY = FMath::Min(Height - 1, EnemyCell.Y + 1);
+            for (int32 Y = MinY; Y <= MaxY; ++Y)
+            {
+                for (int32 X = MinX; X <= MaxX; ++X)
+                {
+                    EnemyAdjacentMask[Y * Width + X] = true;
+                }
+            }
+        }
+    }
+
+    UE_LOG(LogDashStopMask, Verbose, TEXT("[DashStopMask] Rebuilt for turn %d (%dx%d, Enemies=%d, DangerTiles=%d)"),
+        TurnId, Width, Height, NumEnemies, DangerTiles.Num());
+}
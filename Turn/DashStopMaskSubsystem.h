@@ -0,0 +1,85 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+// CodeRevision: INC-2025-1219-R1 (Per-turn dash stop bitmasks) (2025-12-17 14:00)
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Containers/BitArray.h"
+#include "Turn/TurnSystemTypes.h"
+#include "DashStopMaskSubsystem.generated.h"
+
+// Log category
+DECLARE_LOG_CATEGORY_EXTERN(LogDashStopMask, Log, All);
+
+class URogueDungeonSubsystem;
+
+/**
+ * UDashStopMaskSubsystem: grid-sized bit planes behind UDashStopEvaluator.
+ *
+ * Planes (index = Y * Width + X, rebuilt lazily once per turn):
+ * - Blocked:       non-walkable terrain or an occupied cell
+ * - Danger:        copy of the persistent danger layer (SetDangerTile)
+ * - EnemyAdjacent: enemy cells dilated by one cell in all 8 directions
+ *
+ * ScanDash walks a ray over these planes with a flat index stride instead of looking up
+ * subsystems per cell. Call InvalidateMasks after mid-turn board changes that dashes must see.
+ */
+UCLASS()
+class LYRAGAME_API UDashStopMaskSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    /** Mark or clear a danger tile (trap, hazard). Persists until the floor changes. */
+    UFUNCTION(BlueprintCallable, Category = "Turn|Dash")
+    void SetDangerTile(const FIntPoint& Cell, bool bDanger);
+
+    /** Drop every danger tile. */
+    UFUNCTION(BlueprintCallable, Category = "Turn|Dash")
+    void ClearDangerTiles();
+
+    /** Force the next query to rebuild the per-turn planes. */
+    UFUNCTION(BlueprintCallable, Category = "Turn|Dash")
+    void InvalidateMasks() { bMasksDirty = true; }
+
+    bool IsBlocked(const FIntPoint& Cell);
+    bool IsDanger(const FIntPoint& Cell);
+    bool IsEnemyAdjacent(const FIntPoint& Cell);
+
+    /**
+     * Number of steps (0..MaxSteps) that can be taken from Start along Direction (each component
+     * in -1..1) before a stop condition enabled in Config triggers. Blocked and danger cells stop
+     * before the cell; enemy adjacency stops on it. Leaving the grid counts as blocked.
+     */
+    int32 ScanDash(const FIntPoint& Start, const FIntPoint& Direction, int32 MaxSteps, const FDashStopConfig& Config);
+
+private:
+    /** Rebuild the per-turn planes when the turn, grid size or dirty flag changed. */
+    void EnsureMasks();
+
+    FORCEINLINE bool IsInGrid(const FIntPoint& Cell) const
+    {
+        return Cell.X >= 0 && Cell.Y >= 0 && Cell.X < Width && Cell.Y < Height;
+    }
+
+    FORCEINLINE int32 ToIndex(const FIntPoint& Cell) const { return Cell.Y * Width + Cell.X; }
+
+    UFUNCTION()
+    void HandleGridReady(URogueDungeonSubsystem* InDungeonSys);
+
+    int32 Width = 0;
+    int32 Height = 0;
+    int32 MasksTurnId = INDEX_NONE;
+    bool bMasksDirty = true;
+
+    TBitArray<> BlockedMask;
+    TBitArray<> DangerMask;
+    TBitArray<> EnemyAdjacentMask;
+
+    // Persistent danger layer (cells), folded into DangerMask on rebuild
+    TSet<FIntPoint> DangerTiles;
+};
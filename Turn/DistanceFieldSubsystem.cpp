@@ -5,6 +5,7 @@
 #include "../Grid/GridOccupancySubsystem.h"
 #include "../Grid/GridPathfindingSubsystem.h"
 #include "../Utility/ProjectDiagnostics.h"  // DIAG_LOG, diagnostic helpers
+#include "TurnProfilerSubsystem.h"  // CodeRevision: INC-2025-1230-R1 (2025-12-23 10:00)
 #include "EngineUtils.h"
 #include "Kismet/GameplayStatics.h"
 
@@ -68,6 +69,46 @@ void UDistanceFieldSubsystem::Deinitialize()
     Super::Deinitialize();
 }
 
+//-----------------------------------------------------------------------------
+// Snapshots
+//-----------------------------------------------------------------------------
+
+// CodeRevision: INC-2025-1217-R1 (Field snapshots for speculative enemy planning) (2025-12-16 14:00)
+void UDistanceFieldSubsystem::CaptureSnapshot(FFieldSnapshot& OutSnapshot) const
+{
+    OutSnapshot.DistanceMap = DistanceMap;
+    OutSnapshot.NextStepMap = NextStepMap;
+    OutSnapshot.PlayerPosition = PlayerPosition;
+    OutSnapshot.Bounds = Bounds;
+}
+
+void UDistanceFieldSubsystem::ExtractSnapshot(FFieldSnapshot& OutSnapshot)
+{
+    OutSnapshot.DistanceMap = MoveTemp(DistanceMap);
+    OutSnapshot.NextStepMap = MoveTemp(NextStepMap);
+    OutSnapshot.PlayerPosition = PlayerPosition;
+    OutSnapshot.Bounds = Bounds;
+
+    DistanceMap.Reset();
+    NextStepMap.Reset();
+}
+
+void UDistanceFieldSubsystem::RestoreSnapshot(const FFieldSnapshot& Snapshot)
+{
+    DistanceMap = Snapshot.DistanceMap;
+    NextStepMap = Snapshot.NextStepMap;
+    PlayerPosition = Snapshot.PlayerPosition;
+    Bounds = Snapshot.Bounds;
+}
+
+void UDistanceFieldSubsystem::RestoreSnapshot(FFieldSnapshot&& Snapshot)
+{
+    DistanceMap = MoveTemp(Snapshot.DistanceMap);
+    NextStepMap = MoveTemp(Snapshot.NextStepMap);
+    PlayerPosition = Snapshot.PlayerPosition;
+    Bounds = Snapshot.Bounds;
+}
+
 //-----------------------------------------------------------------------------
 // Public API (Blueprint-friendly)
 //-----------------------------------------------------------------------------
@@ -115,6 +156,8 @@ void UDistanceFieldSubsystem::UpdateDistanceFieldInternal(
     const TSet<FIntPoint>& OptionalTargets,
     int32 BoundsMargin)
 {
+    TURN_PROFILE_SCOPE(this, DistanceField);
+
     DistanceMap.Empty();
     NextStepMap.Empty();
     PlayerPosition = PlayerCell;
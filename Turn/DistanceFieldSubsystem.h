@@ -57,6 +57,26 @@ public:
     // CodeRevision: INC-2025-1123-LOG-R5 (Debug getter for PlayerPosition) (2025-11-23 02:30)
     FORCEINLINE FIntPoint GetPlayerPosition() const { return PlayerPosition; }
 
+    // CodeRevision: INC-2025-1217-R1 (Field snapshots for speculative enemy planning) (2025-12-16 14:00)
+    /** Complete field state for one player cell (see UEnemySpeculationSubsystem) */
+    struct FFieldSnapshot
+    {
+        TMap<FIntPoint, int32> DistanceMap;
+        TMap<FIntPoint, FIntPoint> NextStepMap;
+        FIntPoint PlayerPosition = FIntPoint(-1, -1);
+        FGridBounds Bounds;
+    };
+
+    /** Copy the current field into OutSnapshot. */
+    void CaptureSnapshot(FFieldSnapshot& OutSnapshot) const;
+
+    /** Move the current field into OutSnapshot; the live field is left empty until the next update or restore. */
+    void ExtractSnapshot(FFieldSnapshot& OutSnapshot);
+
+    /** Replace the current field with a previously captured one. */
+    void RestoreSnapshot(const FFieldSnapshot& Snapshot);
+    void RestoreSnapshot(FFieldSnapshot&& Snapshot);
+
 private:
     bool IsWalkable(const FIntPoint& Cell, AActor* IgnoreActor = nullptr) const;  // ★★★ 修正 (2025-11-11): AI待機問題修正のためIgnoreActor追加
     bool CanMoveDiagonal(const FIntPoint& From, const FIntPoint& To) const;
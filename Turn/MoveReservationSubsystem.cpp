@@ -242,7 +242,7 @@ bool UMoveReservationSubsystem::HandleWaitResolvedAction(AUnitBase* Unit, const
         if (UTurnActionBarrierSubsystem* Barrier = World->GetSubsystem<UTurnActionBarrierSubsystem>())
         {
             const int32 RegisteredTurnId = Barrier->GetCurrentTurnId();
-            const FGuid ActionId = Barrier->RegisterAction(Unit, RegisteredTurnId);
+            const FTurnActionHandle ActionId = Barrier->RegisterAction(Unit, RegisteredTurnId);
             if (ActionId.IsValid())
             {
                 Barrier->CompleteAction(Unit, RegisteredTurnId, ActionId);
@@ -308,7 +308,7 @@ bool UMoveReservationSubsystem::HandleEnemyResolvedMove(AUnitBase* Unit, const F
         if (UTurnActionBarrierSubsystem* Barrier = World->GetSubsystem<UTurnActionBarrierSubsystem>())
         {
             const int32 RegisteredTurnId = Barrier->GetCurrentTurnId();
-            const FGuid ActionId = Barrier->RegisterAction(Unit, RegisteredTurnId);
+            const FTurnActionHandle ActionId = Barrier->RegisterAction(Unit, RegisteredTurnId);
             if (ActionId.IsValid())
             {
                 FManualMoveBarrierInfo Info;
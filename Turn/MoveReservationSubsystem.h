@@ -29,7 +29,7 @@ struct FManualMoveBarrierInfo
     int32 TurnId = INDEX_NONE;
 
     UPROPERTY()
-    FGuid ActionId;
+    FTurnActionHandle ActionId;
 };
 
 /**
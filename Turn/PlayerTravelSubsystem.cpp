@@ -0,0 +1,498 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+// CodeRevision: INC-2025-1218-R1 (Travel / auto-explore that feeds route steps into consecutive turns) (2025-12-17 10:00)
+#include "Turn/PlayerTravelSubsystem.h"
+#include "Turn/TurnCommandHandler.h"
+#include "Turn/TurnFlowCoordinator.h"
+#include "Turn/PlayerInputProcessor.h"
+#include "Turn/UnitTurnStateSubsystem.h"
+#include "Turn/DashStopConditions.h"
+#include "Grid/GridPathfindingSubsystem.h"
+#include "Grid/GridOccupancySubsystem.h"
+#include "Grid/URogueDungeonSubsystem.h"
+#include "Utility/GridUtils.h"
+#include "Utility/RogueGameplayTags.h"
+#include "Kismet/GameplayStatics.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_LOG_CATEGORY(LogPlayerTravel);
+
+static int32 GTS_Travel_ViewRadius = 8;
+static FAutoConsoleVariableRef CVarTS_Travel_ViewRadius(
+    TEXT("ts.Travel.ViewRadius"),
+    GTS_Travel_ViewRadius,
+    TEXT("Chebyshev radius (with line of sight) in which a visible enemy stops travel."),
+    ECVF_Default
+);
+
+static float GTS_Travel_MoveSpeedScale = 4.0f;
+static FAutoConsoleVariableRef CVarTS_Travel_MoveSpeedScale(
+    TEXT("ts.Travel.MoveSpeedScale"),
+    GTS_Travel_MoveSpeedScale,
+    TEXT("Movement playback speed multiplier for the player while traveling (no enemy in view); other units keep their speed."),
+    ECVF_Default
+);
+
+static int32 GTS_Travel_MaxSteps = 500;
+static FAutoConsoleVariableRef CVarTS_Travel_MaxSteps(
+    TEXT("ts.Travel.MaxSteps"),
+    GTS_Travel_MaxSteps,
+    TEXT("Upper bound on steps taken by one travel / auto-explore command."),
+    ECVF_Default
+);
+
+static int32 GTS_Travel_ExploreRevealRadius = 3;
+static FAutoConsoleVariableRef CVarTS_Travel_ExploreRevealRadius(
+    TEXT("ts.Travel.ExploreRevealRadius"),
+    GTS_Travel_ExploreRevealRadius,
+    TEXT("Cells within this Chebyshev radius of the player count as visited for auto-explore."),
+    ECVF_Default
+);
+
+namespace PlayerTravelPrivate
+{
+    static const FIntPoint NeighborOffsets[] =
+    {
+        { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 },
+        { 1, 1 }, { 1, -1 }, { -1, 1 }, { -1, -1 }
+    };
+
+    static const TCHAR* ModeToString(EPlayerTravelMode Mode)
+    {
+        switch (Mode)
+        {
+        case EPlayerTravelMode::Travel:  return TEXT("Travel");
+        case EPlayerTravelMode::Explore: return TEXT("Explore");
+        default:                         return TEXT("None");
+        }
+    }
+}
+
+void UPlayerTravelSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    // Routes and explore memory belong to one floor.
+    if (URogueDungeonSubsystem* DungeonSys = Collection.InitializeDependency<URogueDungeonSubsystem>())
+    {
+        DungeonSys->OnGridReady.AddDynamic(this, &UPlayerTravelSubsystem::HandleGridReady);
+    }
+
+    UE_LOG(LogPlayerTravel, Log, TEXT("[PlayerTravel] Initialized"));
+}
+
+void UPlayerTravelSubsystem::Deinitialize()
+{
+    if (UWorld* World = GetWorld())
+    {
+        if (URogueDungeonSubsystem* DungeonSys = World->GetSubsystem<URogueDungeonSubsystem>())
+        {
+            DungeonSys->OnGridReady.RemoveDynamic(this, &UPlayerTravelSubsystem::HandleGridReady);
+        }
+    }
+
+    Mode = EPlayerTravelMode::None;
+    Route.Reset();
+    VisitedCells.Reset();
+
+    Super::Deinitialize();
+}
+
+void UPlayerTravelSubsystem::HandleGridReady(URogueDungeonSubsystem* InDungeonSys)
+{
+    if (IsTraveling())
+    {
+        CancelTravel(TEXT("FloorChanged"));
+    }
+    VisitedCells.Reset();
+}
+
+//------------------------------------------------------------------------------
+// Public API
+//------------------------------------------------------------------------------
+
+bool UPlayerTravelSubsystem::BeginTravel(const FIntPoint& InDestination, const FDashStopConfig& Config)
+{
+    Destination = InDestination;
+    return StartRoute(EPlayerTravelMode::Travel, Config);
+}
+
+bool UPlayerTravelSubsystem::BeginAutoExplore(const FDashStopConfig& Config)
+{
+    Destination = FIntPoint(-1, -1);
+    return StartRoute(EPlayerTravelMode::Explore, Config);
+}
+
+void UPlayerTravelSubsystem::CancelTravel(const FString& Reason)
+{
+    if (!IsTraveling())
+    {
+        return;
+    }
+
+    UE_LOG(LogPlayerTravel, Log, TEXT("[PlayerTravel] %s stopped after %d steps: %s"),
+        PlayerTravelPrivate::ModeToString(Mode), StepsTaken, *Reason);
+
+    Mode = EPlayerTravelMode::None;
+    Route.Reset();
+    RouteIndex = 0;
+    PendingHandler.Reset();
+    // A step already queued for the next tick sees Mode == None and does nothing.
+}
+
+FIntPoint UPlayerTravelSubsystem::PeekNextCell() const
+{
+    return (IsTraveling() && Route.IsValidIndex(RouteIndex)) ? Route[RouteIndex] : FIntPoint(-1, -1);
+}
+
+// CodeRevision: INC-2025-1218-R2 (Travel speed-up applies only to the traveling player) (2025-12-27 18:00)
+APawn* UPlayerTravelSubsystem::GetTravelingPawn() const
+{
+    UWorld* World = GetWorld();
+    return (IsTraveling() && World) ? UGameplayStatics::GetPlayerPawn(World, 0) : nullptr;
+}
+
+float UPlayerTravelSubsystem::GetMoveSpeedScale(const AActor* Unit) const
+{
+    // Enemies out of view keep their pace; the turn still finishes with the player's step
+    return (Unit && Unit == GetTravelingPawn()) ? FMath::Max(1.0f, GTS_Travel_MoveSpeedScale) : 1.0f;
+}
+
+bool UPlayerTravelSubsystem::StartRoute(EPlayerTravelMode InMode, const FDashStopConfig& Config)
+{
+    using namespace PlayerTravelPrivate;
+
+    CancelTravel(TEXT("Restarted"));
+
+    UWorld* World = GetWorld();
+    UGridOccupancySubsystem* Occupancy = World ? World->GetSubsystem<UGridOccupancySubsystem>() : nullptr;
+    APawn* PlayerPawn = World ? UGameplayStatics::GetPlayerPawn(World, 0) : nullptr;
+    if (!Occupancy || !PlayerPawn)
+    {
+        return false;
+    }
+
+    const FIntPoint PlayerCell = Occupancy->GetCellOfActor(PlayerPawn);
+    if (IsAnyEnemyInView(PlayerCell))
+    {
+        UE_LOG(LogPlayerTravel, Log, TEXT("[PlayerTravel] %s refused: enemy in view"), ModeToString(InMode));
+        return false;
+    }
+
+    StopConfig = Config;
+    StepsTaken = 0;
+    Route.Reset();
+    RouteIndex = 0;
+
+    // Explore picks its first target when the next window opens.
+    if (InMode == EPlayerTravelMode::Travel && !PlanRoute(PlayerCell, Destination))
+    {
+        UE_LOG(LogPlayerTravel, Log, TEXT("[PlayerTravel] No route from (%d,%d) to (%d,%d)"),
+            PlayerCell.X, PlayerCell.Y, Destination.X, Destination.Y);
+        return false;
+    }
+
+    Mode = InMode;
+
+    UE_LOG(LogPlayerTravel, Log, TEXT("[PlayerTravel] %s started at (%d,%d) (RouteLen=%d)"),
+        ModeToString(Mode), PlayerCell.X, PlayerCell.Y, Route.Num());
+
+    // If the input window is already open, take the first step right away.
+    const UPlayerInputProcessor* InputProc = World->GetSubsystem<UPlayerInputProcessor>();
+    if (InputProc && InputProc->IsInputWindowOpen())
+    {
+        NoteInputWindowOpened(World->GetSubsystem<UTurnCommandHandler>());
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Per-window driver
+//------------------------------------------------------------------------------
+
+void UPlayerTravelSubsystem::NoteInputWindowOpened(UTurnCommandHandler* Handler)
+{
+    using namespace PlayerTravelPrivate;
+
+    if (!IsTraveling() || !Handler)
+    {
+        return;
+    }
+
+    UWorld* World = GetWorld();
+    UGridOccupancySubsystem* Occupancy = World ? World->GetSubsystem<UGridOccupancySubsystem>() : nullptr;
+    APawn* PlayerPawn = World ? UGameplayStatics::GetPlayerPawn(World, 0) : nullptr;
+    if (!Occupancy || !PlayerPawn)
+    {
+        CancelTravel(TEXT("NoPlayer"));
+        return;
+    }
+
+    const FIntPoint PlayerCell = Occupancy->GetCellOfActor(PlayerPawn);
+    RevealAround(PlayerCell);
+
+    if (IsAnyEnemyInView(PlayerCell))
+    {
+        CancelTravel(TEXT("EnemyInView"));
+        return;
+    }
+
+    if (StopConfig.bStopOnEnemyAdjacent && UDashStopEvaluator::HasAdjacentEnemy(PlayerCell, World))
+    {
+        CancelTravel(TEXT("EnemyAdjacent"));
+        return;
+    }
+
+    if (StepsTaken >= FMath::Max(1, GTS_Travel_MaxSteps))
+    {
+        CancelTravel(TEXT("MaxSteps"));
+        return;
+    }
+
+    if (!Route.IsValidIndex(RouteIndex))
+    {
+        if (Mode == EPlayerTravelMode::Travel)
+        {
+            CancelTravel(TEXT("Arrived"));
+            return;
+        }
+
+        FIntPoint Target;
+        if (!FindExploreTarget(PlayerCell, Target) || !PlanRoute(PlayerCell, Target))
+        {
+            CancelTravel(TEXT("Explored"));
+            return;
+        }
+        Destination = Target;
+    }
+
+    FString Reason;
+    if (!CanTakeStep(PlayerCell, Route[RouteIndex], Reason))
+    {
+        // Terrain/occupancy changed under the route (door, unit); one replan before giving up.
+        if (!PlanRoute(PlayerCell, Destination) || !CanTakeStep(PlayerCell, Route[RouteIndex], Reason))
+        {
+            CancelTravel(Reason);
+            return;
+        }
+    }
+
+    PendingHandler = Handler;
+
+    // Submit from the next tick so the command does not re-enter the code that opened the window.
+    if (!bSubmitScheduled)
+    {
+        bSubmitScheduled = true;
+        World->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateUObject(this, &UPlayerTravelSubsystem::SubmitNextStep));
+    }
+}
+
+void UPlayerTravelSubsystem::SubmitNextStep()
+{
+    bSubmitScheduled = false;
+
+    UTurnCommandHandler* Handler = PendingHandler.Get();
+    UWorld* World = GetWorld();
+    UGridOccupancySubsystem* Occupancy = World ? World->GetSubsystem<UGridOccupancySubsystem>() : nullptr;
+    APawn* PlayerPawn = World ? UGameplayStatics::GetPlayerPawn(World, 0) : nullptr;
+    if (!IsTraveling() || !Handler || !Occupancy || !PlayerPawn || !Route.IsValidIndex(RouteIndex))
+    {
+        return;
+    }
+
+    const FIntPoint From = Occupancy->GetCellOfActor(PlayerPawn);
+    const FIntPoint To = Route[RouteIndex];
+
+    FPlayerCommand Command;
+    Command.CommandTag = RogueGameplayTags::InputTag_Move;
+    Command.Direction = FVector(To.X - From.X, To.Y - From.Y, 0.0f);
+    Command.TargetActor = PlayerPawn;
+    Command.TargetCell = To;
+    if (UTurnFlowCoordinator* TFC = World->GetSubsystem<UTurnFlowCoordinator>())
+    {
+        Command.TurnId = TFC->GetCurrentTurnId();
+        Command.WindowId = TFC->GetCurrentInputWindowId();
+    }
+
+    // Advance first: the command runs the enemy phase synchronously and speculation reads PeekNextCell.
+    ++RouteIndex;
+    ++StepsTaken;
+    PendingHandler.Reset();
+
+    if (!Handler->ProcessPlayerCommand(Command))
+    {
+        CancelTravel(TEXT("StepRejected"));
+    }
+}
+
+//------------------------------------------------------------------------------
+// Planning helpers
+//------------------------------------------------------------------------------
+
+bool UPlayerTravelSubsystem::PlanRoute(const FIntPoint& From, const FIntPoint& Target)
+{
+    UWorld* World = GetWorld();
+    UGridPathfindingSubsystem* PathFinder = World ? World->GetSubsystem<UGridPathfindingSubsystem>() : nullptr;
+
+    Route.Reset();
+    RouteIndex = 0;
+
+    if (!PathFinder || From == Target || !PathFinder->IsCellWalkableIgnoringActor(Target, nullptr))
+    {
+        return false;
+    }
+
+    TArray<FVector> WorldPath;
+    if (!PathFinder->FindPathIgnoreEndpoints(PathFinder->GridToWorldCenter(From), PathFinder->GridToWorldCenter(Target), WorldPath))
+    {
+        return false;
+    }
+
+    // The path starts at From; keep only the cells still to enter.
+    Route.Reserve(WorldPath.Num());
+    for (const FVector& Point : WorldPath)
+    {
+        const FIntPoint Cell = PathFinder->WorldToGrid(Point);
+        if (Cell != From)
+        {
+            Route.Add(Cell);
+        }
+    }
+
+    return Route.Num() > 0;
+}
+
+bool UPlayerTravelSubsystem::FindExploreTarget(const FIntPoint& From, FIntPoint& OutTarget) const
+{
+    using namespace PlayerTravelPrivate;
+
+    UWorld* World = GetWorld();
+    const UGridPathfindingSubsystem* PathFinder = World ? World->GetSubsystem<UGridPathfindingSubsystem>() : nullptr;
+    if (!PathFinder || !PathFinder->IsInitialized())
+    {
+        return false;
+    }
+
+    int32 Width = 0;
+    int32 Height = 0;
+    int32 TileSize = 0;
+    PathFinder->GetGridInfo(Width, Height, TileSize);
+
+    const auto ToIndex = [Width](const FIntPoint& Cell) { return Cell.Y * Width + Cell.X; };
+
+    TBitArray<> Seen(false, Width * Height);
+    TArray<FIntPoint> Queue;
+    Queue.Reserve(256);
+    Queue.Add(From);
+    Seen[ToIndex(From)] = true;
+
+    // Breadth-first over terrain: the first unvisited walkable cell is the nearest one.
+    for (int32 Head = 0; Head < Queue.Num(); ++Head)
+    {
+        const FIntPoint Cell = Queue[Head];
+        if (!VisitedCells.Contains(Cell))
+        {
+            OutTarget = Cell;
+            return true;
+        }
+
+        for (const FIntPoint& Offset : NeighborOffsets)
+        {
+            const FIntPoint Next = Cell + Offset;
+            if (Next.X < 0 || Next.Y < 0 || Next.X >= Width || Next.Y >= Height || Seen[ToIndex(Next)])
+            {
+                continue;
+            }
+
+            Seen[ToIndex(Next)] = true;
+            if (PathFinder->IsCellWalkableIgnoringActor(Next, nullptr))
+            {
+                Queue.Add(Next);
+            }
+        }
+    }
+
+    return false;
+}
+
+void UPlayerTravelSubsystem::RevealAround(const FIntPoint& Cell)
+{
+    const int32 Radius = FMath::Max(0, GTS_Travel_ExploreRevealRadius);
+    for (int32 DY = -Radius; DY <= Radius; ++DY)
+    {
+        for (int32 DX = -Radius; DX <= Radius; ++DX)
+        {
+            VisitedCells.Add(Cell + FIntPoint(DX, DY));
+        }
+    }
+}
+
+bool UPlayerTravelSubsystem::IsAnyEnemyInView(const FIntPoint& PlayerCell) const
+{
+    UWorld* World = GetWorld();
+    const UUnitTurnStateSubsystem* UnitState = World ? World->GetSubsystem<UUnitTurnStateSubsystem>() : nullptr;
+    const UGridOccupancySubsystem* Occupancy = World ? World->GetSubsystem<UGridOccupancySubsystem>() : nullptr;
+    const UGridPathfindingSubsystem* PathFinder = World ? World->GetSubsystem<UGridPathfindingSubsystem>() : nullptr;
+    if (!UnitState || !Occupancy || !PathFinder)
+    {
+        return false;
+    }
+
+    const FVector PlayerWorld = PathFinder->GridToWorldCenter(PlayerCell);
+    for (const TWeakObjectPtr<AActor>& EnemyRef : UnitState->GetCachedEnemyRefs())
+    {
+        AActor* Enemy = EnemyRef.Get();
+        if (!IsValid(Enemy))
+        {
+            continue;
+        }
+
+        const FIntPoint EnemyCell = Occupancy->GetCellOfActor(Enemy);
+        if (FGridUtils::ChebyshevDistance(PlayerCell, EnemyCell) > GTS_Travel_ViewRadius)
+        {
+            continue;
+        }
+
+        if (PathFinder->HasLineOfSight(PlayerWorld, PathFinder->GridToWorldCenter(EnemyCell)))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool UPlayerTravelSubsystem::CanTakeStep(const FIntPoint& From, const FIntPoint& To, FString& OutReason) const
+{
+    UWorld* World = GetWorld();
+    const UGridPathfindingSubsystem* PathFinder = World ? World->GetSubsystem<UGridPathfindingSubsystem>() : nullptr;
+    if (!PathFinder)
+    {
+        OutReason = TEXT("NoPathFinder");
+        return false;
+    }
+
+    if (StopConfig.bStopOnObstacle && UDashStopEvaluator::IsObstacle(To, World))
+    {
+        OutReason = TEXT("Obstacle");
+        return false;
+    }
+
+    if (StopConfig.bStopOnDangerTile && UDashStopEvaluator::IsDangerTile(To, World))
+    {
+        OutReason = TEXT("DangerTile");
+        return false;
+    }
+
+    APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(World, 0);
+    FString FailureReason;
+    if (!PathFinder->IsMoveValid(From, To, PlayerPawn, FailureReason))
+    {
+        OutReason = FString::Printf(TEXT("Blocked (%s)"), *FailureReason);
+        return false;
+    }
+
+    return true;
+}
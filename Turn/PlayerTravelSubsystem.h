@@ -0,0 +1,124 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+// CodeRevision: INC-2025-1218-R1 (Travel / auto-explore that feeds route steps into consecutive turns) (2025-12-17 10:00)
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Turn/TurnSystemTypes.h"
+#include "PlayerTravelSubsystem.generated.h"
+
+// Log category
+DECLARE_LOG_CATEGORY_EXTERN(LogPlayerTravel, Log, All);
+
+class APawn;
+class UTurnCommandHandler;
+class UGridPathfindingSubsystem;
+class URogueDungeonSubsystem;
+
+UENUM(BlueprintType)
+enum class EPlayerTravelMode : uint8
+{
+    None,
+    // Walk a planned route to a fixed destination
+    Travel,
+    // Repeatedly walk to the nearest unvisited floor cell
+    Explore
+};
+
+/**
+ * UPlayerTravelSubsystem: multi-step player movement (travel to a cell / auto-explore).
+ *
+ * The route is planned once with the grid pathfinder. Each time an input window opens while a
+ * route is active, the next step is submitted as a regular move command on the following tick,
+ * so the player never waits for input and every step still goes through the normal pipeline.
+ *
+ * Travel only runs while no enemy is in view (ts.Travel.ViewRadius). During that time:
+ * - enemy speculation plans only the next route cell instead of all nine candidates,
+ * - the traveling player's movement plays back at ts.Travel.MoveSpeedScale (other units keep
+ *   their own speed).
+ *
+ * Travel stops when an enemy comes into view, on the FDashStopConfig conditions, on any manual
+ * player command, when the route is blocked, or when the destination is reached.
+ */
+UCLASS()
+class LYRAGAME_API UPlayerTravelSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    /** Walk to InDestination. Fails when no route exists or an enemy is already in view. */
+    UFUNCTION(BlueprintCallable, Category = "Turn|Travel", meta = (BlueprintAuthorityOnly))
+    bool BeginTravel(const FIntPoint& InDestination, const FDashStopConfig& Config);
+
+    /** Walk to the nearest unvisited floor cell, then the next one, until nothing is left. */
+    UFUNCTION(BlueprintCallable, Category = "Turn|Travel", meta = (BlueprintAuthorityOnly))
+    bool BeginAutoExplore(const FDashStopConfig& Config);
+
+    UFUNCTION(BlueprintCallable, Category = "Turn|Travel")
+    void CancelTravel(const FString& Reason);
+
+    UFUNCTION(BlueprintPure, Category = "Turn|Travel")
+    bool IsTraveling() const { return Mode != EPlayerTravelMode::None; }
+
+    UFUNCTION(BlueprintPure, Category = "Turn|Travel")
+    EPlayerTravelMode GetTravelMode() const { return Mode; }
+
+    /** Cell the next travel step will enter (FIntPoint(-1,-1) when not traveling). */
+    FIntPoint PeekNextCell() const;
+
+    // CodeRevision: INC-2025-1218-R2 (Travel speed-up applies only to the traveling player) (2025-12-27 18:00)
+    /** Player pawn walking the route (nullptr when not traveling). */
+    APawn* GetTravelingPawn() const;
+
+    /** Presentation speed multiplier for Unit's movement (1 unless Unit is the traveling pawn). */
+    float GetMoveSpeedScale(const AActor* Unit) const;
+
+    /** Called by UTurnCommandHandler::BeginInputWindow; decides whether to keep going and queues the step. */
+    void NoteInputWindowOpened(UTurnCommandHandler* Handler);
+
+    /** Number of steps taken by the current (or last) travel. */
+    int32 GetStepsTaken() const { return StepsTaken; }
+
+private:
+    bool StartRoute(EPlayerTravelMode InMode, const FDashStopConfig& Config);
+
+    /** Plan Route from From to Target. */
+    bool PlanRoute(const FIntPoint& From, const FIntPoint& Target);
+
+    /** Nearest walkable, not yet visited cell reachable from From (BFS over terrain). */
+    bool FindExploreTarget(const FIntPoint& From, FIntPoint& OutTarget) const;
+
+    /** Mark cells around Cell as visited for auto-explore. */
+    void RevealAround(const FIntPoint& Cell);
+
+    /** True when an enemy within ts.Travel.ViewRadius has line of sight to PlayerCell. */
+    bool IsAnyEnemyInView(const FIntPoint& PlayerCell) const;
+
+    /** Route step check; false (with OutReason) means travel must stop before this step. */
+    bool CanTakeStep(const FIntPoint& From, const FIntPoint& To, FString& OutReason) const;
+
+    void SubmitNextStep();
+
+    UFUNCTION()
+    void HandleGridReady(URogueDungeonSubsystem* InDungeonSys);
+
+    EPlayerTravelMode Mode = EPlayerTravelMode::None;
+    FDashStopConfig StopConfig;
+
+    // Route cells excluding the start cell; RouteIndex is the next cell to enter
+    TArray<FIntPoint> Route;
+    int32 RouteIndex = 0;
+    FIntPoint Destination = FIntPoint(-1, -1);
+
+    bool bSubmitScheduled = false;
+    int32 StepsTaken = 0;
+
+    TWeakObjectPtr<UTurnCommandHandler> PendingHandler;
+
+    // Auto-explore memory for the current floor
+    TSet<FIntPoint> VisitedCells;
+};
@@ -0,0 +1,411 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+// CodeRevision: INC-2025-1213-R1 (Add headless turbo simulation loop) (2025-12-15 10:00)
+#include "Turn/TurboSimulationSubsystem.h"
+#include "Turn/TurnCorePhaseManager.h"
+#include "Turn/ConflictResolverSubsystem.h"
+#include "Turn/DistanceFieldSubsystem.h"
+#include "Turn/MoveReservationSubsystem.h"
+#include "Turn/CooperativePlannerSubsystem.h"
+#include "AI/Enemy/EnemyAISubsystem.h"
+#include "AI/Enemy/EnemyThinkerBase.h"
+#include "Grid/GridPathfindingSubsystem.h"
+#include "Grid/GridOccupancySubsystem.h"
+#include "Utility/RogueGameplayTags.h"
+#include "Utility/ProjectDiagnostics.h"
+#include "HAL/PlatformTime.h"
+// CodeRevision: INC-2025-1213-R2 (Turbo simulation applies attack damage through the melee GAS path) (2025-12-26 11:00)
+#include "Abilities/GA_MeleeAttack.h"
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "AbilitySystem/Attributes/LyraHealthSet.h"
+#include "GameplayEffect.h"
+
+DEFINE_LOG_CATEGORY(LogTurboSim);
+
+static int32 GTS_Turbo_Turns = 1000;
+static FAutoConsoleVariableRef CVarTS_Turbo_Turns(
+    TEXT("ts.Turbo.Turns"),
+    GTS_Turbo_Turns,
+    TEXT("Number of turns simulated by turbo automation runs (Rogue.Simulation.Turbo)."),
+    ECVF_Default
+);
+
+namespace TurboSimulationPrivate
+{
+    static const FIntPoint PlayerDirections[] =
+    {
+        { 0, 0 },
+        { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 },
+        { 1, 1 }, { 1, -1 }, { -1, 1 }, { -1, -1 }
+    };
+
+    /** Raises the per-turn pipeline categories to Error for the lifetime of the scope. */
+    struct FScopedPipelineLogSilencer
+    {
+        explicit FScopedPipelineLogSilencer(bool bEnabled)
+        {
+            if (!bEnabled)
+            {
+                return;
+            }
+
+            FLogCategoryBase* Categories[] =
+            {
+                &LogEnemyAI, &LogEnemyThinker, &LogTurnCore, &LogConflictResolver,
+                &LogDistanceField, &LogGridOccupancy, &LogGridPathfinding,
+                &LogMoveReservation, &LogCooperativePlanner
+            };
+
+            for (FLogCategoryBase* Category : Categories)
+            {
+                Saved.Emplace(Category, Category->GetVerbosity());
+                Category->SetVerbosity(ELogVerbosity::Error);
+            }
+        }
+
+        ~FScopedPipelineLogSilencer()
+        {
+            for (const TPair<FLogCategoryBase*, ELogVerbosity::Type>& Pair : Saved)
+            {
+                Pair.Key->SetVerbosity(Pair.Value);
+            }
+        }
+
+        TArray<TPair<FLogCategoryBase*, ELogVerbosity::Type>> Saved;
+    };
+}
+
+void UTurboSimulationSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    UE_LOG(LogTurboSim, Log, TEXT("[TurboSim] Initialized"));
+}
+
+int32 UTurboSimulationSubsystem::GetDefaultTurnCount()
+{
+    return FMath::Max(1, GTS_Turbo_Turns);
+}
+
+//-----------------------------------------------------------------------------
+// Main loop
+//-----------------------------------------------------------------------------
+
+FTurboSimStats UTurboSimulationSubsystem::RunTurbo(AActor* Player, const TArray<AActor*>& Enemies, const FTurboSimConfig& Config)
+{
+    using namespace TurboSimulationPrivate;
+
+    FTurboSimStats Stats;
+
+    UWorld* World = GetWorld();
+    if (!World || !IsValid(Player))
+    {
+        UE_LOG(LogTurboSim, Error, TEXT("[TurboSim] RunTurbo: invalid world or player"));
+        return Stats;
+    }
+
+    EnemyAI      = World->GetSubsystem<UEnemyAISubsystem>();
+    PhaseManager = World->GetSubsystem<UTurnCorePhaseManager>();
+    PathFinder   = World->GetSubsystem<UGridPathfindingSubsystem>();
+    Occupancy    = World->GetSubsystem<UGridOccupancySubsystem>();
+
+    if (!EnemyAI || !PhaseManager || !PathFinder || !Occupancy)
+    {
+        UE_LOG(LogTurboSim, Error,
+            TEXT("[TurboSim] Missing subsystems (EnemyAI=%d, PhaseManager=%d, PathFinder=%d, Occupancy=%d)"),
+            EnemyAI != nullptr, PhaseManager != nullptr, PathFinder != nullptr, Occupancy != nullptr);
+        return Stats;
+    }
+
+    if (bTurboActive)
+    {
+        UE_LOG(LogTurboSim, Error, TEXT("[TurboSim] RunTurbo is not re-entrant"));
+        return Stats;
+    }
+
+    UE_LOG(LogTurboSim, Log,
+        TEXT("[TurboSim] Start: Turns=%d Seed=%d Policy=%d Enemies=%d"),
+        Config.NumTurns, Config.Seed, static_cast<int32>(Config.PlayerPolicy), Enemies.Num());
+
+    TGuardValue<bool> ActiveGuard(bTurboActive, true);
+    FScopedPipelineLogSilencer Silencer(Config.bSuppressPipelineLogs);
+
+    FRandomStream Stream(Config.Seed);
+    uint32 Hash = 2166136261u;
+
+    TArray<FEnemyObservation> Observations;
+    TArray<FEnemyIntent> Intents;
+
+    // CodeRevision: INC-2025-1213-R2 (Turbo simulation applies attack damage through the melee GAS path) (2025-12-26 11:00)
+    LiveEnemies.Reset();
+    LiveEnemySet.Reset();
+    for (AActor* Enemy : Enemies)
+    {
+        if (IsValid(Enemy) && !IsOutOfHealth(Enemy))
+        {
+            LiveEnemies.Add(Enemy);
+            LiveEnemySet.Add(Enemy);
+        }
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    for (int32 Turn = 0; Turn < Config.NumTurns; ++Turn)
+    {
+        // (1) Player command: stepping into an enemy's cell attacks it
+        const FIntPoint Direction = PickPlayerDirection(Config, Turn, Stream);
+        if (Direction != FIntPoint::ZeroValue)
+        {
+            AActor* Victim = Occupancy->GetActorAtCell(Occupancy->GetCellOfActor(Player) + Direction);
+            // CodeRevision: INC-2025-1213-R3 (Constant-time live-enemy lookups) (2025-12-27 14:00)
+            if (Victim && LiveEnemySet.Contains(Victim))
+            {
+                ++Stats.PlayerAttacks;
+                if (!ApplyAttack(Player, Victim, Config))
+                {
+                    ++Stats.AttacksWithoutDamage;
+                }
+                else if (IsOutOfHealth(Victim))
+                {
+                    RemoveDeadEnemy(Victim, Stats);
+                }
+            }
+            else if (ApplyPlayerStep(Player, Direction))
+            {
+                ++Stats.PlayerMoves;
+            }
+            else
+            {
+                ++Stats.PlayerBlocked;
+            }
+        }
+
+        // (2) Observe + think (DistanceField update happens inside BuildObservations)
+        const FIntPoint PlayerCell = Occupancy->GetCellOfActor(Player);
+        EnemyAI->BuildObservations(LiveEnemies, PlayerCell, PathFinder, Observations);
+        EnemyAI->CollectIntents(Observations, LiveEnemies, Intents);
+
+        // (3) Resolve
+        const TArray<FResolvedAction> Resolved = PhaseManager->CoreResolvePhase(Intents);
+
+        // (4) Execute synchronously
+        CommitResolvedActions(Resolved, Player, Config, Stats);
+
+        // (5) Cleanup
+        PhaseManager->CoreCleanupPhase();
+        if (UMoveReservationSubsystem* MoveRes = World->GetSubsystem<UMoveReservationSubsystem>())
+        {
+            MoveRes->ClearResolvedMoves();
+        }
+        Occupancy->ClearAllReservations();
+
+        Hash = HashUnitCells(Player, Enemies, Hash);
+        ++Stats.TurnsSimulated;
+
+        if (IsOutOfHealth(Player))
+        {
+            Stats.PlayerDeathTurn = Turn;
+            break;
+        }
+    }
+
+    LiveEnemies.Reset();
+    LiveEnemySet.Reset();
+
+    Stats.WallSeconds = FPlatformTime::Seconds() - StartTime;
+    Stats.TurnsPerSecond = Stats.WallSeconds > 0.0 ? Stats.TurnsSimulated / Stats.WallSeconds : 0.0;
+    Stats.StateHash = static_cast<int64>(Hash);
+
+    UE_LOG(LogTurboSim, Log,
+        TEXT("[TurboSim] Done: Turns=%d Wall=%.3fs (%.1f turns/s) PlayerMoves=%d Blocked=%d PlayerAttacks=%d EnemyMoves=%d Waits=%d Attacks=%d NoDamage=%d Killed=%d PlayerDeathTurn=%d Rejected=%d Hash=0x%08X"),
+        Stats.TurnsSimulated, Stats.WallSeconds, Stats.TurnsPerSecond,
+        Stats.PlayerMoves, Stats.PlayerBlocked, Stats.PlayerAttacks, Stats.EnemyMoves, Stats.EnemyWaits, Stats.EnemyAttacks,
+        Stats.AttacksWithoutDamage, Stats.EnemiesKilled, Stats.PlayerDeathTurn, Stats.RejectedCommits, Hash);
+
+    return Stats;
+}
+
+//-----------------------------------------------------------------------------
+// Player policy
+//-----------------------------------------------------------------------------
+
+FIntPoint UTurboSimulationSubsystem::PickPlayerDirection(const FTurboSimConfig& Config, int32 TurnIndex, FRandomStream& Stream) const
+{
+    using namespace TurboSimulationPrivate;
+
+    switch (Config.PlayerPolicy)
+    {
+    case ETurboPlayerPolicy::Wait:
+        return FIntPoint::ZeroValue;
+
+    case ETurboPlayerPolicy::Scripted:
+        if (Config.ScriptedDirections.Num() > 0)
+        {
+            const FIntPoint& Dir = Config.ScriptedDirections[TurnIndex % Config.ScriptedDirections.Num()];
+            return FIntPoint(FMath::Clamp(Dir.X, -1, 1), FMath::Clamp(Dir.Y, -1, 1));
+        }
+        return FIntPoint::ZeroValue;
+
+    case ETurboPlayerPolicy::Random:
+    default:
+        return PlayerDirections[Stream.RandRange(0, UE_ARRAY_COUNT(PlayerDirections) - 1)];
+    }
+}
+
+bool UTurboSimulationSubsystem::ApplyPlayerStep(AActor* Player, const FIntPoint& Direction)
+{
+    const FIntPoint From = Occupancy->GetCellOfActor(Player);
+    const FIntPoint To = From + Direction;
+
+    // Same legality rules as a real player command (terrain, corner cutting, occupancy)
+    FString FailureReason;
+    if (!PathFinder->IsMoveValid(From, To, Player, FailureReason))
+    {
+        return false;
+    }
+
+    return Occupancy->UpdateActorCell(Player, To);
+}
+
+//-----------------------------------------------------------------------------
+// Execute
+//-----------------------------------------------------------------------------
+
+void UTurboSimulationSubsystem::CommitResolvedActions(const TArray<FResolvedAction>& Resolved, AActor* Player, const FTurboSimConfig& Config, FTurboSimStats& Stats)
+{
+    const FGameplayTag MoveTag = RogueGameplayTags::AI_Intent_Move;
+    const FGameplayTag AttackTag = RogueGameplayTags::AI_Intent_Attack;
+
+    TArray<const FResolvedAction*> PendingMoves;
+    PendingMoves.Reserve(Resolved.Num());
+
+    for (const FResolvedAction& Action : Resolved)
+    {
+        if (Action.FinalAbilityTag.MatchesTag(AttackTag) || Action.AbilityTag.MatchesTag(AttackTag))
+        {
+            // CodeRevision: INC-2025-1213-R2 (Turbo simulation applies attack damage through the melee GAS path) (2025-12-26 11:00)
+            // Attacks execute before moves, against the player on its committed cell (melee reach = 1 cell)
+            ++Stats.EnemyAttacks;
+            AActor* Attacker = Action.Actor.Get();
+            const FIntPoint Offset = Attacker ? Occupancy->GetCellOfActor(Attacker) - Occupancy->GetCellOfActor(Player) : FIntPoint::ZeroValue;
+            const bool bInReach = Attacker && FMath::Max(FMath::Abs(Offset.X), FMath::Abs(Offset.Y)) <= 1;
+            if (!bInReach || IsOutOfHealth(Player) || !ApplyAttack(Attacker, Player, Config))
+            {
+                ++Stats.AttacksWithoutDamage;
+            }
+        }
+        else if (!Action.bIsWait && Action.FinalAbilityTag.MatchesTag(MoveTag) && Action.NextCell != Action.CurrentCell)
+        {
+            PendingMoves.Add(&Action);
+        }
+        else
+        {
+            ++Stats.EnemyWaits;
+        }
+    }
+
+    // Followers can only enter a cell after its occupant committed (two-phase commit in
+    // GridOccupancy), so repeat passes until nothing else can move.
+    Occupancy->BeginMovePhase();
+
+    bool bProgress = true;
+    while (bProgress && PendingMoves.Num() > 0)
+    {
+        bProgress = false;
+        for (int32 Index = PendingMoves.Num() - 1; Index >= 0; --Index)
+        {
+            const FResolvedAction& Action = *PendingMoves[Index];
+            AActor* Actor = Action.Actor.Get();
+
+            if (!Actor || Occupancy->UpdateActorCell(Actor, Action.NextCell))
+            {
+                if (Actor)
+                {
+                    ++Stats.EnemyMoves;
+                }
+                PendingMoves.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+                bProgress = true;
+            }
+        }
+    }
+
+    Stats.RejectedCommits += PendingMoves.Num();
+    Stats.EnemyWaits += PendingMoves.Num();
+
+    Occupancy->EndMovePhase();
+}
+
+// CodeRevision: INC-2025-1213-R2 (Turbo simulation applies attack damage through the melee GAS path) (2025-12-26 11:00)
+bool UTurboSimulationSubsystem::ApplyAttack(AActor* Attacker, AActor* Target, const FTurboSimConfig& Config) const
+{
+    UAbilitySystemComponent* SourceASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Attacker);
+    if (!SourceASC)
+    {
+        return false;
+    }
+
+    // Same effect and damage the granted melee ability applies in ApplyDamageToTarget
+    const UGA_MeleeAttack* Melee = nullptr;
+    for (const FGameplayAbilitySpec& Spec : SourceASC->GetActivatableAbilities())
+    {
+        Melee = Cast<UGA_MeleeAttack>(Spec.Ability);
+        if (Melee)
+        {
+            break;
+        }
+    }
+
+    const UGameplayEffect* Effect = Config.DamageEffectOverride ? Config.DamageEffectOverride.Get() : (Melee ? Melee->GetDamageEffect() : nullptr);
+    const float Damage = Melee ? Melee->GetEffectiveDamage() : -1.0f;
+    return UGA_MeleeAttack::ApplyMeleeDamage(SourceASC, Target, Effect, Damage, Melee ? static_cast<const UObject*>(Melee) : this);
+}
+
+void UTurboSimulationSubsystem::RemoveDeadEnemy(AActor* Enemy, FTurboSimStats& Stats)
+{
+    Occupancy->UnregisterActor(Enemy);
+    LiveEnemies.Remove(Enemy);
+    LiveEnemySet.Remove(Enemy);
+    ++Stats.EnemiesKilled;
+}
+
+bool UTurboSimulationSubsystem::IsOutOfHealth(const AActor* Actor)
+{
+    const UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Actor);
+    const ULyraHealthSet* HealthSet = ASC ? ASC->GetSet<ULyraHealthSet>() : nullptr;
+    return HealthSet && HealthSet->GetHealth() <= 0.0f;
+}
+
+uint32 UTurboSimulationSubsystem::HashUnitCells(AActor* Player, const TArray<AActor*>& Enemies, uint32 Seed) const
+{
+    uint32 Hash = Seed;
+    auto Mix = [&Hash](uint32 Value)
+    {
+        Hash ^= Value;
+        Hash *= 16777619u;
+    };
+
+    // CodeRevision: INC-2025-1213-R2 (Turbo simulation applies attack damage through the melee GAS path) (2025-12-26 11:00)
+    auto MixHealth = [&Mix](const AActor* Actor)
+    {
+        const UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Actor);
+        const ULyraHealthSet* HealthSet = ASC ? ASC->GetSet<ULyraHealthSet>() : nullptr;
+        Mix(HealthSet ? static_cast<uint32>(FMath::RoundToInt(HealthSet->GetHealth() * 100.0f)) : 0u);
+    };
+
+    const FIntPoint PlayerCell = Occupancy->GetCellOfActor(Player);
+    Mix(static_cast<uint32>(PlayerCell.X));
+    Mix(static_cast<uint32>(PlayerCell.Y));
+    MixHealth(Player);
+
+    for (AActor* Enemy : Enemies)
+    {
+        // Dead enemies hash as (-1,-1)
+        const FIntPoint Cell = LiveEnemySet.Contains(Enemy) ? Occupancy->GetCellOfActor(Enemy) : FIntPoint(-1, -1);
+        Mix(static_cast<uint32>(Cell.X));
+        Mix(static_cast<uint32>(Cell.Y));
+        MixHealth(Enemy);
+    }
+
+    return Hash;
+}
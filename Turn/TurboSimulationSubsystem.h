@@ -0,0 +1,186 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "TurnSystemTypes.h"
+#include "TurboSimulationSubsystem.generated.h"
+
+// Log category
+DECLARE_LOG_CATEGORY_EXTERN(LogTurboSim, Log, All);
+
+class UEnemyAISubsystem;
+class UTurnCorePhaseManager;
+class UGridPathfindingSubsystem;
+class UGridOccupancySubsystem;
+class UGameplayEffect;
+
+/**
+ * How the simulated player picks its action each turn.
+ */
+UENUM(BlueprintType)
+enum class ETurboPlayerPolicy : uint8
+{
+    // Uniformly random among the 8 directions and wait (seeded)
+    Random,
+    // Always wait in place (pure enemy convergence runs)
+    Wait,
+    // Replay ScriptedDirections in a loop (FIntPoint(0,0) = wait)
+    Scripted
+};
+
+USTRUCT(BlueprintType)
+struct LYRAGAME_API FTurboSimConfig
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TurboSim", meta = (ClampMin = 1))
+    int32 NumTurns = 1000;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TurboSim")
+    int32 Seed = 12345;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TurboSim")
+    ETurboPlayerPolicy PlayerPolicy = ETurboPlayerPolicy::Random;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TurboSim")
+    TArray<FIntPoint> ScriptedDirections;
+
+    // Silence per-turn pipeline logging (Warning and below) while the run is active
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TurboSim")
+    bool bSuppressPipelineLogs = true;
+
+    // CodeRevision: INC-2025-1213-R2 (Turbo simulation applies attack damage through the melee GAS path) (2025-12-26 11:00)
+    // Damage effect for every attack instead of the attacker's UGA_MeleeAttack effect (units without the ability, tests)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TurboSim")
+    TObjectPtr<UGameplayEffect> DamageEffectOverride = nullptr;
+};
+
+USTRUCT(BlueprintType)
+struct LYRAGAME_API FTurboSimStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "TurboSim")
+    int32 TurnsSimulated = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "TurboSim")
+    double WallSeconds = 0.0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "TurboSim")
+    double TurnsPerSecond = 0.0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "TurboSim")
+    int32 PlayerMoves = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "TurboSim")
+    int32 PlayerBlocked = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "TurboSim")
+    int32 EnemyMoves = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "TurboSim")
+    int32 EnemyWaits = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "TurboSim")
+    int32 EnemyAttacks = 0;
+
+    // CodeRevision: INC-2025-1213-R2 (Turbo simulation applies attack damage through the melee GAS path) (2025-12-26 11:00)
+    // Player steps into an enemy's cell (bump attack)
+    UPROPERTY(BlueprintReadOnly, Category = "TurboSim")
+    int32 PlayerAttacks = 0;
+
+    // Attacks that could not apply damage (target out of reach, no ASC or no damage effect)
+    UPROPERTY(BlueprintReadOnly, Category = "TurboSim")
+    int32 AttacksWithoutDamage = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "TurboSim")
+    int32 EnemiesKilled = 0;
+
+    // Turn index the player died on (-1 = survived; the run stops after that turn)
+    UPROPERTY(BlueprintReadOnly, Category = "TurboSim")
+    int32 PlayerDeathTurn = -1;
+
+    // Resolved moves the occupancy rejected at commit time (should stay 0)
+    UPROPERTY(BlueprintReadOnly, Category = "TurboSim")
+    int32 RejectedCommits = 0;
+
+    // FNV-1a over all unit cells and health after every turn (same seed + map => same hash)
+    UPROPERTY(BlueprintReadOnly, Category = "TurboSim")
+    int64 StateHash = 0;
+};
+
+/**
+ * UTurboSimulationSubsystem: headless turn loop for soak tests and balance runs.
+ *
+ * Runs observe -> think -> resolve -> execute -> cleanup synchronously for NumTurns turns in a
+ * single call. Execution commits resolved moves straight into GridOccupancy and applies attack
+ * damage with the melee ability's GameplayEffect (UGA_MeleeAttack::ApplyMeleeDamage) instead of
+ * dispatching abilities, so no montages, timers or barrier next-tick hops are involved.
+ * Units whose ULyraHealthSet health reaches 0 are removed; the run stops when the player dies.
+ * Works in any world with an initialized grid (including -nullrhi automation runs).
+ */
+UCLASS()
+class LYRAGAME_API UTurboSimulationSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+    /**
+     * Simulate Config.NumTurns turns.
+     * Player and Enemies must already be registered in GridOccupancy.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Turn|TurboSim")
+    FTurboSimStats RunTurbo(AActor* Player, const TArray<AActor*>& Enemies, const FTurboSimConfig& Config);
+
+    /** True while RunTurbo is executing (gameplay code may skip presentation work). */
+    UFUNCTION(BlueprintPure, Category = "Turn|TurboSim")
+    bool IsTurboActive() const { return bTurboActive; }
+
+    /** Default turn count for automation runs (ts.Turbo.Turns). */
+    static int32 GetDefaultTurnCount();
+
+private:
+    /** Player step for this turn according to the policy (FIntPoint(0,0) = wait). */
+    FIntPoint PickPlayerDirection(const FTurboSimConfig& Config, int32 TurnIndex, FRandomStream& Stream) const;
+
+    /** Apply one player step; returns true when the player changed cell. */
+    bool ApplyPlayerStep(AActor* Player, const FIntPoint& Direction);
+
+    /** Apply resolved attacks, then commit resolved moves in dependency order (leavers before followers). */
+    void CommitResolvedActions(const TArray<FResolvedAction>& Resolved, AActor* Player, const FTurboSimConfig& Config, FTurboSimStats& Stats);
+
+    /** Damage Target with Attacker's melee effect; returns false when no damage could be applied. */
+    bool ApplyAttack(AActor* Attacker, AActor* Target, const FTurboSimConfig& Config) const;
+
+    /** Enemy whose health reached 0: leaves the grid and the live set. */
+    void RemoveDeadEnemy(AActor* Enemy, FTurboSimStats& Stats);
+
+    static bool IsOutOfHealth(const AActor* Actor);
+
+    uint32 HashUnitCells(AActor* Player, const TArray<AActor*>& Enemies, uint32 Seed) const;
+
+    bool bTurboActive = false;
+
+    // Enemies still alive in the current run (only valid inside RunTurbo)
+    TArray<AActor*> LiveEnemies;
+
+    // CodeRevision: INC-2025-1213-R3 (Constant-time live-enemy lookups) (2025-12-27 14:00)
+    // Same actors as LiveEnemies, for the per-turn "is this enemy alive" checks
+    TSet<const AActor*> LiveEnemySet;
+
+    UPROPERTY(Transient)
+    TObjectPtr<UEnemyAISubsystem> EnemyAI = nullptr;
+
+    UPROPERTY(Transient)
+    TObjectPtr<UTurnCorePhaseManager> PhaseManager = nullptr;
+
+    UPROPERTY(Transient)
+    TObjectPtr<UGridPathfindingSubsystem> PathFinder = nullptr;
+
+    UPROPERTY(Transient)
+    TObjectPtr<UGridOccupancySubsystem> Occupancy = nullptr;
+};
@@ -14,6 +14,11 @@
 #include "AbilitySystemGlobals.h"
 #include "EngineUtils.h"
 #include "Utility/TurnAuthorityUtils.h"
+// CodeRevision: INC-2025-1230-R1 (Turn pipeline CPU profiling: trace scopes, STAT counters, rolling percentiles, Chrome trace export) (2025-12-23 10:00)
+#include "Turn/TurnProfilerSubsystem.h"
+#include "ProfilingDebugging/MiscTrace.h"
+// CodeRevision: INC-2025-1231-R1 (Flight recorder of recent turns: barrier events, dump on timeout) (2025-12-23 14:00)
+#include "Turn/TurnFlightRecorderSubsystem.h"
 
 // ============================================================================
 // Log category
@@ -38,10 +43,9 @@ void UTurnActionBarrierSubsystem::Initialize(FSubsystemCollectionBase& Collectio
 void UTurnActionBarrierSubsystem::Deinitialize()
 {
     // Warn if there are any pending actions when the subsystem shuts down
-    for (auto& TurnPair : TurnStates)
+    for (const auto& TurnPair : TurnStates)
     {
         const int32 TurnId = TurnPair.Key;
-        FTurnState& State = TurnPair.Value;
 
         const int32 PendingCount = GetPendingActionCount(TurnId);
         if (PendingCount > 0)
@@ -52,6 +56,14 @@ void UTurnActionBarrierSubsystem::Deinitialize()
         }
     }
 
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(TimeoutCheckTimer);
+    }
+    Slots.Empty();
+    FreeSlots.Empty();
+    DeadlineHeap.Empty();
+
     Super::Deinitialize();
 }
 
@@ -76,13 +88,20 @@ void UTurnActionBarrierSubsystem::BeginTurn(int32 TurnId)
     CurrentTurnId = TurnId;
     CurrentKey.TurnId = TurnId;
 
+    // CodeRevision: INC-2025-1211-R1 (Drop slots left over from a restarted turn instead of resetting maps) (2025-12-14 14:00)
+    if (const FTurnState* Existing = TurnStates.Find(TurnId))
+    {
+        if (Existing->PendingCount.load(std::memory_order_acquire) > 0)
+        {
+            ReleaseSlotsForTurn(TurnId);
+            TRACE_END_REGION(BarrierWaitRegion);
+        }
+    }
+
     // Initialize state for this turn
     FTurnState& State = TurnStates.FindOrAdd(TurnId);
     State.TurnStartTime = FPlatformTime::Seconds();
-    State.PendingActions.Reset();
-    State.ActionStartTimes.Reset();
-    State.ActorToAction.Reset();
-    State.ActionToActor.Reset();
+    State.PendingCount.store(0, std::memory_order_release);
 
     if (bEnableVerboseLogging)
     {
@@ -91,53 +110,44 @@ void UTurnActionBarrierSubsystem::BeginTurn(int32 TurnId)
 
     // Cleanup old turns (keep only the last 2 turns)
     RemoveOldTurns(TurnId);
-
-    // Timer-based timeout check (replaces Tick)
-    UWorld* World = GetWorld();
-    if (World)
-    {
-        World->GetTimerManager().SetTimer(
-            TimeoutCheckTimer,
-            this,
-            &UTurnActionBarrierSubsystem::CheckTimeouts,
-            1.0f,  // every 1 second
-            true   // looping
-        );
-    }
 }
 
 // ============================================================================
 // Public API: RegisterAction
 // ============================================================================
 
-FGuid UTurnActionBarrierSubsystem::RegisterAction(AActor* Actor, int32 TurnId)
+FTurnActionHandle UTurnActionBarrierSubsystem::RegisterAction(AActor* Actor, int32 TurnId)
 {
     // Server-only
     if (!IsServer())
     {
-        return FGuid();
+        return FTurnActionHandle();
     }
 
     if (!Actor)
     {
         UE_LOG(LogTurnBarrier, Warning, TEXT("[Barrier] RegisterAction: null Actor"));
-        return FGuid();
+        return FTurnActionHandle();
     }
 
-    // Generate a unique ActionId
-    FGuid ActionId = FGuid::NewGuid();
-
     // Get or create the turn state
     FTurnState& State = TurnStates.FindOrAdd(TurnId);
 
-    // Register this ActionId in the actor's pending set
-    State.PendingActions.FindOrAdd(Actor).Add(ActionId);
+    // CodeRevision: INC-2025-1211-R1 (Slot allocation + atomic counter replaces GUID generation and map inserts) (2025-12-14 14:00)
+    const FTurnActionHandle ActionId = AllocateSlot(Actor, TurnId);
+    const int32 TotalPending = State.PendingCount.fetch_add(1, std::memory_order_acq_rel) + 1;
 
-    // Record registration time for timeout detection
-    State.ActionStartTimes.Add(ActionId, FPlatformTime::Seconds());
+    // CodeRevision: INC-2025-1230-R1 (Turn pipeline CPU profiling: trace scopes, STAT counters, rolling percentiles, Chrome trace export) (2025-12-23 10:00)
+    if (TotalPending == 1)
+    {
+        State.WaitStartTime = FPlatformTime::Seconds();
+        TRACE_BEGIN_REGION(BarrierWaitRegion);
+    }
 
-    // Compute total pending count for logging
-    const int32 TotalPending = GetPendingActionCount(TurnId);
+    if (UTurnFlightRecorderSubsystem* Recorder = UTurnFlightRecorderSubsystem::Get(this))
+    {
+        Recorder->Record(ETurnFlightRecordKind::BarrierRegister, Actor, FIntPoint(-1, -1), FIntPoint(-1, -1), NAME_None, TotalPending);
+    }
 
     UE_LOG(LogTurnBarrier, Verbose,
         TEXT("[Barrier] REGISTER: Turn=%d Actor=%s Action=%s (Total=%d)"),
@@ -150,7 +160,7 @@ FGuid UTurnActionBarrierSubsystem::RegisterAction(AActor* Actor, int32 TurnId)
 // Public API: CompleteAction
 // ============================================================================
 
-void UTurnActionBarrierSubsystem::CompleteAction(AActor* Actor, int32 TurnId, const FGuid& ActionId)
+void UTurnActionBarrierSubsystem::CompleteAction(AActor* Actor, int32 TurnId, const FTurnActionHandle& ActionId)
 {
     // Server-only
     if (!IsServer())
@@ -158,91 +168,73 @@ void UTurnActionBarrierSubsystem::CompleteAction(AActor* Actor, int32 TurnId, co
         return;
     }
 
-    if (!Actor || !ActionId.IsValid())
+    if (!ActionId.IsValid())
     {
         return;
     }
 
     //--------------------------------------------------------------------------
-    // (1) Resolve turn state
+    // (1) Resolve slot (idempotent; stale generation means already completed)
     //--------------------------------------------------------------------------
-    FTurnState* State = TurnStates.Find(TurnId);
-    if (!State)
+    const FTurnActionSlot* Slot = ResolveSlot(ActionId);
+    if (!Slot)
     {
-        // Completion for an old / unknown turn is ignored (log only)
+        // Duplicate completion / completion after timeout is silently ignored (verbose only)
         if (bEnableVerboseLogging)
         {
             UE_LOG(LogTurnBarrier, Verbose,
-                TEXT("[Barrier] Complete(Ignored): Turn=%d Actor=%s Action=%s (Turn not found)"),
+                TEXT("[Barrier] Complete(Duplicate): Turn=%d Actor=%s Action=%s"),
                 TurnId, *GetNameSafe(Actor), *ActionId.ToString());
         }
         return;
     }
 
     //--------------------------------------------------------------------------
-    // (2) Lookup pending actions for this actor
+    // (2) Completion for a different turn is ignored (log only)
     //--------------------------------------------------------------------------
-    TArray<FGuid>* ActionSet = State->PendingActions.Find(Actor);
-    if (!ActionSet)
+    if (Slot->TurnId != TurnId || !TurnStates.Contains(TurnId))
     {
         if (bEnableVerboseLogging)
         {
             UE_LOG(LogTurnBarrier, Verbose,
-                TEXT("[Barrier] Complete(NoActor): Turn=%d Actor=%s Action=%s"),
-                TurnId, *GetNameSafe(Actor), *ActionId.ToString());
+                TEXT("[Barrier] Complete(Ignored): Turn=%d Actor=%s Action=%s (Slot turn=%d)"),
+                TurnId, *GetNameSafe(Actor), *ActionId.ToString(), Slot->TurnId);
         }
         return;
     }
 
     //--------------------------------------------------------------------------
-    // (3) Remove ActionId (idempotent; ignore if already removed)
+    // (3) Release the slot
     //--------------------------------------------------------------------------
-    const int32 RemovedCount = ActionSet->Remove(ActionId);
-    if (RemovedCount > 0)
+    const int32 Remaining = ReleaseSlot(ActionId.Index);
+
+    UE_LOG(LogTurnBarrier, Verbose,
+        TEXT("[Barrier] COMPLETE: Turn=%d Actor=%s Action=%s (Remaining=%d)"),
+        TurnId, *GetNameSafe(Actor), *ActionId.ToString(), Remaining);
+
+    // If we reached zero, notify listeners on the next tick to prevent recursion
+    if (Remaining == 0)
     {
-        // If the actor has no more actions, remove the actor entry
-        if (ActionSet->Num() == 0)
+        if (const FTurnState* State = TurnStates.Find(TurnId))
         {
-            State->PendingActions.Remove(Actor);
+            RecordBarrierWait(State->WaitStartTime, BarrierWaitRegion);
+        }
+        if (UTurnFlightRecorderSubsystem* Recorder = UTurnFlightRecorderSubsystem::Get(this))
+        {
+            Recorder->Record(ETurnFlightRecordKind::BarrierDrained, Actor, FIntPoint(-1, -1));
         }
 
-        // Remove from ActionStartTimes as well
-        State->ActionStartTimes.Remove(ActionId);
-
-        // Remaining actions after this completion
-        const int32 Remaining = GetPendingActionCount(TurnId);
-
-        UE_LOG(LogTurnBarrier, Verbose,
-            TEXT("[Barrier] COMPLETE: Turn=%d Actor=%s Action=%s (Remaining=%d)"),
-            TurnId, *GetNameSafe(Actor), *ActionId.ToString(), Remaining);
+        UE_LOG(LogTurnBarrier, Warning,
+            TEXT("[Barrier] Turn %d: ALL ACTIONS COMPLETED (Remaining=0) -> Scheduling OnAllMovesFinished (NextTick)"),
+            TurnId);
 
-        // If we reached zero, notify listeners on the next tick to prevent recursion
-        if (Remaining == 0)
+        if (UWorld* World = GetWorld())
         {
-            UE_LOG(LogTurnBarrier, Warning,
-                TEXT("[Barrier] Turn %d: ALL ACTIONS COMPLETED (Remaining=0) -> Scheduling OnAllMovesFinished (NextTick)"),
-                TurnId);
-
-            if (UWorld* World = GetWorld())
+            World->GetTimerManager().SetTimerForNextTick([this, TurnId]()
             {
-                World->GetTimerManager().SetTimerForNextTick([this, TurnId]()
-                {
-                    // Verify that the turn is still valid and we haven't moved past it (though unlikely in one tick)
-                    // Actually, we just want to signal that *that* turn finished.
-                    UE_LOG(LogTurnBarrier, Log, TEXT("[Barrier] Broadcasting OnAllMovesFinished for Turn %d"), TurnId);
-                    OnAllMovesFinished.Broadcast(TurnId);
-                });
-            }
-        }
-    }
-    else
-    {
-        // Duplicate completion is silently ignored (verbose only)
-        if (bEnableVerboseLogging)
-        {
-            UE_LOG(LogTurnBarrier, Verbose,
-                TEXT("[Barrier] Complete(Duplicate): Turn=%d Actor=%s Action=%s"),
-                TurnId, *GetNameSafe(Actor), *ActionId.ToString());
+                UE_LOG(LogTurnBarrier, Log, TEXT("[Barrier] Broadcasting OnAllMovesFinished for Turn %d"), TurnId);
+                OnAllMovesFinished.Broadcast(TurnId);
+            });
         }
     }
 }
@@ -253,23 +245,8 @@ void UTurnActionBarrierSubsystem::CompleteAction(AActor* Actor, int32 TurnId, co
 
 bool UTurnActionBarrierSubsystem::IsQuiescent(int32 TurnId) const
 {
-    const FTurnState* State = TurnStates.Find(TurnId);
-    if (!State)
-    {
-        // No state for this turn means nothing is pending
-        return true;
-    }
-
-    int32 ValidPendingCount = 0;
-    for (const auto& Pair : State->PendingActions)
-    {
-        if (Pair.Key.IsValid() && Pair.Value.Num() > 0)
-        {
-            ++ValidPendingCount;
-        }
-    }
-
-    return ValidPendingCount == 0;
+    // No state for this turn means nothing is pending
+    return GetPendingActionCount(TurnId) == 0;
 }
 
 // ============================================================================
@@ -279,34 +256,16 @@ bool UTurnActionBarrierSubsystem::IsQuiescent(int32 TurnId) const
 int32 UTurnActionBarrierSubsystem::GetPendingActionCount(int32 TurnId) const
 {
     const FTurnState* State = TurnStates.Find(TurnId);
-    if (!State)
-    {
-        return 0;
-    }
-
-    int32 Count = 0;
-    for (const auto& Pair : State->PendingActions)
-    {
-        if (Pair.Key.IsValid())
-        {
-            Count += Pair.Value.Num();
-        }
-    }
-    return Count;
+    return State ? State->PendingCount.load(std::memory_order_acquire) : 0;
 }
 
 // ============================================================================
 // Idempotent API: RegisterActionOnce
 // ============================================================================
 
-void UTurnActionBarrierSubsystem::RegisterActionOnce(AActor* Owner, FGuid& OutToken)
+void UTurnActionBarrierSubsystem::RegisterActionOnce(AActor* Owner, FTurnActionHandle& OutToken)
 {
-    if (!OutToken.IsValid())
-    {
-        OutToken = FGuid::NewGuid();
-    }
-
-    if (ActiveTokens.Contains(OutToken))
+    if (ResolveSlot(OutToken))
     {
         UE_LOG(LogTurnBarrier, VeryVerbose,
             TEXT("[RegisterActionOnce] Duplicate token=%s owner=%s"),
@@ -315,8 +274,8 @@ void UTurnActionBarrierSubsystem::RegisterActionOnce(AActor* Owner, FGuid& OutTo
         return;
     }
 
-    ActiveTokens.Add(OutToken);
-    TokenOwners.Add(OutToken, Owner);
+    // Tokens are not bound to a turn and therefore never counted toward quiescence
+    OutToken = AllocateSlot(Owner, INDEX_NONE);
 
     UE_LOG(LogTurnBarrier, Verbose,
         TEXT("[RegisterActionOnce] token=%s owner=%s"),
@@ -328,7 +287,7 @@ void UTurnActionBarrierSubsystem::RegisterActionOnce(AActor* Owner, FGuid& OutTo
 // Idempotent API: CompleteActionToken
 // ============================================================================
 
-void UTurnActionBarrierSubsystem::CompleteActionToken(const FGuid& Token)
+void UTurnActionBarrierSubsystem::CompleteActionToken(const FTurnActionHandle& Token)
 {
     if (!Token.IsValid())
     {
@@ -336,7 +295,8 @@ void UTurnActionBarrierSubsystem::CompleteActionToken(const FGuid& Token)
         return;
     }
 
-    if (!ActiveTokens.Remove(Token))
+    const FTurnActionSlot* Slot = ResolveSlot(Token);
+    if (!Slot || Slot->TurnId != INDEX_NONE)
     {
         UE_LOG(LogTurnBarrier, VeryVerbose,
             TEXT("[CompleteActionToken] unknown token=%s"),
@@ -344,114 +304,203 @@ void UTurnActionBarrierSubsystem::CompleteActionToken(const FGuid& Token)
         return;
     }
 
-    TokenOwners.Remove(Token);
+    ReleaseSlot(Token.Index);
     UE_LOG(LogTurnBarrier, Verbose,
         TEXT("[CompleteActionToken] token=%s completed"), *Token.ToString());
 }
 
 // ============================================================================
-// Timeout monitoring (timer-based; Tick removed)
+// Slot array (INC-2025-1211)
 // ============================================================================
 
-/*
-REMOVED: Tick is replaced with timer-based CheckTimeouts()
-void UTurnActionBarrierSubsystem::Tick(float DeltaTime)
+FTurnActionHandle UTurnActionBarrierSubsystem::AllocateSlot(AActor* Actor, int32 TurnId)
+{
+    int32 Index;
+    if (FreeSlots.Num() > 0)
+    {
+        Index = FreeSlots.Pop(EAllowShrinking::No);
+    }
+    else
+    {
+        Index = Slots.AddDefaulted();
+    }
+
+    FTurnActionSlot& Slot = Slots[Index];
+    Slot.Actor = Actor;
+    Slot.TurnId = TurnId;
+    Slot.StartTime = FPlatformTime::Seconds();
+    Slot.bActive = true;
+
+    FTurnActionHandle Handle;
+    Handle.Index = Index;
+    Handle.Generation = Slot.Generation;
+
+    // Only turn actions time out; idempotent tokens are owned by the caller
+    if (TurnId != INDEX_NONE)
+    {
+        DeadlineHeap.HeapPush({ Slot.StartTime + ActionTimeoutSeconds, Handle });
+        ScheduleTimeoutCheck();
+    }
+
+    return Handle;
+}
+
+FTurnActionSlot* UTurnActionBarrierSubsystem::ResolveSlot(const FTurnActionHandle& Handle)
+{
+    if (!Handle.IsValid() || !Slots.IsValidIndex(Handle.Index))
+    {
+        return nullptr;
+    }
+    FTurnActionSlot& Slot = Slots[Handle.Index];
+    return (Slot.bActive && Slot.Generation == Handle.Generation) ? &Slot : nullptr;
+}
+
+const FTurnActionSlot* UTurnActionBarrierSubsystem::ResolveSlot(const FTurnActionHandle& Handle) const
 {
-    SCOPE_CYCLE_COUNTER(STAT_TurnBarrierTick);
-    if (!IsServer()) return;
-    CheckTimeouts();
+    return const_cast<UTurnActionBarrierSubsystem*>(this)->ResolveSlot(Handle);
+}
+
+int32 UTurnActionBarrierSubsystem::ReleaseSlot(int32 Index)
+{
+    FTurnActionSlot& Slot = Slots[Index];
+    const int32 TurnId = Slot.TurnId;
+
+    Slot.bActive = false;
+    Slot.Actor.Reset();
+    Slot.TurnId = INDEX_NONE;
+    // Skip 0 on wrap-around so a released slot never matches a default handle
+    Slot.Generation = (Slot.Generation == MAX_int32) ? 1 : Slot.Generation + 1;
+    FreeSlots.Add(Index);
+
+    if (TurnId == INDEX_NONE)
+    {
+        return 0;
+    }
+
+    FTurnState* State = TurnStates.Find(TurnId);
+    return State ? State->PendingCount.fetch_sub(1, std::memory_order_acq_rel) - 1 : 0;
+}
+
+void UTurnActionBarrierSubsystem::ReleaseSlotsForTurn(int32 TurnId)
+{
+    for (int32 Index = 0; Index < Slots.Num(); ++Index)
+    {
+        if (Slots[Index].bActive && Slots[Index].TurnId == TurnId)
+        {
+            ReleaseSlot(Index);
+        }
+    }
+}
+
+void UTurnActionBarrierSubsystem::ScheduleTimeoutCheck()
+{
+    // Discard entries whose actions already completed
+    while (DeadlineHeap.Num() > 0 && !ResolveSlot(DeadlineHeap.HeapTop().Handle))
+    {
+        DeadlineHeap.HeapPopDiscard(EAllowShrinking::No);
+    }
+
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    if (DeadlineHeap.Num() == 0)
+    {
+        World->GetTimerManager().ClearTimer(TimeoutCheckTimer);
+        ScheduledDeadline = 0.0;
+        return;
+    }
+
+    const double NextDeadline = DeadlineHeap.HeapTop().Deadline;
+    if (ScheduledDeadline > 0.0 && ScheduledDeadline <= NextDeadline && World->GetTimerManager().IsTimerActive(TimeoutCheckTimer))
+    {
+        // Already armed for an earlier (or the same) deadline
+        return;
+    }
+
+    ScheduledDeadline = NextDeadline;
+    const float Delay = FMath::Max(static_cast<float>(NextDeadline - FPlatformTime::Seconds()), KINDA_SMALL_NUMBER);
+    World->GetTimerManager().SetTimer(
+        TimeoutCheckTimer,
+        this,
+        &UTurnActionBarrierSubsystem::CheckTimeouts,
+        Delay,
+        false  // one-shot; re-armed for the next deadline
+    );
 }
-*/
 
 // ============================================================================
-// CheckTimeouts: detect and force-complete timed-out actions
+// CheckTimeouts: force-complete actions whose deadline has passed
 // ============================================================================
 
 void UTurnActionBarrierSubsystem::CheckTimeouts()
 {
     const double Now = FPlatformTime::Seconds();
+    ScheduledDeadline = 0.0;
 
-    // Check all active turns
-    for (auto& TurnPair : TurnStates)
+    // Pop expired entries only; everything still in the heap is due later
+    TArray<FTurnActionHandle> Expired;
+    while (DeadlineHeap.Num() > 0 && DeadlineHeap.HeapTop().Deadline <= Now)
     {
-        const int32 TurnId = TurnPair.Key;
-        FTurnState& State = TurnPair.Value;
-
-        if (State.TurnStartTime <= 0.0)
+        FTurnActionDeadline Entry;
+        DeadlineHeap.HeapPop(Entry, EAllowShrinking::No);
+        if (ResolveSlot(Entry.Handle))
         {
-            continue;
+            Expired.Add(Entry.Handle);
         }
+    }
 
-        const double Elapsed = Now - State.TurnStartTime;
-        if (Elapsed < ActionTimeoutSeconds)
+    UTurnFlightRecorderSubsystem* Recorder = Expired.Num() > 0 ? UTurnFlightRecorderSubsystem::Get(this) : nullptr;
+    bool bAnyTimedOut = false;
+
+    for (const FTurnActionHandle& ActionId : Expired)
+    {
+        // An earlier CompleteAction in this loop (ability cancel) may already have released it
+        const FTurnActionSlot* Slot = ResolveSlot(ActionId);
+        if (!Slot)
         {
-            continue; // Turn is not timed out yet
+            continue;
         }
 
-        // Collect all actions that have exceeded the timeout
-        TArray<TWeakObjectPtr<AActor>> TimeoutActors;
-        TArray<FGuid> TimeoutActions;
-
-        for (const auto& ActorPair : State.PendingActions)
-        {
-            if (!ActorPair.Key.IsValid() || ActorPair.Value.Num() == 0)
-            {
-                continue;
-            }
+        AActor* Actor = Slot->Actor.Get();
+        const int32 TurnId = Slot->TurnId;
 
-            AActor* Actor = ActorPair.Key.Get();
+        UE_LOG(LogTurnBarrier, Error,
+            TEXT("[Barrier] Timeout: Turn=%d Actor=%s Action=%s Elapsed=%.2fs"),
+            TurnId, *GetNameSafe(Actor), *ActionId.ToString(), Now - Slot->StartTime);
 
-            for (const FGuid& ActionId : ActorPair.Value)
-            {
-                double* StartTime = State.ActionStartTimes.Find(ActionId);
-                if (!StartTime)
-                {
-                    continue;
-                }
-
-                const double ActionElapsed = Now - *StartTime;
-                if (ActionElapsed >= ActionTimeoutSeconds)
-                {
-                    TimeoutActors.Add(ActorPair.Key);
-                    TimeoutActions.Add(ActionId);
-
-                    UE_LOG(LogTurnBarrier, Error,
-                        TEXT("[Barrier] Timeout: Turn=%d Actor=%s Action=%s Elapsed=%.2fs"),
-                        TurnId, *GetNameSafe(Actor), *ActionId.ToString(), ActionElapsed);
-                }
-            }
+        bAnyTimedOut = true;
+        if (Recorder)
+        {
+            Recorder->Record(ETurnFlightRecordKind::BarrierTimeout, Actor, FIntPoint(-1, -1), FIntPoint(-1, -1), NAME_None,
+                FMath::RoundToInt32((Now - Slot->StartTime) * 1000.0));
         }
 
-        // Process all timed-out actions
-        for (int32 i = 0; i < TimeoutActors.Num(); ++i)
+        // Optionally cancel active abilities on timeout
+        if (bCancelAbilitiesOnTimeout && Actor)
         {
-            TWeakObjectPtr<AActor> ActorPtr = TimeoutActors[i];
-            const FGuid ActionId = TimeoutActions[i];
-
-            if (!ActorPtr.IsValid())
+            if (UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Actor))
             {
-                continue;
-            }
-
-            AActor* Actor = ActorPtr.Get();
+                UE_LOG(LogTurnBarrier, Warning,
+                    TEXT("[Barrier] Cancelling abilities due to timeout: Actor=%s"),
+                    *GetNameSafe(Actor));
 
-            // Optionally cancel active abilities on timeout
-            if (bCancelAbilitiesOnTimeout)
-            {
-                if (UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Actor))
-                {
-                    UE_LOG(LogTurnBarrier, Warning,
-                        TEXT("[Barrier] Cancelling abilities due to timeout: Actor=%s"),
-                        *GetNameSafe(Actor));
-
-                    ASC->CancelAbilities();
-                }
+                ASC->CancelAbilities();
             }
-
-            // Force-complete the timed-out action
-            CompleteAction(Actor, TurnId, ActionId);
         }
+
+        // Force-complete the timed-out action (no-op if the cancel already completed it)
+        CompleteAction(Actor, TurnId, ActionId);
+    }
+
+    if (Recorder && bAnyTimedOut)
+    {
+        Recorder->Dump(TEXT("BarrierTimeout"), /*bAutomatic*/true);
     }
+
+    ScheduleTimeoutCheck();
 }
 
 // ============================================================================
@@ -478,6 +527,7 @@ void UTurnActionBarrierSubsystem::RemoveOldTurns(int32 CurrentTurn)
             UE_LOG(LogTurnBarrier, Warning,
                 TEXT("[Barrier] Removing old turn with pending actions: Turn=%d Count=%d"),
                 Key, RemainingActions);
+            ReleaseSlotsForTurn(Key);
         }
         TurnStates.Remove(Key);
     }
@@ -508,29 +558,21 @@ void UTurnActionBarrierSubsystem::DumpTurnState(int32 TurnId) const
     UE_LOG(LogTurnBarrier, Log,
         TEXT("  TurnStartTime: %.2fs"), State->TurnStartTime);
     UE_LOG(LogTurnBarrier, Log,
-        TEXT("  Total Pending: %d"), GetPendingActionCount(TurnId));
+        TEXT("  Total Pending: %d (Slots=%d, Free=%d, Deadlines=%d)"),
+        GetPendingActionCount(TurnId), Slots.Num(), FreeSlots.Num(), DeadlineHeap.Num());
 
-    for (const auto& ActorPair : State->PendingActions)
+    const double Now = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < Slots.Num(); ++Index)
     {
-        if (!ActorPair.Key.IsValid())
+        const FTurnActionSlot& Slot = Slots[Index];
+        if (!Slot.bActive || Slot.TurnId != TurnId)
         {
             continue;
         }
 
-        AActor* Actor = ActorPair.Key.Get();
         UE_LOG(LogTurnBarrier, Log,
-            TEXT("  Actor: %s (Actions: %d)"),
-            *GetNameSafe(Actor), ActorPair.Value.Num());
-
-        for (const FGuid& ActionId : ActorPair.Value)
-        {
-            const double* StartTime = State->ActionStartTimes.Find(ActionId);
-            const double Elapsed = StartTime ? (FPlatformTime::Seconds() - *StartTime) : 0.0;
-
-            UE_LOG(LogTurnBarrier, Log,
-                TEXT("    - Action: %s (Elapsed: %.2fs)"),
-                *ActionId.ToString(), Elapsed);
-        }
+            TEXT("  Actor: %s - Action: %d:%d (Elapsed: %.2fs)"),
+            *GetNameSafe(Slot.Actor.Get()), Index, Slot.Generation, Now - Slot.StartTime);
     }
 
     UE_LOG(LogTurnBarrier, Log,
@@ -552,6 +594,13 @@ void UTurnActionBarrierSubsystem::StartMoveBatch(int32 InCount, int32 InTurnId)
     CurrentTurnId = InTurnId;
     PendingMoves = InCount;
 
+    // CodeRevision: INC-2025-1230-R1 (Turn pipeline CPU profiling: trace scopes, STAT counters, rolling percentiles, Chrome trace export) (2025-12-23 10:00)
+    if (InCount > 0)
+    {
+        MoveBatchStartTime = FPlatformTime::Seconds();
+        TRACE_BEGIN_REGION(MoveBatchWaitRegion);
+    }
+
     UE_LOG(LogTurnBarrier, Log,
         TEXT("Turn %d: StartMoveBatch Count=%d"),
         InTurnId, InCount);
@@ -628,6 +677,12 @@ void UTurnActionBarrierSubsystem::ForceFinishBarrier()
         TEXT("Turn %d: ForceFinishBarrier (Pending=%d)"),
         CurrentKey.TurnId, PendingMoves);
 
+    if (UTurnFlightRecorderSubsystem* Recorder = UTurnFlightRecorderSubsystem::Get(this))
+    {
+        Recorder->Record(ETurnFlightRecordKind::BarrierForceFinish, nullptr, FIntPoint(-1, -1), FIntPoint(-1, -1), NAME_None, PendingMoves);
+        Recorder->Dump(TEXT("ForceFinishBarrier"), /*bAutomatic*/true);
+    }
+
     PendingMoves = 0;
     FireAllFinished(CurrentKey.TurnId);
 }
@@ -673,6 +728,12 @@ void UTurnActionBarrierSubsystem::FireAllFinished(int32 TurnId)
         TEXT("Turn %d: FireAllFinished - Broadcasting OnAllMovesFinished"),
         TurnId);
 
+    if (MoveBatchStartTime > 0.0)
+    {
+        RecordBarrierWait(MoveBatchStartTime, MoveBatchWaitRegion);
+        MoveBatchStartTime = 0.0;
+    }
+
     // Blueprint-facing delegate
     OnAllMovesFinished.Broadcast(TurnId);
 
@@ -685,3 +746,21 @@ void UTurnActionBarrierSubsystem::FireAllFinished(int32 TurnId)
     // Reset per-turn notification set
     NotifiedActorsThisTurn.Empty();
 }
+
+// ============================================================================
+// Internal helper: barrier wait profiling
+// ============================================================================
+
+// CodeRevision: INC-2025-1230-R1 (Turn pipeline CPU profiling: trace scopes, STAT counters, rolling percentiles, Chrome trace export) (2025-12-23 10:00)
+void UTurnActionBarrierSubsystem::RecordBarrierWait(double WaitStartTime, const TCHAR* RegionName)
+{
+    // CodeRevision: INC-2025-1230-R2 (Separate Insights regions for barrier slots and legacy move batches) (2025-12-27 11:00)
+    TRACE_END_REGION(RegionName);
+
+    UWorld* World = GetWorld();
+    UTurnProfilerSubsystem* Profiler = World ? World->GetSubsystem<UTurnProfilerSubsystem>() : nullptr;
+    if (Profiler && Profiler->IsEnabled() && WaitStartTime > 0.0)
+    {
+        Profiler->AddPhaseTime(ETurnProfilePhase::BarrierWait, WaitStartTime, FPlatformTime::Seconds() - WaitStartTime);
+    }
+}
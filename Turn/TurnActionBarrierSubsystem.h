@@ -9,6 +9,8 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
+#include "Turn/TurnSystemTypes.h"
+#include <atomic>
 #include "TurnActionBarrierSubsystem.generated.h"
 
 // ============================================================================
@@ -49,31 +51,68 @@ struct FTurnKey
 // ============================================================================
 // ★★★ Phase 1: ターン状態構造体（ActionID管理用）
 // ============================================================================
-USTRUCT()
+// CodeRevision: INC-2025-1211-R1 (Per-turn atomic pending counter replaces FGuid maps) (2025-12-14 14:00)
 struct FTurnState
 {
-    GENERATED_BODY()
+    /** Pending action count (inc on slot allocate, dec on release; makes IsQuiescent O(1)) */
+    std::atomic<int32> PendingCount{ 0 };
 
-    /** ペンディング中の ActionID 集合 */
-    TSet<FGuid> PendingActionIds;
+    /** Turn start time */
+    double TurnStartTime = 0.0;
 
-    /** Actor ごとの未完了 ActionID */
-    TMap<TWeakObjectPtr<AActor>, FGuid> ActorToAction;
+    // CodeRevision: INC-2025-1230-R1 (Turn pipeline CPU profiling: trace scopes, STAT counters, rolling percentiles, Chrome trace export) (2025-12-23 10:00)
+    /** When PendingCount last went 0 -> 1 (start of the current barrier wait) */
+    double WaitStartTime = 0.0;
 
-    /** ActionID から Actor への逆引き */
-    TMap<FGuid, TWeakObjectPtr<AActor>> ActionToActor;
+    FTurnState() = default;
 
-    /** Actor ごとの保留アクション配列（複数アクション対応） */
-    TMap<TWeakObjectPtr<AActor>, TArray<FGuid>> PendingActions;
+    FTurnState(const FTurnState& Other)
+        : PendingCount(Other.PendingCount.load(std::memory_order_relaxed))
+        , TurnStartTime(Other.TurnStartTime)
+        , WaitStartTime(Other.WaitStartTime)
+    {
+    }
 
-    /** ActionID開始時刻マップ（タイムアウト検出用） */
-    TMap<FGuid, double> ActionStartTimes;
+    FTurnState& operator=(const FTurnState& Other)
+    {
+        PendingCount.store(Other.PendingCount.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        TurnStartTime = Other.TurnStartTime;
+        WaitStartTime = Other.WaitStartTime;
+        return *this;
+    }
+};
 
-    /** ターン開始時刻 */
-    double TurnStartTime = 0.0;
+// ============================================================================
+// Action slot (element of the generational slot array)
+// ============================================================================
+struct FTurnActionSlot
+{
+    /** Owning actor (logging / ability cancel on timeout) */
+    TWeakObjectPtr<AActor> Actor;
+
+    /** Owning turn (INDEX_NONE = idempotent token, not counted per turn) */
+    int32 TurnId = INDEX_NONE;
+
+    /** Bumped on every release; a handle is live only while its generation matches */
+    int32 Generation = 1;
+
+    /** Registration time */
+    double StartTime = 0.0;
+
+    bool bActive = false;
 };
 
+/** Timeout heap entry (entries for completed actions are discarded lazily) */
+struct FTurnActionDeadline
+{
+    double Deadline = 0.0;
+    FTurnActionHandle Handle;
 
+    bool operator<(const FTurnActionDeadline& Other) const
+    {
+        return Deadline < Other.Deadline;
+    }
+};
 
 // ============================================================================
 // TurnActionBarrierSubsystem
@@ -88,6 +127,9 @@ struct FTurnState
  * - Phase 4: IsQuiescent()による二重鍵
  * - Phase 5: Gate再オープン（TurnManagerに移管）
  * - Phase 6: タイムアウトとGAキャンセル
+ *
+ * INC-2025-1211: actions live in a generational slot array with a per-turn atomic counter.
+ * Deadlines go into a min-heap; a one-shot timer is armed for the earliest one (no periodic sweep).
  */
 UCLASS(Config = Game)
 class LYRAGAME_API UTurnActionBarrierSubsystem : public UWorldSubsystem
@@ -110,15 +152,15 @@ public:
     void BeginTurn(int32 TurnId);
 
     /** アクション登録 */
-    FGuid RegisterAction(AActor* Actor, int32 TurnId);
+    FTurnActionHandle RegisterAction(AActor* Actor, int32 TurnId);
 
-    /** アクション完了 */
-    void CompleteAction(AActor* Actor, int32 TurnId, const FGuid& ActionId);
+    /** Complete an action (stale generation / duplicate completion is ignored) */
+    void CompleteAction(AActor* Actor, int32 TurnId, const FTurnActionHandle& ActionId);
 
-    /** 全アクション完了確認 */
+    /** 全アクション完了確認 (O(1)) */
     bool IsQuiescent(int32 TurnId) const;
 
-    /** 未完了アクション数取得 */
+    /** 未完了アクション数取得 (O(1)) */
     int32 GetPendingActionCount(int32 TurnId) const;
 
     /** 現在のターンID取得 */
@@ -136,20 +178,18 @@ public:
 
     /** 重複安全な登録（Ownerはログ表示目的） */
     UFUNCTION(BlueprintCallable, Category = "TurnBarrier")
-    void RegisterActionOnce(AActor* Owner, FGuid& OutToken);
+    void RegisterActionOnce(AActor* Owner, FTurnActionHandle& OutToken);
 
     /** 重複安全な完了 */
     UFUNCTION(BlueprintCallable, Category = "TurnBarrier")
-    void CompleteActionToken(const FGuid& Token);
+    void CompleteActionToken(const FTurnActionHandle& Token);
 
     //==========================================================================
     // ★★★ Phase 6: タイムアウト管理
     //==========================================================================
 
-    /** タイムアウトチェック */
+    /** Timeout check (pops expired entries from the deadline heap) */
     void CheckTimeouts();
-    void CompactTurnState(FTurnState& State);
-    bool RemoveActionById(FTurnState& State, const FGuid& ActionId);
 
     //==========================================================================
     // ★★★ デリゲート（Blueprint購読用）
@@ -270,6 +310,15 @@ private:
     /** ★★★ レガシー: 待機中のアクション数 */
     int32 PendingMoves = 0;
 
+    // CodeRevision: INC-2025-1230-R1 (Turn pipeline CPU profiling: trace scopes, STAT counters, rolling percentiles, Chrome trace export) (2025-12-23 10:00)
+    /** Legacy batch start (StartMoveBatch), reported as a barrier wait by FireAllFinished */
+    double MoveBatchStartTime = 0.0;
+
+    // CodeRevision: INC-2025-1230-R2 (Separate Insights regions for barrier slots and legacy move batches) (2025-12-27 11:00)
+    /** Insights regions: action slots (RegisterAction) and the legacy batch (StartMoveBatch) can overlap */
+    static constexpr const TCHAR* BarrierWaitRegion = TEXT("Rogue.BarrierWait");
+    static constexpr const TCHAR* MoveBatchWaitRegion = TEXT("Rogue.BarrierWait.MoveBatch");
+
     /** ★★★ レガシー: 既に通知済みのユニット（二重通知防止 - 永続的） */
     TSet<TWeakObjectPtr<AActor>> AlreadyNotified;
 
@@ -283,16 +332,20 @@ private:
     FTimerHandle TimeoutCheckTimer;
 
     //==========================================================================
-    // ★★★ Token方式の状態管理（冪等API用）
+    // ★★★ INC-2025-1211: Generational slot array
     //==========================================================================
 
-    /** 有効トークン集合 */
-    UPROPERTY(Transient)
-    TSet<FGuid> ActiveTokens;
+    /** Action slots (addressed directly by handle Index) */
+    TArray<FTurnActionSlot> Slots;
+
+    /** Free slot indices (reused LIFO) */
+    TArray<int32> FreeSlots;
 
-    /** デバッグ用：トークン→所有者 */
-    UPROPERTY(Transient)
-    TMap<FGuid, TWeakObjectPtr<AActor>> TokenOwners;
+    /** Min-heap of action deadlines */
+    TArray<FTurnActionDeadline> DeadlineHeap;
+
+    /** Deadline the timer is currently armed for (0 = none) */
+    double ScheduledDeadline = 0.0;
 
     //==========================================================================
     // 内部メソッド
@@ -301,9 +354,28 @@ private:
     /** サーバーかどうかを判定 */
     bool IsServer() const;
 
+    /** Allocate a slot and push its deadline */
+    FTurnActionHandle AllocateSlot(AActor* Actor, int32 TurnId);
+
+    /** Live slot for Handle (nullptr if released or generation mismatch) */
+    FTurnActionSlot* ResolveSlot(const FTurnActionHandle& Handle);
+    const FTurnActionSlot* ResolveSlot(const FTurnActionHandle& Handle) const;
+
+    /** Release a slot (bump generation, decrement turn counter). Returns remaining count for that turn */
+    int32 ReleaseSlot(int32 Index);
+
+    /** Release all slots of a turn (turn restart / old turn pruning) */
+    void ReleaseSlotsForTurn(int32 TurnId);
+
+    /** Re-arm the one-shot timer for the earliest pending deadline */
+    void ScheduleTimeoutCheck();
+
     /** 完了デリゲートを発火 */
     void FireAllFinished(int32 TurnId);
 
+    /** Close RegionName and report one barrier wait to the turn profiler */
+    void RecordBarrierWait(double WaitStartTime, const TCHAR* RegionName);
+
     /** タイムアウト時のコールバック */
     void OnSafetyTimeout();
 };
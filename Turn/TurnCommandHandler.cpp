@@ -16,6 +16,11 @@
 #include "Turn/GameTurnManagerBase.h"
 #include "Turn/MoveReservationSubsystem.h"
 #include "AI/Enemy/EnemyTurnDataSubsystem.h"
+#include "Turn/TurnReplaySubsystem.h"
+#include "AI/Enemy/EnemySpeculationSubsystem.h"
+#include "Turn/PlayerTravelSubsystem.h"
+// CodeRevision: INC-2025-1231-R1 (Flight recorder of recent turns) (2025-12-23 14:00)
+#include "Turn/TurnFlightRecorderSubsystem.h"
 
 //------------------------------------------------------------------------------
 // Subsystem Lifecycle
@@ -181,6 +186,22 @@ bool UTurnCommandHandler::ProcessPlayerCommand(const FPlayerCommand& Command)
 			*GetNameSafe(TargetActor),
 			TargetCell.X, TargetCell.Y);
 
+		// CodeRevision: INC-2025-1216-R1 (Record accepted attack commands for turn replay) (2025-12-16 10:00)
+		if (UTurnReplaySubsystem* Replay = GetWorld()->GetSubsystem<UTurnReplaySubsystem>())
+		{
+			Replay->NoteAcceptedCommand(Command);
+		}
+		if (UTurnFlightRecorderSubsystem* Recorder = UTurnFlightRecorderSubsystem::Get(this))
+		{
+			Recorder->RecordCommand(Command);
+		}
+
+		// CodeRevision: INC-2025-1217-R1 (Attacks can change enemy state the speculative plans did not see) (2025-12-16 14:00)
+		if (UEnemySpeculationSubsystem* Speculation = GetWorld()->GetSubsystem<UEnemySpeculationSubsystem>())
+		{
+			Speculation->CancelSpeculation();
+		}
+
 		ASC->HandleGameplayEvent(AttackEventData.EventTag, &AttackEventData);
 
 		// CodeRevision: INC-2025-1122-ATTACK-SEQ-R1 (Do NOT trigger enemy phase immediately for attack commands) (2025-11-22)
@@ -418,6 +439,17 @@ void UTurnCommandHandler::MarkCommandAsAccepted(const FPlayerCommand& Command)
 {
 	LastAcceptedCommands.Add(Command.TurnId, Command);
 
+	// CodeRevision: INC-2025-1216-R1 (Record accepted move commands for turn replay) (2025-12-16 10:00)
+	if (UTurnReplaySubsystem* Replay = GetWorld() ? GetWorld()->GetSubsystem<UTurnReplaySubsystem>() : nullptr)
+	{
+		Replay->NoteAcceptedCommand(Command);
+	}
+	// CodeRevision: INC-2025-1231-R1 (Flight recorder of recent turns) (2025-12-23 14:00)
+	if (UTurnFlightRecorderSubsystem* Recorder = UTurnFlightRecorderSubsystem::Get(this))
+	{
+		Recorder->RecordCommand(Command);
+	}
+
 	UE_LOG(LogTurnManager, Log, TEXT("[TurnCommandHandler] Command marked as accepted: TurnId=%d, Tag=%s"),
 		Command.TurnId, *Command.CommandTag.ToString());
 }
@@ -432,6 +464,25 @@ void UTurnCommandHandler::BeginInputWindow(int32 WindowId)
 	bInputWindowOpen = true;
 
 	UE_LOG(LogTurnManager, Log, TEXT("[TurnCommandHandler] Input window opened: WindowId=%d"), WindowId);
+
+	// CodeRevision: INC-2025-1218-R1 (Travel decides its next step before speculation reads it) (2025-12-17 10:00)
+	if (UPlayerTravelSubsystem* Travel = GetWorld() ? GetWorld()->GetSubsystem<UPlayerTravelSubsystem>() : nullptr)
+	{
+		Travel->NoteInputWindowOpened(this);
+	}
+
+	// CodeRevision: INC-2025-1217-R1 (Plan enemy responses while the player decides) (2025-12-16 14:00)
+	if (UEnemySpeculationSubsystem* Speculation = GetWorld() ? GetWorld()->GetSubsystem<UEnemySpeculationSubsystem>() : nullptr)
+	{
+		const UTurnFlowCoordinator* TFC = GetWorld()->GetSubsystem<UTurnFlowCoordinator>();
+		Speculation->BeginSpeculation(TFC ? TFC->GetCurrentTurnId() : INDEX_NONE);
+	}
+
+	// CodeRevision: INC-2025-1216-R1 (Let the replayer feed the next recorded command) (2025-12-16 10:00)
+	if (UTurnReplaySubsystem* Replay = GetWorld() ? GetWorld()->GetSubsystem<UTurnReplaySubsystem>() : nullptr)
+	{
+		Replay->NoteInputWindowOpened(this);
+	}
 }
 
 //------------------------------------------------------------------------------
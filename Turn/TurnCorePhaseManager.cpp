@@ -8,6 +8,9 @@
 #include "Turn/GameTurnManagerBase.h"
 #include "Turn/MoveReservationSubsystem.h"
 #include "Turn/TurnFlowCoordinator.h"
+#include "Turn/TurnReplaySubsystem.h"
+#include "Turn/TurnProfilerSubsystem.h"
+#include "Turn/TurnFlightRecorderSubsystem.h"
 #include "TurnSystemTypes.h"
 #include "../Grid/GridOccupancySubsystem.h"
 #include "../Utility/GridUtils.h"
@@ -59,27 +62,6 @@ namespace TurnCorePhaseManagerPrivate
     }
 }
 
-static int32 ReadGenerationOrderFromBlueprint(const AActor* Actor)
-{
-    static const FName GenName(TEXT("GenerationOrder"));
-
-    if (!Actor)
-    {
-        return TNumericLimits<int32>::Max();
-    }
-
-    if (const FIntProperty* Prop = FindFProperty<FIntProperty>(Actor->GetClass(), GenName))
-    {
-        if (const int32* ValuePtr = Prop->ContainerPtrToValuePtr<int32>(Actor))
-        {
-            const int32 Order = *ValuePtr;
-            return Order >= 0 ? Order : TNumericLimits<int32>::Max();
-        }
-    }
-
-    return TNumericLimits<int32>::Max();
-}
-
 void UTurnCorePhaseManager::Initialize(FSubsystemCollectionBase& Collection)
 {
     Super::Initialize(Collection);
@@ -190,6 +172,8 @@ void UTurnCorePhaseManager::CoreObservationPhase(const FIntPoint& PlayerCell)
 
 TArray<FEnemyIntent> UTurnCorePhaseManager::CoreThinkPhase(const TArray<AActor*>& Enemies)
 {
+    TURN_PROFILE_SCOPE(this, Think);
+
     TArray<FEnemyIntent> Intents;
     Intents.Reserve(Enemies.Num());
 
@@ -219,6 +203,23 @@ TArray<FEnemyIntent> UTurnCorePhaseManager::CoreThinkPhase(const TArray<AActor*>
 
 TArray<FResolvedAction> UTurnCorePhaseManager::CoreResolvePhase(const TArray<FEnemyIntent>& Intents)
 {
+    TArray<FResolvedAction> Resolved;
+    CoreResolveIntents(Intents, Resolved);
+    return Resolved;
+}
+
+void UTurnCorePhaseManager::CoreResolveIntents(TArrayView<const FEnemyIntent> Intents, TArray<FResolvedAction>& OutResolved)
+{
+    TURN_PROFILE_SCOPE(this, Resolve);
+    OutResolved.Reset();
+
+    // CodeRevision: INC-2025-1231-R1 (Flight recorder of recent turns) (2025-12-23 14:00)
+    UTurnFlightRecorderSubsystem* Recorder = UTurnFlightRecorderSubsystem::Get(this);
+    if (Recorder)
+    {
+        Recorder->RecordIntents(Intents);
+    }
+
     UConflictResolverSubsystem* ConflictResolverPtr = ConflictResolver.Get();
     UStableActorRegistry* ActorRegistryPtr = ActorRegistry.Get();
     UDistanceFieldSubsystem* DistanceFieldPtr = DistanceField.Get();
@@ -228,7 +229,7 @@ TArray<FResolvedAction> UTurnCorePhaseManager::CoreResolvePhase(const TArray<FEn
         UE_LOG(LogTurnCore, Error,
             TEXT("[TurnCore] CoreResolvePhase: Required subsystems are null (ConflictResolver=%p, ActorRegistry=%p, DistanceField=%p)"),
             ConflictResolverPtr, ActorRegistryPtr, DistanceFieldPtr);
-        return TArray<FResolvedAction>();
+        return;
     }
 
     UGridOccupancySubsystem* GridOccupancy = GetWorld()->GetSubsystem<UGridOccupancySubsystem>();
@@ -355,16 +356,16 @@ TArray<FResolvedAction> UTurnCorePhaseManager::CoreResolvePhase(const TArray<FEn
         Entry.CurrentCell      = LiveCurrentCell;
         Entry.Cell             = ResolvedNextCell;
         Entry.AbilityTag       = ResolvedAbilityTag;
-        Entry.ActionTier       = 1;    // TODO: use GetActionTier if we introduce tiered abilities
-        Entry.BasePriority     = 100;
         Entry.DistanceReduction= DistanceReduction;
-        Entry.GenerationOrder  = ReadGenerationOrderFromBlueprint(Actor);
+        // CodeRevision: INC-2025-1210-R2 (Planner and resolver rank movers from one priority source) (2025-12-26 10:00)
+        UConflictResolverSubsystem::AssignPriority(Entry);
 
         ConflictResolverPtr->AddReservation(Entry);
     }
 
     // Run the conflict resolver to convert reservations into resolved actions.
-    TArray<FResolvedAction> Resolved = ConflictResolverPtr->ResolveAllConflicts();
+    // CodeRevision: INC-2025-1214-R3 (No hidden arena fallback; resolve outputs filled into reused caller arrays) (2025-12-27 12:00)
+    ConflictResolverPtr->ResolveAllConflictsInto(OutResolved);
 
     // Build a stable hash for debugging determinism across runs.
     uint32 TurnHash = 2166136261u;
@@ -374,7 +375,7 @@ TArray<FResolvedAction> UTurnCorePhaseManager::CoreResolvePhase(const TArray<FEn
         TurnHash *= 16777619u;
     };
 
-    for (const FResolvedAction& Action : Resolved)
+    for (const FResolvedAction& Action : OutResolved)
     {
         Mix(static_cast<uint32>(Action.GenerationOrder));
         Mix(GetTypeHash(Action.ActorID.PersistentGUID.A));
@@ -387,7 +388,17 @@ TArray<FResolvedAction> UTurnCorePhaseManager::CoreResolvePhase(const TArray<FEn
 
     UE_LOG(LogTurnCore, Log,
         TEXT("[TurnCore] ResolvePhase: Resolved %d actions, Hash=0x%08X"),
-        Resolved.Num(), TurnHash);
+        OutResolved.Num(), TurnHash);
+
+    // CodeRevision: INC-2025-1216-R1 (Feed the GUID-free resolve digest to the turn replay recorder) (2025-12-16 10:00)
+    if (UTurnReplaySubsystem* Replay = GetWorld()->GetSubsystem<UTurnReplaySubsystem>())
+    {
+        Replay->NoteResolvedActions(OutResolved);
+    }
+    if (Recorder)
+    {
+        Recorder->RecordResolved(OutResolved);
+    }
 
     // Only true movement actions should reserve destination cells with the MoveReservation subsystem.
     UMoveReservationSubsystem* MoveRes = nullptr;
@@ -398,7 +409,7 @@ TArray<FResolvedAction> UTurnCorePhaseManager::CoreResolvePhase(const TArray<FEn
 
     if (MoveRes)
     {
-        for (FResolvedAction& Action : Resolved)
+        for (FResolvedAction& Action : OutResolved)
         {
             const bool bIsMoveLikeAction = Action.FinalAbilityTag.MatchesTag(MoveTag);
 
@@ -412,7 +423,7 @@ TArray<FResolvedAction> UTurnCorePhaseManager::CoreResolvePhase(const TArray<FEn
                         *GetNameSafe(Action.SourceActor.Get()), Action.NextCell.X, Action.NextCell.Y);
 
                     Action.bIsWait = true;
-                    Action.ResolutionReason = TEXT("Move reservation failed - converted to wait");
+                    Action.SetResolution(EResolutionReason::MoveReservationFailed, Action.NextCell);
                 }
             }
             else
@@ -422,7 +433,7 @@ TArray<FResolvedAction> UTurnCorePhaseManager::CoreResolvePhase(const TArray<FEn
                     *GetNameSafe(Action.SourceActor.Get()),
                     Action.bIsWait ? 1 : 0,
                     *Action.FinalAbilityTag.ToString(),
-                    *Action.ResolutionReason);
+                    *Action.DescribeResolution());
             }
         }
     }
@@ -430,8 +441,6 @@ TArray<FResolvedAction> UTurnCorePhaseManager::CoreResolvePhase(const TArray<FEn
     {
         UE_LOG(LogTurnCore, Error, TEXT("[TurnCore] MoveReservationSubsystem not found - skipping move registration"));
     }
-
-    return Resolved;
 }
 
 // ============================================================================
@@ -440,6 +449,8 @@ TArray<FResolvedAction> UTurnCorePhaseManager::CoreResolvePhase(const TArray<FEn
 
 void UTurnCorePhaseManager::CoreExecutePhase(const TArray<FResolvedAction>& ResolvedActions)
 {
+    TURN_PROFILE_SCOPE(this, Execute);
+
     AGameTurnManagerBase* TurnManager = ResolveTurnManager();
     UMoveReservationSubsystem* MoveResSubsystem = nullptr;
     if (UWorld* World = GetWorld())
@@ -544,12 +555,51 @@ void UTurnCorePhaseManager::CoreExecutePhase(const TArray<FResolvedAction>& Reso
 
 void UTurnCorePhaseManager::CoreCleanupPhase()
 {
-    if (ConflictResolver)
+    UTurnReplaySubsystem* Replay = GetWorld() ? GetWorld()->GetSubsystem<UTurnReplaySubsystem>() : nullptr;
+
+    {
+        TURN_PROFILE_SCOPE(this, Cleanup);
+
+        if (ConflictResolver)
+        {
+            ConflictResolver->ClearReservations();
+        }
+
+        // CodeRevision: INC-2025-1214-R1 (Release every phase temporary in one arena reset) (2025-12-15 14:00)
+        // CodeRevision: INC-2025-1214-R2 (Reset only this world's arena) (2025-12-26 12:00)
+        FTurnFrameArena& Arena = FrameArena;
+        const SIZE_T ArenaBytes = Arena.GetBytesUsed();
+        Arena.Reset();
+
+        UE_LOG(LogTurnCore, Log, TEXT("[TurnCore] CleanupPhase: Complete (FrameArena=%llu bytes, Capacity=%llu)"),
+            (uint64)ArenaBytes, (uint64)Arena.GetCapacity());
+    }
+
+    // CodeRevision: INC-2025-1216-R1 (Close the turn replay frame after cleanup is timed) (2025-12-16 10:00)
+    if (Replay)
+    {
+        Replay->NoteTurnCompleted();
+    }
+
+    // CodeRevision: INC-2025-1230-R1 (Turn pipeline CPU profiling: trace scopes, STAT counters, rolling percentiles, Chrome trace export) (2025-12-23 10:00)
+    UWorld* World = GetWorld();
+    const UTurnFlowCoordinator* TFC = World ? World->GetSubsystem<UTurnFlowCoordinator>() : nullptr;
+    const int32 TurnId = TFC ? TFC->GetCurrentTurnId() : INDEX_NONE;
+    UTurnProfilerSubsystem* Profiler = World ? World->GetSubsystem<UTurnProfilerSubsystem>() : nullptr;
+    if (Profiler)
     {
-        ConflictResolver->ClearReservations();
+        const AGameTurnManagerBase* TurnManager = ResolveTurnManager();
+        Profiler->NoteTurnCompleted(TurnId,
+            TurnManager ? TConstArrayView<TObjectPtr<UObject>>(TurnManager->DebugObservers) : TConstArrayView<TObjectPtr<UObject>>());
     }
 
-    UE_LOG(LogTurnCore, Log, TEXT("[TurnCore] CleanupPhase: Complete"));
+    // CodeRevision: INC-2025-1231-R1 (Flight recorder of recent turns: phase timings and turn end marker) (2025-12-23 14:00)
+    if (UTurnFlightRecorderSubsystem* Recorder = UTurnFlightRecorderSubsystem::Get(this))
+    {
+        const bool bHasPhases = Profiler && Profiler->IsEnabled() && Profiler->GetWindow().Num() > 0
+            && Profiler->GetWindow().GetSample(0).TurnId == TurnId;
+        Recorder->RecordTurnEnd(TurnId, bHasPhases ? &Profiler->GetWindow().GetSample(0) : nullptr);
+    }
 }
 
 // ============================================================================
@@ -603,7 +653,7 @@ AGameTurnManagerBase* UTurnCorePhaseManager::ResolveTurnManager()
 
 void UTurnCorePhaseManager::BucketizeIntentsBySlot(
     const TArray<FEnemyIntent>& All,
-    TArray<TArray<FEnemyIntent>>& OutBuckets,
+    TTurnFrameArray<TTurnFrameArray<FEnemyIntent>>& OutBuckets,
     int32& OutMaxSlot)
 {
     OutMaxSlot = 0;
@@ -644,7 +694,8 @@ int32 UTurnCorePhaseManager::ExecuteMovePhaseWithSlots(
         return 0;
     }
 
-    TArray<TArray<FEnemyIntent>> Buckets;
+    FTurnFrameArenaScope ArenaScope(FrameArena);  // CodeRevision: INC-2025-1214-R2 (2025-12-26 12:00)
+    TTurnFrameArray<TTurnFrameArray<FEnemyIntent>> Buckets;
     int32 MaxSlot = 0;
     BucketizeIntentsBySlot(AllIntents, Buckets, MaxSlot);
 
@@ -652,9 +703,13 @@ int32 UTurnCorePhaseManager::ExecuteMovePhaseWithSlots(
         TEXT("[ExecuteMovePhaseWithSlots] MaxTimeSlot = %d, Total Intents = %d"),
         MaxSlot, AllIntents.Num());
 
+    // CodeRevision: INC-2025-1214-R3 (No hidden arena fallback; resolve outputs filled into reused caller arrays) (2025-12-27 12:00)
+    // One resolve buffer for every slot; CoreExecutePhase (Blueprint) needs a heap TArray
+    TArray<FResolvedAction> SlotActions;
+
     for (int32 Slot = 0; Slot <= MaxSlot; ++Slot)
     {
-        const TArray<FEnemyIntent>& SlotIntents = Buckets[Slot];
+        const TTurnFrameArray<FEnemyIntent>& SlotIntents = Buckets[Slot];
 
         if (SlotIntents.Num() == 0)
         {
@@ -667,7 +722,7 @@ int32 UTurnCorePhaseManager::ExecuteMovePhaseWithSlots(
             TEXT("[Move Slot %d] Processing %d intents"),
             Slot, SlotIntents.Num());
 
-        TArray<FResolvedAction> SlotActions = CoreResolvePhase(SlotIntents);
+        CoreResolveIntents(SlotIntents, SlotActions);
 
         for (FResolvedAction& Action : SlotActions)
         {
@@ -709,7 +764,8 @@ int32 UTurnCorePhaseManager::ExecuteAttackPhaseWithSlots(
     ensureMsgf(AttackTag.IsValid(),
         TEXT("Tag 'AI.Intent.Attack' is not registered."));
 
-    TArray<TArray<FEnemyIntent>> Buckets;
+    FTurnFrameArenaScope ArenaScope(FrameArena);  // CodeRevision: INC-2025-1214-R2 (2025-12-26 12:00)
+    TTurnFrameArray<TTurnFrameArray<FEnemyIntent>> Buckets;
     int32 MaxSlot = 0;
     BucketizeIntentsBySlot(AllIntents, Buckets, MaxSlot);
 
@@ -718,13 +774,13 @@ int32 UTurnCorePhaseManager::ExecuteAttackPhaseWithSlots(
 
     for (int32 Slot = 0; Slot <= MaxSlot; ++Slot)
     {
-        const TArray<FEnemyIntent>& Src = Buckets[Slot];
+        const TTurnFrameArray<FEnemyIntent>& Src = Buckets[Slot];
         if (Src.Num() == 0)
         {
             continue;
         }
 
-        TArray<FEnemyIntent> Attacks;
+        TTurnFrameArray<FEnemyIntent> Attacks;
         Attacks.Reserve(Src.Num());
 
         for (const FEnemyIntent& Intent : Src)
@@ -746,7 +802,7 @@ int32 UTurnCorePhaseManager::ExecuteAttackPhaseWithSlots(
             TEXT("[Attack Slot %d] Processing %d attacks"),
             Slot, Attacks.Num());
 
-        TArray<FResolvedAction> SlotActions;
+        TTurnFrameArray<FResolvedAction> SlotActions;
         SlotActions.Reserve(Attacks.Num());
 
         for (const FEnemyIntent& Intent : Attacks)
@@ -769,7 +825,7 @@ int32 UTurnCorePhaseManager::ExecuteAttackPhaseWithSlots(
             Action.NextCell       = Intent.NextCell;
             Action.TimeSlot       = Slot;
             Action.bIsWait        = false;
-            Action.ResolutionReason = TEXT("Attack phase action");
+            Action.SetResolution(EResolutionReason::AttackPhase, Intent.NextCell);
 
             // Build target data if a target exists.
             if (AActor* TargetActor = Intent.Target.Get())
@@ -811,19 +867,19 @@ int32 UTurnCorePhaseManager::ExecuteAttackPhaseWithSlots(
                     Slot, *GetNameSafe(IntentActor));
             }
 
-            SlotActions.Add(Action);
+            SlotActions.Add(MoveTemp(Action));
         }
 
         // Filter out any invalid actions before executing.
-        TArray<FResolvedAction> ValidActions;
+        TTurnFrameArray<FResolvedAction> ValidActions;
         ValidActions.Reserve(SlotActions.Num());
-        for (const FResolvedAction& Action : SlotActions)
+        for (FResolvedAction& Action : SlotActions)
         {
             if (Action.Actor.IsValid() &&
                 Action.SourceActor != nullptr &&
                 IsValid(Action.SourceActor))
             {
-                ValidActions.Add(Action);
+                ValidActions.Add(MoveTemp(Action));
             }
             else
             {
@@ -833,7 +889,7 @@ int32 UTurnCorePhaseManager::ExecuteAttackPhaseWithSlots(
             }
         }
 
-        OutActions.Append(ValidActions);
+        OutActions.Append(MoveTemp(ValidActions));
     }
 
     UE_LOG(LogTurnCore, Log,
@@ -1125,7 +1181,7 @@ bool UTurnCorePhaseManager::IsGASReady(AActor* Actor)
 
 namespace TurnCorePhaseManager_Private
 {
-    void AppendPlayerIntentIfPending(UWorld* World, APawn* PlayerPawn, TArray<FEnemyIntent>& InOutIntents)
+    void AppendPlayerIntentIfPending(UWorld* World, APawn* PlayerPawn, TTurnFrameArray<FEnemyIntent>& InOutIntents)
     {
         if (!PlayerPawn || !World) return;
 
@@ -1176,11 +1232,16 @@ TArray<FResolvedAction> UTurnCorePhaseManager::ExecuteMovePhaseWithResolution(in
         return {}; 
     }
     
-    TArray<FEnemyIntent> AllIntents = EnemyData->Intents;
+    // CodeRevision: INC-2025-1214-R1 (Working intent list lives in the turn frame arena) (2025-12-15 14:00)
+    FTurnFrameArenaScope ArenaScope(FrameArena);  // CodeRevision: INC-2025-1214-R2 (2025-12-26 12:00)
+    TTurnFrameArray<FEnemyIntent> AllIntents;
+    AllIntents.Reserve(EnemyData->Intents.Num() + 1);
+    AllIntents.Append(EnemyData->Intents);
     
     TurnCorePhaseManager_Private::AppendPlayerIntentIfPending(World, PlayerPawn, AllIntents);
     
-    TArray<FResolvedAction> ResolvedActions = CoreResolvePhase(AllIntents);
+    TArray<FResolvedAction> ResolvedActions;
+    CoreResolveIntents(AllIntents, ResolvedActions);
     
     if (PlayerPawn) {
         for (const FResolvedAction& Action : ResolvedActions) {
@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "TurnSystemTypes.h"
+#include "TurnFrameArena.h"
 #include "TurnCorePhaseManager.generated.h"
 
 // Log category
@@ -46,6 +47,13 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Turn|Core")
     TArray<FResolvedAction> CoreResolvePhase(const TArray<FEnemyIntent>& Intents);
 
+    // CodeRevision: INC-2025-1214-R3 (No hidden arena fallback; resolve outputs filled into reused caller arrays) (2025-12-27 12:00)
+    /**
+     * C++ body of CoreResolvePhase; accepts turn-frame arrays (per-slot buckets) without copying.
+     * OutResolved is reset and refilled, so a caller resolving several slots reuses one allocation.
+     */
+    void CoreResolveIntents(TArrayView<const FEnemyIntent> Intents, TArray<FResolvedAction>& OutResolved);
+
     /**
      * Phase 4: Execute Phase
      * Delegated entirely to Blueprint. C++ performs no execution.
@@ -53,9 +61,18 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Turn|Core")
     void CoreExecutePhase(const TArray<FResolvedAction>& ResolvedActions);
 
+    /**
+     * Phase 5: Cleanup
+     * Clears resolver reservations and resets the turn frame arena (all phase temporaries).
+     */
     UFUNCTION(BlueprintCallable, Category = "Turn|Core")
     void CoreCleanupPhase();
 
+    // CodeRevision: INC-2025-1214-R2 (Turn frame arena is owned per world instead of process-global) (2025-12-26 12:00)
+    /** This world's turn frame arena (bind it with FTurnFrameArenaScope; reset by CoreCleanupPhase) */
+    FTurnFrameArena& GetFrameArena() { return FrameArena; }
+    const FTurnFrameArena& GetFrameArena() const { return FrameArena; }
+
     // ========================================================================
     // TimeSlot-Based Execution Pipeline
     // ========================================================================
@@ -170,6 +187,9 @@ private:
     UPROPERTY()
     TObjectPtr<UStableActorRegistry> ActorRegistry = nullptr;
 
+    // Phase temporaries of this world's turns (other worlds' cleanups never touch it)
+    FTurnFrameArena FrameArena;
+
     // ========================================================================
     // Helper Methods
     // ========================================================================
@@ -178,9 +198,10 @@ private:
     const FGameplayTag& Tag_Attack();
     const FGameplayTag& Tag_Wait();
 
+    // CodeRevision: INC-2025-1214-R1 (Buckets live in the turn frame arena) (2025-12-15 14:00)
     void BucketizeIntentsBySlot(
         const TArray<FEnemyIntent>& All,
-        TArray<TArray<FEnemyIntent>>& OutBuckets,
+        TTurnFrameArray<TTurnFrameArray<FEnemyIntent>>& OutBuckets,
         int32& OutMaxSlot);
 
     TWeakObjectPtr<AGameTurnManagerBase> CachedTurnManager;
@@ -67,8 +67,9 @@ void UTurnEnemyPhaseSubsystem::ExecuteEnemyPhase(AGameTurnManagerBase* TurnManag
 		EnterSequentialMode();
 
 		// Resolve conflicts
-		TArray<FResolvedAction> ResolvedActions = PhaseManager->CoreResolvePhase(Intents);
-		StoredResolvedActions = ResolvedActions;
+		// CodeRevision: INC-2025-1215-R1 (Move resolved actions into the stored list instead of copying) (2025-12-15 17:00)
+		StoredResolvedActions = PhaseManager->CoreResolvePhase(Intents);
+		const TArray<FResolvedAction>& ResolvedActions = StoredResolvedActions;
 
 		TArray<FResolvedAction> AttackActions;
 		const FGameplayTag AttackTag = RogueGameplayTags::AI_Intent_Attack;
@@ -241,11 +242,10 @@ void UTurnEnemyPhaseSubsystem::ExecuteAttacks(AGameTurnManagerBase* TurnManager,
 		// Legacy path: resolve if not provided
 		if (PhaseManager && EnemyData)
 		{
-			TArray<FResolvedAction> Resolved = PhaseManager->CoreResolvePhase(EnemyData->Intents);
-			StoredResolvedActions = Resolved;
+			StoredResolvedActions = PhaseManager->CoreResolvePhase(EnemyData->Intents);
 
 			const FGameplayTag AttackTag = RogueGameplayTags::AI_Intent_Attack;
-			for (const FResolvedAction& Action : Resolved)
+			for (const FResolvedAction& Action : StoredResolvedActions)
 			{
 				if (Action.AbilityTag.MatchesTag(AttackTag) || Action.FinalAbilityTag.MatchesTag(AttackTag))
 				{
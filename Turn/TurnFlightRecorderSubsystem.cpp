@@ -0,0 +1,340 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+// CodeRevision: INC-2025-1231-R1 (Always-on flight recorder of recent turns, dumped on ensure/check, barrier timeouts and on demand) (2025-12-23 14:00)
+#include "Turn/TurnFlightRecorderSubsystem.h"
+#include "Turn/TurnFlowCoordinator.h"
+#include "Turn/TurnProfilerSubsystem.h"
+#include "Turn/TurnSystemTypes.h"
+#include "Async/Async.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY(LogTurnFlightRecorder);
+
+static int32 GTS_FlightRecorder_Capacity = UE_BUILD_SHIPPING ? 0 : 16384;
+static FAutoConsoleVariableRef CVarTS_FlightRecorder_Capacity(
+    TEXT("ts.FlightRecorder.Capacity"),
+    GTS_FlightRecorder_Capacity,
+    TEXT("Records kept by the turn flight recorder for worlds created after this is set (0 = off)."),
+    ECVF_Default
+);
+
+static int32 GTS_FlightRecorder_MaxAutoDumps = 8;
+static FAutoConsoleVariableRef CVarTS_FlightRecorder_MaxAutoDumps(
+    TEXT("ts.FlightRecorder.MaxAutoDumps"),
+    GTS_FlightRecorder_MaxAutoDumps,
+    TEXT("Automatic flight recorder dumps (ensure / check / barrier timeout) allowed per world (0 = on demand only)."),
+    ECVF_Default
+);
+
+namespace TurnFlightRecorderPrivate
+{
+    static constexpr int32 MaxCapacity = 1 << 20;
+
+    static int16 ToCellCoord(int32 Value)
+    {
+        return static_cast<int16>(FMath::Clamp(Value, static_cast<int32>(MIN_int16), static_cast<int32>(MAX_int16)));
+    }
+}
+
+//------------------------------------------------------------------------------
+// Lifecycle
+//------------------------------------------------------------------------------
+
+bool UTurnFlightRecorderSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UTurnFlightRecorderSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    const int32 Capacity = FMath::Clamp(GTS_FlightRecorder_Capacity, 0, TurnFlightRecorderPrivate::MaxCapacity);
+    if (Capacity == 0)
+    {
+        return;
+    }
+
+    Ring.Init(Capacity);
+    EnsureHandle = FCoreDelegates::OnHandleSystemEnsure.AddUObject(this, &UTurnFlightRecorderSubsystem::HandleSystemEnsure);
+    ErrorHandle = FCoreDelegates::OnHandleSystemError.AddUObject(this, &UTurnFlightRecorderSubsystem::HandleSystemError);
+
+    UE_LOG(LogTurnFlightRecorder, Log, TEXT("[FlightRecorder] Initialized (Capacity=%d records, %llu KB)"),
+        Capacity, static_cast<uint64>(Ring.Capacity() * sizeof(FTurnFlightRecord) / 1024));
+}
+
+void UTurnFlightRecorderSubsystem::Deinitialize()
+{
+    FCoreDelegates::OnHandleSystemEnsure.Remove(EnsureHandle);
+    FCoreDelegates::OnHandleSystemError.Remove(ErrorHandle);
+    Ring.Empty();
+
+    Super::Deinitialize();
+}
+
+UTurnFlightRecorderSubsystem* UTurnFlightRecorderSubsystem::Get(const UObject* WorldContext)
+{
+    UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+    UTurnFlightRecorderSubsystem* Recorder = World ? World->GetSubsystem<UTurnFlightRecorderSubsystem>() : nullptr;
+    return (Recorder && Recorder->Ring.IsEnabled()) ? Recorder : nullptr;
+}
+
+//------------------------------------------------------------------------------
+// Recording
+//------------------------------------------------------------------------------
+
+FTurnFlightRecord* UTurnFlightRecorderSubsystem::Append(ETurnFlightRecordKind Kind, int32 TurnId)
+{
+    if (!Ring.IsEnabled() || !IsInGameThread())
+    {
+        return nullptr;
+    }
+    return &Ring.Append(Kind, TurnId, FPlatformTime::Seconds());
+}
+
+int32 UTurnFlightRecorderSubsystem::GetCurrentTurnId()
+{
+    UTurnFlowCoordinator* Flow = TurnFlow.Get();
+    if (!Flow)
+    {
+        UWorld* World = GetWorld();
+        Flow = World ? World->GetSubsystem<UTurnFlowCoordinator>() : nullptr;
+        TurnFlow = Flow;
+    }
+    return Flow ? Flow->GetCurrentTurnId() : INDEX_NONE;
+}
+
+void UTurnFlightRecorderSubsystem::Record(ETurnFlightRecordKind Kind, const AActor* Actor, const FIntPoint& Cell,
+    const FIntPoint& Target, FName Detail, int32 Value)
+{
+    using namespace TurnFlightRecorderPrivate;
+
+    if (FTurnFlightRecord* Record = Append(Kind, GetCurrentTurnId()))
+    {
+        Record->Actor = Actor ? Actor->GetFName() : NAME_None;
+        Record->Detail = Detail;
+        Record->Value = Value;
+        Record->CellX = ToCellCoord(Cell.X);
+        Record->CellY = ToCellCoord(Cell.Y);
+        Record->TargetX = ToCellCoord(Target.X);
+        Record->TargetY = ToCellCoord(Target.Y);
+    }
+}
+
+void UTurnFlightRecorderSubsystem::RecordCommand(const FPlayerCommand& Command)
+{
+    Record(ETurnFlightRecordKind::Command, Command.TargetActor, Command.TargetCell, FIntPoint(-1, -1),
+        Command.CommandTag.GetTagName(), Command.WindowId);
+}
+
+void UTurnFlightRecorderSubsystem::RecordIntents(TConstArrayView<FEnemyIntent> Intents)
+{
+    for (const FEnemyIntent& Intent : Intents)
+    {
+        Record(ETurnFlightRecordKind::Intent, Intent.Actor.Get(), Intent.CurrentCell, Intent.NextCell,
+            Intent.AbilityTag.GetTagName(), Intent.TimeSlot);
+    }
+}
+
+void UTurnFlightRecorderSubsystem::RecordResolved(TConstArrayView<FResolvedAction> Actions)
+{
+    for (const FResolvedAction& Action : Actions)
+    {
+        Record(ETurnFlightRecordKind::Resolved, Action.Actor.Get(), Action.CurrentCell, Action.NextCell,
+            Action.FinalAbilityTag.GetTagName(), static_cast<int32>(Action.Reason));
+    }
+}
+
+void UTurnFlightRecorderSubsystem::RecordTurnEnd(int32 TurnId, const FTurnProfileSample* Phases)
+{
+    if (Phases)
+    {
+        for (int32 PhaseIndex = 0; PhaseIndex < FTurnProfileSample::NumPhases; ++PhaseIndex)
+        {
+            if (Phases->Calls[PhaseIndex] == 0)
+            {
+                continue;
+            }
+
+            if (FTurnFlightRecord* Record = Append(ETurnFlightRecordKind::PhaseTime, TurnId))
+            {
+                Record->Detail = FName(FTurnProfileWindow::GetPhaseName(static_cast<ETurnProfilePhase>(PhaseIndex)));
+                Record->Value = FMath::RoundToInt32(Phases->PhaseMs[PhaseIndex] * 1000.0);
+                Record->CellX = TurnFlightRecorderPrivate::ToCellCoord(Phases->Calls[PhaseIndex]);
+            }
+        }
+    }
+
+    Append(ETurnFlightRecordKind::TurnEnd, TurnId);
+}
+
+//------------------------------------------------------------------------------
+// Ring
+// CodeRevision: INC-2025-1231-R2 (Thread-safe automatic dumps; ring split out for tests) (2025-12-27 10:00)
+//------------------------------------------------------------------------------
+
+void FTurnFlightRecordRing::Init(int32 Capacity)
+{
+    Records.SetNum(FMath::Max(0, Capacity));
+    NextRecord = 0;
+    NumRecords = 0;
+}
+
+void FTurnFlightRecordRing::Empty()
+{
+    Records.Empty();
+    NextRecord = 0;
+    NumRecords = 0;
+}
+
+FTurnFlightRecord& FTurnFlightRecordRing::Append(ETurnFlightRecordKind Kind, int32 TurnId, double Timestamp)
+{
+    check(IsEnabled());
+
+    FTurnFlightRecord& Record = Records[NextRecord];
+    if (++NextRecord == Records.Num())
+    {
+        NextRecord = 0;
+    }
+    NumRecords = FMath::Min(NumRecords + 1, Records.Num());
+
+    Record = FTurnFlightRecord();
+    Record.Timestamp = Timestamp;
+    Record.TurnId = TurnId;
+    Record.Kind = Kind;
+    return Record;
+}
+
+const FTurnFlightRecord& FTurnFlightRecordRing::GetRecord(int32 Age) const
+{
+    check(Age >= 0 && Age < NumRecords);
+    return Records[(NextRecord - 1 - Age + Records.Num()) % Records.Num()];
+}
+
+FString FTurnFlightRecordRing::ToCSV() const
+{
+    const UEnum* KindEnum = StaticEnum<ETurnFlightRecordKind>();
+
+    FString Csv;
+    Csv.Reserve(64 + NumRecords * 96);
+    Csv += TEXT("TurnID,Timestamp,Kind,Actor,Cell,Target,Detail,Value\n");
+
+    for (int32 Age = NumRecords - 1; Age >= 0; --Age)
+    {
+        const FTurnFlightRecord& Record = GetRecord(Age);
+        Csv.Appendf(TEXT("%d,%.6f,%s,%s,%d:%d,%d:%d,%s,%d\n"),
+            Record.TurnId, Record.Timestamp,
+            *KindEnum->GetNameStringByValue(static_cast<int64>(Record.Kind)),
+            Record.Actor.IsNone() ? TEXT("") : *Record.Actor.ToString(),
+            Record.CellX, Record.CellY, Record.TargetX, Record.TargetY,
+            Record.Detail.IsNone() ? TEXT("") : *Record.Detail.ToString(),
+            Record.Value);
+    }
+    return Csv;
+}
+
+bool FTurnFlightDumpBudget::TryConsume(int32 MaxDumps)
+{
+    int32 Current = Used.load();
+    while (Current < MaxDumps)
+    {
+        if (Used.compare_exchange_weak(Current, Current + 1))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+//------------------------------------------------------------------------------
+// Dumping
+//------------------------------------------------------------------------------
+
+bool UTurnFlightRecorderSubsystem::Dump(const FString& Reason, bool bAutomatic)
+{
+    if (!Ring.IsEnabled())
+    {
+        return false;
+    }
+
+    if (bAutomatic && !AutoDumps.TryConsume(GTS_FlightRecorder_MaxAutoDumps))
+    {
+        return false;
+    }
+
+    // CodeRevision: INC-2025-1231-R2 (Thread-safe automatic dumps; ring split out for tests) (2025-12-27 10:00)
+    // Ensures fire on whichever thread raised them; the ring and the world belong to the game thread
+    if (!IsInGameThread())
+    {
+        AsyncTask(ENamedThreads::GameThread, [WeakThis = TWeakObjectPtr<UTurnFlightRecorderSubsystem>(this), Reason]()
+        {
+            if (UTurnFlightRecorderSubsystem* Recorder = WeakThis.Get())
+            {
+                Recorder->WriteDump(Reason);
+            }
+        });
+        return false;
+    }
+
+    return WriteDump(Reason);
+}
+
+bool UTurnFlightRecorderSubsystem::WriteDump(const FString& Reason)
+{
+    check(IsInGameThread());
+
+    if (!Ring.IsEnabled())
+    {
+        return false;
+    }
+
+    // An ensure raised while writing must not recurse into another dump
+    bool bExpected = false;
+    if (!bDumping.compare_exchange_strong(bExpected, true))
+    {
+        return false;
+    }
+
+    const FString MapName = GetWorld() ? UWorld::RemovePIEPrefix(GetWorld()->GetMapName()) : FString(TEXT("NoWorld"));
+    const FString Path = FPaths::ProjectSavedDir() / TEXT("FlightRecorder") / FPaths::MakeValidFileName(FString::Printf(TEXT("Flight_%s_%s_%s.csv"),
+        *MapName, *FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S")), *Reason));
+
+    const bool bSaved = FFileHelper::SaveStringToFile(Ring.ToCSV(), *Path, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+    UE_LOG(LogTurnFlightRecorder, Warning, TEXT("[FlightRecorder] Dump (%s): %d record(s) -> %s (%s)"),
+        *Reason, Ring.Num(), *Path, bSaved ? TEXT("ok") : TEXT("failed"));
+
+    bDumping.store(false);
+    return bSaved;
+}
+
+void UTurnFlightRecorderSubsystem::HandleSystemEnsure()
+{
+    Dump(TEXT("Ensure"), /*bAutomatic*/true);
+}
+
+void UTurnFlightRecorderSubsystem::HandleSystemError()
+{
+    Dump(TEXT("SystemError"), /*bAutomatic*/true);
+}
+
+static FAutoConsoleCommandWithWorldAndArgs CmdTS_FlightRecorder_Dump(
+    TEXT("ts.FlightRecorder.Dump"),
+    TEXT("Write the turn flight recorder ring to Saved/FlightRecorder. Usage: ts.FlightRecorder.Dump [Reason]"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+    {
+        if (UTurnFlightRecorderSubsystem* Recorder = UTurnFlightRecorderSubsystem::Get(World))
+        {
+            Recorder->Dump(Args.Num() > 0 ? Args[0] : FString(TEXT("Manual")));
+        }
+        else
+        {
+            UE_LOG(LogTurnFlightRecorder, Warning, TEXT("[FlightRecorder] No game world with an active flight recorder"));
+        }
+    }));
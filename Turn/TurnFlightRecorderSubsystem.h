@@ -0,0 +1,174 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+// CodeRevision: INC-2025-1231-R1 (Always-on flight recorder of recent turns, dumped on ensure/check, barrier timeouts and on demand) (2025-12-23 14:00)
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include <atomic>
+#include "TurnFlightRecorderSubsystem.generated.h"
+
+// Log category
+DECLARE_LOG_CATEGORY_EXTERN(LogTurnFlightRecorder, Log, All);
+
+class UTurnFlowCoordinator;
+struct FEnemyIntent;
+struct FPlayerCommand;
+struct FResolvedAction;
+struct FTurnProfileSample;
+
+/** What a flight record describes. Cell / Target / Detail / Value meanings are listed per kind. */
+UENUM()
+enum class ETurnFlightRecordKind : uint8
+{
+    // Cell = target cell, Detail = command tag, Value = WindowId
+    Command,
+    // Cell = current cell, Target = next cell, Detail = ability tag, Value = time slot
+    Intent,
+    // Cell = requested cell, Target = actor's current cell, Detail = reject reason
+    ReserveOk,
+    ReserveReject,
+    // Cell = from, Target = to, Detail = final ability tag, Value = EResolutionReason
+    Resolved,
+    // Value = pending actions after the event
+    BarrierRegister,
+    BarrierDrained,
+    // Value = elapsed ms of the timed-out action
+    BarrierTimeout,
+    // Value = legacy pending moves that were dropped
+    BarrierForceFinish,
+    // Detail = phase name, Value = microseconds, Cell.X = scope count
+    PhaseTime,
+    TurnEnd
+};
+
+/** One compact record; actor and detail are FNames so recording never builds strings. */
+struct FTurnFlightRecord
+{
+    double Timestamp = 0.0;
+    FName Actor;
+    FName Detail;
+    int32 TurnId = INDEX_NONE;
+    int32 Value = 0;
+    int16 CellX = -1;
+    int16 CellY = -1;
+    int16 TargetX = -1;
+    int16 TargetY = -1;
+    ETurnFlightRecordKind Kind = ETurnFlightRecordKind::TurnEnd;
+};
+
+// CodeRevision: INC-2025-1231-R2 (Thread-safe automatic dumps; ring split out for tests) (2025-12-27 10:00)
+/** Fixed-capacity ring of flight records. Single writer, no locking: only touch it from one thread. */
+class LYRAGAME_API FTurnFlightRecordRing
+{
+public:
+    /** Preallocate Capacity records and forget the old ones (0 = disabled). */
+    void Init(int32 Capacity);
+    void Empty();
+
+    bool IsEnabled() const { return Records.Num() > 0; }
+    int32 Num() const { return NumRecords; }
+    int32 Capacity() const { return Records.Num(); }
+
+    /** Next slot, cleared and stamped with Kind / TurnId / Timestamp; overwrites the oldest when full. */
+    FTurnFlightRecord& Append(ETurnFlightRecordKind Kind, int32 TurnId, double Timestamp);
+
+    /** Age 0 is the newest record. */
+    const FTurnFlightRecord& GetRecord(int32 Age) const;
+
+    /** CSV (TurnID,Timestamp,Kind,Actor,Cell,Target,Detail,Value), oldest record first */
+    FString ToCSV() const;
+
+private:
+    TArray<FTurnFlightRecord> Records;
+    int32 NextRecord = 0;
+    int32 NumRecords = 0;
+};
+
+/** Cap on automatic dumps; consumed from whichever thread raised the ensure. */
+class LYRAGAME_API FTurnFlightDumpBudget
+{
+public:
+    /** Take one dump if fewer than MaxDumps were taken so far. */
+    bool TryConsume(int32 MaxDumps);
+    int32 GetUsed() const { return Used.load(); }
+
+private:
+    std::atomic<int32> Used{ 0 };
+};
+
+/**
+ * UTurnFlightRecorderSubsystem: always-on ring of the most recent turn events.
+ *
+ * The turn pipeline appends fixed-size records (commands, intents, reservations, resolved
+ * actions, barrier events, phase timings) to a preallocated ring of ts.FlightRecorder.Capacity
+ * entries. Recording is a handful of stores on the game thread and never allocates or logs,
+ * so it stays on in every non-shipping build without changing turn timing
+ * (Rogue.Turn.FlightRecorder.Ring measures the per-record cost against the frame budget).
+ *
+ * The ring is written to Saved/FlightRecorder/Flight_<Map>_<Time>_<Reason>.csv:
+ *   - automatically on ensure / check failure and on barrier timeouts (ForceFinishBarrier,
+ *     per-action deadline expiry), at most ts.FlightRecorder.MaxAutoDumps times per world;
+ *   - on demand with ts.FlightRecorder.Dump [Reason].
+ * The ring is only read on the game thread: an ensure raised on another thread queues its
+ * dump there instead of reading records the game thread is still writing.
+ */
+UCLASS()
+class LYRAGAME_API UTurnFlightRecorderSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    /** Recorder of WorldContext's world, or nullptr when recording is off. */
+    static UTurnFlightRecorderSubsystem* Get(const UObject* WorldContext);
+
+    // ========== Recording (game thread; other threads are ignored) ==========
+
+    void Record(ETurnFlightRecordKind Kind, const AActor* Actor, const FIntPoint& Cell,
+        const FIntPoint& Target = FIntPoint(-1, -1), FName Detail = NAME_None, int32 Value = 0);
+
+    /** Actor column is the command's target actor (if any). */
+    void RecordCommand(const FPlayerCommand& Command);
+    void RecordIntents(TConstArrayView<FEnemyIntent> Intents);
+    void RecordResolved(TConstArrayView<FResolvedAction> Actions);
+
+    /** Phase timings of the closed turn (Phases may be null when the profiler is off), then a TurnEnd marker. */
+    void RecordTurnEnd(int32 TurnId, const FTurnProfileSample* Phases);
+
+    // ========== Dumping ==========
+
+    /**
+     * Write the ring oldest-first. bAutomatic dumps are capped by ts.FlightRecorder.MaxAutoDumps.
+     * Off the game thread the dump is queued to the game thread and this returns false.
+     */
+    bool Dump(const FString& Reason, bool bAutomatic = false);
+
+    int32 Num() const { return Ring.Num(); }
+
+    /** Age 0 is the newest record. */
+    const FTurnFlightRecord& GetRecord(int32 Age) const { return Ring.GetRecord(Age); }
+
+    FString ToCSV() const { return Ring.ToCSV(); }
+
+private:
+    /** Next ring slot stamped with Kind / TurnId / time, or nullptr when recording is off or off-thread. */
+    FTurnFlightRecord* Append(ETurnFlightRecordKind Kind, int32 TurnId);
+    int32 GetCurrentTurnId();
+
+    void HandleSystemEnsure();
+    void HandleSystemError();
+    bool WriteDump(const FString& Reason);
+
+    FTurnFlightRecordRing Ring;
+
+    TWeakObjectPtr<UTurnFlowCoordinator> TurnFlow;
+
+    FDelegateHandle EnsureHandle;
+    FDelegateHandle ErrorHandle;
+    FTurnFlightDumpBudget AutoDumps;
+    std::atomic<bool> bDumping{ false };
+};
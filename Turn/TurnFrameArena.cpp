@@ -0,0 +1,195 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+// CodeRevision: INC-2025-1214-R1 (Add per-turn frame arena for turn-pipeline temporaries) (2025-12-15 14:00)
+#include "Turn/TurnFrameArena.h"
+#include "Turn/TurnCorePhaseManager.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_LOG_CATEGORY(LogTurnFrameArena);
+
+static int32 GTS_Arena_BlockKB = 64;
+static FAutoConsoleVariableRef CVarTS_Arena_BlockKB(
+    TEXT("ts.Arena.BlockKB"),
+    GTS_Arena_BlockKB,
+    TEXT("Initial block size (KB) of the per-turn frame arena. The arena grows to the observed high-water mark on its own."),
+    ECVF_Default
+);
+
+// CodeRevision: INC-2025-1214-R2 (Turn frame arena is owned per world instead of process-global) (2025-12-26 12:00)
+static FTurnFrameArena* GActiveTurnFrameArena = nullptr;
+// CodeRevision: INC-2025-1214-R3 (No hidden arena fallback; resolve outputs filled into reused caller arrays) (2025-12-27 12:00)
+static int32 GTurnFrameArenaScopeDepth = 0;
+
+FTurnFrameArena* FTurnFrameArena::GetBound()
+{
+    check(IsInGameThread());
+    checkf(GTurnFrameArenaScopeDepth > 0, TEXT("Turn-frame container allocated outside an FTurnFrameArenaScope"));
+    return GActiveTurnFrameArena;
+}
+
+FTurnFrameArenaScope::FTurnFrameArenaScope(const UObject* WorldContext)
+{
+    const UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+    UTurnCorePhaseManager* PhaseManager = World ? World->GetSubsystem<UTurnCorePhaseManager>() : nullptr;
+    ensureMsgf(PhaseManager, TEXT("FTurnFrameArenaScope: no UTurnCorePhaseManager for %s; turn-frame containers use the heap"),
+        *GetNameSafe(WorldContext));
+
+    Bind(PhaseManager ? &PhaseManager->GetFrameArena() : nullptr);
+}
+
+FTurnFrameArenaScope::FTurnFrameArenaScope(FTurnFrameArena& Arena)
+{
+    Bind(&Arena);
+}
+
+FTurnFrameArenaScope::~FTurnFrameArenaScope()
+{
+    check(IsInGameThread());
+    GActiveTurnFrameArena = Previous;
+    --GTurnFrameArenaScopeDepth;
+}
+
+void FTurnFrameArenaScope::Bind(FTurnFrameArena* Arena)
+{
+    check(IsInGameThread());
+    Previous = GActiveTurnFrameArena;
+    GActiveTurnFrameArena = Arena;
+    ++GTurnFrameArenaScopeDepth;
+}
+
+// CodeRevision: INC-2025-1217-R2 (Speculative plans rewind their arena scratch) (2025-12-27 15:00)
+FTurnFrameArenaMark::FTurnFrameArenaMark(const UObject* WorldContext)
+{
+    check(IsInGameThread());
+    const UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+    if (UTurnCorePhaseManager* PhaseManager = World ? World->GetSubsystem<UTurnCorePhaseManager>() : nullptr)
+    {
+        Arena = &PhaseManager->GetFrameArena();
+        Mark = Arena->GetMark();
+    }
+}
+
+FTurnFrameArenaMark::~FTurnFrameArenaMark()
+{
+    if (Arena)
+    {
+        Arena->RewindTo(Mark);
+    }
+}
+
+FTurnFrameArena::~FTurnFrameArena()
+{
+    FreeAllBlocks();
+}
+
+void* FTurnFrameArena::Allocate(SIZE_T Size, uint32 Alignment)
+{
+    if (Size == 0)
+    {
+        return nullptr;
+    }
+
+    if (CurrentBlock != INDEX_NONE)
+    {
+        const FBlock& Block = Blocks[CurrentBlock];
+        uint8* Result = Align(Block.Memory + CurrentOffset, Alignment);
+        if (Result + Size <= Block.Memory + Block.Size)
+        {
+            CurrentOffset = (Result - Block.Memory) + Size;
+            return Result;
+        }
+
+        BytesUsedBeforeCurrent += CurrentOffset;
+    }
+
+    // Overflow: step into the next block when a rewind left one big enough, otherwise chain a new
+    // block; Reset() folds the chain into one block afterwards.
+    if (Blocks.IsValidIndex(CurrentBlock + 1) && Blocks[CurrentBlock + 1].Size >= Size + Alignment)
+    {
+        ++CurrentBlock;
+        CurrentOffset = 0;
+    }
+    else
+    {
+        AddBlock(Size + Alignment);
+    }
+
+    const FBlock& Block = Blocks[CurrentBlock];
+    uint8* Result = Align(Block.Memory, Alignment);
+    CurrentOffset = (Result - Block.Memory) + Size;
+    return Result;
+}
+
+void FTurnFrameArena::Reset()
+{
+    ensureMsgf(GActiveTurnFrameArena != this, TEXT("Turn frame arena reset while a scope still binds it"));
+
+    const SIZE_T Used = GetBytesUsed();
+    HighWaterBytes = FMath::Max(HighWaterBytes, Used);
+
+    if (Blocks.Num() > 1)
+    {
+        const SIZE_T Target = FMath::RoundUpToPowerOfTwo64(FMath::Max<SIZE_T>(HighWaterBytes, GetCapacity()));
+
+        UE_LOG(LogTurnFrameArena, Log,
+            TEXT("[TurnFrameArena] Turn used %llu bytes across %d blocks; consolidating into %llu bytes"),
+            (uint64)Used, Blocks.Num(), (uint64)Target);
+
+        FreeAllBlocks();
+        AddBlock(Target);
+    }
+
+    CurrentBlock = Blocks.Num() > 0 ? 0 : INDEX_NONE;
+    CurrentOffset = 0;
+    BytesUsedBeforeCurrent = 0;
+    ++Generation;
+}
+
+// CodeRevision: INC-2025-1217-R2 (Speculative plans rewind their arena scratch) (2025-12-27 15:00)
+void FTurnFrameArena::RewindTo(const FMark& Mark)
+{
+    checkf(Mark.Generation == Generation, TEXT("Turn frame arena rewound to a mark from an earlier turn"));
+    checkf(Mark.Block < CurrentBlock || (Mark.Block == CurrentBlock && Mark.Offset <= CurrentOffset),
+        TEXT("Turn frame arena rewound past its current position"));
+
+    // Reset() sizes the consolidated block from the peak, including what is dropped here
+    HighWaterBytes = FMath::Max(HighWaterBytes, GetBytesUsed());
+
+    CurrentBlock = Mark.Block;
+    CurrentOffset = Mark.Offset;
+    BytesUsedBeforeCurrent = Mark.BytesUsedBeforeBlock;
+}
+
+SIZE_T FTurnFrameArena::GetCapacity() const
+{
+    SIZE_T Total = 0;
+    for (const FBlock& Block : Blocks)
+    {
+        Total += Block.Size;
+    }
+    return Total;
+}
+
+void FTurnFrameArena::AddBlock(SIZE_T MinSize)
+{
+    FBlock Block;
+    Block.Size = FMath::Max<SIZE_T>(MinSize, (SIZE_T)FMath::Max(1, GTS_Arena_BlockKB) * 1024);
+    Block.Memory = static_cast<uint8*>(FMemory::Malloc(Block.Size, 16));
+
+    CurrentBlock = Blocks.Add(Block);
+    CurrentOffset = 0;
+    ++BlockAllocationCount;
+}
+
+void FTurnFrameArena::FreeAllBlocks()
+{
+    for (FBlock& Block : Blocks)
+    {
+        FMemory::Free(Block.Memory);
+    }
+    Blocks.Reset();
+    CurrentBlock = INDEX_NONE;
+    CurrentOffset = 0;
+    BytesUsedBeforeCurrent = 0;
+}
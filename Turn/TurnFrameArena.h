@@ -0,0 +1,303 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+// CodeRevision: INC-2025-1214-R1 (Add per-turn frame arena for turn-pipeline temporaries) (2025-12-15 14:00)
+#include "CoreMinimal.h"
+#include "Containers/ContainerAllocationPolicies.h"
+#include "Containers/Set.h"
+#include "Containers/Map.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogTurnFrameArena, Log, All);
+
+/**
+ * FTurnFrameArena: linear (bump) allocator for turn-pipeline scratch memory.
+ *
+ * - Game thread only. Allocations are never freed individually.
+ * - One arena per world, owned by that world's UTurnCorePhaseManager; turn-frame containers allocate
+ *   from the arena bound by the innermost FTurnFrameArenaScope.
+ * - Reset() rewinds the arena in one step; it is called from UTurnCorePhaseManager::CoreCleanupPhase.
+ * - When a turn overflowed the current block, Reset() replaces all blocks with a single block sized
+ *   to the high-water mark, so steady-state turn scratch does not touch the general heap.
+ *   Outputs that leave the pipeline (resolved actions, Blueprint-facing copies) stay ordinary TArrays.
+ *
+ * Containers using TTurnFrameAllocator must not outlive the turn (no members, no statics,
+ * nothing returned across CoreCleanupPhase).
+ */
+class LYRAGAME_API FTurnFrameArena
+{
+public:
+    // CodeRevision: INC-2025-1214-R2 (Turn frame arena is owned per world instead of process-global) (2025-12-26 12:00)
+    // CodeRevision: INC-2025-1214-R3 (No hidden arena fallback; resolve outputs filled into reused caller arrays) (2025-12-27 12:00)
+    /**
+     * Arena bound by the innermost FTurnFrameArenaScope, or nullptr when that scope bound the heap
+     * (world without a UTurnCorePhaseManager). Checked: there must be a scope.
+     */
+    static FTurnFrameArena* GetBound();
+
+    FTurnFrameArena() = default;
+    ~FTurnFrameArena();
+
+    FTurnFrameArena(const FTurnFrameArena&) = delete;
+    FTurnFrameArena& operator=(const FTurnFrameArena&) = delete;
+
+    void* Allocate(SIZE_T Size, uint32 Alignment);
+
+    /** Release every allocation made since the previous Reset() */
+    void Reset();
+
+    /** Bytes handed out since the last Reset() (including alignment padding) */
+    SIZE_T GetBytesUsed() const { return BytesUsedBeforeCurrent + CurrentOffset; }
+
+    /** Largest GetBytesUsed() seen at a Reset() */
+    SIZE_T GetHighWaterBytes() const { return HighWaterBytes; }
+
+    /** Total bytes owned by the arena */
+    SIZE_T GetCapacity() const;
+
+    /** Number of general-heap block allocations made so far (stable in steady state) */
+    int32 GetBlockAllocationCount() const { return BlockAllocationCount; }
+
+    /** Incremented on every Reset(); used to catch containers that survive their turn */
+    uint32 GetGeneration() const { return Generation; }
+
+    // CodeRevision: INC-2025-1217-R2 (Speculative plans rewind their arena scratch) (2025-12-27 15:00)
+    /** Bump-pointer position inside the current turn; see RewindTo */
+    struct FMark
+    {
+        int32 Block = INDEX_NONE;
+        SIZE_T Offset = 0;
+        SIZE_T BytesUsedBeforeBlock = 0;
+        uint32 Generation = 0;
+    };
+
+    FMark GetMark() const { return { CurrentBlock, CurrentOffset, BytesUsedBeforeCurrent, Generation }; }
+
+    /**
+     * Release every allocation made since Mark without ending the turn. Containers allocated after
+     * the mark must already be gone; those allocated before it are unaffected.
+     */
+    void RewindTo(const FMark& Mark);
+
+private:
+    struct FBlock
+    {
+        uint8* Memory = nullptr;
+        SIZE_T Size = 0;
+    };
+
+    void AddBlock(SIZE_T MinSize);
+    void FreeAllBlocks();
+
+    TArray<FBlock> Blocks;
+    int32 CurrentBlock = INDEX_NONE;
+    SIZE_T CurrentOffset = 0;
+    SIZE_T BytesUsedBeforeCurrent = 0;
+    SIZE_T HighWaterBytes = 0;
+    int32 BlockAllocationCount = 0;
+    uint32 Generation = 0;
+};
+
+/**
+ * Binds a turn frame arena for turn-frame containers created on the game thread while it is alive.
+ * Scopes nest; the previous binding is restored on destruction.
+ */
+class LYRAGAME_API FTurnFrameArenaScope
+{
+public:
+    /**
+     * Bind the arena of WorldContext's UTurnCorePhaseManager. A world without one ensures and binds
+     * no arena: containers created in the scope use the default heap allocator instead.
+     */
+    explicit FTurnFrameArenaScope(const UObject* WorldContext);
+    explicit FTurnFrameArenaScope(FTurnFrameArena& Arena);
+    ~FTurnFrameArenaScope();
+
+    FTurnFrameArenaScope(const FTurnFrameArenaScope&) = delete;
+    FTurnFrameArenaScope& operator=(const FTurnFrameArenaScope&) = delete;
+
+private:
+    void Bind(FTurnFrameArena* Arena);
+
+    FTurnFrameArena* Previous = nullptr;
+};
+
+// CodeRevision: INC-2025-1217-R2 (Speculative plans rewind their arena scratch) (2025-12-27 15:00)
+/**
+ * Rewinds WorldContext's turn frame arena to where it stood at construction (no-op for a world
+ * without a UTurnCorePhaseManager). For repeated scratch work within one turn, such as one
+ * speculative plan after another.
+ */
+class LYRAGAME_API FTurnFrameArenaMark
+{
+public:
+    explicit FTurnFrameArenaMark(const UObject* WorldContext);
+    ~FTurnFrameArenaMark();
+
+    FTurnFrameArenaMark(const FTurnFrameArenaMark&) = delete;
+    FTurnFrameArenaMark& operator=(const FTurnFrameArenaMark&) = delete;
+
+private:
+    FTurnFrameArena* Arena = nullptr;
+    FTurnFrameArena::FMark Mark;
+};
+
+/**
+ * TArray allocator backed by FTurnFrameArena (same contract as TMemStackAllocator).
+ * Growing copies into a fresh arena range; the old range is reclaimed at the next Reset().
+ * Under a scope that bound no arena, the container is heap-backed and frees itself like TArray.
+ */
+template<uint32 Alignment = DEFAULT_ALIGNMENT>
+class TTurnFrameAllocator
+{
+public:
+    using SizeType = int32;
+
+    enum { NeedsElementType = true };
+    enum { RequireRangeCheck = true };
+
+    template<typename ElementType>
+    class ForElementType
+    {
+    public:
+        ForElementType() = default;
+
+        ~ForElementType()
+        {
+            FreeHeapData();
+        }
+
+        FORCEINLINE void MoveToEmpty(ForElementType& Other)
+        {
+            checkSlow(this != &Other);
+            FreeHeapData();
+            Data = Other.Data;
+            Other.Data = nullptr;
+            Arena = Other.Arena;
+            Other.Arena = nullptr;
+#if DO_CHECK
+            ArenaGeneration = Other.ArenaGeneration;
+#endif
+        }
+
+        FORCEINLINE ElementType* GetAllocation() const
+        {
+            return Data;
+        }
+
+        void ResizeAllocation(SizeType CurrentNum, SizeType NewMax, SIZE_T NumBytesPerElement)
+        {
+            // Growth stays where the first allocation was made (the owning world's arena, or the heap)
+            if (!Data)
+            {
+                Arena = FTurnFrameArena::GetBound();
+            }
+
+            if (!Arena)
+            {
+                if (NewMax <= 0)
+                {
+                    FreeHeapData();
+                    return;
+                }
+                Data = (ElementType*)FMemory::Realloc(Data, NewMax * NumBytesPerElement, FMath::Max(Alignment, (uint32)alignof(ElementType)));
+                return;
+            }
+
+#if DO_CHECK
+            checkf(!Data || ArenaGeneration == Arena->GetGeneration(),
+                TEXT("Turn-frame container used after CoreCleanupPhase reset the arena"));
+#endif
+
+            ElementType* OldData = Data;
+            if (NewMax <= 0)
+            {
+                Data = nullptr;
+                Arena = nullptr;
+                return;
+            }
+
+            checkf((SIZE_T)NewMax <= (SIZE_T)TNumericLimits<int32>::Max() / NumBytesPerElement,
+                TEXT("Turn-frame allocation overflow (%d x %llu bytes)"), NewMax, (uint64)NumBytesPerElement);
+
+            Data = (ElementType*)Arena->Allocate(NewMax * NumBytesPerElement, FMath::Max(Alignment, (uint32)alignof(ElementType)));
+#if DO_CHECK
+            ArenaGeneration = Arena->GetGeneration();
+#endif
+
+            if (OldData && CurrentNum)
+            {
+                FMemory::Memcpy(Data, OldData, FMath::Min(NewMax, CurrentNum) * NumBytesPerElement);
+            }
+        }
+
+        FORCEINLINE SizeType CalculateSlackReserve(SizeType NewMax, SIZE_T NumBytesPerElement) const
+        {
+            return DefaultCalculateSlackReserve(NewMax, NumBytesPerElement, false, Alignment);
+        }
+
+        FORCEINLINE SizeType CalculateSlackShrink(SizeType NewMax, SizeType CurrentMax, SIZE_T NumBytesPerElement) const
+        {
+            // Shrinking never returns memory to a linear arena; keep the slack.
+            return CurrentMax;
+        }
+
+        FORCEINLINE SizeType CalculateSlackGrow(SizeType NewMax, SizeType CurrentMax, SIZE_T NumBytesPerElement) const
+        {
+            return DefaultCalculateSlackGrow(NewMax, CurrentMax, NumBytesPerElement, false, Alignment);
+        }
+
+        SIZE_T GetAllocatedSize(SizeType CurrentMax, SIZE_T NumBytesPerElement) const
+        {
+            return CurrentMax * NumBytesPerElement;
+        }
+
+        bool HasAllocation() const
+        {
+            return !!Data;
+        }
+
+        SizeType GetInitialCapacity() const
+        {
+            return 0;
+        }
+
+    private:
+        FORCEINLINE void FreeHeapData()
+        {
+            if (Data && !Arena)
+            {
+                FMemory::Free(Data);
+                Data = nullptr;
+            }
+        }
+
+        ElementType* Data = nullptr;
+        FTurnFrameArena* Arena = nullptr;
+#if DO_CHECK
+        uint32 ArenaGeneration = 0;
+#endif
+    };
+
+    typedef ForElementType<FScriptContainerElement> ForAnyElementType;
+};
+
+template<uint32 Alignment>
+struct TAllocatorTraits<TTurnFrameAllocator<Alignment>> : TAllocatorTraitsBase<TTurnFrameAllocator<Alignment>>
+{
+    enum { IsZeroConstruct = true };
+};
+
+/** Set/Map allocator whose element, bit-array and hash storage all live in the turn arena */
+using FTurnFrameSetAllocator = TSetAllocator<
+    TSparseArrayAllocator<TTurnFrameAllocator<>, TTurnFrameAllocator<>>,
+    TTurnFrameAllocator<>>;
+
+template<typename ElementType>
+using TTurnFrameArray = TArray<ElementType, TTurnFrameAllocator<>>;
+
+template<typename ElementType>
+using TTurnFrameSet = TSet<ElementType, DefaultKeyFuncs<ElementType>, FTurnFrameSetAllocator>;
+
+template<typename KeyType, typename ValueType>
+using TTurnFrameMap = TMap<KeyType, ValueType, FTurnFrameSetAllocator>;
@@ -0,0 +1,520 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+// CodeRevision: INC-2025-1230-R1 (Turn pipeline CPU profiling: trace scopes, STAT counters, rolling percentiles, Chrome trace export) (2025-12-23 10:00)
+#include "Turn/TurnProfilerSubsystem.h"
+#include "Turn/TurnReplaySubsystem.h"
+#include "Debug/DebugObserverInterface.h"
+#include "Utility/RogueGameplayTags.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY(LogTurnProfiler);
+
+DEFINE_STAT(STAT_TurnProfile_Observe);
+DEFINE_STAT(STAT_TurnProfile_Think);
+DEFINE_STAT(STAT_TurnProfile_Resolve);
+DEFINE_STAT(STAT_TurnProfile_Execute);
+DEFINE_STAT(STAT_TurnProfile_Cleanup);
+DEFINE_STAT(STAT_TurnProfile_ResolveConflicts);
+DEFINE_STAT(STAT_TurnProfile_DistanceField);
+DEFINE_STAT(STAT_TurnProfile_FindPath);
+DEFINE_STAT(STAT_TurnProfile_Speculate);
+DEFINE_STAT(STAT_TurnProfile_FindPathCalls);
+DEFINE_STAT(STAT_TurnProfile_BarrierWaitMs);
+DEFINE_STAT(STAT_TurnProfile_TurnMs);
+
+static int32 GTS_Profile_Window = 128;
+static FAutoConsoleVariableRef CVarTS_Profile_Window(
+    TEXT("ts.Profile.Window"),
+    GTS_Profile_Window,
+    TEXT("Turns kept by the turn profiler for p50/p95/max (0 disables phase timing; resizing clears the window)."),
+    ECVF_Default
+);
+
+namespace TurnProfilerPrivate
+{
+    static constexpr int32 NumPhases = FTurnProfileSample::NumPhases;
+    static constexpr int32 MaxWindow = 4096;
+
+    // Chrome trace lanes ("tid")
+    static constexpr int32 LaneTurns = 1;
+    static constexpr int32 LanePipeline = 2;
+    static constexpr int32 LaneBarrier = 3;
+
+    /** Nearest-rank percentile of ascending values */
+    static double Percentile(TConstArrayView<double> Sorted, double Fraction)
+    {
+        const int32 Rank = FMath::CeilToInt32(Fraction * Sorted.Num());
+        return Sorted[FMath::Clamp(Rank - 1, 0, Sorted.Num() - 1)];
+    }
+
+    static double ToMicros(double Seconds, double Origin)
+    {
+        return (Seconds - Origin) * 1000000.0;
+    }
+
+    static UTurnProfilerSubsystem* GetProfiler(UWorld* World)
+    {
+        UTurnProfilerSubsystem* Profiler = World ? World->GetSubsystem<UTurnProfilerSubsystem>() : nullptr;
+        if (!Profiler)
+        {
+            UE_LOG(LogTurnProfiler, Warning, TEXT("[TurnProfiler] No game world with a turn profiler"));
+        }
+        return Profiler;
+    }
+}
+
+//------------------------------------------------------------------------------
+// FTurnProfileWindow
+//------------------------------------------------------------------------------
+
+FTurnProfileWindow::FTurnProfileWindow(int32 InCapacity)
+{
+    SetCapacity(InCapacity);
+}
+
+void FTurnProfileWindow::SetCapacity(int32 InCapacity)
+{
+    const int32 Capacity = FMath::Clamp(InCapacity, 1, TurnProfilerPrivate::MaxWindow);
+    Samples.SetNum(Capacity);
+    Events.SetNum(Capacity * EventsPerTurn);
+    Reset();
+}
+
+void FTurnProfileWindow::Reset()
+{
+    NextSample = 0;
+    NumSamples = 0;
+    NextEvent = 0;
+    NumEvents = 0;
+    OpenEvents = 0;
+    Open = FTurnProfileSample();
+}
+
+void FTurnProfileWindow::AddTime(ETurnProfilePhase Phase, double StartSeconds, double Seconds)
+{
+    const int32 PhaseIndex = static_cast<int32>(Phase);
+    if (Open.StartSeconds == 0.0)
+    {
+        Open.StartSeconds = StartSeconds;
+    }
+    Open.PhaseMs[PhaseIndex] += Seconds * 1000.0;
+    ++Open.Calls[PhaseIndex];
+
+    if (Phase == ETurnProfilePhase::FindPath)
+    {
+        return;
+    }
+
+    FTurnProfileEvent& Event = Events[NextEvent];
+    Event.StartSeconds = StartSeconds;
+    Event.DurationMs = static_cast<float>(Seconds * 1000.0);
+    Event.TurnId = INDEX_NONE;
+    Event.Phase = Phase;
+
+    NextEvent = (NextEvent + 1) % Events.Num();
+    NumEvents = FMath::Min(NumEvents + 1, Events.Num());
+    OpenEvents = FMath::Min(OpenEvents + 1, Events.Num());
+}
+
+const FTurnProfileSample& FTurnProfileWindow::CommitTurn(int32 TurnId, double NowSeconds)
+{
+    Open.TurnId = TurnId;
+    if (Open.StartSeconds == 0.0)
+    {
+        Open.StartSeconds = NowSeconds;
+    }
+    Open.EndSeconds = NowSeconds;
+
+    // Events recorded while the turn was open learn their turn id now
+    for (int32 Back = 1; Back <= OpenEvents; ++Back)
+    {
+        Events[(NextEvent - Back + Events.Num()) % Events.Num()].TurnId = TurnId;
+    }
+    OpenEvents = 0;
+
+    FTurnProfileSample& Slot = Samples[NextSample];
+    Slot = Open;
+    NextSample = (NextSample + 1) % Samples.Num();
+    NumSamples = FMath::Min(NumSamples + 1, Samples.Num());
+
+    Open = FTurnProfileSample();
+    return Slot;
+}
+
+const FTurnProfileSample& FTurnProfileWindow::GetSample(int32 Age) const
+{
+    check(Age >= 0 && Age < NumSamples);
+    return Samples[(NextSample - 1 - Age + Samples.Num()) % Samples.Num()];
+}
+
+FTurnProfilePhaseStats FTurnProfileWindow::ComputeStats(ETurnProfilePhase Phase) const
+{
+    const int32 PhaseIndex = static_cast<int32>(Phase);
+
+    TArray<double, TInlineAllocator<256>> Values;
+    int64 Calls = 0;
+    for (int32 Age = 0; Age < NumSamples; ++Age)
+    {
+        const FTurnProfileSample& Sample = GetSample(Age);
+        if (Sample.Calls[PhaseIndex] > 0)
+        {
+            Values.Add(Sample.PhaseMs[PhaseIndex]);
+            Calls += Sample.Calls[PhaseIndex];
+        }
+    }
+
+    FTurnProfilePhaseStats Stats;
+    Stats.Turns = Values.Num();
+    if (Values.Num() == 0)
+    {
+        return Stats;
+    }
+
+    Values.Sort();
+    Stats.P50Ms = TurnProfilerPrivate::Percentile(Values, 0.50);
+    Stats.P95Ms = TurnProfilerPrivate::Percentile(Values, 0.95);
+    Stats.MaxMs = Values.Last();
+    Stats.MeanCalls = static_cast<double>(Calls) / Values.Num();
+    return Stats;
+}
+
+FString FTurnProfileWindow::ToChromeTraceJson() const
+{
+    using namespace TurnProfilerPrivate;
+
+    // Oldest closed turn is time zero
+    double Origin = NumSamples > 0 ? GetSample(NumSamples - 1).StartSeconds : 0.0;
+    const int32 FirstEvent = (NextEvent - NumEvents + Events.Num()) % Events.Num();
+    for (int32 Offset = 0; Offset < NumEvents; ++Offset)
+    {
+        const FTurnProfileEvent& Event = Events[(FirstEvent + Offset) % Events.Num()];
+        if (Event.TurnId != INDEX_NONE && (Origin == 0.0 || Event.StartSeconds < Origin))
+        {
+            Origin = Event.StartSeconds;
+        }
+    }
+
+    FString Json;
+    Json.Reserve(256 + NumSamples * 192 + NumEvents * 128);
+    Json += TEXT("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    Json += TEXT("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"RogueTurn\"}}");
+    Json.Appendf(TEXT(",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"Turns\"}}"), LaneTurns);
+    Json.Appendf(TEXT(",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"Pipeline\"}}"), LanePipeline);
+    Json.Appendf(TEXT(",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"Barrier\"}}"), LaneBarrier);
+
+    const int32 FindPathIndex = static_cast<int32>(ETurnProfilePhase::FindPath);
+    for (int32 Age = NumSamples - 1; Age >= 0; --Age)
+    {
+        const FTurnProfileSample& Sample = GetSample(Age);
+        const double Ts = ToMicros(Sample.StartSeconds, Origin);
+
+        Json.Appendf(TEXT(",\n{\"name\":\"Turn %d\",\"cat\":\"turn\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"turn\":%d}}"),
+            Sample.TurnId, LaneTurns, Ts, (Sample.EndSeconds - Sample.StartSeconds) * 1000000.0, Sample.TurnId);
+
+        // FindPath is aggregated per turn, so it is a counter track rather than slices
+        Json.Appendf(TEXT(",\n{\"name\":\"FindPath\",\"cat\":\"turn\",\"ph\":\"C\",\"pid\":1,\"ts\":%.3f,\"args\":{\"ms\":%.4f,\"calls\":%d}}"),
+            Ts, Sample.PhaseMs[FindPathIndex], Sample.Calls[FindPathIndex]);
+    }
+
+    for (int32 Offset = 0; Offset < NumEvents; ++Offset)
+    {
+        const FTurnProfileEvent& Event = Events[(FirstEvent + Offset) % Events.Num()];
+        if (Event.TurnId == INDEX_NONE)
+        {
+            continue;
+        }
+
+        Json.Appendf(TEXT(",\n{\"name\":\"%s\",\"cat\":\"phase\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"turn\":%d}}"),
+            GetPhaseName(Event.Phase),
+            Event.Phase == ETurnProfilePhase::BarrierWait ? LaneBarrier : LanePipeline,
+            ToMicros(Event.StartSeconds, Origin), Event.DurationMs * 1000.0, Event.TurnId);
+    }
+
+    Json.Appendf(TEXT("\n],\n\"otherData\":{\"turns\":%d,\"phases\":{"), NumSamples);
+    for (int32 PhaseIndex = 0; PhaseIndex < NumPhases; ++PhaseIndex)
+    {
+        const ETurnProfilePhase Phase = static_cast<ETurnProfilePhase>(PhaseIndex);
+        const FTurnProfilePhaseStats Stats = ComputeStats(Phase);
+        Json.Appendf(TEXT("%s\n\"%s\":{\"turns\":%d,\"p50_ms\":%.4f,\"p95_ms\":%.4f,\"max_ms\":%.4f,\"calls_per_turn\":%.2f}"),
+            PhaseIndex > 0 ? TEXT(",") : TEXT(""), GetPhaseName(Phase),
+            Stats.Turns, Stats.P50Ms, Stats.P95Ms, Stats.MaxMs, Stats.MeanCalls);
+    }
+    Json += TEXT("\n}}}\n");
+
+    return Json;
+}
+
+const TCHAR* FTurnProfileWindow::GetPhaseName(ETurnProfilePhase Phase)
+{
+    switch (Phase)
+    {
+    case ETurnProfilePhase::Observe:          return TEXT("Observe");
+    case ETurnProfilePhase::Think:            return TEXT("Think");
+    case ETurnProfilePhase::Resolve:          return TEXT("Resolve");
+    case ETurnProfilePhase::Execute:          return TEXT("Execute");
+    case ETurnProfilePhase::Cleanup:          return TEXT("Cleanup");
+    case ETurnProfilePhase::ResolveConflicts: return TEXT("ResolveConflicts");
+    case ETurnProfilePhase::DistanceField:    return TEXT("DistanceField");
+    case ETurnProfilePhase::FindPath:         return TEXT("FindPath");
+    case ETurnProfilePhase::BarrierWait:      return TEXT("BarrierWait");
+    case ETurnProfilePhase::Speculate:        return TEXT("Speculate");
+    default:                                  return TEXT("Unknown");
+    }
+}
+
+//------------------------------------------------------------------------------
+// UTurnProfilerSubsystem
+//------------------------------------------------------------------------------
+
+bool UTurnProfilerSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UTurnProfilerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+    SyncCapacity();
+    UE_LOG(LogTurnProfiler, Log, TEXT("[TurnProfiler] Initialized (Window=%d)"), GTS_Profile_Window);
+}
+
+void UTurnProfilerSubsystem::Deinitialize()
+{
+    if (Window.Num() > 0)
+    {
+        DumpStats();
+    }
+    Super::Deinitialize();
+}
+
+bool UTurnProfilerSubsystem::IsEnabled() const
+{
+    return GTS_Profile_Window > 0;
+}
+
+void UTurnProfilerSubsystem::SyncCapacity()
+{
+    const int32 Desired = FMath::Clamp(GTS_Profile_Window, 1, TurnProfilerPrivate::MaxWindow);
+    if (Window.GetCapacity() != Desired)
+    {
+        Window.SetCapacity(Desired);
+    }
+}
+
+void UTurnProfilerSubsystem::AddPhaseTime(ETurnProfilePhase Phase, double StartSeconds, double Seconds)
+{
+    Window.AddTime(Phase, StartSeconds, Seconds);
+
+    if (Phase == ETurnProfilePhase::FindPath)
+    {
+        INC_DWORD_STAT(STAT_TurnProfile_FindPathCalls);
+    }
+    else if (Phase == ETurnProfilePhase::BarrierWait)
+    {
+        SET_FLOAT_STAT(STAT_TurnProfile_BarrierWaitMs, Seconds * 1000.0);
+    }
+}
+
+void UTurnProfilerSubsystem::NoteTurnCompleted(int32 TurnId, TConstArrayView<TObjectPtr<UObject>> Observers)
+{
+    if (!IsEnabled())
+    {
+        return;
+    }
+
+    const FTurnProfileSample& Sample = Window.CommitTurn(TurnId, FPlatformTime::Seconds());
+    SET_FLOAT_STAT(STAT_TurnProfile_TurnMs, (Sample.EndSeconds - Sample.StartSeconds) * 1000.0);
+
+    for (UObject* Observer : Observers)
+    {
+        if (!IsValid(Observer) || !Observer->Implements<UDebugObserver>())
+        {
+            continue;
+        }
+
+        for (int32 PhaseIndex = 0; PhaseIndex < TurnProfilerPrivate::NumPhases; ++PhaseIndex)
+        {
+            if (Sample.Calls[PhaseIndex] > 0)
+            {
+                IDebugObserver::Execute_OnPhaseCompleted(Observer, GetPhaseTag(static_cast<ETurnProfilePhase>(PhaseIndex)),
+                    static_cast<float>(Sample.PhaseMs[PhaseIndex] / 1000.0));
+            }
+        }
+    }
+
+    // A console resize takes effect between turns
+    SyncCapacity();
+}
+
+FTurnProfilePhaseStats UTurnProfilerSubsystem::GetPhaseStats(ETurnProfilePhase Phase) const
+{
+    return Window.ComputeStats(Phase);
+}
+
+void UTurnProfilerSubsystem::DumpStats() const
+{
+    UE_LOG(LogTurnProfiler, Log, TEXT("[TurnProfiler] Last %d turn(s) (window %d):"), Window.Num(), Window.GetCapacity());
+
+    for (int32 PhaseIndex = 0; PhaseIndex < TurnProfilerPrivate::NumPhases; ++PhaseIndex)
+    {
+        const ETurnProfilePhase Phase = static_cast<ETurnProfilePhase>(PhaseIndex);
+        const FTurnProfilePhaseStats Stats = Window.ComputeStats(Phase);
+        UE_LOG(LogTurnProfiler, Log, TEXT("[TurnProfiler]   %-16s turns=%4d p50=%8.3fms p95=%8.3fms max=%8.3fms calls/turn=%.1f"),
+            FTurnProfileWindow::GetPhaseName(Phase), Stats.Turns, Stats.P50Ms, Stats.P95Ms, Stats.MaxMs, Stats.MeanCalls);
+    }
+}
+
+bool UTurnProfilerSubsystem::ExportChromeTrace(const FString& Path)
+{
+    FString OutPath = Path;
+    if (OutPath.IsEmpty())
+    {
+        const FString MapName = GetWorld() ? UWorld::RemovePIEPrefix(GetWorld()->GetMapName()) : FString(TEXT("NoWorld"));
+        OutPath = FPaths::ProjectSavedDir() / TEXT("Profiling") / FString::Printf(TEXT("TurnProfile_%s_%s.json"),
+            *MapName, *FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S")));
+    }
+
+    const bool bSaved = FFileHelper::SaveStringToFile(Window.ToChromeTraceJson(), *OutPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+    UE_LOG(LogTurnProfiler, Log, TEXT("[TurnProfiler] Chrome trace (%d turns) -> %s (%s)"),
+        Window.Num(), *OutPath, bSaved ? TEXT("ok") : TEXT("failed"));
+    return bSaved;
+}
+
+void UTurnProfilerSubsystem::ResetWindow()
+{
+    Window.Reset();
+}
+
+FGameplayTag UTurnProfilerSubsystem::GetPhaseTag(ETurnProfilePhase Phase)
+{
+    switch (Phase)
+    {
+    case ETurnProfilePhase::Observe:          return RogueGameplayTags::Phase_Profile_Observe;
+    case ETurnProfilePhase::Think:            return RogueGameplayTags::Phase_Profile_Think;
+    case ETurnProfilePhase::Resolve:          return RogueGameplayTags::Phase_Profile_Resolve;
+    case ETurnProfilePhase::Execute:          return RogueGameplayTags::Phase_Profile_Execute;
+    case ETurnProfilePhase::Cleanup:          return RogueGameplayTags::Phase_Profile_Cleanup;
+    case ETurnProfilePhase::ResolveConflicts: return RogueGameplayTags::Phase_Profile_ResolveConflicts;
+    case ETurnProfilePhase::DistanceField:    return RogueGameplayTags::Phase_Profile_DistanceField;
+    case ETurnProfilePhase::FindPath:         return RogueGameplayTags::Phase_Profile_FindPath;
+    case ETurnProfilePhase::BarrierWait:      return RogueGameplayTags::Phase_Profile_BarrierWait;
+    case ETurnProfilePhase::Speculate:        return RogueGameplayTags::Phase_Profile_Speculate;
+    default:                                  return FGameplayTag();
+    }
+}
+
+//------------------------------------------------------------------------------
+// Console commands
+//------------------------------------------------------------------------------
+
+static FAutoConsoleCommandWithWorldAndArgs CmdTS_Profile_Dump(
+    TEXT("ts.Profile.Dump"),
+    TEXT("Log p50/p95/max per turn phase over the turn profiler window."),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+    {
+        if (UTurnProfilerSubsystem* Profiler = TurnProfilerPrivate::GetProfiler(World))
+        {
+            Profiler->DumpStats();
+        }
+    }));
+
+static FAutoConsoleCommandWithWorldAndArgs CmdTS_Profile_ExportTrace(
+    TEXT("ts.Profile.ExportTrace"),
+    TEXT("Write the turn profiler window as Chrome trace JSON. Usage: ts.Profile.ExportTrace [OutFile]"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+    {
+        if (UTurnProfilerSubsystem* Profiler = TurnProfilerPrivate::GetProfiler(World))
+        {
+            Profiler->ExportChromeTrace(Args.Num() > 0 ? Args[0] : FString());
+        }
+    }));
+
+static FAutoConsoleCommandWithWorldAndArgs CmdTS_Profile_Reset(
+    TEXT("ts.Profile.Reset"),
+    TEXT("Clear the turn profiler window."),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+    {
+        if (UTurnProfilerSubsystem* Profiler = TurnProfilerPrivate::GetProfiler(World))
+        {
+            Profiler->ResetWindow();
+        }
+    }));
+
+//------------------------------------------------------------------------------
+// FTurnProfileScope
+//------------------------------------------------------------------------------
+
+// CodeRevision: INC-2025-1230-R2 (One phase scope for profiler and replay; speculative planning timed separately) (2025-12-27 11:00)
+namespace TurnProfilerPrivate
+{
+    // Open Speculate scopes (game thread only)
+    static int32 GSpeculationDepth = 0;
+}
+
+FTurnProfileScope::FTurnProfileScope(const UObject* WorldContext, ETurnProfilePhase InPhase)
+    : Phase(InPhase)
+{
+    // The window is game-thread state; worker-thread callers only get the CPU scope
+    if (!IsInGameThread())
+    {
+        return;
+    }
+
+    if (Phase == ETurnProfilePhase::Speculate)
+    {
+        bOpensSpeculation = true;
+        ++TurnProfilerPrivate::GSpeculationDepth;
+    }
+    else if (TurnProfilerPrivate::GSpeculationDepth > 0)
+    {
+        // Speculative plans are accounted to the enclosing Speculate scope only
+        return;
+    }
+
+    UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+    Profiler = World ? World->GetSubsystem<UTurnProfilerSubsystem>() : nullptr;
+    if (Profiler && !Profiler->IsEnabled())
+    {
+        Profiler = nullptr;
+    }
+
+    if (static_cast<int32>(Phase) < NumTurnCorePhases)
+    {
+        Replay = World ? World->GetSubsystem<UTurnReplaySubsystem>() : nullptr;
+        if (Replay && !Replay->IsCapturing())
+        {
+            Replay = nullptr;
+        }
+    }
+
+    if (Profiler || Replay)
+    {
+        StartSeconds = FPlatformTime::Seconds();
+    }
+}
+
+FTurnProfileScope::~FTurnProfileScope()
+{
+    if (bOpensSpeculation)
+    {
+        --TurnProfilerPrivate::GSpeculationDepth;
+    }
+
+    if (Profiler || Replay)
+    {
+        const double Seconds = FPlatformTime::Seconds() - StartSeconds;
+        if (Profiler)
+        {
+            Profiler->AddPhaseTime(Phase, StartSeconds, Seconds);
+        }
+        if (Replay)
+        {
+            Replay->AddPhaseTime(Phase, Seconds);
+        }
+    }
+}
@@ -0,0 +1,239 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+// CodeRevision: INC-2025-1230-R1 (Turn pipeline CPU profiling: trace scopes, STAT counters, rolling percentiles, Chrome trace export) (2025-12-23 10:00)
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "TurnProfilerSubsystem.generated.h"
+
+// Log category
+DECLARE_LOG_CATEGORY_EXTERN(LogTurnProfiler, Log, All);
+
+class UTurnReplaySubsystem;
+
+DECLARE_STATS_GROUP(TEXT("RogueTurn"), STATGROUP_RogueTurn, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Observe"), STAT_TurnProfile_Observe, STATGROUP_RogueTurn, LYRAGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Think"), STAT_TurnProfile_Think, STATGROUP_RogueTurn, LYRAGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Resolve"), STAT_TurnProfile_Resolve, STATGROUP_RogueTurn, LYRAGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Execute"), STAT_TurnProfile_Execute, STATGROUP_RogueTurn, LYRAGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Cleanup"), STAT_TurnProfile_Cleanup, STATGROUP_RogueTurn, LYRAGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ResolveAllConflicts"), STAT_TurnProfile_ResolveConflicts, STATGROUP_RogueTurn, LYRAGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("DistanceField Update"), STAT_TurnProfile_DistanceField, STATGROUP_RogueTurn, LYRAGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("FindPath"), STAT_TurnProfile_FindPath, STATGROUP_RogueTurn, LYRAGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Speculate"), STAT_TurnProfile_Speculate, STATGROUP_RogueTurn, LYRAGAME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("FindPath Calls"), STAT_TurnProfile_FindPathCalls, STATGROUP_RogueTurn, LYRAGAME_API);
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Barrier Wait (ms, last)"), STAT_TurnProfile_BarrierWaitMs, STATGROUP_RogueTurn, LYRAGAME_API);
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Turn (ms, last)"), STAT_TurnProfile_TurnMs, STATGROUP_RogueTurn, LYRAGAME_API);
+
+/** Timed sections of a turn. The first five are the core pipeline; the rest are nested or asynchronous. */
+UENUM(BlueprintType)
+enum class ETurnProfilePhase : uint8
+{
+    Observe,
+    Think,
+    Resolve,
+    Execute,
+    Cleanup,
+    ResolveConflicts,
+    DistanceField,
+    FindPath,
+    // Wall time from the first registered action until the barrier drains (not a CPU scope)
+    BarrierWait,
+    // Speculative enemy planning during the input window; scopes opened inside it are not timed on their own
+    Speculate,
+    Count UMETA(Hidden)
+};
+
+// CodeRevision: INC-2025-1230-R2 (One phase scope for profiler and replay; speculative planning timed separately) (2025-12-27 11:00)
+/** Observe..Cleanup: the core pipeline phases UTurnReplaySubsystem also keeps per frame */
+constexpr int32 NumTurnCorePhases = static_cast<int32>(ETurnProfilePhase::Cleanup) + 1;
+
+/** Rolling statistics of one phase over the profiler window */
+USTRUCT(BlueprintType)
+struct LYRAGAME_API FTurnProfilePhaseStats
+{
+    GENERATED_BODY()
+
+    // Turns in the window that entered this phase at least once
+    UPROPERTY(BlueprintReadOnly, Category = "Turn|Profile")
+    int32 Turns = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Turn|Profile")
+    double P50Ms = 0.0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Turn|Profile")
+    double P95Ms = 0.0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Turn|Profile")
+    double MaxMs = 0.0;
+
+    // Mean number of scopes per turn (FindPath runs many times per turn)
+    UPROPERTY(BlueprintReadOnly, Category = "Turn|Profile")
+    double MeanCalls = 0.0;
+};
+
+/** One closed turn: summed wall time and scope count per phase */
+struct FTurnProfileSample
+{
+    static constexpr int32 NumPhases = static_cast<int32>(ETurnProfilePhase::Count);
+
+    int32 TurnId = INDEX_NONE;
+    double StartSeconds = 0.0;
+    double EndSeconds = 0.0;
+    double PhaseMs[NumPhases] = {};
+    int32 Calls[NumPhases] = {};
+};
+
+/** One timed scope, kept for the Chrome trace export */
+struct FTurnProfileEvent
+{
+    double StartSeconds = 0.0;
+    float DurationMs = 0.0f;
+    int32 TurnId = INDEX_NONE;
+    ETurnProfilePhase Phase = ETurnProfilePhase::Observe;
+};
+
+/**
+ * FTurnProfileWindow: the last N turns of phase timings (plain data, no UObject).
+ *
+ * Scopes accumulate into the open turn; CommitTurn closes it into a ring of N samples.
+ * Individual scopes are also kept in a bounded event ring for the Chrome trace export,
+ * except FindPath which is only aggregated (hundreds of calls per turn).
+ */
+class LYRAGAME_API FTurnProfileWindow
+{
+public:
+    static constexpr int32 EventsPerTurn = 32;
+
+    explicit FTurnProfileWindow(int32 InCapacity = 128);
+
+    /** Resizes the ring; drops every sample and event. */
+    void SetCapacity(int32 InCapacity);
+    int32 GetCapacity() const { return Samples.Num(); }
+
+    void AddTime(ETurnProfilePhase Phase, double StartSeconds, double Seconds);
+
+    /** Closes the open turn into the ring and returns it. */
+    const FTurnProfileSample& CommitTurn(int32 TurnId, double NowSeconds);
+
+    void Reset();
+
+    /** Closed turns in the window (<= capacity) */
+    int32 Num() const { return NumSamples; }
+
+    /** Age 0 is the newest closed turn. */
+    const FTurnProfileSample& GetSample(int32 Age) const;
+
+    /** Nearest-rank percentiles over the turns that entered Phase. */
+    FTurnProfilePhaseStats ComputeStats(ETurnProfilePhase Phase) const;
+
+    /** Trace Event Format JSON (chrome://tracing, Perfetto) with the window stats under "otherData". */
+    FString ToChromeTraceJson() const;
+
+    static const TCHAR* GetPhaseName(ETurnProfilePhase Phase);
+
+private:
+    TArray<FTurnProfileSample> Samples;
+    int32 NextSample = 0;
+    int32 NumSamples = 0;
+
+    TArray<FTurnProfileEvent> Events;
+    int32 NextEvent = 0;
+    int32 NumEvents = 0;
+    // Events of the open turn (stamped with its id on commit)
+    int32 OpenEvents = 0;
+
+    FTurnProfileSample Open;
+};
+
+/**
+ * UTurnProfilerSubsystem: always-on per-turn phase timings for the turn pipeline.
+ *
+ * The pipeline marks its phases with TURN_PROFILE_SCOPE, which emits a named CPU scope for
+ * Unreal Insights (and a STAT_TurnProfile_* cycle counter when stats are compiled in) and adds
+ * the wall time to the open turn. UTurnCorePhaseManager closes the turn after cleanup, which
+ * reports each phase to the IDebugObservers via OnPhaseCompleted.
+ *
+ * Console:
+ *   ts.Profile.Window <N>        turns kept (0 disables timing)
+ *   ts.Profile.Dump              p50 / p95 / max per phase over the window
+ *   ts.Profile.ExportTrace [Path] Chrome trace JSON (default Saved/Profiling/TurnProfile_<Map>_<Time>.json)
+ *   ts.Profile.Reset
+ */
+UCLASS()
+class LYRAGAME_API UTurnProfilerSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    /** False while ts.Profile.Window is 0 (scopes then skip the clock reads). */
+    bool IsEnabled() const;
+
+    void AddPhaseTime(ETurnProfilePhase Phase, double StartSeconds, double Seconds);
+
+    /** Close the open turn and report every phase it entered to Observers (IDebugObserver). */
+    void NoteTurnCompleted(int32 TurnId, TConstArrayView<TObjectPtr<UObject>> Observers);
+
+    UFUNCTION(BlueprintPure, Category = "Turn|Profile")
+    FTurnProfilePhaseStats GetPhaseStats(ETurnProfilePhase Phase) const;
+
+    UFUNCTION(BlueprintCallable, Category = "Turn|Profile")
+    void DumpStats() const;
+
+    /** Write the window as Chrome trace JSON to Path (or Saved/Profiling/TurnProfile_<Map>_<Time>.json). */
+    UFUNCTION(BlueprintCallable, Category = "Turn|Profile")
+    bool ExportChromeTrace(const FString& Path = TEXT(""));
+
+    UFUNCTION(BlueprintCallable, Category = "Turn|Profile")
+    void ResetWindow();
+
+    const FTurnProfileWindow& GetWindow() const { return Window; }
+
+    /** Tag passed to IDebugObserver::OnPhaseCompleted for Phase */
+    static FGameplayTag GetPhaseTag(ETurnProfilePhase Phase);
+
+private:
+    void SyncCapacity();
+
+    FTurnProfileWindow Window;
+};
+
+/**
+ * Adds the scope's wall time to the open turn (no-op without a profiler or with ts.Profile.Window 0)
+ * and, for the core phases, to the current replay frame while recording or replaying.
+ * Inside a Speculate scope other phases are not timed, so speculative plans do not count as Think.
+ */
+class LYRAGAME_API FTurnProfileScope
+{
+public:
+    FTurnProfileScope(const UObject* WorldContext, ETurnProfilePhase InPhase);
+    ~FTurnProfileScope();
+
+private:
+    UTurnProfilerSubsystem* Profiler = nullptr;
+    UTurnReplaySubsystem* Replay = nullptr;
+    ETurnProfilePhase Phase;
+    double StartSeconds = 0.0;
+    bool bOpensSpeculation = false;
+};
+
+// Cycle counters already emit a named Insights scope when stats are compiled in; avoid a duplicate.
+#if STATS
+#define TURN_PROFILE_CPU_SCOPE(Phase) SCOPE_CYCLE_COUNTER(STAT_TurnProfile_##Phase)
+#else
+#define TURN_PROFILE_CPU_SCOPE(Phase) TRACE_CPUPROFILER_EVENT_SCOPE(TurnProfile_##Phase)
+#endif
+
+/** Insights scope + STAT counter + rolling window sample for one ETurnProfilePhase. */
+#define TURN_PROFILE_SCOPE(WorldContext, Phase) \
+    TURN_PROFILE_CPU_SCOPE(Phase); \
+    FTurnProfileScope PREPROCESSOR_JOIN(TurnProfileScope_, __LINE__)(WorldContext, ETurnProfilePhase::Phase)
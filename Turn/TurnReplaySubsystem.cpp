@@ -0,0 +1,498 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+// CodeRevision: INC-2025-1216-R1 (Add deterministic turn record/replay for perf regression runs) (2025-12-16 10:00)
+#include "Turn/TurnReplaySubsystem.h"
+#include "Turn/TurnCommandHandler.h"
+#include "Turn/TurnFlowCoordinator.h"
+#include "Grid/GridOccupancySubsystem.h"
+#include "Utility/RogueGameplayTags.h"
+#include "Kismet/GameplayStatics.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+DEFINE_LOG_CATEGORY(LogTurnReplay);
+
+static int32 GTS_Replay_Record = 0;
+static FAutoConsoleVariableRef CVarTS_Replay_Record(
+    TEXT("ts.Replay.Record"),
+    GTS_Replay_Record,
+    TEXT("Record floor seeds, accepted player commands and per-turn hashes for game worlds created after this is set (0=off, 1=on)."),
+    ECVF_Default
+);
+
+TOptional<FTurnReplayRecord> UTurnReplaySubsystem::QueuedReplay;
+
+namespace TurnReplayPrivate
+{
+    static constexpr uint32 FileMagic = 0x50525452; // 'RTRP'
+    static constexpr int32 FileVersion = 1;
+    // CodeRevision: INC-2025-1230-R2 (One phase scope for profiler and replay; speculative planning timed separately) (2025-12-27 11:00)
+    static constexpr int32 NumPhases = NumTurnCorePhases;
+
+    /** Long package name without the PIE prefix, so records match across PIE and -game */
+    static FString GetWorldMapName(const UWorld* World)
+    {
+        return World ? UWorld::RemovePIEPrefix(World->GetOutermost()->GetName()) : FString();
+    }
+
+    struct FFnv1a
+    {
+        uint32 Hash = 2166136261u;
+
+        void Mix(uint32 Value)
+        {
+            Hash ^= Value;
+            Hash *= 16777619u;
+        }
+    };
+
+    /** Coarse action class; FName-based tag hashes differ between processes */
+    static uint32 ClassifyAction(const FResolvedAction& Action)
+    {
+        if (Action.bIsWait)
+        {
+            return 0;
+        }
+        if (Action.FinalAbilityTag.MatchesTag(RogueGameplayTags::AI_Intent_Attack))
+        {
+            return 2;
+        }
+        if (Action.FinalAbilityTag.MatchesTag(RogueGameplayTags::AI_Intent_Move))
+        {
+            return 1;
+        }
+        return 3;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Record serialization
+//------------------------------------------------------------------------------
+
+FArchive& operator<<(FArchive& Ar, FTurnReplayRecord& Record)
+{
+    using namespace TurnReplayPrivate;
+
+    uint32 Magic = FileMagic;
+    int32 Version = FileVersion;
+    Ar << Magic;
+    Ar << Version;
+
+    if (Ar.IsLoading() && (Magic != FileMagic || Version != FileVersion))
+    {
+        UE_LOG(LogTurnReplay, Error, TEXT("[TurnReplay] Unsupported record (Magic=0x%08X, Version=%d)"), Magic, Version);
+        Ar.SetError();
+        return Ar;
+    }
+
+    Ar << Record.MapName;
+    Ar << Record.FloorSeeds;
+
+    int32 NumCommands = Record.Commands.Num();
+    Ar << NumCommands;
+    if (Ar.IsLoading())
+    {
+        Record.Commands.SetNum(NumCommands);
+    }
+
+    for (FPlayerCommand& Command : Record.Commands)
+    {
+        FString TagName = Command.CommandTag.ToString();
+        Ar << TagName;
+        Ar << Command.TargetCell;
+        Ar << Command.Direction;
+        Ar << Command.TurnId;
+
+        if (Ar.IsLoading())
+        {
+            Command.CommandTag = FGameplayTag::RequestGameplayTag(FName(*TagName), /*ErrorIfNotFound=*/false);
+            Command.TargetActor = nullptr;
+        }
+    }
+
+    int32 NumFrames = Record.Frames.Num();
+    Ar << NumFrames;
+    if (Ar.IsLoading())
+    {
+        Record.Frames.SetNum(NumFrames);
+    }
+
+    for (FTurnReplayFrame& Frame : Record.Frames)
+    {
+        Ar << Frame.ResolveHash;
+        Ar << Frame.StateHash;
+        Ar << Frame.PhaseMicros;
+    }
+
+    return Ar;
+}
+
+bool FTurnReplayRecord::SaveToFile(const FString& Path) const
+{
+    TArray<uint8> Bytes;
+    FMemoryWriter Writer(Bytes);
+    Writer << const_cast<FTurnReplayRecord&>(*this);
+
+    return !Writer.IsError() && FFileHelper::SaveArrayToFile(Bytes, *Path);
+}
+
+bool FTurnReplayRecord::LoadFromFile(const FString& Path)
+{
+    TArray<uint8> Bytes;
+    if (!FFileHelper::LoadFileToArray(Bytes, *Path))
+    {
+        return false;
+    }
+
+    FMemoryReader Reader(Bytes);
+    Reader << *this;
+    return !Reader.IsError();
+}
+
+//------------------------------------------------------------------------------
+// Subsystem Lifecycle
+//------------------------------------------------------------------------------
+
+bool UTurnReplaySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UTurnReplaySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    using namespace TurnReplayPrivate;
+
+    Super::Initialize(Collection);
+
+    const FString MapName = GetWorldMapName(GetWorld());
+
+    FString ReplayPath;
+    if (QueuedReplay.IsSet() && QueuedReplay->MapName == MapName)
+    {
+        Record = MoveTemp(QueuedReplay.GetValue());
+        QueuedReplay.Reset();
+        Mode = ETurnReplayMode::Replaying;
+    }
+    else if (FParse::Value(FCommandLine::Get(), TEXT("TurnReplay="), ReplayPath))
+    {
+        FTurnReplayRecord Loaded;
+        if (!Loaded.LoadFromFile(ReplayPath))
+        {
+            UE_LOG(LogTurnReplay, Error, TEXT("[TurnReplay] Failed to load %s"), *ReplayPath);
+        }
+        else if (Loaded.MapName == MapName)
+        {
+            Record = MoveTemp(Loaded);
+            Mode = ETurnReplayMode::Replaying;
+        }
+    }
+    else if (GTS_Replay_Record != 0 || FParse::Param(FCommandLine::Get(), TEXT("TurnReplayRecord")))
+    {
+        Record.MapName = MapName;
+        Mode = ETurnReplayMode::Recording;
+    }
+
+    CurrentFrame.PhaseMicros.Init(0.f, NumPhases);
+    Result.PhaseTotalMs.Init(0.0, NumPhases);
+    Result.PhaseMaxMs.Init(0.0, NumPhases);
+
+    UE_LOG(LogTurnReplay, Log, TEXT("[TurnReplay] Initialized: Map=%s Mode=%s Commands=%d Frames=%d"),
+        *MapName, *UEnum::GetValueAsString(Mode), Record.Commands.Num(), Record.Frames.Num());
+}
+
+void UTurnReplaySubsystem::Deinitialize()
+{
+    if (Mode == ETurnReplayMode::Recording && Record.Frames.Num() > 0)
+    {
+        SaveRecording();
+    }
+    else if (Mode == ETurnReplayMode::Replaying && !bReplayFinished)
+    {
+        UE_LOG(LogTurnReplay, Warning, TEXT("[TurnReplay] World torn down after %d/%d frames"),
+            NextFrameIndex, Record.Frames.Num());
+    }
+
+    Mode = ETurnReplayMode::Idle;
+    PendingHandler.Reset();
+
+    Super::Deinitialize();
+}
+
+void UTurnReplaySubsystem::QueueReplay(const FTurnReplayRecord& InRecord)
+{
+    QueuedReplay = InRecord;
+}
+
+bool UTurnReplaySubsystem::SaveRecording(const FString& Path)
+{
+    FString FinalPath = Path;
+    if (FinalPath.IsEmpty())
+    {
+        FinalPath = FPaths::ProjectSavedDir() / TEXT("TurnReplays") /
+            FString::Printf(TEXT("%s_%s.turnreplay"), *FPaths::GetBaseFilename(Record.MapName), *FDateTime::Now().ToString());
+    }
+
+    const bool bSaved = Record.SaveToFile(FinalPath);
+    UE_LOG(LogTurnReplay, Log, TEXT("[TurnReplay] %s %s (Seeds=%d Commands=%d Frames=%d)"),
+        bSaved ? TEXT("Saved") : TEXT("FAILED to save"), *FinalPath,
+        Record.FloorSeeds.Num(), Record.Commands.Num(), Record.Frames.Num());
+    return bSaved;
+}
+
+//------------------------------------------------------------------------------
+// Pipeline Hooks
+//------------------------------------------------------------------------------
+
+int32 UTurnReplaySubsystem::AcquireFloorSeed()
+{
+    int32 Seed = 0;
+    if (Mode == ETurnReplayMode::Replaying && Record.FloorSeeds.IsValidIndex(NextFloorSeedIndex))
+    {
+        Seed = Record.FloorSeeds[NextFloorSeedIndex++];
+    }
+    else
+    {
+        if (Mode == ETurnReplayMode::Replaying)
+        {
+            UE_LOG(LogTurnReplay, Warning, TEXT("[TurnReplay] Floor %d was not recorded; using a fresh seed"), NextFloorSeedIndex);
+        }
+
+        FRandomStream Fresh;
+        Fresh.GenerateNewSeed();
+        Seed = Fresh.GetInitialSeed();
+
+        if (Mode == ETurnReplayMode::Recording)
+        {
+            Record.FloorSeeds.Add(Seed);
+        }
+    }
+
+    // Spawn placement and combat rolls use the global RNG; tie it to the floor.
+    if (IsCapturing())
+    {
+        FMath::RandInit(Seed);
+        FMath::SRandInit(Seed);
+    }
+
+    return Seed;
+}
+
+void UTurnReplaySubsystem::NoteAcceptedCommand(const FPlayerCommand& Command)
+{
+    if (Mode != ETurnReplayMode::Recording)
+    {
+        return;
+    }
+
+    FPlayerCommand& Stored = Record.Commands.Add_GetRef(Command);
+    Stored.TargetActor = nullptr;
+}
+
+void UTurnReplaySubsystem::NoteInputWindowOpened(UTurnCommandHandler* Handler)
+{
+    if (Mode != ETurnReplayMode::Replaying || bReplayFinished || !Handler)
+    {
+        return;
+    }
+
+    PendingHandler = Handler;
+
+    // Submit from the next tick so the command does not re-enter the code that opened the window.
+    if (!bSubmitScheduled)
+    {
+        if (UWorld* World = GetWorld())
+        {
+            bSubmitScheduled = true;
+            World->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateUObject(this, &UTurnReplaySubsystem::SubmitNextCommand));
+        }
+    }
+}
+
+void UTurnReplaySubsystem::NoteResolvedActions(const TArray<FResolvedAction>& Resolved)
+{
+    using namespace TurnReplayPrivate;
+
+    if (!IsCapturing())
+    {
+        return;
+    }
+
+    FFnv1a Hash;
+    Hash.Mix(static_cast<uint32>(CurrentFrame.ResolveHash));
+    for (const FResolvedAction& Action : Resolved)
+    {
+        Hash.Mix(static_cast<uint32>(Action.GenerationOrder));
+        Hash.Mix(static_cast<uint32>(Action.CurrentCell.X));
+        Hash.Mix(static_cast<uint32>(Action.CurrentCell.Y));
+        Hash.Mix(static_cast<uint32>(Action.NextCell.X));
+        Hash.Mix(static_cast<uint32>(Action.NextCell.Y));
+        Hash.Mix(ClassifyAction(Action));
+        Hash.Mix(static_cast<uint32>(Action.Reason));
+    }
+
+    // A turn may resolve more than once (slots, attack/move split); fold them together.
+    CurrentFrame.ResolveHash = static_cast<int32>(Hash.Hash);
+}
+
+void UTurnReplaySubsystem::NoteTurnCompleted()
+{
+    using namespace TurnReplayPrivate;
+
+    if (!IsCapturing())
+    {
+        return;
+    }
+
+    CurrentFrame.StateHash = static_cast<int32>(HashOccupiedCells());
+
+    if (Mode == ETurnReplayMode::Recording)
+    {
+        Record.Frames.Add(CurrentFrame);
+    }
+    else if (!bReplayFinished && Record.Frames.IsValidIndex(NextFrameIndex))
+    {
+        const FTurnReplayFrame& Expected = Record.Frames[NextFrameIndex];
+        if (Expected.ResolveHash != CurrentFrame.ResolveHash || Expected.StateHash != CurrentFrame.StateHash)
+        {
+            ++Result.HashMismatches;
+            if (Result.FirstMismatchTurn == INDEX_NONE)
+            {
+                Result.FirstMismatchTurn = NextFrameIndex;
+            }
+
+            UE_LOG(LogTurnReplay, Error,
+                TEXT("[TurnReplay] Turn %d diverged: Resolve 0x%08X (expected 0x%08X), State 0x%08X (expected 0x%08X)"),
+                NextFrameIndex,
+                static_cast<uint32>(CurrentFrame.ResolveHash), static_cast<uint32>(Expected.ResolveHash),
+                static_cast<uint32>(CurrentFrame.StateHash), static_cast<uint32>(Expected.StateHash));
+        }
+
+        for (int32 PhaseIndex = 0; PhaseIndex < NumPhases; ++PhaseIndex)
+        {
+            const double Ms = CurrentFrame.PhaseMicros[PhaseIndex] / 1000.0;
+            Result.PhaseTotalMs[PhaseIndex] += Ms;
+            Result.PhaseMaxMs[PhaseIndex] = FMath::Max(Result.PhaseMaxMs[PhaseIndex], Ms);
+        }
+
+        ++Result.TurnsVerified;
+        if (++NextFrameIndex >= Record.Frames.Num())
+        {
+            FinishReplay();
+        }
+    }
+
+    CurrentFrame.ResolveHash = 0;
+    CurrentFrame.StateHash = 0;
+    CurrentFrame.PhaseMicros.Init(0.f, NumPhases);
+}
+
+void UTurnReplaySubsystem::AddPhaseTime(ETurnProfilePhase Phase, double Seconds)
+{
+    const int32 PhaseIndex = static_cast<int32>(Phase);
+    if (CurrentFrame.PhaseMicros.IsValidIndex(PhaseIndex))
+    {
+        CurrentFrame.PhaseMicros[PhaseIndex] += static_cast<float>(Seconds * 1000000.0);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Replay Driver
+//------------------------------------------------------------------------------
+
+void UTurnReplaySubsystem::SubmitNextCommand()
+{
+    bSubmitScheduled = false;
+
+    UTurnCommandHandler* Handler = PendingHandler.Get();
+    if (Mode != ETurnReplayMode::Replaying || bReplayFinished || !Handler)
+    {
+        return;
+    }
+
+    if (!Record.Commands.IsValidIndex(NextCommandIndex))
+    {
+        // The recording ended while waiting for input; nothing can advance the game any more.
+        UE_LOG(LogTurnReplay, Log, TEXT("[TurnReplay] Out of commands at frame %d/%d"), NextFrameIndex, Record.Frames.Num());
+        FinishReplay();
+        return;
+    }
+
+    FPlayerCommand Command = Record.Commands[NextCommandIndex++];
+    if (UTurnFlowCoordinator* TFC = GetWorld()->GetSubsystem<UTurnFlowCoordinator>())
+    {
+        Command.TurnId = TFC->GetCurrentTurnId();
+        Command.WindowId = TFC->GetCurrentInputWindowId();
+    }
+
+    ++Result.CommandsSubmitted;
+    if (!Handler->ProcessPlayerCommand(Command))
+    {
+        ++Result.CommandsRejected;
+        UE_LOG(LogTurnReplay, Warning, TEXT("[TurnReplay] Recorded command %d (%s) rejected on replay"),
+            NextCommandIndex - 1, *Command.CommandTag.ToString());
+
+        // The window is still open; try the next recorded command.
+        NoteInputWindowOpened(Handler);
+    }
+}
+
+void UTurnReplaySubsystem::FinishReplay()
+{
+    using namespace TurnReplayPrivate;
+
+    bReplayFinished = true;
+    PendingHandler.Reset();
+
+    UE_LOG(LogTurnReplay, Log,
+        TEXT("[TurnReplay] Finished: Turns=%d/%d Submitted=%d Rejected=%d Mismatches=%d FirstMismatch=%d"),
+        Result.TurnsVerified, Record.Frames.Num(), Result.CommandsSubmitted, Result.CommandsRejected,
+        Result.HashMismatches, Result.FirstMismatchTurn);
+
+    for (int32 PhaseIndex = 0; PhaseIndex < NumPhases; ++PhaseIndex)
+    {
+        UE_LOG(LogTurnReplay, Log, TEXT("[TurnReplay]   %-8s total=%.3fms max=%.3fms"),
+            *UEnum::GetDisplayValueAsText(static_cast<ETurnProfilePhase>(PhaseIndex)).ToString(),
+            Result.PhaseTotalMs[PhaseIndex], Result.PhaseMaxMs[PhaseIndex]);
+    }
+}
+
+uint32 UTurnReplaySubsystem::HashOccupiedCells() const
+{
+    UWorld* World = GetWorld();
+    UGridOccupancySubsystem* Occupancy = World ? World->GetSubsystem<UGridOccupancySubsystem>() : nullptr;
+    if (!Occupancy)
+    {
+        return 0;
+    }
+
+    const AActor* Player = UGameplayStatics::GetPlayerPawn(World, 0);
+
+    // Map iteration order depends on insertion history; sort so only the layout matters.
+    TArray<TPair<FIntPoint, bool>, TInlineAllocator<64>> Cells;
+    for (const TPair<FIntPoint, TWeakObjectPtr<AActor>>& Pair : Occupancy->GetOccupiedCellMap())
+    {
+        Cells.Emplace(Pair.Key, Pair.Value.Get() == Player);
+    }
+
+    Cells.Sort([](const TPair<FIntPoint, bool>& A, const TPair<FIntPoint, bool>& B)
+    {
+        return A.Key.Y != B.Key.Y ? A.Key.Y < B.Key.Y : A.Key.X < B.Key.X;
+    });
+
+    TurnReplayPrivate::FFnv1a Hash;
+    for (const TPair<FIntPoint, bool>& Cell : Cells)
+    {
+        Hash.Mix(static_cast<uint32>(Cell.Key.X));
+        Hash.Mix(static_cast<uint32>(Cell.Key.Y));
+        Hash.Mix(Cell.Value ? 1u : 0u);
+    }
+    return Hash.Hash;
+}
@@ -0,0 +1,194 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+// CodeRevision: INC-2025-1216-R1 (Add deterministic turn record/replay for perf regression runs) (2025-12-16 10:00)
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "TurnSystemTypes.h"
+#include "TurnProfilerSubsystem.h"
+#include "TurnReplaySubsystem.generated.h"
+
+// Log category
+DECLARE_LOG_CATEGORY_EXTERN(LogTurnReplay, Log, All);
+
+class UTurnCommandHandler;
+
+UENUM(BlueprintType)
+enum class ETurnReplayMode : uint8
+{
+    Idle,
+    Recording,
+    Replaying
+};
+
+/** Per-turn digests and phase timings (timings are informational and never compared) */
+USTRUCT(BlueprintType)
+struct LYRAGAME_API FTurnReplayFrame
+{
+    GENERATED_BODY()
+
+    // FNV-1a over the resolved actions (GUID-free, so it survives a restart)
+    UPROPERTY(BlueprintReadOnly, Category = "Turn|Replay")
+    int32 ResolveHash = 0;
+
+    // FNV-1a over the sorted occupied cells at cleanup
+    UPROPERTY(BlueprintReadOnly, Category = "Turn|Replay")
+    int32 StateHash = 0;
+
+    // Microseconds spent in each core ETurnProfilePhase (Observe..Cleanup) during this turn
+    UPROPERTY(BlueprintReadOnly, Category = "Turn|Replay")
+    TArray<float> PhaseMicros;
+};
+
+/**
+ * Everything needed to reproduce a session: floor seeds, accepted commands and the
+ * per-turn digests to verify against. Serialized with operator<< (see SaveToFile).
+ */
+USTRUCT(BlueprintType)
+struct LYRAGAME_API FTurnReplayRecord
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Turn|Replay")
+    FString MapName;
+
+    // One entry per URogueDungeonSubsystem::StartGenerate call, in order
+    UPROPERTY(BlueprintReadOnly, Category = "Turn|Replay")
+    TArray<int32> FloorSeeds;
+
+    // Accepted player commands in acceptance order (TargetActor is not stored)
+    UPROPERTY(BlueprintReadOnly, Category = "Turn|Replay")
+    TArray<FPlayerCommand> Commands;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Turn|Replay")
+    TArray<FTurnReplayFrame> Frames;
+
+    bool SaveToFile(const FString& Path) const;
+    bool LoadFromFile(const FString& Path);
+
+    friend FArchive& operator<<(FArchive& Ar, FTurnReplayRecord& Record);
+};
+
+/** Outcome of a replay (valid once IsReplayFinished() returns true) */
+USTRUCT(BlueprintType)
+struct LYRAGAME_API FTurnReplayResult
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Turn|Replay")
+    int32 TurnsVerified = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Turn|Replay")
+    int32 CommandsSubmitted = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Turn|Replay")
+    int32 CommandsRejected = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Turn|Replay")
+    int32 HashMismatches = 0;
+
+    // First turn whose digests differ from the recording (INDEX_NONE if none)
+    UPROPERTY(BlueprintReadOnly, Category = "Turn|Replay")
+    int32 FirstMismatchTurn = INDEX_NONE;
+
+    // Per-phase totals (ms) over the whole replay, indexed by ETurnProfilePhase (core phases)
+    UPROPERTY(BlueprintReadOnly, Category = "Turn|Replay")
+    TArray<double> PhaseTotalMs;
+
+    // Per-phase worst single turn (ms), indexed by ETurnProfilePhase (core phases)
+    UPROPERTY(BlueprintReadOnly, Category = "Turn|Replay")
+    TArray<double> PhaseMaxMs;
+};
+
+/**
+ * UTurnReplaySubsystem: deterministic record/replay of a game session.
+ *
+ * Recording (ts.Replay.Record 1 or -TurnReplayRecord):
+ *   - URogueDungeonSubsystem reports the floor seed it generated with.
+ *   - UTurnCommandHandler reports every accepted FPlayerCommand.
+ *   - UTurnCorePhaseManager reports the resolved actions and the end of each turn.
+ *   The record is written to Saved/TurnReplays when the world is torn down.
+ *
+ * Replaying (-TurnReplay=<file> or QueueReplay before the map loads):
+ *   - Floor seeds are forced in recording order; the global gameplay RNG is reseeded
+ *     from them so spawn and combat rolls repeat.
+ *   - Each time an input window opens, the next recorded command is fed to
+ *     UTurnCommandHandler::ProcessPlayerCommand (re-stamped with the live TurnId/WindowId).
+ *   - Every turn's digests are compared against the recording.
+ *
+ * Conflict tie-breaks draw no random numbers (equal scores keep registration order),
+ * so they are covered by ResolveHash rather than a recorded draw stream.
+ */
+UCLASS()
+class LYRAGAME_API UTurnReplaySubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    /** Replay Record in the next game world that initializes this subsystem. */
+    static void QueueReplay(const FTurnReplayRecord& Record);
+
+    UFUNCTION(BlueprintPure, Category = "Turn|Replay")
+    ETurnReplayMode GetMode() const { return Mode; }
+
+    /** True while recording or replaying (phase timers are skipped otherwise). */
+    bool IsCapturing() const { return Mode != ETurnReplayMode::Idle; }
+
+    /** True once every recorded frame has been verified or the replay diverged fatally. */
+    UFUNCTION(BlueprintPure, Category = "Turn|Replay")
+    bool IsReplayFinished() const { return bReplayFinished; }
+
+    const FTurnReplayResult& GetReplayResult() const { return Result; }
+
+    const FTurnReplayRecord& GetRecord() const { return Record; }
+
+    /** Write the current recording to Path (or Saved/TurnReplays/<Map>_<Time>.turnreplay). */
+    UFUNCTION(BlueprintCallable, Category = "Turn|Replay")
+    bool SaveRecording(const FString& Path = TEXT(""));
+
+    // ========== Hooks called by the turn pipeline ==========
+
+    /**
+     * Pick the seed for the next floor: the recorded one while replaying, otherwise a fresh one.
+     * The chosen seed is recorded and also seeds the global gameplay RNG.
+     */
+    int32 AcquireFloorSeed();
+
+    void NoteAcceptedCommand(const FPlayerCommand& Command);
+    void NoteInputWindowOpened(UTurnCommandHandler* Handler);
+    void NoteResolvedActions(const TArray<FResolvedAction>& Resolved);
+    void NoteTurnCompleted();
+
+    /** Fed by FTurnProfileScope for the core phases while capturing. */
+    void AddPhaseTime(ETurnProfilePhase Phase, double Seconds);
+
+private:
+    void SubmitNextCommand();
+    void FinishReplay();
+    uint32 HashOccupiedCells() const;
+
+    ETurnReplayMode Mode = ETurnReplayMode::Idle;
+
+    UPROPERTY(Transient)
+    FTurnReplayRecord Record;
+
+    UPROPERTY(Transient)
+    FTurnReplayResult Result;
+
+    TWeakObjectPtr<UTurnCommandHandler> PendingHandler;
+
+    FTurnReplayFrame CurrentFrame;
+    int32 NextFloorSeedIndex = 0;
+    int32 NextCommandIndex = 0;
+    int32 NextFrameIndex = 0;
+    bool bReplayFinished = false;
+    bool bSubmitScheduled = false;
+
+    static TOptional<FTurnReplayRecord> QueuedReplay;
+};
+
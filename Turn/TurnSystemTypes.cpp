@@ -7,3 +7,38 @@
 
 // i\݂̂̂̂߁j
 // KvɉĒǉ
+
+
+// CodeRevision: INC-2025-1215-R1 (Compact resolution reason codes) (2025-12-15 17:00)
+FString FResolvedAction::DescribeResolution() const
+{
+    switch (Reason)
+    {
+    case EResolutionReason::NoConflict:
+        return FString::Printf(TEXT("Success: %s (no conflict)"), *FinalAbilityTag.ToString());
+    case EResolutionReason::HoldsOwnCell:
+        return FString::Printf(TEXT("Success: Stationary unit holds its own cell (%d,%d)"), ReasonCell.X, ReasonCell.Y);
+    case EResolutionReason::WonContest:
+        return FString::Printf(TEXT("Won contest for cell (%d,%d)"), ReasonCell.X, ReasonCell.Y);
+    case EResolutionReason::BlockedByStationary:
+        return FString::Printf(TEXT("Blocked by non-moving unit at cell (%d,%d)"), ReasonCell.X, ReasonCell.Y);
+    case EResolutionReason::SwapForbidden:
+        return ReasonDetail != 0
+            ? FString::Printf(TEXT("Conflict: Swap move forbidden (non-winning contender) at cell (%d,%d)"), ReasonCell.X, ReasonCell.Y)
+            : FString::Printf(TEXT("Conflict: Swap move forbidden at cell (%d,%d)"), ReasonCell.X, ReasonCell.Y);
+    case EResolutionReason::LostToAttacker:
+        return FString::Printf(TEXT("LostConflict: Cell (%d,%d) locked by attacker (Sequential)"), ReasonCell.X, ReasonCell.Y);
+    case EResolutionReason::LostToHigherPriority:
+        return FString::Printf(TEXT("LostConflict: Cell (%d,%d) occupied by higher priority"), ReasonCell.X, ReasonCell.Y);
+    case EResolutionReason::BlockedOnRevalidation:
+        return FString::Printf(TEXT("LostConflict: Target cell (%d,%d) blocked by stationary unit (Revalidation Iter %d)"),
+            ReasonCell.X, ReasonCell.Y, ReasonDetail);
+    case EResolutionReason::MoveReservationFailed:
+        return TEXT("Move reservation failed - converted to wait");
+    case EResolutionReason::AttackPhase:
+        return TEXT("Attack phase action");
+    case EResolutionReason::None:
+    default:
+        return TEXT("None");
+    }
+}
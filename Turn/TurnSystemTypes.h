@@ -300,6 +300,44 @@ struct FTurnContext
     FBoardSnapshot BoardState;
 };
 
+//------------------------------------------------------------------------------
+// Turn Action Barrier Handle
+//------------------------------------------------------------------------------
+
+// CodeRevision: INC-2025-1211-R1 (Generational slot handle replaces FGuid barrier action IDs) (2025-12-14 14:00)
+/**
+ * Handle to an in-flight action slot in UTurnActionBarrierSubsystem.
+ * Index addresses the slot array; Generation is bumped when the slot is released,
+ * so stale handles (double completion, completion after timeout) are rejected.
+ */
+USTRUCT(BlueprintType)
+struct LYRAGAME_API FTurnActionHandle
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "TurnBarrier")
+    int32 Index = INDEX_NONE;
+
+    // 0 = never issued; live slots start at 1
+    UPROPERTY(BlueprintReadOnly, Category = "TurnBarrier")
+    int32 Generation = 0;
+
+    bool IsValid() const { return Index != INDEX_NONE && Generation != 0; }
+    void Invalidate() { Index = INDEX_NONE; Generation = 0; }
+
+    FString ToString() const { return FString::Printf(TEXT("%d:%d"), Index, Generation); }
+
+    bool operator==(const FTurnActionHandle& Other) const
+    {
+        return Index == Other.Index && Generation == Other.Generation;
+    }
+
+    friend uint32 GetTypeHash(const FTurnActionHandle& Handle)
+    {
+        return HashCombine(::GetTypeHash(Handle.Index), ::GetTypeHash(Handle.Generation));
+    }
+};
+
 //------------------------------------------------------------------------------
 // Phase 2: Reservation / Resolution Structures
 //------------------------------------------------------------------------------
@@ -350,6 +388,27 @@ struct LYRAGAME_API FReservationEntry
     int32 GenerationOrder = 2147483647;
 };
 
+// CodeRevision: INC-2025-1215-R1 (Compact resolution reason codes) (2025-12-15 17:00)
+/**
+ * Why the conflict resolver produced an action. Rendered to text only for logs/debug
+ * via FResolvedAction::DescribeResolution().
+ */
+UENUM(BlueprintType)
+enum class EResolutionReason : uint8
+{
+    None                     UMETA(DisplayName = "None"),
+    NoConflict               UMETA(DisplayName = "Success (No Conflict)"),
+    HoldsOwnCell             UMETA(DisplayName = "Success (Stationary Holds Own Cell)"),
+    WonContest               UMETA(DisplayName = "Won Contest"),
+    BlockedByStationary      UMETA(DisplayName = "Blocked By Non-Moving Unit"),
+    SwapForbidden            UMETA(DisplayName = "Swap Forbidden"),
+    LostToAttacker           UMETA(DisplayName = "Lost: Cell Locked By Attacker"),
+    LostToHigherPriority     UMETA(DisplayName = "Lost: Higher Priority Contender"),
+    BlockedOnRevalidation    UMETA(DisplayName = "Lost: Blocked On Revalidation"),
+    MoveReservationFailed    UMETA(DisplayName = "Move Reservation Failed"),
+    AttackPhase              UMETA(DisplayName = "Attack Phase Action")
+};
+
 USTRUCT(BlueprintType)
 struct LYRAGAME_API FResolvedAction
 {
@@ -403,12 +462,30 @@ struct LYRAGAME_API FResolvedAction
     UPROPERTY(BlueprintReadOnly, Category = "Resolved")
     int32 TimeSlot = 0;
 
-    // Human-readable reason for how this action was resolved
+    // How this action was resolved (see DescribeResolution for text)
     UPROPERTY(BlueprintReadWrite, Category = "Resolved")
-    FString ResolutionReason;
+    EResolutionReason Reason = EResolutionReason::None;
+
+    // Cell the reason refers to (contested or blocking cell); (-1,-1) if not applicable
+    UPROPERTY(BlueprintReadWrite, Category = "Resolved")
+    FIntPoint ReasonCell = FIntPoint(-1, -1);
+
+    // Small reason payload (revalidation iteration, 1 = swap rejected as non-winning contender)
+    UPROPERTY(BlueprintReadWrite, Category = "Resolved")
+    int32 ReasonDetail = 0;
 
     // BUGFIX [INC-2025-TIMING]: Pre-registered Barrier ActionId for sync with animation / effects
-    FGuid BarrierActionId;
+    FTurnActionHandle BarrierActionId;
+
+    void SetResolution(EResolutionReason InReason, const FIntPoint& InCell = FIntPoint(-1, -1), int32 InDetail = 0)
+    {
+        Reason = InReason;
+        ReasonCell = InCell;
+        ReasonDetail = InDetail;
+    }
+
+    /** Human-readable reason; only call from log/debug paths. */
+    FString DescribeResolution() const;
 };
 
 //------------------------------------------------------------------------------
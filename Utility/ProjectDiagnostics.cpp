@@ -1,4 +1,5 @@
 #include "Utility/ProjectDiagnostics.h"
+#include "UObject/Object.h"
 
 // ============================================================================
 // ログカテゴリの定義（すべて集約）--
@@ -19,3 +20,43 @@ static FAutoConsoleVariableRef CVarRogueDebugVerboseLogging(
     ECVF_Cheat
 );
 
+// CodeRevision: INC-2025-1229-R1 (Diagnostics compiled out of Test/Shipping; per-channel ROGUE_DIAG gates) (2025-12-22 14:00)
+int32 RogueDiag::GChannelLevels[static_cast<int32>(ERogueDiagChannel::Count)] =
+{
+    ELogVerbosity::VeryVerbose,  // Turn
+    ELogVerbosity::VeryVerbose,  // AI
+    ELogVerbosity::VeryVerbose,  // Grid
+    ELogVerbosity::VeryVerbose,  // Occupancy
+};
+
+static FAutoConsoleVariableRef CVarTS_Diag_Turn(
+    TEXT("ts.Diag.Turn"),
+    RogueDiag::GChannelLevels[static_cast<int32>(ERogueDiagChannel::Turn)],
+    TEXT("Highest verbosity emitted by turn/resolver diagnostics (0=off, 2=Error, 3=Warning, 5=Log, 6=Verbose, 7=VeryVerbose)."),
+    ECVF_Default);
+
+static FAutoConsoleVariableRef CVarTS_Diag_AI(
+    TEXT("ts.Diag.AI"),
+    RogueDiag::GChannelLevels[static_cast<int32>(ERogueDiagChannel::AI)],
+    TEXT("Highest verbosity emitted by enemy AI diagnostics (0=off, 2=Error, 3=Warning, 5=Log, 6=Verbose, 7=VeryVerbose)."),
+    ECVF_Default);
+
+static FAutoConsoleVariableRef CVarTS_Diag_Grid(
+    TEXT("ts.Diag.Grid"),
+    RogueDiag::GChannelLevels[static_cast<int32>(ERogueDiagChannel::Grid)],
+    TEXT("Highest verbosity emitted by grid/pathfinding/spawn diagnostics (0=off, 2=Error, 3=Warning, 5=Log, 6=Verbose, 7=VeryVerbose)."),
+    ECVF_Default);
+
+static FAutoConsoleVariableRef CVarTS_Diag_Occupancy(
+    TEXT("ts.Diag.Occupancy"),
+    RogueDiag::GChannelLevels[static_cast<int32>(ERogueDiagChannel::Occupancy)],
+    TEXT("Highest verbosity emitted by grid occupancy/reservation diagnostics (0=off, 2=Error, 3=Warning, 5=Log, 6=Verbose, 7=VeryVerbose)."),
+    ECVF_Default);
+
+FString RogueDiag::FormatEvent(const TCHAR* EventName, int32 TurnId, const UObject* Actor, const FIntPoint& Cell, const TCHAR* Detail)
+{
+    const bool bHasDetail = Detail && *Detail;
+    return FString::Printf(TEXT("[Event] event=%s turn=%d actor=%s cell=(%d,%d)%s%s"),
+        EventName, TurnId, *GetNameSafe(Actor), Cell.X, Cell.Y,
+        bHasDetail ? TEXT(" ") : TEXT(""), bHasDetail ? Detail : TEXT(""));
+}
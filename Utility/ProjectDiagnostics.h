@@ -2,8 +2,13 @@
 #include "CoreMinimal.h"
 
 // 必要に応じて .Build.cs から PublicDefinitions で上書き可
+// CodeRevision: INC-2025-1229-R1 (Diagnostics compiled out of Test/Shipping; per-channel ROGUE_DIAG gates) (2025-12-22 14:00)
 #ifndef ENABLE_DIAGNOSTICS
-#define ENABLE_DIAGNOSTICS 1  // 開発中は有効化
+  #if UE_BUILD_SHIPPING || UE_BUILD_TEST
+    #define ENABLE_DIAGNOSTICS 0
+  #else
+    #define ENABLE_DIAGNOSTICS 1  // 開発中は有効化
+  #endif
 #endif
 
 // ============================================================================
@@ -18,7 +23,7 @@ DECLARE_LOG_CATEGORY_EXTERN(LogTurnPhase, Log, All);
 // ラッパーマクロ：Shipping では沈黙、開発時もフラグで制御
 extern int32 GRogueDebugVerboseLogging;
 
-#if !UE_BUILD_SHIPPING
+#if ENABLE_DIAGNOSTICS
   #define DIAG_LOG(Verbosity, Format, ...) \
     do { \
         if (ENABLE_DIAGNOSTICS) { \
@@ -33,3 +38,82 @@ extern int32 GRogueDebugVerboseLogging;
   #define DIAG_LOG(Verbosity, Format, ...)
 #endif
 
+// ============================================================================
+// Hot-path diagnostics channels
+//
+// ROGUE_DIAG(Channel, LogCategory, Verbosity, Format, ...) logs only when the line passes
+//   1. the channel's compile-time ceiling ROGUE_DIAG_LEVEL_<Channel> (an ELogVerbosity value;
+//      0 removes every line of the channel - the default in Test/Shipping),
+//   2. the channel's runtime ceiling (ts.Diag.Turn / AI / Grid / Occupancy),
+//   3. the log category's own verbosity.
+// Format arguments are evaluated only after all three checks pass.
+//
+// ROGUE_DIAG_EVENT logs a turn event as "[Event] event=<Name> turn=<Id> actor=<Name> cell=(X,Y) <Detail>"
+// so captures can be filtered by turn / actor / cell without parsing free text.
+// ROGUE_DIAG_ACTIVE guards diagnostics-only work (extra queries, string building loops).
+// ============================================================================
+#ifndef ROGUE_DIAG_DEFAULT_LEVEL
+  #if ENABLE_DIAGNOSTICS
+    #define ROGUE_DIAG_DEFAULT_LEVEL 7  // ELogVerbosity::VeryVerbose
+  #else
+    #define ROGUE_DIAG_DEFAULT_LEVEL 0  // ELogVerbosity::NoLogging
+  #endif
+#endif
+
+#ifndef ROGUE_DIAG_LEVEL_Turn
+#define ROGUE_DIAG_LEVEL_Turn ROGUE_DIAG_DEFAULT_LEVEL
+#endif
+#ifndef ROGUE_DIAG_LEVEL_AI
+#define ROGUE_DIAG_LEVEL_AI ROGUE_DIAG_DEFAULT_LEVEL
+#endif
+#ifndef ROGUE_DIAG_LEVEL_Grid
+#define ROGUE_DIAG_LEVEL_Grid ROGUE_DIAG_DEFAULT_LEVEL
+#endif
+#ifndef ROGUE_DIAG_LEVEL_Occupancy
+#define ROGUE_DIAG_LEVEL_Occupancy ROGUE_DIAG_DEFAULT_LEVEL
+#endif
+
+class UObject;
+
+enum class ERogueDiagChannel : uint8
+{
+    Turn,
+    AI,
+    Grid,
+    Occupancy,
+
+    Count
+};
+
+namespace RogueDiag
+{
+    // Runtime ceilings per channel, bound to ts.Diag.<Channel>
+    extern LYRAGAME_API int32 GChannelLevels[static_cast<int32>(ERogueDiagChannel::Count)];
+
+    FORCEINLINE bool IsEnabled(ERogueDiagChannel Channel, ELogVerbosity::Type Verbosity)
+    {
+        return static_cast<int32>(Verbosity) <= GChannelLevels[static_cast<int32>(Channel)];
+    }
+
+    LYRAGAME_API FString FormatEvent(const TCHAR* EventName, int32 TurnId, const UObject* Actor, const FIntPoint& Cell, const TCHAR* Detail = TEXT(""));
+}
+
+#define ROGUE_DIAG_COMPILED(Channel, Verbosity) \
+    (static_cast<int32>(ELogVerbosity::Verbosity) <= ROGUE_DIAG_LEVEL_##Channel)
+
+#define ROGUE_DIAG_ACTIVE(Channel, Category, Verbosity) \
+    (ROGUE_DIAG_COMPILED(Channel, Verbosity) \
+        && RogueDiag::IsEnabled(ERogueDiagChannel::Channel, ELogVerbosity::Verbosity) \
+        && UE_LOG_ACTIVE(Category, Verbosity))
+
+#define ROGUE_DIAG(Channel, Category, Verbosity, Format, ...) \
+    do { \
+        if constexpr (ROGUE_DIAG_COMPILED(Channel, Verbosity)) { \
+            if (RogueDiag::IsEnabled(ERogueDiagChannel::Channel, ELogVerbosity::Verbosity)) { \
+                UE_LOG(Category, Verbosity, Format, ##__VA_ARGS__); \
+            } \
+        } \
+    } while (0)
+
+#define ROGUE_DIAG_EVENT(Channel, Category, Verbosity, EventName, TurnId, Actor, Cell, ...) \
+    ROGUE_DIAG(Channel, Category, Verbosity, TEXT("%s"), *RogueDiag::FormatEvent(EventName, TurnId, Actor, Cell, ##__VA_ARGS__))
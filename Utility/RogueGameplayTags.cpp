@@ -18,6 +18,18 @@ namespace RogueGameplayTags
     UE_DEFINE_GAMEPLAY_TAG(Phase_Turn_PostAdvance, "Phase.Turn.PostAdvance");
     UE_DEFINE_GAMEPLAY_TAG(Phase_Ally_IntentBuild, "Phase.Ally.IntentBuild");
     UE_DEFINE_GAMEPLAY_TAG(Phase_Ally_ActionExecute, "Phase.Ally.ActionExecute");
+    // CodeRevision: INC-2025-1230-R1 (Turn pipeline CPU profiling: trace scopes, STAT counters, rolling percentiles, Chrome trace export) (2025-12-23 10:00)
+    UE_DEFINE_GAMEPLAY_TAG(Phase_Profile_Observe, "Phase.Profile.Observe");
+    UE_DEFINE_GAMEPLAY_TAG(Phase_Profile_Think, "Phase.Profile.Think");
+    UE_DEFINE_GAMEPLAY_TAG(Phase_Profile_Resolve, "Phase.Profile.Resolve");
+    UE_DEFINE_GAMEPLAY_TAG(Phase_Profile_Execute, "Phase.Profile.Execute");
+    UE_DEFINE_GAMEPLAY_TAG(Phase_Profile_Cleanup, "Phase.Profile.Cleanup");
+    UE_DEFINE_GAMEPLAY_TAG(Phase_Profile_ResolveConflicts, "Phase.Profile.ResolveConflicts");
+    UE_DEFINE_GAMEPLAY_TAG(Phase_Profile_DistanceField, "Phase.Profile.DistanceField");
+    UE_DEFINE_GAMEPLAY_TAG(Phase_Profile_FindPath, "Phase.Profile.FindPath");
+    UE_DEFINE_GAMEPLAY_TAG(Phase_Profile_BarrierWait, "Phase.Profile.BarrierWait");
+    // CodeRevision: INC-2025-1230-R2 (One phase scope for profiler and replay; speculative planning timed separately) (2025-12-27 11:00)
+    UE_DEFINE_GAMEPLAY_TAG(Phase_Profile_Speculate, "Phase.Profile.Speculate");
 
     // Shared gates & states --------------------------------------------------
     UE_DEFINE_GAMEPLAY_TAG(Gate_Input_Open, "Gate.Input.Open");
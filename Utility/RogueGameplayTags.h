@@ -22,6 +22,18 @@ namespace RogueGameplayTags
     LYRAGAME_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Phase_Turn_PostAdvance);
     LYRAGAME_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Phase_Ally_IntentBuild);
     LYRAGAME_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Phase_Ally_ActionExecute);
+    // CodeRevision: INC-2025-1230-R1 (Turn pipeline CPU profiling: trace scopes, STAT counters, rolling percentiles, Chrome trace export) (2025-12-23 10:00)
+    LYRAGAME_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Phase_Profile_Observe);
+    LYRAGAME_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Phase_Profile_Think);
+    LYRAGAME_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Phase_Profile_Resolve);
+    LYRAGAME_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Phase_Profile_Execute);
+    LYRAGAME_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Phase_Profile_Cleanup);
+    LYRAGAME_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Phase_Profile_ResolveConflicts);
+    LYRAGAME_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Phase_Profile_DistanceField);
+    LYRAGAME_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Phase_Profile_FindPath);
+    LYRAGAME_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Phase_Profile_BarrierWait);
+    // CodeRevision: INC-2025-1230-R2 (One phase scope for profiler and replay; speculative planning timed separately) (2025-12-27 11:00)
+    LYRAGAME_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Phase_Profile_Speculate);
 
     // Shared gates & states --------------------------------------------------
     LYRAGAME_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Gate_Input_Open);